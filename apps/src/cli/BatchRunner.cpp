@@ -0,0 +1,452 @@
+#include "BatchRunner.h"
+
+#include "core/GridOfCells.h"
+#include "core/PhysicsSettings.h"
+#include "core/ReflectSerializer.h"
+#include "core/ScenarioConfig.h"
+#include "core/Timers.h"
+#include "core/World.h"
+#include "core/WorldData.h"
+#include "core/WorldStateHash.h"
+#include "core/organisms/OrganismManager.h"
+#include "core/organisms/evolution/GenomeRepository.h"
+#include "core/scenarios/ClockScenario.h"
+#include "core/scenarios/ScenarioRegistry.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <thread>
+#include <unordered_map>
+
+namespace DirtSim {
+namespace Client {
+
+namespace {
+
+// Same fixed step as the server's SimRunning loop.
+constexpr double kTimestepSeconds = 0.016;
+
+// Clock runs show this instead of the wall clock time.
+constexpr const char* kClockTimeOverride = "1 2 : 3 4";
+
+double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+std::string toHex(uint64_t value)
+{
+    return fmt::format("{:016x}", value);
+}
+
+Result<std::pair<int, int>, std::string> parseWorldSize(const nlohmann::json& json)
+{
+    using ResultType = Result<std::pair<int, int>, std::string>;
+    if (json.is_number_integer()) {
+        const int size = json.get<int>();
+        return ResultType::okay({ size, size });
+    }
+    if (json.is_object() && json.contains("width") && json.contains("height")) {
+        return ResultType::okay({ json.at("width").get<int>(), json.at("height").get<int>() });
+    }
+    return ResultType::error("worldSizes entries must be an integer or {\"width\", \"height\"}");
+}
+
+std::string runKey(
+    const std::string& scenario,
+    int width,
+    int height,
+    uint32_t seed,
+    const nlohmann::json& physics)
+{
+    return fmt::format(
+        "{} {}x{} seed {} physics {}", scenario, width, height, seed, physics.dump());
+}
+
+} // namespace
+
+void to_json(nlohmann::json& j, const BatchRunResult& result)
+{
+    j = ReflectSerializer::to_json(result);
+    if (result.error.empty()) {
+        j.erase("error");
+    }
+}
+
+Result<BatchMatrix, std::string> BatchMatrix::fromJson(const nlohmann::json& json)
+{
+    using ResultType = Result<BatchMatrix, std::string>;
+    if (!json.is_object()) {
+        return ResultType::error("Batch matrix must be a JSON object");
+    }
+
+    BatchMatrix matrix;
+    try {
+        if (!json.contains("scenarios") || !json.at("scenarios").is_array()
+            || json.at("scenarios").empty()) {
+            return ResultType::error("Batch matrix requires a non-empty 'scenarios' array");
+        }
+        for (const auto& entry : json.at("scenarios")) {
+            const std::string name = entry.get<std::string>();
+            const auto id = Scenario::fromString(name);
+            if (!id.has_value()) {
+                return ResultType::error("Unknown scenario: " + name);
+            }
+            matrix.scenarios.push_back(id.value());
+        }
+
+        if (json.contains("worldSizes")) {
+            for (const auto& entry : json.at("worldSizes")) {
+                auto size = parseWorldSize(entry);
+                if (size.isError()) {
+                    return ResultType::error(size.errorValue());
+                }
+                if (size.value().first < 0 || size.value().second < 0) {
+                    return ResultType::error("World sizes must not be negative");
+                }
+                matrix.worldSizes.push_back(size.value());
+            }
+        }
+        if (matrix.worldSizes.empty()) {
+            matrix.worldSizes.push_back({ 0, 0 });
+        }
+
+        const nlohmann::json defaults = PhysicsSettings{};
+        if (json.contains("physics")) {
+            for (const auto& entry : json.at("physics")) {
+                if (!entry.is_object()) {
+                    return ResultType::error("physics entries must be objects");
+                }
+                for (const auto& [key, value] : entry.items()) {
+                    if (!defaults.contains(key)) {
+                        return ResultType::error("Unknown PhysicsSettings field: " + key);
+                    }
+                }
+                nlohmann::json merged = defaults;
+                merged.merge_patch(entry);
+                (void)merged.get<PhysicsSettings>();
+                matrix.physics.push_back(entry);
+            }
+        }
+        if (matrix.physics.empty()) {
+            matrix.physics.push_back(nlohmann::json::object());
+        }
+
+        if (json.contains("seeds")) {
+            for (const auto& entry : json.at("seeds")) {
+                matrix.seeds.push_back(entry.get<uint32_t>());
+            }
+        }
+        if (matrix.seeds.empty()) {
+            matrix.seeds.push_back(1);
+        }
+
+        matrix.steps = json.value("steps", matrix.steps);
+        matrix.hashQuantum = json.value("hashQuantum", matrix.hashQuantum);
+        matrix.jobs = json.value("jobs", matrix.jobs);
+    }
+    catch (const std::exception& e) {
+        return ResultType::error(std::string("Invalid batch matrix: ") + e.what());
+    }
+
+    if (matrix.steps <= 0) {
+        return ResultType::error("'steps' must be positive");
+    }
+    return ResultType::okay(std::move(matrix));
+}
+
+std::vector<BatchRunSpec> BatchMatrix::expand() const
+{
+    std::vector<BatchRunSpec> specs;
+    specs.reserve(scenarios.size() * worldSizes.size() * physics.size() * seeds.size());
+    for (const auto scenario : scenarios) {
+        for (const auto& [width, height] : worldSizes) {
+            for (const auto& overrides : physics) {
+                for (const uint32_t seed : seeds) {
+                    specs.push_back(
+                        BatchRunSpec{
+                            .scenario = scenario,
+                            .width = width,
+                            .height = height,
+                            .physics = overrides,
+                            .seed = seed,
+                            .steps = steps,
+                            .hashQuantum = hashQuantum,
+                        });
+                }
+            }
+        }
+    }
+    return specs;
+}
+
+BatchResults BatchRunner::run(const BatchMatrix& matrix, bool recordTraces)
+{
+    const std::vector<BatchRunSpec> specs = matrix.expand();
+
+    BatchResults results;
+    results.run_count = static_cast<int>(specs.size());
+    results.runs.resize(specs.size());
+    traces_.clear();
+    traces_.resize(recordTraces ? specs.size() : 0);
+
+    const int hardwareJobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int jobs = matrix.jobs > 0 ? matrix.jobs : hardwareJobs;
+    jobs = std::min(jobs, std::max(1, results.run_count));
+    results.jobs = jobs;
+
+    // Parallelism comes from running worlds side by side; per-world OpenMP on top of that
+    // would only oversubscribe the cores.
+    if (jobs > 1) {
+        GridOfCells::USE_OPENMP = false;
+    }
+    results.openmp = GridOfCells::USE_OPENMP;
+
+    spdlog::info("Batch: {} runs on {} workers", specs.size(), jobs);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> next{ 0 };
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<size_t>(jobs));
+    for (int i = 0; i < jobs; ++i) {
+        workers.emplace_back([&]() {
+            for (size_t index = next.fetch_add(1); index < specs.size();
+                 index = next.fetch_add(1)) {
+                results.runs[index] =
+                    runOne(specs[index], recordTraces ? &traces_[index] : nullptr);
+                spdlog::info(
+                    "Batch: {} {}x{} seed {} done ({:.1f} steps/s)",
+                    results.runs[index].scenario,
+                    results.runs[index].width,
+                    results.runs[index].height,
+                    results.runs[index].seed,
+                    results.runs[index].steps_per_sec);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    results.duration_sec = elapsedMs(start) / 1000.0;
+
+    long long totalSteps = 0;
+    for (const auto& run : results.runs) {
+        if (!run.error.empty()) {
+            results.failed_count++;
+            continue;
+        }
+        totalSteps += run.steps;
+    }
+    if (results.duration_sec > 0.0) {
+        results.total_steps_per_sec = static_cast<double>(totalSteps) / results.duration_sec;
+    }
+
+    return results;
+}
+
+BatchRunResult BatchRunner::runOne(const BatchRunSpec& spec, WorldHashTrace* trace)
+{
+    BatchRunResult result;
+    result.scenario = Scenario::toString(spec.scenario);
+    result.seed = spec.seed;
+    result.physics = spec.physics;
+
+    try {
+        // Scenario factories hold a repository reference, so each run owns its own.
+        GenomeRepository genomeRepository;
+        ScenarioRegistry registry = ScenarioRegistry::createDefault(genomeRepository);
+        const ScenarioMetadata* metadata = registry.getMetadata(spec.scenario);
+        if (!metadata || metadata->kind != ScenarioKind::GridWorld) {
+            result.error = "Not a grid world scenario: " + result.scenario;
+            return result;
+        }
+
+        auto scenario = registry.createScenario(spec.scenario);
+        if (!scenario) {
+            result.error = "Scenario factory returned null for: " + result.scenario;
+            return result;
+        }
+        scenario->setRandomSeed(spec.seed);
+        if (auto* clock = dynamic_cast<ClockScenario*>(scenario.get())) {
+            clock->setTimeOverride(kClockTimeOverride);
+        }
+
+        const auto setupStart = std::chrono::steady_clock::now();
+        const Vector2i requestedSize{
+            spec.width > 0 ? spec.width : 45,
+            spec.height > 0 ? spec.height : 30,
+        };
+        const ScenarioConfig config = scenario->resolveInitialConfig(
+            makeDefaultConfig(spec.scenario),
+            Vector2s{ static_cast<int16_t>(requestedSize.x),
+                      static_cast<int16_t>(requestedSize.y) });
+        const Vector2i worldSize = scenario->resolveInitialWorldSize(config, requestedSize);
+        if (worldSize.x <= 0 || worldSize.y <= 0) {
+            result.error = "Scenario returned invalid world size: " + worldSize.toString();
+            return result;
+        }
+        result.width = worldSize.x;
+        result.height = worldSize.y;
+
+        World world(worldSize.x, worldSize.y);
+        world.setRandomSeed(spec.seed);
+
+        // Overrides go in before setup so it builds under them (water_sim_mode decides where
+        // setup's water is stored), and again after because some scenarios set physics there.
+        const auto applyPhysicsOverrides = [&spec, &world]() {
+            if (spec.physics.empty()) {
+                return;
+            }
+            nlohmann::json settings = world.getPhysicsSettings();
+            settings.merge_patch(spec.physics);
+            world.getPhysicsSettings() = settings.get<PhysicsSettings>();
+        };
+        applyPhysicsOverrides();
+        scenario->setConfig(config, world);
+        scenario->setup(world);
+        world.setScenario(scenario.get());
+        applyPhysicsOverrides();
+        result.setup_ms = elapsedMs(setupStart);
+
+        world.setStateHashQuantum(spec.hashQuantum);
+        if (trace) {
+            // Incremental hashing keeps the per-step trace cheap; it shows up in timer_stats.
+            world.enableStateHashing(true);
+            world.getStateHash();
+            trace->record(world.getData().timestep, world.getStateHasher());
+        }
+
+        const auto runStart = std::chrono::steady_clock::now();
+        for (int step = 0; step < spec.steps; ++step) {
+            world.advanceTime(kTimestepSeconds);
+            if (trace) {
+                trace->record(world.getData().timestep, world.getStateHasher());
+            }
+        }
+        result.duration_ms = elapsedMs(runStart);
+        result.steps = spec.steps;
+        if (result.duration_ms > 0.0) {
+            result.steps_per_sec = spec.steps * 1000.0 / result.duration_ms;
+        }
+
+        result.state_hash = toHex(world.getStateHash());
+        result.timer_stats = world.getTimers().exportAllTimersAsJson();
+        world.setScenario(nullptr);
+    }
+    catch (const std::exception& e) {
+        result.error = e.what();
+    }
+
+    return result;
+}
+
+std::vector<std::string> BatchRunner::compareStateHashes(
+    const BatchResults& results, const nlohmann::json& baseline)
+{
+    std::unordered_map<std::string, std::string> baselineHashes;
+    if (baseline.contains("runs") && baseline.at("runs").is_array()) {
+        for (const auto& run : baseline.at("runs")) {
+            if (!run.contains("state_hash")) {
+                continue;
+            }
+            const std::string key = runKey(
+                run.value("scenario", ""),
+                run.value("width", 0),
+                run.value("height", 0),
+                run.value("seed", 0u),
+                run.value("physics", nlohmann::json::object()));
+            baselineHashes[key] = run.at("state_hash").get<std::string>();
+        }
+    }
+
+    std::vector<std::string> mismatches;
+    for (const auto& run : results.runs) {
+        if (!run.error.empty()) {
+            continue;
+        }
+        const std::string key = runKey(run.scenario, run.width, run.height, run.seed, run.physics);
+        const auto it = baselineHashes.find(key);
+        if (it == baselineHashes.end()) {
+            mismatches.push_back(key + ": missing from baseline");
+        }
+        else if (it->second != run.state_hash) {
+            mismatches.push_back(
+                key + ": state hash " + run.state_hash + " != baseline " + it->second);
+        }
+    }
+    return mismatches;
+}
+
+nlohmann::json BatchRunner::tracesToJson(const BatchResults& results) const
+{
+    nlohmann::json runs = nlohmann::json::array();
+    for (size_t i = 0; i < results.runs.size() && i < traces_.size(); ++i) {
+        const BatchRunResult& run = results.runs[i];
+        if (!run.error.empty()) {
+            continue;
+        }
+        runs.push_back(
+            { { "key", runKey(run.scenario, run.width, run.height, run.seed, run.physics) },
+              { "trace", traces_[i].toJson() } });
+    }
+    return { { "runs", std::move(runs) } };
+}
+
+std::vector<std::string> BatchRunner::compareTraces(
+    const BatchResults& results, const nlohmann::json& golden) const
+{
+    std::unordered_map<std::string, const nlohmann::json*> goldenTraces;
+    if (golden.contains("runs") && golden.at("runs").is_array()) {
+        for (const auto& run : golden.at("runs")) {
+            goldenTraces[run.at("key").get<std::string>()] = &run.at("trace");
+        }
+    }
+
+    std::vector<std::string> divergences;
+    for (size_t i = 0; i < results.runs.size() && i < traces_.size(); ++i) {
+        const BatchRunResult& run = results.runs[i];
+        if (!run.error.empty()) {
+            continue;
+        }
+        const std::string key = runKey(run.scenario, run.width, run.height, run.seed, run.physics);
+        const auto it = goldenTraces.find(key);
+        if (it == goldenTraces.end()) {
+            divergences.push_back(key + ": missing from golden traces");
+            continue;
+        }
+
+        const auto divergence =
+            WorldHashTrace::findFirstDivergence(WorldHashTrace::fromJson(*it->second), traces_[i]);
+        if (!divergence.has_value()) {
+            continue;
+        }
+        if (divergence->block_x < 0) {
+            divergences.push_back(fmt::format(
+                "{}: trace length or grid size differs at timestep {}",
+                key,
+                divergence->timestep));
+            continue;
+        }
+        divergences.push_back(fmt::format(
+            "{}: first divergence at timestep {}, block ({}, {}) = cells ({}, {})..({}, {}), "
+            "expected {} actual {}",
+            key,
+            divergence->timestep,
+            divergence->block_x,
+            divergence->block_y,
+            divergence->block_x * WorldStateHash::BLOCK_SIZE,
+            divergence->block_y * WorldStateHash::BLOCK_SIZE,
+            divergence->block_x * WorldStateHash::BLOCK_SIZE + WorldStateHash::BLOCK_SIZE - 1,
+            divergence->block_y * WorldStateHash::BLOCK_SIZE + WorldStateHash::BLOCK_SIZE - 1,
+            toHex(divergence->expected),
+            toHex(divergence->actual)));
+    }
+    return divergences;
+}
+
+} // namespace Client
+} // namespace DirtSim
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "core/Result.h"
+#include "core/ScenarioId.h"
+#include "core/WorldHashTrace.h"
+
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+namespace DirtSim {
+namespace Client {
+
+/**
+ * One expanded entry of a batch matrix.
+ */
+struct BatchRunSpec {
+    Scenario::EnumType scenario = Scenario::EnumType::Benchmark;
+    int width = 0;  // 0 = scenario default.
+    int height = 0; // 0 = scenario default.
+    nlohmann::json physics = nlohmann::json::object(); // PhysicsSettings override (partial).
+    uint32_t seed = 0;
+    int steps = 0;
+    float hashQuantum = 1e-4f;
+};
+
+/**
+ * Parsed batch matrix. Runs are the cartesian product of scenarios, world sizes,
+ * physics overrides, and seeds.
+ */
+struct BatchMatrix {
+    std::vector<Scenario::EnumType> scenarios;
+    std::vector<std::pair<int, int>> worldSizes;
+    std::vector<nlohmann::json> physics;
+    std::vector<uint32_t> seeds;
+    int steps = 600;
+    int jobs = 0;              // 0 = hardware concurrency.
+    float hashQuantum = 1e-4f; // WorldStateHash float quantization.
+
+    static Result<BatchMatrix, std::string> fromJson(const nlohmann::json& json);
+    std::vector<BatchRunSpec> expand() const;
+};
+
+/**
+ * @brief Results from one in-process run (flattened for ReflectSerializer).
+ */
+struct BatchRunResult {
+    std::string scenario;
+    int width = 0;
+    int height = 0;
+    uint32_t seed = 0;
+    nlohmann::json physics;
+    int steps = 0;
+    double setup_ms = 0.0;
+    double duration_ms = 0.0;
+    double steps_per_sec = 0.0;
+    std::string state_hash; // Final WorldStateHash root, hex.
+    std::string error;
+
+    nlohmann::json timer_stats;
+};
+
+void to_json(nlohmann::json& j, const BatchRunResult& result);
+
+struct BatchResults {
+    int jobs = 0;
+    bool openmp = false;
+    int run_count = 0;
+    int failed_count = 0;
+    double duration_sec = 0.0;
+    double total_steps_per_sec = 0.0;
+
+    std::vector<BatchRunResult> runs;
+};
+
+/**
+ * @brief Runs a scenario sweep in-process, with no server, rendering, or networking.
+ *
+ * Each run gets its own World and scenario on a worker thread; workers pull runs
+ * from a shared index so long runs don't hold up the rest. Runs fix the world and
+ * scenario seeds, the timestep, and the clock time, so the final state hash is
+ * repeatable for a given build, except for scenarios that also time events off the
+ * wall clock (Clock's doors, drains, and storms).
+ */
+class BatchRunner {
+public:
+    // With recordTraces, every run also keeps a per-step WorldHashTrace.
+    BatchResults run(const BatchMatrix& matrix, bool recordTraces = false);
+
+    static BatchRunResult runOne(const BatchRunSpec& spec, WorldHashTrace* trace = nullptr);
+
+    // Matches runs by scenario, size, seed, and physics override against a previous
+    // batch output. Returns one line per run whose state hash differs or is missing.
+    static std::vector<std::string> compareStateHashes(
+        const BatchResults& results, const nlohmann::json& baseline);
+
+    // Golden traces from the last run(..., true), keyed the same way.
+    nlohmann::json tracesToJson(const BatchResults& results) const;
+
+    // Returns one line per run naming the first diverging timestep and block.
+    std::vector<std::string> compareTraces(
+        const BatchResults& results, const nlohmann::json& golden) const;
+
+private:
+    std::vector<WorldHashTrace> traces_;
+};
+
+} // namespace Client
+} // namespace DirtSim
@@ -238,13 +238,18 @@ BenchmarkResults BenchmarkRunner::runWithServerArgs(
         results.server_serialization_calls = perf.serialization_calls;
         results.server_cache_update_avg_ms = perf.cache_update_avg_ms;
         results.server_network_send_avg_ms = perf.network_send_avg_ms;
+        results.server_broadcast_avg_ms = perf.broadcast_avg_ms;
+        results.server_broadcast_overlap_ms = perf.broadcast_overlap_ms;
+        results.server_broadcast_dropped = static_cast<int>(perf.broadcast_dropped);
 
         spdlog::info(
             "BenchmarkRunner: Server stats - fps: {:.1f}, physics: {:.1f}ms avg, "
-            "serialization: {:.1f}ms avg",
+            "serialization: {:.1f}ms avg, broadcast: {:.1f}ms avg ({:.0f}ms overlapped)",
             results.server_fps,
             results.server_physics_avg_ms,
-            results.server_serialization_avg_ms);
+            results.server_serialization_avg_ms,
+            results.server_broadcast_avg_ms,
+            results.server_broadcast_overlap_ms);
     }
 
     // Query detailed timer statistics.
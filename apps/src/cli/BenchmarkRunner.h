@@ -31,6 +31,9 @@ struct BenchmarkResults {
     int server_serialization_calls = 0;
     double server_cache_update_avg_ms = 0.0;
     double server_network_send_avg_ms = 0.0;
+    double server_broadcast_avg_ms = 0.0;
+    double server_broadcast_overlap_ms = 0.0;
+    int server_broadcast_dropped = 0;
 
     nlohmann::json timer_stats;
     nlohmann::json final_world_state; // Optional: captured via state_get if requested.
@@ -64,6 +64,7 @@ CommandDispatcher::CommandDispatcher()
     registerCommand<Api::CellSet::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::ClockEventTrigger::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::DiagramGet::Cwc>(serverHandlers_, serverExampleHandlers_);
+    registerCommand<Api::EvaluationRun::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::EventSubscribe::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::EvolutionStart::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::EvolutionStop::Cwc>(serverHandlers_, serverExampleHandlers_);
@@ -93,6 +94,7 @@ CommandDispatcher::CommandDispatcher()
     registerCommand<Api::SimStop::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::SpawnDirtBall::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::StateGet::Cwc>(serverHandlers_, serverExampleHandlers_);
+    registerCommand<Api::StateRegionGet::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::StatusGet::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::TimerStatsGet::Cwc>(serverHandlers_, serverExampleHandlers_);
     registerCommand<Api::UserSettingsGet::Cwc>(serverHandlers_, serverExampleHandlers_);
@@ -1981,7 +1981,7 @@ Result<std::monostate, std::string> waitForClockRenderTimezone(
     std::optional<Config::ClockTimezone> lastTimezone;
     std::string parseError;
 
-    serverClient.onBinary([&](const std::vector<std::byte>& payload) {
+    serverClient.onBinary([&](std::span<const std::byte> payload) {
         try {
             RenderMessageFull fullMessage;
             zpp::bits::in in(payload);
@@ -2023,7 +2023,7 @@ Result<std::monostate, std::string> waitForClockRenderTimezone(
         }
     }
 
-    serverClient.onBinary([](const std::vector<std::byte>& /*payload*/) {});
+    serverClient.onBinary([](std::span<const std::byte> /*payload*/) {});
 
     if (matched) {
         return Result<std::monostate, std::string>::okay(std::monostate{});
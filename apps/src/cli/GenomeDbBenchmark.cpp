@@ -2,12 +2,15 @@
 
 #include "core/UUID.h"
 #include "core/organisms/brains/Genome.h"
+#include "core/organisms/evolution/GenomeRepository.h"
 #include "server/api/GenomeDelete.h"
 #include "server/api/GenomeGet.h"
 #include "server/api/GenomeList.h"
 #include "server/api/GenomeSet.h"
 
+#include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <optional>
 #include <spdlog/spdlog.h>
 #include <vector>
@@ -30,6 +33,20 @@ std::vector<WeightType> createSentinelWeights(float seedValue)
     return weights;
 }
 
+double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+void removeDatabaseFiles(const std::filesystem::path& dbPath)
+{
+    std::error_code ec;
+    std::filesystem::remove(dbPath, ec);
+    std::filesystem::remove(dbPath.string() + "-shm", ec);
+    std::filesystem::remove(dbPath.string() + "-wal", ec);
+}
+
 } // namespace
 
 GenomeDbBenchmarkResults GenomeDbBenchmark::run(int count)
@@ -63,6 +80,9 @@ GenomeDbBenchmarkResults GenomeDbBenchmark::run(int count)
     runPerformanceTests(count, results);
 
     client_.disconnect();
+
+    spdlog::info("Running in-process repository tests with {} genomes...", count);
+    runRepositoryTests(count, results);
     return results;
 }
 
@@ -306,6 +326,27 @@ void GenomeDbBenchmark::runPerformanceTests(int count, GenomeDbBenchmarkResults&
         }
     }
 
+    // First page only, as a browser needs for its first paint.
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        Api::GenomeList::Command cmd;
+        cmd.limit = 64;
+        const auto result =
+            client_.sendCommandAndGetResponse<Api::GenomeList::Okay>(cmd, kTimeoutMs);
+
+        const auto end = std::chrono::steady_clock::now();
+        results.listFirstPageMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        if (!result.isError() && !result.value().isError()) {
+            spdlog::info(
+                "List first page: {:.1f}ms ({} of {} genomes)",
+                results.listFirstPageMs,
+                result.value().value().genomes.size(),
+                result.value().value().totalCount);
+        }
+    }
+
     // Update all genomes.
     {
         const auto start = std::chrono::steady_clock::now();
@@ -371,5 +412,91 @@ void GenomeDbBenchmark::runPerformanceTests(int count, GenomeDbBenchmarkResults&
         "Delete: {:.1f}ms ({:.1f} ops/sec)", results.deleteTotalMs, results.deleteOpsPerSec);
 }
 
+void GenomeDbBenchmark::runRepositoryTests(int count, GenomeDbBenchmarkResults& results)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    const auto dbPath = std::filesystem::temp_directory_path()
+        / ("genome_db_benchmark_" + UUID::generate().toString() + ".db");
+
+    std::vector<GenomeId> ids;
+    ids.reserve(count);
+    {
+        std::vector<Genome> genomes(count);
+        std::vector<GenomeRepository::StoreByHashEntry> entries;
+        entries.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            genomes[i].weights = createSentinelWeights(5.0f + static_cast<float>(i));
+            entries.push_back(
+                GenomeRepository::StoreByHashEntry{
+                    .genome = &genomes[i],
+                    .metadata = GenomeMetadata{
+                        .name = "repo-genome-" + std::to_string(i),
+                        .fitness = static_cast<double>(i),
+                        .robustFitness = static_cast<double>(i),
+                        .robustEvalCount = 1,
+                        .robustFitnessSamples = { static_cast<double>(i) },
+                        .generation = i,
+                        .createdTimestamp = 0,
+                        .scenarioId = Scenario::EnumType::TreeGermination,
+                        .notes = "",
+                        .organismType = std::nullopt,
+                        .brainKind = std::nullopt,
+                        .brainVariant = std::nullopt,
+                        .trainingSessionId = std::nullopt,
+                        .genomePoolId = GenomePoolId::DirtSim,
+                        .nesTileBrainCompatibility = std::nullopt,
+                    },
+                });
+        }
+
+        GenomeRepository repo(dbPath);
+        for (const auto& storeResult : repo.storeOrUpdateByHashBatch(entries)) {
+            ids.push_back(storeResult.id);
+        }
+    }
+
+    size_t warmCount = 0;
+    {
+        const auto openStart = std::chrono::steady_clock::now();
+        GenomeRepository repo(dbPath);
+        results.repositoryOpenMs = elapsedMs(openStart);
+
+        const auto coldStart = std::chrono::steady_clock::now();
+        for (const auto& id : ids) {
+            if (!repo.get(id).has_value()) {
+                spdlog::warn("Repository cold get {} failed", id.toShortString());
+            }
+        }
+        results.repositoryColdGetAvgMs = elapsedMs(coldStart) / static_cast<double>(ids.size());
+
+        // Warm reads cover every genome the cold pass left resident: the cache budget keeps the
+        // most recently fetched ones, which are the tail of ids. Each is read once, as in the
+        // cold pass, so the two averages compare.
+        warmCount = std::min(ids.size(), repo.getWeightCacheStats().residentCount);
+        const auto warmStart = std::chrono::steady_clock::now();
+        for (size_t i = ids.size() - warmCount; i < ids.size(); ++i) {
+            if (!repo.get(ids[i]).has_value()) {
+                spdlog::warn("Repository warm get {} failed", ids[i].toShortString());
+            }
+        }
+        if (warmCount > 0) {
+            results.repositoryWarmGetAvgMs = elapsedMs(warmStart) / static_cast<double>(warmCount);
+        }
+    }
+
+    removeDatabaseFiles(dbPath);
+
+    spdlog::info(
+        "Repository: open {:.1f}ms, cold get {:.3f}ms, warm get {:.3f}ms ({} of {} resident)",
+        results.repositoryOpenMs,
+        results.repositoryColdGetAvgMs,
+        results.repositoryWarmGetAvgMs,
+        warmCount,
+        ids.size());
+}
+
 } // namespace Client
 } // namespace DirtSim
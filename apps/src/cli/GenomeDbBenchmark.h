@@ -21,15 +21,22 @@ struct GenomeDbBenchmarkResults {
     double deleteTotalMs = 0.0;
     double deleteOpsPerSec = 0.0;
     double listMs = 0.0;
+    double listFirstPageMs = 0.0;
     double updateTotalMs = 0.0;
     double updateOpsPerSec = 0.0;
 
+    // In-process GenomeRepository measurements against a temporary database.
+    double repositoryOpenMs = 0.0;
+    double repositoryColdGetAvgMs = 0.0;
+    double repositoryWarmGetAvgMs = 0.0;
+
     size_t genomeSizeBytes = 0;
 };
 
 /**
  * Runs genome database correctness and performance tests.
- * Connects to an already-running server at localhost:8080.
+ * Connects to an already-running server at localhost:8080, then measures
+ * GenomeRepository startup and cold/warm weight fetch latency in-process.
  */
 class GenomeDbBenchmark {
 public:
@@ -40,6 +47,7 @@ private:
 
     std::string runCorrectnessTests();
     void runPerformanceTests(int count, GenomeDbBenchmarkResults& results);
+    void runRepositoryTests(int count, GenomeDbBenchmarkResults& results);
 };
 
 } // namespace Client
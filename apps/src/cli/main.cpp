@@ -1,3 +1,4 @@
+#include "BatchRunner.h"
 #include "BenchmarkRunner.h"
 #include "CleanupRunner.h"
 #include "CommandDispatcher.h"
@@ -410,6 +411,7 @@ struct CliCommandInfo {
 };
 
 static const std::vector<CliCommandInfo> CLI_COMMANDS = {
+    { "batch", "Run a scenario sweep in-process from a JSON matrix (no server)" },
     { "benchmark", "Run performance benchmark (launches server)" },
     { "cleanup", "Clean up rogue dirtsim processes" },
     { "docs-screenshots", "Capture UI docs screenshots to a directory" },
@@ -471,6 +473,7 @@ std::string getGlobalHelp()
 {
     std::string help = "Available targets:\n";
     help += "  audio\n";
+    help += "  batch\n";
     help += "  benchmark\n";
     help += "  cleanup\n";
     help += "  docs-screenshots\n";
@@ -949,6 +952,27 @@ int main(int argc, char** argv)
         "Benchmark: Run twice to compare cached vs non-cached performance",
         { "compare-cache" });
 
+    args::ValueFlag<int> batchJobs(
+        parser,
+        "jobs",
+        "Batch: worker threads (default: matrix 'jobs' or hardware concurrency)",
+        { "jobs" });
+    args::ValueFlag<std::string> batchBaseline(
+        parser,
+        "baseline",
+        "Batch: previous batch output; exit nonzero if any state hash differs",
+        { "baseline" });
+    args::ValueFlag<std::string> batchRecordGolden(
+        parser,
+        "record-golden",
+        "Batch: write per-step world hash traces for every run to this file",
+        { "record-golden" });
+    args::ValueFlag<std::string> batchGolden(
+        parser,
+        "golden",
+        "Batch: compare per-step world hash traces against this file",
+        { "golden" });
+
     args::ValueFlag<int> genomeCount(
         parser,
         "count",
@@ -1169,6 +1193,101 @@ int main(int argc, char** argv)
         return 0;
     }
 
+    if (targetName == "batch") {
+        if (!command) {
+            std::cerr << "Error: batch requires a matrix file or inline JSON\n\n";
+            std::cerr << "Usage: cli batch matrix.json [--jobs N] [--baseline previous.json]"
+                         " [--record-golden traces.json | --golden traces.json]\n";
+            return 1;
+        }
+        if (!verbose) {
+            spdlog::set_level(spdlog::level::err);
+        }
+
+        auto readJson = [](const std::string& source) {
+            if (std::filesystem::exists(source)) {
+                std::ifstream file(source);
+                return nlohmann::json::parse(file);
+            }
+            return nlohmann::json::parse(source);
+        };
+
+        nlohmann::json matrixJson;
+        try {
+            matrixJson = readJson(args::get(command));
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error reading batch matrix: " << e.what() << std::endl;
+            return 1;
+        }
+
+        auto matrixResult = Client::BatchMatrix::fromJson(matrixJson);
+        if (matrixResult.isError()) {
+            std::cerr << "Error: " << matrixResult.errorValue() << std::endl;
+            return 1;
+        }
+        Client::BatchMatrix matrix = matrixResult.value();
+        if (batchJobs) {
+            matrix.jobs = args::get(batchJobs);
+        }
+
+        Client::BatchRunner runner;
+        const auto results = runner.run(matrix, batchRecordGolden || batchGolden);
+
+        nlohmann::json output = ReflectSerializer::to_json(results);
+        for (size_t i = 0; i < results.runs.size(); ++i) {
+            if (!results.runs[i].timer_stats.empty()) {
+                output["runs"][i]["timer_stats"] = sortTimerStats(results.runs[i].timer_stats);
+            }
+        }
+        std::cout << output.dump(2) << std::endl;
+
+        int exitCode = results.failed_count == 0 ? 0 : 1;
+        if (batchBaseline) {
+            nlohmann::json baseline;
+            try {
+                baseline = readJson(args::get(batchBaseline));
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Error reading baseline: " << e.what() << std::endl;
+                return 1;
+            }
+            const auto mismatches = Client::BatchRunner::compareStateHashes(results, baseline);
+            for (const auto& mismatch : mismatches) {
+                std::cerr << "State hash mismatch: " << mismatch << std::endl;
+            }
+            if (!mismatches.empty()) {
+                exitCode = 1;
+            }
+        }
+        if (batchRecordGolden) {
+            std::ofstream file(args::get(batchRecordGolden));
+            if (!file) {
+                std::cerr << "Error: cannot write " << args::get(batchRecordGolden) << std::endl;
+                return 1;
+            }
+            file << runner.tracesToJson(results).dump() << std::endl;
+        }
+        if (batchGolden) {
+            nlohmann::json golden;
+            try {
+                golden = readJson(args::get(batchGolden));
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Error reading golden traces: " << e.what() << std::endl;
+                return 1;
+            }
+            const auto divergences = runner.compareTraces(results, golden);
+            for (const auto& divergence : divergences) {
+                std::cerr << "Golden run divergence: " << divergence << std::endl;
+            }
+            if (!divergences.empty()) {
+                exitCode = 1;
+            }
+        }
+        return exitCode;
+    }
+
     if (targetName == "genome-db-benchmark") {
         if (!verbose) {
             spdlog::set_level(spdlog::level::info);
@@ -2428,6 +2547,10 @@ int main(int argc, char** argv)
                               << progress.lastGenerationPhenotypeUniqueOffspringMutatedCount;
                     telemetry << " novel="
                               << progress.lastGenerationPhenotypeNovelOffspringMutatedCount;
+                    telemetry << " util=" << std::fixed << std::setprecision(0)
+                              << progress.lastGenerationCoreUtilization * 100.0 << "%";
+                    telemetry << " tailIdle=" << std::fixed << std::setprecision(1)
+                              << progress.lastGenerationTailIdleSeconds << "s";
 
                     telemetry << " breedΔw=" << std::fixed << std::setprecision(0)
                               << progress.lastBreeding.weightChangesAvg;
@@ -2542,7 +2665,7 @@ int main(int argc, char** argv)
         client.setClientHello(hello);
 
         // Render payloads are routed through the binary callback.
-        client.onBinary([](const std::vector<std::byte>& payload) {
+        client.onBinary([](std::span<const std::byte> payload) {
             nlohmann::json output;
             output["_type"] = "RenderMessage";
             output["_payload_size"] = payload.size();
@@ -2916,7 +3039,7 @@ int main(int argc, char** argv)
     if (targetName != "server" && targetName != "ui" && targetName != "os-manager"
         && targetName != "audio") {
         std::cerr << "Error: unknown target '" << targetName << "'\n";
-        std::cerr << "Valid targets: server, ui, audio, benchmark, cleanup, "
+        std::cerr << "Valid targets: server, ui, audio, batch, benchmark, cleanup, "
                      "docs-screenshots, functional-test, gamepad-test, "
                      "genome-db-benchmark, network, os-manager, progress, run-all, "
                      "screenshot, test_binary, train, watch\n\n";
@@ -0,0 +1,49 @@
+#include "cli/BatchRunner.h"
+#include "core/GridOfCells.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using namespace DirtSim;
+using namespace DirtSim::Client;
+
+namespace {
+
+// Enough steps for setup randomness and brains to show up in the hash, while staying fast.
+constexpr int kSteps = 60;
+
+BatchMatrix loadGoldenMatrix()
+{
+    std::ifstream file(std::string(DIRTSIM_CLI_EXAMPLES_DIR) + "/golden-matrix.json");
+    EXPECT_TRUE(file.is_open());
+    auto matrix = BatchMatrix::fromJson(nlohmann::json::parse(file));
+    EXPECT_TRUE(matrix.isValue()) << matrix.errorValue();
+    BatchMatrix result = std::move(matrix).value();
+    result.steps = kSteps;
+    return result;
+}
+
+} // namespace
+
+// Every golden entry must hash the same on every run, alone or alongside other runs.
+TEST(BatchRunnerTest, GoldenMatrixRunsRepeatExactly)
+{
+    const bool useOpenMp = GridOfCells::USE_OPENMP;
+    BatchMatrix matrix = loadGoldenMatrix();
+    BatchRunner runner;
+
+    matrix.jobs = 1;
+    const BatchResults serial = runner.run(matrix);
+    matrix.jobs = 4;
+    const BatchResults parallel = runner.run(matrix);
+    GridOfCells::USE_OPENMP = useOpenMp;
+
+    ASSERT_EQ(serial.runs.size(), parallel.runs.size());
+    ASSERT_FALSE(serial.runs.empty());
+    for (size_t i = 0; i < serial.runs.size(); ++i) {
+        SCOPED_TRACE(serial.runs[i].scenario);
+        EXPECT_TRUE(serial.runs[i].error.empty()) << serial.runs[i].error;
+        EXPECT_EQ(serial.runs[i].state_hash, parallel.runs[i].state_hash);
+    }
+}
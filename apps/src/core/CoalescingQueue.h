@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Thread-safe, move-only event queue that collapses superseded items.
+ *
+ * Items with a coalesce key are snapshots (render frames, progress updates): pushing
+ * one removes any older unprocessed item with the same key and appends the new one,
+ * so a consumer that falls behind only sees the latest. Items without a key (commands,
+ * input) are always delivered, in push order.
+ *
+ * Multiple producers, single consumer, like SynchronizedQueue.
+ */
+template <typename T>
+class CoalescingQueue {
+public:
+    using CoalesceKeyFn = std::function<std::optional<size_t>(const T&)>;
+
+    struct Stats {
+        size_t highWaterMark = 0; // Deepest the queue has been.
+        uint64_t pushed = 0;
+        uint64_t coalesced = 0; // Items dropped because a newer one replaced them.
+    };
+
+    explicit CoalescingQueue(CoalesceKeyFn coalesceKey) : coalesceKey_(std::move(coalesceKey)) {}
+
+    /**
+     * @brief Push an item, replacing an older pending item with the same coalesce key.
+     */
+    void push(T&& item)
+    {
+        {
+            std::unique_lock lock(mutex_);
+            const std::optional<size_t> key = coalesceKey_ ? coalesceKey_(item) : std::nullopt;
+            if (key.has_value()) {
+                const auto superseded = std::find_if(
+                    queue_.begin(), queue_.end(), [&key](const Entry& entry) {
+                        return entry.key == key;
+                    });
+                if (superseded != queue_.end()) {
+                    queue_.erase(superseded);
+                    stats_.coalesced++;
+                }
+            }
+
+            queue_.push_back(Entry{ .item = std::move(item), .key = key });
+            stats_.pushed++;
+            stats_.highWaterMark = std::max(stats_.highWaterMark, queue_.size());
+        }
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Try to pop an item from the queue (non-blocking).
+     * @return The item if available, std::nullopt otherwise.
+     */
+    std::optional<T> tryPop()
+    {
+        std::unique_lock lock(mutex_);
+        if (queue_.empty()) {
+            return std::nullopt;
+        }
+
+        T item = std::move(queue_.front().item);
+        queue_.pop_front();
+        return item;
+    }
+
+    size_t size() const
+    {
+        std::unique_lock lock(mutex_);
+        return queue_.size();
+    }
+
+    bool empty() const
+    {
+        std::unique_lock lock(mutex_);
+        return queue_.empty();
+    }
+
+    /**
+     * @brief Wait until the queue has items or the timeout expires.
+     * @return true if the queue has items, false if timed out.
+     */
+    bool waitFor(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this] { return !queue_.empty(); });
+    }
+
+    void clear()
+    {
+        std::unique_lock lock(mutex_);
+        queue_.clear();
+    }
+
+    Stats stats() const
+    {
+        std::unique_lock lock(mutex_);
+        return stats_;
+    }
+
+private:
+    struct Entry {
+        T item;
+        std::optional<size_t> key;
+    };
+
+    CoalesceKeyFn coalesceKey_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Entry> queue_;
+    Stats stats_;
+};
@@ -1,8 +1,10 @@
 #include "FontSampler.h"
+#include "GlyphAtlas.h"
 
 #include <algorithm>
 #include <array>
 #include <lvgl.h>
+#include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
 #if LV_USE_FREETYPE
@@ -102,9 +104,7 @@ lv_display_t* ensureHeadlessDisplay()
 
 FontSampler::FontSampler(const lv_font_t* font, int targetWidth, int targetHeight, float threshold)
     : font_(font), targetWidth_(targetWidth), targetHeight_(targetHeight), threshold_(threshold)
-{
-    initCanvas();
-}
+{}
 
 FontSampler::FontSampler(
     const std::string& fontPath, int fontSize, int targetWidth, int targetHeight, float threshold)
@@ -112,18 +112,17 @@ FontSampler::FontSampler(
       targetWidth_(targetWidth),
       targetHeight_(targetHeight),
       threshold_(threshold),
-      ownsFont_(true)
+      fontPath_(fontPath),
+      fontSize_(fontSize)
 {
 #if LV_USE_FREETYPE
-    initFreeType();
-
-    // Probe font to detect if it's a non-scalable bitmap font.
+    // Probe font to detect if it's a non-scalable bitmap font. This only needs FreeType, so
+    // the canvas size is known up front while LVGL setup waits for the first rasterization.
     int nativeSize = probeNativeBitmapSize(fontPath);
-    int effectiveFontSize = fontSize;
 
     if (nativeSize > 0) {
         // Bitmap font detected - use native size and ensure canvas is large enough.
-        effectiveFontSize = nativeSize;
+        fontSize_ = nativeSize;
 
         // Canvas needs margin for the full glyph (some padding for positioning).
         int requiredCanvasSize = nativeSize + 11;
@@ -142,36 +141,7 @@ FontSampler::FontSampler(
             targetHeight_ = requiredCanvasSize;
         }
     }
-
-    // Create FreeType font from file. Use BITMAP mode for color emoji support.
-    ownedFont_ = lv_freetype_font_create(
-        fontPath.c_str(),
-        LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
-        static_cast<uint32_t>(effectiveFontSize),
-        LV_FREETYPE_FONT_STYLE_NORMAL);
-
-    if (ownedFont_) {
-        font_ = ownedFont_;
-        spdlog::info(
-            "FontSampler: Loaded FreeType font from {} (size {}, canvas {}x{})",
-            fontPath,
-            effectiveFontSize,
-            targetWidth_,
-            targetHeight_);
-    }
-    else {
-        spdlog::error("FontSampler: Failed to load font from {}", fontPath);
-        ownsFont_ = false;
-    }
-#else
-    spdlog::error(
-        "FontSampler: Cannot load font from file - FreeType support not enabled "
-        "(LV_USE_FREETYPE=0)");
-    (void)fontPath;
-    (void)fontSize;
 #endif
-
-    initCanvas();
 }
 
 FontSampler::~FontSampler()
@@ -194,9 +164,15 @@ FontSampler::FontSampler(FontSampler&& other) noexcept
       threshold_(other.threshold_),
       ownsFont_(other.ownsFont_),
       ownedFont_(other.ownedFont_),
+      fontPath_(std::move(other.fontPath_)),
+      fontSize_(other.fontSize_),
+      fontLoadAttempted_(other.fontLoadAttempted_),
       canvas_(other.canvas_),
       drawBuf_(other.drawBuf_),
-      cache_(std::move(other.cache_))
+      cache_(std::move(other.cache_)),
+      trimmedCache_(std::move(other.trimmedCache_)),
+      atlas_(std::move(other.atlas_)),
+      atlasFontId_(std::move(other.atlasFontId_))
 {
     other.canvas_ = nullptr;
     other.drawBuf_ = nullptr;
@@ -222,9 +198,15 @@ FontSampler& FontSampler::operator=(FontSampler&& other) noexcept
         threshold_ = other.threshold_;
         ownsFont_ = other.ownsFont_;
         ownedFont_ = other.ownedFont_;
+        fontPath_ = std::move(other.fontPath_);
+        fontSize_ = other.fontSize_;
+        fontLoadAttempted_ = other.fontLoadAttempted_;
         canvas_ = other.canvas_;
         drawBuf_ = other.drawBuf_;
         cache_ = std::move(other.cache_);
+        trimmedCache_ = std::move(other.trimmedCache_);
+        atlas_ = std::move(other.atlas_);
+        atlasFontId_ = std::move(other.atlasFontId_);
         other.canvas_ = nullptr;
         other.drawBuf_ = nullptr;
         other.ownsFont_ = false;
@@ -233,6 +215,19 @@ FontSampler& FontSampler::operator=(FontSampler&& other) noexcept
     return *this;
 }
 
+bool FontSampler::ensureCanvas()
+{
+    if (canvas_ && drawBuf_) {
+        return true;
+    }
+
+    if (!fontPath_.empty() && !fontLoadAttempted_) {
+        loadFreeTypeFont();
+    }
+    initCanvas();
+    return canvas_ && drawBuf_;
+}
+
 void FontSampler::initCanvas()
 {
     // Ensure we have a display (creates headless one if needed).
@@ -275,6 +270,40 @@ void FontSampler::destroyCanvas()
     }
 }
 
+void FontSampler::loadFreeTypeFont()
+{
+    fontLoadAttempted_ = true;
+
+#if LV_USE_FREETYPE
+    initFreeType();
+
+    // Create FreeType font from file. Use BITMAP mode for color emoji support.
+    ownedFont_ = lv_freetype_font_create(
+        fontPath_.c_str(),
+        LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
+        static_cast<uint32_t>(fontSize_),
+        LV_FREETYPE_FONT_STYLE_NORMAL);
+
+    if (ownedFont_) {
+        font_ = ownedFont_;
+        ownsFont_ = true;
+        spdlog::info(
+            "FontSampler: Loaded FreeType font from {} (size {}, canvas {}x{})",
+            fontPath_,
+            fontSize_,
+            targetWidth_,
+            targetHeight_);
+    }
+    else {
+        spdlog::error("FontSampler: Failed to load font from {}", fontPath_);
+    }
+#else
+    spdlog::error(
+        "FontSampler: Cannot load font from file - FreeType support not enabled "
+        "(LV_USE_FREETYPE=0)");
+#endif
+}
+
 void FontSampler::initFreeType()
 {
     // Note: lv_freetype_init() is called automatically by lv_init() in LVGL.
@@ -293,7 +322,7 @@ std::vector<std::vector<bool>> FontSampler::sampleCharacter(char c)
 
 std::vector<std::vector<bool>> FontSampler::sampleCharacter(char c, float threshold)
 {
-    if (!canvas_ || !drawBuf_) {
+    if (!ensureCanvas()) {
         spdlog::warn("FontSampler: Canvas not initialized");
         return {};
     }
@@ -332,7 +361,7 @@ std::vector<std::vector<bool>> FontSampler::sampleCharacter(char c, float thresh
 
 std::vector<std::vector<bool>> FontSampler::sampleUtf8Character(const std::string& utf8Char)
 {
-    if (!canvas_ || !drawBuf_) {
+    if (!ensureCanvas()) {
         spdlog::warn("FontSampler: Canvas not initialized");
         return {};
     }
@@ -395,7 +424,7 @@ std::vector<std::vector<bool>> FontSampler::sampleCurrentCanvas(float threshold)
 
 std::vector<std::vector<RgbPixel>> FontSampler::sampleCharacterRgb(char c)
 {
-    if (!canvas_ || !drawBuf_) {
+    if (!ensureCanvas()) {
         spdlog::warn("FontSampler: Canvas not initialized");
         return {};
     }
@@ -433,7 +462,7 @@ std::vector<std::vector<RgbPixel>> FontSampler::sampleCharacterRgb(char c)
 
 std::vector<std::vector<RgbPixel>> FontSampler::sampleUtf8CharacterRgb(const std::string& utf8Char)
 {
-    if (!canvas_ || !drawBuf_) {
+    if (!ensureCanvas()) {
         spdlog::warn("FontSampler: Canvas not initialized");
         return {};
     }
@@ -522,7 +551,7 @@ GridBuffer<RgbPixel> FontSampler::sampleCurrentCanvasRgbGrid()
 
 GridBuffer<RgbPixel> FontSampler::sampleUtf8CharacterRgbGrid(const std::string& utf8Char)
 {
-    if (!canvas_ || !drawBuf_) {
+    if (!ensureCanvas()) {
         spdlog::warn("FontSampler: Canvas not initialized");
         return {};
     }
@@ -587,11 +616,35 @@ const std::vector<std::vector<bool>>& FontSampler::getCachedPattern(char c)
         return it->second;
     }
 
+    if (atlas_) {
+        const std::string key = atlasKey(threshold_, "bits", std::string_view(&c, 1));
+        auto stored = atlas_->findPattern(key);
+        if (!stored) {
+            stored = sampleCharacter(c);
+            atlas_->storePattern(key, *stored);
+        }
+        cache_[c] = std::move(*stored);
+        return cache_[c];
+    }
+
     // Sample and cache.
     cache_[c] = sampleCharacter(c);
     return cache_[c];
 }
 
+void FontSampler::setGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas, std::string fontId)
+{
+    atlas_ = std::move(atlas);
+    atlasFontId_ = std::move(fontId);
+}
+
+std::string FontSampler::atlasKey(
+    float threshold, std::string_view variant, std::string_view glyph) const
+{
+    return GlyphAtlas::makeKey(
+        atlasFontId_, targetWidth_, targetHeight_, threshold, variant, glyph);
+}
+
 void FontSampler::clearCache()
 {
     cache_.clear();
@@ -612,10 +665,10 @@ void FontSampler::resizeCanvas(int newWidth, int newHeight)
         return;
     }
 
+    // The canvas is recreated at the new size on the next rasterization.
     destroyCanvas();
     targetWidth_ = newWidth;
     targetHeight_ = newHeight;
-    initCanvas();
 
     // Clear caches since canvas size changed.
     cache_.clear();
@@ -671,6 +724,18 @@ const std::vector<std::vector<bool>>& FontSampler::getCachedPatternTrimmed(char
         return it->second;
     }
 
+    if (atlas_) {
+        // Keyed by the canvas size before sampling, since clipping may grow the canvas.
+        const std::string key = atlasKey(threshold_, "trimmed", std::string_view(&c, 1));
+        auto stored = atlas_->findPattern(key);
+        if (!stored) {
+            stored = sampleCharacterTrimmed(c);
+            atlas_->storePattern(key, *stored);
+        }
+        trimmedCache_[c] = std::move(*stored);
+        return trimmedCache_[c];
+    }
+
     // Sample, trim, and cache.
     trimmedCache_[c] = sampleCharacterTrimmed(c);
     return trimmedCache_[c];
@@ -765,6 +830,24 @@ std::vector<std::vector<bool>> FontSampler::trimPattern(
 
 GridBuffer<Material::EnumType> FontSampler::sampleAndDownsample(
     const std::string& utf8Char, int targetWidth, int targetHeight, float alphaThreshold)
+{
+    if (atlas_) {
+        const std::string key = atlasKey(
+            alphaThreshold, fmt::format("material {}x{}", targetWidth, targetHeight), utf8Char);
+        if (auto stored = atlas_->findMaterialGrid(key)) {
+            return std::move(*stored);
+        }
+
+        auto grid = sampleAndDownsampleLive(utf8Char, targetWidth, targetHeight, alphaThreshold);
+        atlas_->storeMaterialGrid(key, grid);
+        return grid;
+    }
+
+    return sampleAndDownsampleLive(utf8Char, targetWidth, targetHeight, alphaThreshold);
+}
+
+GridBuffer<Material::EnumType> FontSampler::sampleAndDownsampleLive(
+    const std::string& utf8Char, int targetWidth, int targetHeight, float alphaThreshold)
 {
     // Sample at native font resolution.
     auto fullGrid = sampleUtf8CharacterMaterialGrid(utf8Char, alphaThreshold);
@@ -4,7 +4,9 @@
 #include "GridBuffer.h"
 #include "MaterialType.h"
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -14,6 +16,8 @@ typedef struct _lv_font_t lv_font_t;
 
 namespace DirtSim {
 
+class GlyphAtlas;
+
 /**
  * Samples characters from LVGL fonts into boolean or RGB grid patterns.
  *
@@ -25,6 +29,10 @@ namespace DirtSim {
  * Supports two font sources:
  * 1. Built-in LVGL fonts (passed as const lv_font_t*)
  * 2. Runtime-loaded fonts via FreeType (TTF files, including color emoji)
+ *
+ * The LVGL canvas (and FreeType font) are created on the first sample that needs them. With a
+ * GlyphAtlas attached, the cached pattern getters and sampleAndDownsample() read from the
+ * atlas first and store what they rasterize, so a warm atlas never touches LVGL.
  */
 class FontSampler {
 public:
@@ -77,6 +85,9 @@ public:
     void clearCache();
     void precacheAscii();
 
+    // fontId names the font and size in atlas keys (e.g. "montserrat_24").
+    void setGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas, std::string fontId);
+
     // Resize the internal canvas. Clears the cache since patterns may change.
     void resizeCanvas(int newWidth, int newHeight);
 
@@ -107,9 +118,14 @@ public:
     void setThreshold(float threshold) { threshold_ = threshold; }
 
 private:
+    bool ensureCanvas();
     void initCanvas();
     void destroyCanvas();
     void initFreeType();
+    void loadFreeTypeFont();
+    std::string atlasKey(float threshold, std::string_view variant, std::string_view glyph) const;
+    GridBuffer<Material::EnumType> sampleAndDownsampleLive(
+        const std::string& utf8Char, int targetWidth, int targetHeight, float alphaThreshold);
     std::vector<std::vector<bool>> sampleCurrentCanvas(float threshold);
     std::vector<std::vector<RgbPixel>> sampleCurrentCanvasRgb();
     GridBuffer<RgbPixel> sampleCurrentCanvasRgbGrid();
@@ -123,12 +139,20 @@ private:
     bool ownsFont_ = false;
     lv_font_t* ownedFont_ = nullptr; // Non-const pointer for fonts we own.
 
+    // FreeType font source, loaded on first rasterization.
+    std::string fontPath_;
+    int fontSize_ = 0;
+    bool fontLoadAttempted_ = false;
+
     // LVGL canvas resources (stored as void* to avoid LVGL in header).
     void* canvas_ = nullptr;
     void* drawBuf_ = nullptr;
 
     std::unordered_map<char, std::vector<std::vector<bool>>> cache_;
     std::unordered_map<char, std::vector<std::vector<bool>>> trimmedCache_;
+
+    std::shared_ptr<GlyphAtlas> atlas_;
+    std::string atlasFontId_;
 };
 
 } // namespace DirtSim
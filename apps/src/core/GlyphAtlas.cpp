@@ -0,0 +1,450 @@
+#include "GlyphAtlas.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace DirtSim {
+
+namespace {
+
+// File layout (native byte order):
+//   FileHeader
+//   FileEntry[entryCount]
+//   key and data bytes, addressed by offsets from the start of the file.
+constexpr char kMagic[4] = { 'D', 'S', 'G', 'A' };
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+};
+
+struct FileEntry {
+    uint32_t keyOffset;
+    uint32_t keyLength;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;
+    uint8_t padding[3];
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(FileEntry) == 24);
+
+size_t packedBitsSize(size_t width, size_t height)
+{
+    return (width * height + 7) / 8;
+}
+
+struct SharedAtlasState {
+    std::mutex mutex;
+    std::filesystem::path path;
+    std::shared_ptr<GlyphAtlas> atlas;
+};
+
+SharedAtlasState& sharedAtlasState()
+{
+    static SharedAtlasState state;
+    return state;
+}
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas(std::filesystem::path path) : path_(std::move(path))
+{
+    mapFile();
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    {
+        std::lock_guard<std::mutex> lock(saveThreadMutex_);
+        if (saveThread_.joinable()) {
+            saveThread_.join();
+        }
+    }
+    unmapFile();
+}
+
+std::string GlyphAtlas::makeKey(
+    std::string_view fontId,
+    int canvasWidth,
+    int canvasHeight,
+    float threshold,
+    std::string_view variant,
+    std::string_view glyph)
+{
+    return fmt::format(
+        "{}|{}x{}|{:.3f}|{}|{}", fontId, canvasWidth, canvasHeight, threshold, variant, glyph);
+}
+
+void GlyphAtlas::mapFile()
+{
+    const int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        return;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        spdlog::warn("GlyphAtlas: Failed to map {}", path_.string());
+        return;
+    }
+
+    mapped_ = static_cast<const uint8_t*>(addr);
+    mappedSize_ = size;
+
+    FileHeader header;
+    std::memcpy(&header, mapped_, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+        spdlog::info(
+            "GlyphAtlas: Ignoring {} (version {}, expected {})",
+            path_.string(),
+            header.version,
+            kVersion);
+        unmapFile();
+        return;
+    }
+
+    const size_t tableEnd = sizeof(FileHeader) + size_t{ header.entryCount } * sizeof(FileEntry);
+    if (tableEnd > mappedSize_) {
+        spdlog::warn("GlyphAtlas: Truncated entry table in {}", path_.string());
+        unmapFile();
+        return;
+    }
+
+    mappedEntries_.reserve(header.entryCount);
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        FileEntry fileEntry;
+        std::memcpy(
+            &fileEntry, mapped_ + sizeof(FileHeader) + i * sizeof(FileEntry), sizeof(fileEntry));
+
+        const bool keyInBounds = size_t{ fileEntry.keyOffset } + fileEntry.keyLength <= size;
+        const bool dataInBounds = size_t{ fileEntry.dataOffset } + fileEntry.dataSize <= size;
+        const Format format = static_cast<Format>(fileEntry.format);
+        const size_t expectedSize = format == Format::Bits
+            ? packedBitsSize(fileEntry.width, fileEntry.height)
+            : size_t{ fileEntry.width } * fileEntry.height;
+        if (!keyInBounds || !dataInBounds || fileEntry.format > 1
+            || fileEntry.dataSize != expectedSize) {
+            spdlog::warn("GlyphAtlas: Corrupt entry {} in {}", i, path_.string());
+            mappedEntries_.clear();
+            unmapFile();
+            return;
+        }
+
+        const std::string_view key(
+            reinterpret_cast<const char*>(mapped_ + fileEntry.keyOffset), fileEntry.keyLength);
+        mappedEntries_[key] = Entry{
+            .width = fileEntry.width,
+            .height = fileEntry.height,
+            .format = format,
+            .data = mapped_ + fileEntry.dataOffset,
+            .size = fileEntry.dataSize,
+        };
+    }
+
+    spdlog::info(
+        "GlyphAtlas: Mapped {} glyphs from {} ({} bytes)",
+        mappedEntries_.size(),
+        path_.string(),
+        mappedSize_);
+}
+
+void GlyphAtlas::unmapFile()
+{
+    mappedEntries_.clear();
+    if (mapped_) {
+        ::munmap(const_cast<uint8_t*>(mapped_), mappedSize_);
+        mapped_ = nullptr;
+        mappedSize_ = 0;
+    }
+}
+
+std::optional<GlyphAtlas::Entry> GlyphAtlas::findEntry(const std::string& key, Format format) const
+{
+    const auto pendingIt = pendingEntries_.find(key);
+    if (pendingIt != pendingEntries_.end()) {
+        const PendingEntry& pending = pendingIt->second;
+        if (pending.format != format) {
+            return std::nullopt;
+        }
+        return Entry{
+            .width = pending.width,
+            .height = pending.height,
+            .format = pending.format,
+            .data = pending.bytes.data(),
+            .size = static_cast<uint32_t>(pending.bytes.size()),
+        };
+    }
+
+    const auto mappedIt = mappedEntries_.find(std::string_view(key));
+    if (mappedIt == mappedEntries_.end() || mappedIt->second.format != format) {
+        return std::nullopt;
+    }
+    return mappedIt->second;
+}
+
+std::optional<std::vector<std::vector<bool>>> GlyphAtlas::findPattern(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto entry = findEntry(key, Format::Bits);
+    if (!entry.has_value()) {
+        return std::nullopt;
+    }
+
+    std::vector<std::vector<bool>> pattern(entry->height, std::vector<bool>(entry->width));
+    size_t bit = 0;
+    for (auto& row : pattern) {
+        for (size_t x = 0; x < row.size(); ++x, ++bit) {
+            row[x] = (entry->data[bit / 8] >> (bit % 8)) & 1u;
+        }
+    }
+    return pattern;
+}
+
+void GlyphAtlas::storePattern(const std::string& key, const std::vector<std::vector<bool>>& pattern)
+{
+    if (pattern.empty() || pattern.front().empty()) {
+        return;
+    }
+
+    PendingEntry entry{
+        .width = static_cast<uint16_t>(pattern.front().size()),
+        .height = static_cast<uint16_t>(pattern.size()),
+        .format = Format::Bits,
+        .bytes = {},
+        .generation = 0,
+    };
+    entry.bytes.assign(packedBitsSize(entry.width, entry.height), 0);
+
+    size_t bit = 0;
+    for (const auto& row : pattern) {
+        for (size_t x = 0; x < entry.width; ++x, ++bit) {
+            if (x < row.size() && row[x]) {
+                entry.bytes[bit / 8] |= static_cast<uint8_t>(1u << (bit % 8));
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry.generation = nextPendingGeneration_++;
+    pendingEntries_[key] = std::move(entry);
+}
+
+std::optional<GridBuffer<Material::EnumType>> GlyphAtlas::findMaterialGrid(
+    const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto entry = findEntry(key, Format::Material);
+    if (!entry.has_value()) {
+        return std::nullopt;
+    }
+
+    GridBuffer<Material::EnumType> grid;
+    grid.resize(entry->width, entry->height);
+    std::memcpy(grid.data.data(), entry->data, entry->size);
+    return grid;
+}
+
+void GlyphAtlas::storeMaterialGrid(
+    const std::string& key, const GridBuffer<Material::EnumType>& grid)
+{
+    if (grid.width <= 0 || grid.height <= 0) {
+        return;
+    }
+
+    PendingEntry entry{
+        .width = static_cast<uint16_t>(grid.width),
+        .height = static_cast<uint16_t>(grid.height),
+        .format = Format::Material,
+        .bytes = std::vector<uint8_t>(grid.data.size()),
+        .generation = 0,
+    };
+    std::memcpy(entry.bytes.data(), grid.data.data(), grid.data.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry.generation = nextPendingGeneration_++;
+    pendingEntries_[key] = std::move(entry);
+}
+
+Result<std::monostate, std::string> GlyphAtlas::save()
+{
+    std::lock_guard<std::mutex> saveLock(saveMutex_);
+
+    // Build the whole file image under the lookup lock, then write it without the lock so
+    // lookups and stores from other threads don't wait on the disk.
+    FileHeader header{};
+    std::vector<uint8_t> table;
+    std::vector<uint8_t> blob;
+    std::unordered_map<std::string, uint64_t> savedGenerations;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pendingEntries_.empty()) {
+            return Result<std::monostate, std::string>::okay(std::monostate{});
+        }
+
+        struct OutEntry {
+            std::string_view key;
+            Entry entry;
+        };
+        std::vector<OutEntry> entries;
+        entries.reserve(mappedEntries_.size() + pendingEntries_.size());
+        for (const auto& [key, entry] : mappedEntries_) {
+            if (!pendingEntries_.contains(std::string(key))) {
+                entries.push_back(OutEntry{ .key = key, .entry = entry });
+            }
+        }
+        for (const auto& [key, pending] : pendingEntries_) {
+            entries.push_back(OutEntry{
+                .key = key,
+                .entry = Entry{
+                    .width = pending.width,
+                    .height = pending.height,
+                    .format = pending.format,
+                    .data = pending.bytes.data(),
+                    .size = static_cast<uint32_t>(pending.bytes.size()),
+                },
+            });
+            savedGenerations.emplace(key, pending.generation);
+        }
+
+        table.resize(entries.size() * sizeof(FileEntry));
+        const size_t blobStart = sizeof(FileHeader) + table.size();
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const OutEntry& out = entries[i];
+            FileEntry fileEntry{};
+            fileEntry.keyOffset = static_cast<uint32_t>(blobStart + blob.size());
+            fileEntry.keyLength = static_cast<uint32_t>(out.key.size());
+            blob.insert(blob.end(), out.key.begin(), out.key.end());
+            fileEntry.dataOffset = static_cast<uint32_t>(blobStart + blob.size());
+            fileEntry.dataSize = out.entry.size;
+            blob.insert(blob.end(), out.entry.data, out.entry.data + out.entry.size);
+            fileEntry.width = out.entry.width;
+            fileEntry.height = out.entry.height;
+            fileEntry.format = static_cast<uint8_t>(out.entry.format);
+            std::memcpy(table.data() + i * sizeof(FileEntry), &fileEntry, sizeof(fileEntry));
+        }
+
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.entryCount = static_cast<uint32_t>(entries.size());
+    }
+
+    std::error_code ec;
+    if (path_.has_parent_path()) {
+        std::filesystem::create_directories(path_.parent_path(), ec);
+    }
+
+    const std::filesystem::path tmpPath = path_.string() + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(table.data()), table.size());
+        file.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+        if (!file) {
+            return Result<std::monostate, std::string>::error(
+                "Failed to write " + tmpPath.string());
+        }
+    }
+
+    std::filesystem::rename(tmpPath, path_, ec);
+    if (ec) {
+        return Result<std::monostate, std::string>::error(
+            "Failed to replace " + path_.string() + ": " + ec.message());
+    }
+
+    // Entries stored or replaced while the file was written stay pending for the next save.
+    std::lock_guard<std::mutex> lock(mutex_);
+    unmapFile();
+    for (const auto& [key, generation] : savedGenerations) {
+        auto it = pendingEntries_.find(key);
+        if (it != pendingEntries_.end() && it->second.generation == generation) {
+            pendingEntries_.erase(it);
+        }
+    }
+    mapFile();
+    return Result<std::monostate, std::string>::okay(std::monostate{});
+}
+
+void GlyphAtlas::saveInBackground()
+{
+    if (!isDirty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(saveThreadMutex_);
+    if (saveRunning_.load()) {
+        return;
+    }
+    if (saveThread_.joinable()) {
+        saveThread_.join();
+    }
+    saveRunning_ = true;
+    saveThread_ = std::thread([this]() {
+        auto result = save();
+        if (result.isError()) {
+            spdlog::warn("GlyphAtlas: Background save failed: {}", result.errorValue());
+        }
+        saveRunning_ = false;
+    });
+}
+
+bool GlyphAtlas::isDirty() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !pendingEntries_.empty();
+}
+
+size_t GlyphAtlas::getEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = pendingEntries_.size();
+    for (const auto& [key, entry] : mappedEntries_) {
+        if (!pendingEntries_.contains(std::string(key))) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void GlyphAtlas::setSharedPath(std::filesystem::path path)
+{
+    SharedAtlasState& state = sharedAtlasState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.path == path) {
+        return;
+    }
+    state.path = std::move(path);
+    state.atlas.reset();
+}
+
+std::shared_ptr<GlyphAtlas> GlyphAtlas::shared()
+{
+    SharedAtlasState& state = sharedAtlasState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.atlas && !state.path.empty()) {
+        state.atlas = std::make_shared<GlyphAtlas>(state.path);
+    }
+    return state.atlas;
+}
+
+} // namespace DirtSim
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "GridBuffer.h"
+#include "MaterialType.h"
+#include "core/Result.h"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace DirtSim {
+
+/**
+ * Versioned on-disk cache of sampled glyph patterns, so FontSampler can skip LVGL
+ * rasterization for glyphs it has seen before.
+ *
+ * Entries are looked up by a text key from makeKey(): font, canvas size, threshold, variant
+ * and glyph. Boolean patterns are stored bit-packed and material grids one byte per cell.
+ * The file is mapped read-only when the atlas is constructed. New entries stay in memory
+ * until save() rewrites the file (temp file + rename) and maps the result. A file with the
+ * wrong magic or version, or one that fails bounds checks, is ignored and replaced by the
+ * next save. save() only holds the lookup lock while copying entries out and remapping, not
+ * while writing, and saveInBackground() runs it off the caller's thread.
+ *
+ * All methods are thread-safe; lookups return copies.
+ */
+class GlyphAtlas {
+public:
+    // Bump when the file layout or FontSampler's sampling output changes.
+    static constexpr uint32_t kVersion = 1;
+
+    explicit GlyphAtlas(std::filesystem::path path);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    static std::string makeKey(
+        std::string_view fontId,
+        int canvasWidth,
+        int canvasHeight,
+        float threshold,
+        std::string_view variant,
+        std::string_view glyph);
+
+    std::optional<std::vector<std::vector<bool>>> findPattern(const std::string& key) const;
+    void storePattern(const std::string& key, const std::vector<std::vector<bool>>& pattern);
+
+    std::optional<GridBuffer<Material::EnumType>> findMaterialGrid(const std::string& key) const;
+    void storeMaterialGrid(const std::string& key, const GridBuffer<Material::EnumType>& grid);
+
+    // Writes mapped and new entries to the file. Does nothing when there are no new entries.
+    Result<std::monostate, std::string> save();
+
+    // Starts save() on a writer thread and returns at once; failures are logged. Does nothing
+    // when there are no new entries or a background save is still running. The destructor
+    // waits for it.
+    void saveInBackground();
+
+    bool isDirty() const;
+    size_t getEntryCount() const;
+    const std::filesystem::path& getPath() const { return path_; }
+
+    // Process-wide atlas for scenarios that sample fonts. shared() returns null until a path
+    // has been set, so tests and tools without one keep rasterizing live.
+    static void setSharedPath(std::filesystem::path path);
+    static std::shared_ptr<GlyphAtlas> shared();
+
+private:
+    enum class Format : uint8_t {
+        Bits = 0,
+        Material = 1,
+    };
+
+    struct Entry {
+        uint16_t width = 0;
+        uint16_t height = 0;
+        Format format = Format::Bits;
+        const uint8_t* data = nullptr;
+        uint32_t size = 0;
+    };
+
+    struct PendingEntry {
+        uint16_t width = 0;
+        uint16_t height = 0;
+        Format format = Format::Bits;
+        std::vector<uint8_t> bytes;
+        // Tells save() whether the entry it wrote was replaced while the file was written.
+        uint64_t generation = 0;
+    };
+
+    void mapFile();
+    void unmapFile();
+    std::optional<Entry> findEntry(const std::string& key, Format format) const;
+
+    std::filesystem::path path_;
+
+    // Serializes save() calls; taken before mutex_.
+    std::mutex saveMutex_;
+    std::mutex saveThreadMutex_;
+    std::thread saveThread_;
+    std::atomic<bool> saveRunning_{ false };
+
+    mutable std::mutex mutex_;
+    const uint8_t* mapped_ = nullptr;
+    size_t mappedSize_ = 0;
+    // Keys and data point into the mapping.
+    std::unordered_map<std::string_view, Entry> mappedEntries_;
+    std::unordered_map<std::string, PendingEntry> pendingEntries_;
+    uint64_t nextPendingGeneration_ = 0;
+};
+
+} // namespace DirtSim
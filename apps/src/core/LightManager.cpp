@@ -39,6 +39,17 @@ void LightManager::clear()
     lights_.clear();
 }
 
+LightManager::State LightManager::captureState() const
+{
+    return State{ .lights = lights_, .nextId = next_id_ };
+}
+
+void LightManager::restoreState(const State& state)
+{
+    lights_ = state.lights;
+    next_id_ = state.nextId;
+}
+
 void LightManager::forEachLight(const std::function<void(LightId, const Light&)>& callback) const
 {
     for (const auto& [id, light] : lights_) {
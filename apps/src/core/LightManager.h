@@ -60,6 +60,15 @@ public:
     size_t count() const;
     void clear();
 
+    // Full light table, so World setup snapshots can put lights back exactly as setup left
+    // them. Restoring replaces every light; ids handed out after the capture become invalid.
+    struct State {
+        std::unordered_map<LightId, Light> lights;
+        LightId nextId{ 1 };
+    };
+    State captureState() const;
+    void restoreState(const State& state);
+
     void forEachLight(const std::function<void(LightId, const Light&)>& callback) const;
 
 private:
@@ -0,0 +1,93 @@
+#include "MaterialSummedAreaTable.h"
+#include "Assert.h"
+#include "ColorNames.h"
+#include "LightBuffer.h"
+#include "WorldData.h"
+
+#include <algorithm>
+
+namespace DirtSim {
+
+void MaterialSummedAreaTable::rebuild(const WorldData& data, const LightBuffer* light)
+{
+    width_ = data.width;
+    height_ = data.height;
+    hasLight_ = light && light->width == data.width && light->height == data.height;
+
+    // Every corner is written below, so a same-sized rebuild reuses the buffers as-is.
+    const size_t corners = static_cast<size_t>(width_ + 1) * static_cast<size_t>(height_ + 1);
+    counts_.resize(corners * kMaterialCount);
+    light_.resize(hasLight_ ? corners : 0);
+
+    std::fill_n(counts_.begin(), static_cast<size_t>(width_ + 1) * kMaterialCount, 0);
+    if (hasLight_) {
+        std::fill_n(light_.begin(), static_cast<size_t>(width_ + 1), 0.0);
+    }
+
+    // Each corner adds its row prefix to the corner above. Counts wrap modulo 2^16; the
+    // box differences stay exact for boxes up to kMaxBoxCells.
+    std::array<uint16_t, kMaterialCount> rowCounts{};
+    for (int y = 0; y < height_; y++) {
+        rowCounts.fill(0);
+        double rowLight = 0.0;
+        const uint16_t* above = &counts_[cornerIndex(0, y) * kMaterialCount];
+        uint16_t* corner = &counts_[cornerIndex(0, y + 1) * kMaterialCount];
+        std::fill_n(corner, kMaterialCount, 0);
+        if (hasLight_) {
+            light_[cornerIndex(0, y + 1)] = 0.0;
+        }
+
+        for (int x = 0; x < width_; x++) {
+            const int materialIndex = static_cast<int>(data.at(x, y).material_type);
+            if (materialIndex >= 0 && materialIndex < kMaterialCount) {
+                rowCounts[materialIndex]++;
+            }
+
+            above += kMaterialCount;
+            corner += kMaterialCount;
+            for (int m = 0; m < kMaterialCount; m++) {
+                corner[m] = static_cast<uint16_t>(above[m] + rowCounts[m]);
+            }
+
+            if (hasLight_) {
+                rowLight += ColorNames::brightness(light->at(x, y));
+                light_[cornerIndex(x + 1, y + 1)] = light_[cornerIndex(x + 1, y)] + rowLight;
+            }
+        }
+    }
+}
+
+MaterialSummedAreaTable::MaterialCounts MaterialSummedAreaTable::materialCounts(
+    int x0, int y0, int x1, int y1) const
+{
+    MaterialCounts result{};
+    if (x1 <= x0 || y1 <= y0) {
+        return result;
+    }
+    DIRTSIM_ASSERT(
+        static_cast<int64_t>(x1 - x0) * (y1 - y0) <= kMaxBoxCells,
+        "MaterialSummedAreaTable: box too large for 16-bit counts");
+
+    const uint16_t* bottomRight = &counts_[cornerIndex(x1, y1) * kMaterialCount];
+    const uint16_t* bottomLeft = &counts_[cornerIndex(x0, y1) * kMaterialCount];
+    const uint16_t* topRight = &counts_[cornerIndex(x1, y0) * kMaterialCount];
+    const uint16_t* topLeft = &counts_[cornerIndex(x0, y0) * kMaterialCount];
+    for (int m = 0; m < kMaterialCount; m++) {
+        result[m] =
+            static_cast<uint16_t>(bottomRight[m] - bottomLeft[m] - topRight[m] + topLeft[m]);
+    }
+    return result;
+}
+
+double MaterialSummedAreaTable::lightSum(int x0, int y0, int x1, int y1) const
+{
+    if (!hasLight_ || x1 <= x0 || y1 <= y0) {
+        return 0.0;
+    }
+
+    const double sum = light_[cornerIndex(x1, y1)] - light_[cornerIndex(x0, y1)]
+        - light_[cornerIndex(x1, y0)] + light_[cornerIndex(x0, y0)];
+    return std::max(0.0, sum);
+}
+
+} // namespace DirtSim
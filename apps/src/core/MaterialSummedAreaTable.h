@@ -0,0 +1,59 @@
+#pragma once
+
+#include "MaterialType.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DirtSim {
+
+struct LightBuffer;
+struct WorldData;
+
+/**
+ * Per-material integral images of the world grid.
+ *
+ * Each entry holds the number of cells of every material (and the summed light
+ * brightness) in the rectangle from the origin to that corner, so the contents of
+ * any box come out of four lookups no matter how large it is. World builds one lazily
+ * per frame for sensors that downsample regions, such as tree sensing.
+ */
+class MaterialSummedAreaTable {
+public:
+    static constexpr int kMaterialCount = static_cast<int>(Material::EnumType::Wood) + 1;
+
+    // Largest box materialCounts() can answer exactly.
+    static constexpr int kMaxBoxCells = 65535;
+
+    using MaterialCounts = std::array<int32_t, kMaterialCount>;
+
+    // Rebuild from the grid. Light sums are only available when the buffer matches the grid.
+    void rebuild(const WorldData& data, const LightBuffer* light);
+
+    // Box queries over [x0, x1) x [y0, y1); callers clamp to the grid.
+    MaterialCounts materialCounts(int x0, int y0, int x1, int y1) const;
+    double lightSum(int x0, int y0, int x1, int y1) const;
+
+    bool hasLight() const { return hasLight_; }
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+private:
+    size_t cornerIndex(int x, int y) const
+    {
+        return static_cast<size_t>(y) * static_cast<size_t>(width_ + 1) + static_cast<size_t>(x);
+    }
+
+    int width_ = 0;
+    int height_ = 0;
+    bool hasLight_ = false;
+
+    // Corner-major: all material counts for one corner are contiguous. 16-bit counts halve
+    // the rebuild's memory traffic; wraparound cancels out in the box differences.
+    std::vector<uint16_t> counts_;
+    std::vector<double> light_;
+};
+
+} // namespace DirtSim
@@ -23,6 +23,16 @@ void from_json(const nlohmann::json& j, DebugCell& cell)
     cell = ReflectSerializer::from_json<DebugCell>(j);
 }
 
+void to_json(nlohmann::json& j, const OrganismSpan& span)
+{
+    j = ReflectSerializer::to_json(span);
+}
+
+void from_json(const nlohmann::json& j, OrganismSpan& span)
+{
+    span = ReflectSerializer::from_json<OrganismSpan>(j);
+}
+
 void to_json(nlohmann::json& j, const OrganismData& org)
 {
     j = ReflectSerializer::to_json(org);
@@ -55,19 +55,30 @@ struct DebugCell {
     using serialize = zpp::bits::members<10>;
 };
 
+/**
+ * @brief Run of consecutive cells on one grid row that belong to the same organism.
+ */
+struct OrganismSpan {
+    uint32_t start = 0;  // Flat grid index (y * width + x) of the first cell.
+    uint16_t length = 0; // Cell count; a span never crosses the end of a row.
+
+    using serialize = zpp::bits::members<2>;
+};
+
 /**
  * @brief Sparse organism data.
  *
  * Instead of sending organism_id for every cell (mostly zeros), we send a sparse
- * representation: organism ID + list of cells it occupies.
+ * representation: organism ID + the row runs of cells it occupies. 32-bit indices and
+ * IDs cover grids past 65,536 cells and long-running worlds that allocate many IDs.
  *
- * Example: 1 tree with 100 cells:
+ * Example: 1 tree with 100 cells in 12 rows on a 150x150 grid:
  *   Dense: 22,500 bytes (1 byte per cell)
- *   Sparse: ~200 bytes (1 byte ID + 100 × 2 byte indices)
+ *   Sparse: ~80 bytes (4 byte ID + 12 x 6 byte spans)
  */
 struct OrganismData {
-    uint8_t organism_id;                // Organism identifier (1-255, 0 = none).
-    std::vector<uint16_t> cell_indices; // Flat grid indices (y * width + x).
+    uint32_t organism_id = 0;        // Organism identifier (0 = none).
+    std::vector<OrganismSpan> spans; // Row runs, ascending by start.
 
     using serialize = zpp::bits::members<2>;
 };
@@ -128,6 +139,8 @@ void to_json(nlohmann::json& j, const BasicCell& cell);
 void from_json(const nlohmann::json& j, BasicCell& cell);
 void to_json(nlohmann::json& j, const DebugCell& cell);
 void from_json(const nlohmann::json& j, DebugCell& cell);
+void to_json(nlohmann::json& j, const OrganismSpan& span);
+void from_json(const nlohmann::json& j, OrganismSpan& span);
 void to_json(nlohmann::json& j, const OrganismData& org);
 void from_json(const nlohmann::json& j, OrganismData& org);
 void to_json(nlohmann::json& j, const ScenarioVideoFrame& frame);
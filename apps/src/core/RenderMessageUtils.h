@@ -129,25 +129,49 @@ inline size_t checkedRenderCellCount(int16_t width, int16_t height, const std::s
 
 /**
  * @brief Extract sparse organism data from OrganismManager grid.
+ *
+ * Cells are grouped into per-row runs, so a solid organism costs one span per row it
+ * covers rather than one index per cell.
  */
-inline std::vector<OrganismData> extractOrganisms(const std::vector<OrganismId>& grid)
+inline std::vector<OrganismData> extractOrganisms(
+    const std::vector<OrganismId>& grid, int16_t width)
 {
-    std::map<OrganismId, std::vector<uint16_t>> organism_map;
+    std::map<OrganismId, std::vector<OrganismSpan>> organism_map;
+    if (width <= 0) {
+        return {};
+    }
+
+    const size_t row_width = static_cast<size_t>(width);
+    OrganismId run_id = INVALID_ORGANISM_ID;
+    OrganismSpan run;
+    const auto flush = [&]() {
+        if (run_id != INVALID_ORGANISM_ID) {
+            organism_map[run_id].push_back(run);
+        }
+        run_id = INVALID_ORGANISM_ID;
+    };
 
     for (size_t i = 0; i < grid.size(); ++i) {
-        OrganismId org_id = grid[i];
+        const OrganismId org_id = grid[i];
+        if (org_id == run_id && i % row_width != 0) {
+            run.length++;
+            continue;
+        }
+        flush();
         if (org_id != INVALID_ORGANISM_ID) {
-            organism_map[org_id].push_back(static_cast<uint16_t>(i));
+            run_id = org_id;
+            run = OrganismSpan{ .start = static_cast<uint32_t>(i), .length = 1 };
         }
     }
+    flush();
 
     std::vector<OrganismData> result;
     result.reserve(organism_map.size());
 
-    for (const auto& [id, indices] : organism_map) {
+    for (auto& [id, spans] : organism_map) {
         OrganismData org;
-        org.organism_id = static_cast<uint8_t>(id.get());
-        org.cell_indices = indices;
+        org.organism_id = static_cast<uint32_t>(id.get());
+        org.spans = std::move(spans);
         result.push_back(std::move(org));
     }
 
@@ -193,7 +217,7 @@ inline RenderMessage packCellRenderMessage(
         DIRTSIM_ASSERT(false, "packCellRenderMessage: unsupported render format");
     }
 
-    msg.organisms = extractOrganisms(organism_grid);
+    msg.organisms = extractOrganisms(organism_grid, data.width);
     msg.entities = data.entities;
 
     return msg;
@@ -225,7 +249,7 @@ inline RenderMessage packVideoRenderMessage(
     msg.region_debug = data.region_debug;
     msg.tree_vision = data.tree_vision;
     msg.scenario_video_frame = scenarioVideoFrame;
-    msg.organisms = extractOrganisms(organism_grid);
+    msg.organisms = extractOrganisms(organism_grid, data.width);
     msg.entities = data.entities;
     return msg;
 }
@@ -301,10 +325,11 @@ inline std::vector<OrganismId> applyOrganismData(
     std::vector<OrganismId> organism_ids(num_cells);
 
     for (const auto& org : organisms) {
-        for (uint16_t idx : org.cell_indices) {
-            if (idx < num_cells) {
-                organism_ids[idx] = OrganismId{ static_cast<int>(org.organism_id) };
-            }
+        const OrganismId id{ static_cast<int>(org.organism_id) };
+        for (const OrganismSpan& span : org.spans) {
+            const size_t begin = std::min<size_t>(span.start, num_cells);
+            const size_t end = std::min<size_t>(begin + span.length, num_cells);
+            std::fill(organism_ids.begin() + begin, organism_ids.begin() + end, id);
         }
     }
 
@@ -7,6 +7,7 @@
 #include "LightCalculatorBase.h"
 #include "LightManager.h"
 #include "LightPropagator.h"
+#include "MaterialSummedAreaTable.h"
 #include "PhysicsSettings.h"
 #include "ReflectSerializer.h"
 #include "ScopeTimer.h"
@@ -22,8 +23,10 @@
 #include "WorldInterpolationTool.h"
 
 #include "WorldPressureCalculator.h"
+#include "WorldHistory.h"
 #include "WorldRegionActivityTracker.h"
 #include "WorldRigidBodyCalculator.h"
+#include "WorldStateHash.h"
 #include "WorldStaticLoadCalculator.h"
 #include "WorldVelocityLimitCalculator.h"
 #include "WorldViscosityCalculator.h"
@@ -37,9 +40,11 @@
 #include <cassert>
 #include <cmath>
 #include <limits>
+#include <optional>
 #include <queue>
 #include <random>
 #include <set>
+#include <span>
 #include <sstream>
 #include <unordered_set>
 
@@ -512,6 +517,14 @@ struct World::Impl {
     // Persistent grid cache (initialized after data_ in constructor).
     std::optional<GridOfCells> grid_;
     bool is_grid_cache_dirty_ = false;
+
+    // Sensing cache, keyed by timestep and invalidated alongside the grid cache.
+    MaterialSummedAreaTable material_summed_area_table_;
+    bool is_material_summed_area_table_dirty_ = true;
+    int32_t material_summed_area_table_timestep_ = -1;
+    int32_t sensing_query_timestep_ = -1;
+    int64_t sensing_query_cells_this_frame_ = 0;
+    int64_t sensing_query_cells_last_frame_ = 0;
     bool is_static_load_dirty_ = true;
     double static_load_gravity_ = std::numeric_limits<double>::quiet_NaN();
 
@@ -534,6 +547,21 @@ struct World::Impl {
     // Light sources.
     LightManager light_manager_;
 
+    // Time reversal.
+    WorldHistory history_;
+    bool time_reversal_enabled_ = false;
+    std::vector<uint8_t> changed_block_candidates_;
+
+    // State hashing.
+    WorldStateHash state_hash_;
+    bool state_hashing_enabled_ = false;
+    // Set by every grid edit and cleared at the end of a frame, so at the start of a frame it
+    // means the grid was edited outside the activity tracker's view.
+    bool is_state_hash_stale_ = true;
+
+    // Seed from setRandomSeed(); restoring a setup snapshot re-seeds from it.
+    std::optional<uint32_t> rng_seed_;
+
     // Performance timing.
     mutable Timers timers_;
 
@@ -558,6 +586,16 @@ void exportRegionDebugInfo(World::Impl& impl)
     impl.region_activity_tracker_.populateDebugInfo(impl.data_.region_debug);
 }
 
+// MAC projection water lives outside the cell grid, so the state hash covers it separately.
+std::span<const float> stateHashWaterVolume(const World::Impl& impl)
+{
+    WaterVolumeView volume{};
+    if (!impl.water_sim_system_.tryGetWaterVolumeView(volume)) {
+        return {};
+    }
+    return volume.volume;
+}
+
 void resizeRegionDebugTracking(World::Impl& impl, int world_width, int world_height)
 {
     const int blocks_x = computeRegionBlockCount(world_width);
@@ -733,6 +771,59 @@ const WorldRegionActivityTracker& World::getRegionActivityTracker() const
     return pImpl->region_activity_tracker_;
 }
 
+const MaterialSummedAreaTable& World::getMaterialSummedAreaTable() const
+{
+    const_cast<World*>(this)->ensureMaterialSummedAreaTableFresh();
+    return pImpl->material_summed_area_table_;
+}
+
+const MaterialSummedAreaTable* World::getMaterialSummedAreaTableFor(int64_t queriedCells) const
+{
+    Impl& impl = *const_cast<World*>(this)->pImpl;
+    if (impl.sensing_query_timestep_ != impl.data_.timestep) {
+        impl.sensing_query_cells_last_frame_ =
+            impl.sensing_query_timestep_ == impl.data_.timestep - 1
+            ? impl.sensing_query_cells_this_frame_
+            : 0;
+        impl.sensing_query_cells_this_frame_ = 0;
+        impl.sensing_query_timestep_ = impl.data_.timestep;
+    }
+    impl.sensing_query_cells_this_frame_ += queriedCells;
+
+    // Once built, further queries this frame are nearly free.
+    if (isMaterialSummedAreaTableFresh()) {
+        return &impl.material_summed_area_table_;
+    }
+
+    const int64_t forecastCells =
+        std::max(impl.sensing_query_cells_last_frame_, impl.sensing_query_cells_this_frame_);
+    const double worldCells = static_cast<double>(impl.data_.width) * impl.data_.height;
+    if (static_cast<double>(forecastCells)
+        < kMaterialSummedAreaTableBreakEvenCoverage * worldCells) {
+        return nullptr;
+    }
+
+    return &getMaterialSummedAreaTable();
+}
+
+bool World::isMaterialSummedAreaTableFresh() const
+{
+    return !pImpl->is_material_summed_area_table_dirty_
+        && pImpl->material_summed_area_table_timestep_ == pImpl->data_.timestep;
+}
+
+void World::ensureMaterialSummedAreaTableFresh()
+{
+    if (isMaterialSummedAreaTableFresh()) {
+        return;
+    }
+
+    ScopeTimer timer(pImpl->timers_, "material_summed_area_table_rebuild");
+    pImpl->material_summed_area_table_.rebuild(pImpl->data_, &getRawLightBuffer());
+    pImpl->is_material_summed_area_table_dirty_ = false;
+    pImpl->material_summed_area_table_timestep_ = pImpl->data_.timestep;
+}
+
 void World::ensureGridCacheFresh(const char* timerName)
 {
     if (!pImpl->is_grid_cache_dirty_) {
@@ -754,6 +845,8 @@ void World::markGridCacheDirty()
 {
     pImpl->is_grid_cache_dirty_ = true;
     pImpl->is_static_load_dirty_ = true;
+    pImpl->is_material_summed_area_table_dirty_ = true;
+    pImpl->is_state_hash_stale_ = true;
 }
 
 bool World::isStaticLoadRecomputeNeeded() const
@@ -810,34 +903,224 @@ void World::setDirtFragmentationFactor(double /* factor */)
 }
 
 // =================================================================
-// TIME REVERSAL STUBS (no-op implementations)
+// TIME REVERSAL
 // =================================================================
 
-void World::enableTimeReversal(bool /* enabled */)
-{}
+void World::enableTimeReversal(bool enabled)
+{
+    if (enabled == pImpl->time_reversal_enabled_) {
+        return;
+    }
+
+    pImpl->time_reversal_enabled_ = enabled;
+    pImpl->history_.clear();
+    if (enabled) {
+        saveWorldState();
+    }
+}
+
 bool World::isTimeReversalEnabled() const
 {
-    return false;
+    return pImpl->time_reversal_enabled_;
 }
+
 void World::saveWorldState()
-{}
+{
+    if (!pImpl->time_reversal_enabled_) {
+        return;
+    }
+
+    pImpl->history_.record(pImpl->data_, buildChangedBlockCandidates());
+}
+
+const std::vector<uint8_t>& World::buildChangedBlockCandidates()
+{
+    // Sleeping blocks that nothing touched cannot have changed, so only the rest are compared.
+    const WorldRegionActivityTracker& tracker = pImpl->region_activity_tracker_;
+    std::vector<uint8_t>& candidates = pImpl->changed_block_candidates_;
+    candidates.clear();
+    if (tracker.getBlocksX() == computeRegionBlockCount(pImpl->data_.width)
+        && tracker.getBlocksY() == computeRegionBlockCount(pImpl->data_.height)) {
+        candidates.resize(static_cast<size_t>(tracker.getBlocksX()) * tracker.getBlocksY());
+        for (int block_y = 0; block_y < tracker.getBlocksY(); ++block_y) {
+            for (int block_x = 0; block_x < tracker.getBlocksX(); ++block_x) {
+                const bool candidate = tracker.isRegionActive(block_x, block_y)
+                    || tracker.getRegionSummary(block_x, block_y).touched_this_frame;
+                candidates[static_cast<size_t>(block_y) * tracker.getBlocksX() + block_x] =
+                    candidate ? 1 : 0;
+            }
+        }
+    }
+    return candidates;
+}
+
 bool World::canGoBackward() const
 {
-    return false;
+    return pImpl->history_.canStepBack();
 }
+
 bool World::canGoForward() const
 {
-    return false;
+    return pImpl->history_.canStepForward();
 }
+
 void World::goBackward()
-{}
+{
+    applyHistoryStep(pImpl->history_.stepBack(pImpl->data_));
+}
+
 void World::goForward()
-{}
+{
+    applyHistoryStep(pImpl->history_.stepForward(pImpl->data_));
+}
+
+void World::applyHistoryStep(const std::vector<uint32_t>& restored_blocks)
+{
+    if (restored_blocks.empty()) {
+        return;
+    }
+
+    // Restored blocks must be simulated again even if they were asleep.
+    const int blocks_x = pImpl->history_.getBlocksX();
+    for (const uint32_t block : restored_blocks) {
+        pImpl->region_activity_tracker_.noteWakeAtRegion(
+            static_cast<int>(block % blocks_x),
+            static_cast<int>(block / blocks_x),
+            WakeReason::ExternalMutation);
+    }
+    pImpl->pending_moves_.clear();
+    markGridCacheDirty();
+}
+
 void World::clearHistory()
-{}
+{
+    pImpl->history_.clear();
+    saveWorldState();
+}
+
 size_t World::getHistorySize() const
 {
-    return 0;
+    return pImpl->history_.getFrameCount();
+}
+
+size_t World::getHistoryMemoryBytes() const
+{
+    return pImpl->history_.getMemoryBytes();
+}
+
+void World::setHistoryMemoryBudget(size_t bytes)
+{
+    WorldHistory::Config config = pImpl->history_.getConfig();
+    config.memory_budget_bytes = bytes;
+    pImpl->history_.setConfig(config);
+}
+
+// =================================================================
+// STATE HASHING
+// =================================================================
+
+void World::enableStateHashing(bool enabled)
+{
+    pImpl->state_hashing_enabled_ = enabled;
+    pImpl->is_state_hash_stale_ = true;
+}
+
+bool World::isStateHashingEnabled() const
+{
+    return pImpl->state_hashing_enabled_;
+}
+
+void World::setStateHashQuantum(float quantum)
+{
+    WorldStateHash::Config config = pImpl->state_hash_.getConfig();
+    config.quantum = quantum;
+    pImpl->state_hash_.setConfig(config);
+    pImpl->is_state_hash_stale_ = true;
+}
+
+uint64_t World::getStateHash()
+{
+    if (!pImpl->state_hashing_enabled_ || pImpl->is_state_hash_stale_) {
+        ScopeTimer timer(pImpl->timers_, "state_hash_full");
+        pImpl->state_hash_.rehashAll(pImpl->data_, stateHashWaterVolume(*pImpl));
+        pImpl->is_state_hash_stale_ = false;
+    }
+    return pImpl->state_hash_.getRoot();
+}
+
+const WorldStateHash& World::getStateHasher() const
+{
+    return pImpl->state_hash_;
+}
+
+// =================================================================
+// SETUP SNAPSHOTS
+// =================================================================
+
+struct World::SetupSnapshot {
+    WorldData data;
+    PhysicsSettings physicsSettings;
+    std::vector<float> waterVolume;
+    LightManager::State lights;
+};
+
+std::shared_ptr<const World::SetupSnapshot> World::captureSetupSnapshot() const
+{
+    auto snapshot = std::make_shared<SetupSnapshot>();
+    snapshot->data = pImpl->data_;
+    snapshot->physicsSettings = pImpl->physicsSettings_;
+    snapshot->lights = pImpl->light_manager_.captureState();
+
+    WaterVolumeView volume{};
+    if (pImpl->water_sim_system_.tryGetWaterVolumeView(volume)) {
+        snapshot->waterVolume.assign(volume.volume.begin(), volume.volume.end());
+    }
+    return snapshot;
+}
+
+void World::restoreSetupSnapshot(const SetupSnapshot& snapshot)
+{
+    DIRTSIM_ASSERT(
+        snapshot.data.width == pImpl->data_.width && snapshot.data.height == pImpl->data_.height,
+        "World::restoreSetupSnapshot: Snapshot size does not match world");
+
+    organism_manager_->clear();
+
+    // Same-size vectors copy in place, so this is a memcpy of the cell arrays.
+    pImpl->data_ = snapshot.data;
+    pImpl->physicsSettings_ = snapshot.physicsSettings;
+    pImpl->pending_moves_.clear();
+    pImpl->light_manager_.restoreState(snapshot.lights);
+    pImpl->light_calculator_->clearAllEmissive();
+    pImpl->region_activity_tracker_.reset();
+    exportRegionDebugInfo(*pImpl);
+
+    // A fresh World draws a new seed unless one was configured.
+    if (pImpl->rng_seed_.has_value()) {
+        rng_ = std::make_unique<std::mt19937>(pImpl->rng_seed_.value());
+    }
+    else {
+        rng_ = std::make_unique<std::mt19937>(std::random_device{}());
+    }
+
+    pImpl->water_sim_system_.syncToSettings(
+        pImpl->physicsSettings_, pImpl->data_.width, pImpl->data_.height);
+    pImpl->water_sim_system_.reset();
+    WaterVolumeMutableView volume{};
+    if (!snapshot.waterVolume.empty()
+        && pImpl->water_sim_system_.tryGetMutableWaterVolumeView(volume)
+        && volume.volume.size() == snapshot.waterVolume.size()) {
+        std::copy(snapshot.waterVolume.begin(), snapshot.waterVolume.end(), volume.volume.begin());
+    }
+
+    pImpl->timers_ = Timers{};
+    pImpl->timers_.startTimer("total_simulation");
+    pImpl->state_hash_.clear();
+    markGridCacheDirty();
+
+    // History restarts at the restored state, as it does when time reversal is first enabled.
+    pImpl->history_.clear();
+    saveWorldState();
 }
 
 // =================================================================
@@ -970,6 +1253,7 @@ double World::getAirResistanceStrength() const
 
 void World::setRandomSeed(uint32_t seed)
 {
+    pImpl->rng_seed_ = seed;
     rng_ = std::make_unique<std::mt19937>(seed);
     spdlog::debug("World RNG seed set to {}", seed);
 }
@@ -996,6 +1280,9 @@ void World::advanceTime(double deltaTimeSeconds)
         return;
     }
 
+    // Edits made between frames are outside the activity tracker's view.
+    const bool edited_before_frame = pImpl->is_state_hash_stale_;
+
     pImpl->water_sim_system_.syncToSettings(
         pImpl->physicsSettings_, pImpl->data_.width, pImpl->data_.height);
     pImpl->water_sim_system_.advanceTime(*this, scaledDeltaTime);
@@ -1117,6 +1404,35 @@ void World::advanceTime(double deltaTimeSeconds)
     organism_manager_->syncEntitiesToWorldData(*this);
 
     pImpl->data_.timestep++;
+
+    if (pImpl->time_reversal_enabled_) {
+        ScopeTimer historyTimer(pImpl->timers_, "time_reversal_record");
+        if (edited_before_frame) {
+            // The edit may have landed in a sleeping block; an empty mask compares them all.
+            pImpl->changed_block_candidates_.clear();
+            pImpl->history_.record(pImpl->data_, pImpl->changed_block_candidates_);
+        }
+        else {
+            saveWorldState();
+        }
+    }
+
+    if (pImpl->state_hashing_enabled_) {
+        ScopeTimer stateHashTimer(pImpl->timers_, "state_hash_update");
+        const std::span<const float> waterVolume = stateHashWaterVolume(*pImpl);
+        if (edited_before_frame) {
+            pImpl->state_hash_.rehashAll(pImpl->data_, waterVolume);
+        }
+        else {
+            // saveWorldState() already built this frame's candidates.
+            if (!pImpl->time_reversal_enabled_) {
+                buildChangedBlockCandidates();
+            }
+            pImpl->state_hash_.update(
+                pImpl->data_, pImpl->changed_block_candidates_, waterVolume);
+        }
+    }
+    pImpl->is_state_hash_stale_ = false;
 }
 
 // DEPRECATED: World setup now handled by Scenario::setup().
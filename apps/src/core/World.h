@@ -21,12 +21,14 @@ struct WaterVolumeMutableView;
 struct WaterVolumeView;
 class LightCalculatorBase;
 class LightManager;
+class MaterialSummedAreaTable;
 class WorldAdhesionCalculator;
 class WorldCollisionCalculator;
 class WorldFrictionCalculator;
 
 class WorldPressureCalculator;
 class WorldRegionActivityTracker;
+class WorldStateHash;
 class WorldViscosityCalculator;
 class GridOfCells;
 struct LightBuffer;
@@ -116,9 +118,11 @@ public:
     const WorldViscosityCalculator& getViscosityCalculator() const;
 
     // =================================================================
-    // TIME REVERSAL (NO-OP)
+    // TIME REVERSAL
     // =================================================================
 
+    // While enabled, every advanceTime() records the cells that changed (see WorldHistory).
+    // Stepping restores cells and the timestep only; organisms and water volume stay as is.
     void enableTimeReversal(bool enabled);
     bool isTimeReversalEnabled() const;
     void saveWorldState();
@@ -128,6 +132,37 @@ public:
     void goForward();
     void clearHistory();
     size_t getHistorySize() const;
+    size_t getHistoryMemoryBytes() const;
+    void setHistoryMemoryBudget(size_t bytes);
+
+    // =================================================================
+    // STATE HASHING
+    // =================================================================
+
+    // While enabled, every advanceTime() rehashes only the 8x8 blocks that may have changed
+    // (see WorldStateHash), so getStateHash() is cheap. Otherwise it hashes the whole grid.
+    void enableStateHashing(bool enabled);
+    bool isStateHashingEnabled() const;
+    void setStateHashQuantum(float quantum);
+    uint64_t getStateHash();
+
+    // Block hashes as of the last getStateHash() or hashed frame.
+    const WorldStateHash& getStateHasher() const;
+
+    // =================================================================
+    // SETUP SNAPSHOTS
+    // =================================================================
+
+    // Post-setup cell, physics, and water state. Lets training reuse a World
+    // by restoring this instead of reallocating and re-running scenario setup.
+    struct SetupSnapshot;
+    std::shared_ptr<const SetupSnapshot> captureSetupSnapshot() const;
+
+    // Snapshot must come from a world of the same size. Organisms, pending moves,
+    // emissive overlay, region activity, state hash, history, and timers are reset,
+    // lights return to their captured state, and the RNG is re-seeded (from the
+    // configured seed if there is one), so the result steps like a fresh setup.
+    void restoreSetupSnapshot(const SetupSnapshot& snapshot);
 
     // World-specific wall setup behavior
     void setWallsEnabled(bool enabled);
@@ -232,6 +267,19 @@ public:
     const GridOfCells& getGrid() const;
     const WorldRegionActivityTracker& getRegionActivityTracker() const;
 
+    // Per-material integral images, rebuilt on first use each frame or after cell edits.
+    const MaterialSummedAreaTable& getMaterialSummedAreaTable() const;
+
+    // The table for a sensor about to box-sum queriedCells cells, or null when this frame's
+    // sensing is not expected to cover enough cells to repay a rebuild; the caller then scans
+    // cells directly. The forecast is the larger of last frame's total and this frame's
+    // running total, so a steady tree population settles on one strategy.
+    const MaterialSummedAreaTable* getMaterialSummedAreaTableFor(int64_t queriedCells) const;
+
+    // Queried cells per world cell above which box sums beat direct scans. A rebuild costs
+    // three to five direct cell reads per world cell, depending on the machine.
+    static constexpr double kMaterialSummedAreaTableBreakEvenCoverage = 4.0;
+
     // Physics settings - public accessors for Pimpl-stored settings.
     PhysicsSettings& getPhysicsSettings();
     const PhysicsSettings& getPhysicsSettings() const;
@@ -295,6 +343,10 @@ private:
     bool isStaticLoadRecomputeNeeded() const;
     void rebuildGridCache(const char* timerName);
     void markGridCacheDirty();
+    void applyHistoryStep(const std::vector<uint32_t>& restored_blocks);
+    const std::vector<uint8_t>& buildChangedBlockCandidates();
+    void ensureMaterialSummedAreaTableFresh();
+    bool isMaterialSummedAreaTableFresh() const;
     void recomputeStaticLoad(const char* timerName);
 
     // Coordinate conversion helpers (can be public if needed).
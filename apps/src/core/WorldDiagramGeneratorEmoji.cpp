@@ -35,11 +35,16 @@ std::vector<std::string> splitDiagramLines(const std::string& diagram)
 } // namespace
 
 std::string WorldDiagramGeneratorEmoji::generateEmojiDiagram(const World& world)
+{
+    return generateEmojiDiagram(world.getData());
+}
+
+std::string WorldDiagramGeneratorEmoji::generateEmojiDiagram(const WorldData& data)
 {
     std::ostringstream diagram;
 
-    uint32_t width = world.getData().width;
-    uint32_t height = world.getData().height;
+    uint32_t width = data.width;
+    uint32_t height = data.height;
 
     // Top border with sparkles!
     diagram << "✨";
@@ -56,7 +61,7 @@ std::string WorldDiagramGeneratorEmoji::generateEmojiDiagram(const World& world)
         diagram << "┃";
 
         for (uint32_t x = 0; x < width; ++x) {
-            const auto& cell = world.getData().at(x, y);
+            const auto& cell = data.at(x, y);
 
             if (cell.isEmpty()) {
                 diagram << "⬜";
@@ -126,11 +131,16 @@ std::string WorldDiagramGeneratorEmoji::generateEmojiDiagram(const World& world)
 }
 
 std::string WorldDiagramGeneratorEmoji::generateMixedDiagram(const World& world)
+{
+    return generateMixedDiagram(world.getData());
+}
+
+std::string WorldDiagramGeneratorEmoji::generateMixedDiagram(const WorldData& data)
 {
     std::ostringstream diagram;
 
-    uint32_t width = world.getData().width;
-    uint32_t height = world.getData().height;
+    uint32_t width = data.width;
+    uint32_t height = data.height;
 
     // Top border.
     diagram << "🦆✨ Sparkle Duck World ✨🦆\n";
@@ -146,7 +156,7 @@ std::string WorldDiagramGeneratorEmoji::generateMixedDiagram(const World& world)
         diagram << "│";
 
         for (uint32_t x = 0; x < width; ++x) {
-            const auto& cell = world.getData().at(x, y);
+            const auto& cell = data.at(x, y);
 
             if (cell.isEmpty()) {
                 diagram << "   ";
@@ -248,10 +258,15 @@ std::string WorldDiagramGeneratorEmoji::generateMixedDiagram(const World& world)
 
 std::string WorldDiagramGeneratorEmoji::generateAnsiDiagram(
     const World& world, bool useLitColors, bool includeEmoji)
+{
+    return generateAnsiDiagram(world.getData(), useLitColors, includeEmoji);
+}
+
+std::string WorldDiagramGeneratorEmoji::generateAnsiDiagram(
+    const WorldData& data, bool useLitColors, bool includeEmoji)
 {
     std::ostringstream ansiDiagram;
 
-    const auto& data = world.getData();
     const int width = data.width;
     const int height = data.height;
     const size_t expectedSize = static_cast<size_t>(width) * height;
@@ -297,7 +312,7 @@ std::string WorldDiagramGeneratorEmoji::generateAnsiDiagram(
         return ansiOutput;
     }
 
-    const std::string emojiOutput = generateEmojiDiagram(world);
+    const std::string emojiOutput = generateEmojiDiagram(data);
     const auto ansiLines = splitDiagramLines(ansiOutput);
     const auto emojiLines = splitDiagramLines(emojiOutput);
     const size_t lineCount = std::max(ansiLines.size(), emojiLines.size());
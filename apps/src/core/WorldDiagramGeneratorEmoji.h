@@ -6,6 +6,7 @@
 namespace DirtSim {
 
 class World;
+struct WorldData;
 
 class WorldDiagramGeneratorEmoji {
 public:
@@ -13,6 +14,12 @@ public:
     static std::string generateMixedDiagram(const World& world);
     static std::string generateAnsiDiagram(
         const World& world, bool useLitColors, bool includeEmoji = false);
+
+    // Snapshot overloads, for callers holding a published WorldData rather than the World.
+    static std::string generateEmojiDiagram(const WorldData& data);
+    static std::string generateMixedDiagram(const WorldData& data);
+    static std::string generateAnsiDiagram(
+        const WorldData& data, bool useLitColors, bool includeEmoji = false);
 };
 
 } // namespace DirtSim
@@ -0,0 +1,156 @@
+#include "WorldHashTrace.h"
+#include "WorldStateHash.h"
+
+#include <algorithm>
+#include <nlohmann/json.hpp>
+#include <spdlog/fmt/fmt.h>
+#include <string>
+
+namespace DirtSim {
+
+namespace {
+
+std::string toHex(uint64_t value)
+{
+    return fmt::format("{:016x}", value);
+}
+
+uint64_t fromHex(const nlohmann::json& json)
+{
+    return std::stoull(json.get<std::string>(), nullptr, 16);
+}
+
+} // namespace
+
+void WorldHashTrace::record(int32_t timestep, const WorldStateHash& hash)
+{
+    const std::vector<uint64_t>& blocks = hash.getBlockHashes();
+    if (frames_.empty()) {
+        blocks_x_ = hash.getBlocksX();
+        blocks_y_ = hash.getBlocksY();
+        last_blocks_.assign(blocks.size(), 0);
+    }
+    else if (hash.getBlocksX() != blocks_x_ || hash.getBlocksY() != blocks_y_) {
+        // A resized grid starts over; the old frames no longer line up with the blocks.
+        clear();
+        record(timestep, hash);
+        return;
+    }
+
+    Frame frame{ .timestep = timestep, .root = hash.getRoot(), .changed_blocks = {} };
+    for (size_t block = 0; block < blocks.size(); ++block) {
+        if (frames_.empty() || blocks[block] != last_blocks_[block]) {
+            frame.changed_blocks.emplace_back(static_cast<uint32_t>(block), blocks[block]);
+            last_blocks_[block] = blocks[block];
+        }
+    }
+    frames_.push_back(std::move(frame));
+}
+
+void WorldHashTrace::clear()
+{
+    blocks_x_ = 0;
+    blocks_y_ = 0;
+    frames_.clear();
+    last_blocks_.clear();
+}
+
+nlohmann::json WorldHashTrace::toJson() const
+{
+    nlohmann::json frames = nlohmann::json::array();
+    for (const Frame& frame : frames_) {
+        nlohmann::json changed = nlohmann::json::array();
+        for (const auto& [block, hash] : frame.changed_blocks) {
+            changed.push_back({ block, toHex(hash) });
+        }
+        frames.push_back(
+            { { "timestep", frame.timestep },
+              { "root", toHex(frame.root) },
+              { "changed", std::move(changed) } });
+    }
+    return { { "blocksX", blocks_x_ }, { "blocksY", blocks_y_ }, { "frames", std::move(frames) } };
+}
+
+WorldHashTrace WorldHashTrace::fromJson(const nlohmann::json& json)
+{
+    WorldHashTrace trace;
+    trace.blocks_x_ = json.at("blocksX").get<int>();
+    trace.blocks_y_ = json.at("blocksY").get<int>();
+    trace.last_blocks_.assign(static_cast<size_t>(trace.blocks_x_) * trace.blocks_y_, 0);
+    for (const auto& entry : json.at("frames")) {
+        Frame frame{
+            .timestep = entry.at("timestep").get<int32_t>(),
+            .root = fromHex(entry.at("root")),
+            .changed_blocks = {},
+        };
+        for (const auto& changed : entry.at("changed")) {
+            const uint32_t block = changed.at(0).get<uint32_t>();
+            const uint64_t hash = fromHex(changed.at(1));
+            frame.changed_blocks.emplace_back(block, hash);
+            if (block < trace.last_blocks_.size()) {
+                trace.last_blocks_[block] = hash;
+            }
+        }
+        trace.frames_.push_back(std::move(frame));
+    }
+    return trace;
+}
+
+std::optional<WorldHashTrace::Divergence> WorldHashTrace::findFirstDivergence(
+    const WorldHashTrace& expected, const WorldHashTrace& actual)
+{
+    if (expected.blocks_x_ != actual.blocks_x_ || expected.blocks_y_ != actual.blocks_y_) {
+        return Divergence{};
+    }
+
+    // Replay both traces' block deltas so each frame's full block hashes are at hand.
+    const size_t block_total = static_cast<size_t>(expected.blocks_x_) * expected.blocks_y_;
+    std::vector<uint64_t> expected_blocks(block_total, 0);
+    std::vector<uint64_t> actual_blocks(block_total, 0);
+    const auto apply = [](std::vector<uint64_t>& blocks, const Frame& frame) {
+        for (const auto& [block, hash] : frame.changed_blocks) {
+            if (block < blocks.size()) {
+                blocks[block] = hash;
+            }
+        }
+    };
+
+    const size_t frame_total = std::min(expected.frames_.size(), actual.frames_.size());
+    for (size_t i = 0; i < frame_total; ++i) {
+        const Frame& expected_frame = expected.frames_[i];
+        const Frame& actual_frame = actual.frames_[i];
+        apply(expected_blocks, expected_frame);
+        apply(actual_blocks, actual_frame);
+        if (expected_frame.timestep != actual_frame.timestep) {
+            return Divergence{ .timestep = expected_frame.timestep };
+        }
+        if (expected_frame.root == actual_frame.root) {
+            continue;
+        }
+
+        Divergence divergence{
+            .timestep = expected_frame.timestep,
+            .expected = expected_frame.root,
+            .actual = actual_frame.root,
+        };
+        for (size_t block = 0; block < block_total; ++block) {
+            if (expected_blocks[block] != actual_blocks[block]) {
+                divergence.block_x = static_cast<int>(block % expected.blocks_x_);
+                divergence.block_y = static_cast<int>(block / expected.blocks_x_);
+                divergence.expected = expected_blocks[block];
+                divergence.actual = actual_blocks[block];
+                break;
+            }
+        }
+        return divergence;
+    }
+
+    if (expected.frames_.size() != actual.frames_.size()) {
+        const Frame& next = expected.frames_.size() > frame_total ? expected.frames_[frame_total]
+                                                                   : actual.frames_[frame_total];
+        return Divergence{ .timestep = next.timestep };
+    }
+    return std::nullopt;
+}
+
+} // namespace DirtSim
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <nlohmann/json_fwd.hpp>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace DirtSim {
+
+class WorldStateHash;
+
+/**
+ * Per-step record of a run's WorldStateHash, for golden-run regression checks.
+ *
+ * Each frame stores the root plus only the block hashes that changed since the previous
+ * frame, so a trace costs memory in proportion to activity. Comparing two traces finds
+ * the first timestep whose roots differ and, within it, the first block that differs.
+ */
+class WorldHashTrace {
+public:
+    struct Divergence {
+        int32_t timestep = 0;
+        // Block coordinates, or -1 when the traces differ in length or grid size.
+        int block_x = -1;
+        int block_y = -1;
+        uint64_t expected = 0;
+        uint64_t actual = 0;
+    };
+
+    void record(int32_t timestep, const WorldStateHash& hash);
+    void clear();
+
+    size_t getFrameCount() const { return frames_.size(); }
+    uint64_t getFinalRoot() const { return frames_.empty() ? 0 : frames_.back().root; }
+
+    nlohmann::json toJson() const;
+    static WorldHashTrace fromJson(const nlohmann::json& json);
+
+    static std::optional<Divergence> findFirstDivergence(
+        const WorldHashTrace& expected, const WorldHashTrace& actual);
+
+private:
+    struct Frame {
+        int32_t timestep = 0;
+        uint64_t root = 0;
+        std::vector<std::pair<uint32_t, uint64_t>> changed_blocks;
+    };
+
+    int blocks_x_ = 0;
+    int blocks_y_ = 0;
+    std::vector<Frame> frames_;
+
+    // Block hashes as of the last recorded frame.
+    std::vector<uint64_t> last_blocks_;
+};
+
+} // namespace DirtSim
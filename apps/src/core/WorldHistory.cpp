@@ -0,0 +1,200 @@
+#include "WorldHistory.h"
+#include "WorldData.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace DirtSim {
+
+namespace {
+
+int blockCount(int cells)
+{
+    return std::max(0, (cells + WorldHistory::BLOCK_SIZE - 1) / WorldHistory::BLOCK_SIZE);
+}
+
+} // namespace
+
+void WorldHistory::setConfig(const Config& config)
+{
+    config_ = config;
+    config_.keyframe_interval = std::max(1, config_.keyframe_interval);
+    enforceBudget();
+}
+
+void WorldHistory::clear()
+{
+    frames_.clear();
+    cursor_ = 0;
+    frame_bytes_ = 0;
+    has_baseline_ = false;
+    frames_since_keyframe_ = 0;
+    shadow_.clear();
+    shadow_.shrink_to_fit();
+}
+
+void WorldHistory::record(const WorldData& data, const std::vector<uint8_t>& candidate_blocks)
+{
+    if (!has_baseline_ || data.width != width_ || data.height != height_) {
+        resetBaseline(data);
+        return;
+    }
+
+    truncateRedo();
+
+    const size_t block_total = static_cast<size_t>(blocks_x_) * blocks_y_;
+    const bool keyframe = ++frames_since_keyframe_ >= config_.keyframe_interval
+        || candidate_blocks.size() != block_total;
+    if (keyframe) {
+        frames_since_keyframe_ = 0;
+    }
+
+    Frame frame;
+    frame.timestep = shadow_timestep_;
+    for (uint32_t block = 0; block < block_total; ++block) {
+        if (!keyframe && candidate_blocks[block] == 0) {
+            continue;
+        }
+        if (!blockEqualsShadow(data, block)) {
+            frame.blocks.push_back(block);
+        }
+    }
+
+    // Keep the shadow's old contents in the frame and bring the shadow up to date.
+    for (const uint32_t block : frame.blocks) {
+        const int x0 = static_cast<int>(block % blocks_x_) * BLOCK_SIZE;
+        const int y0 = static_cast<int>(block / blocks_x_) * BLOCK_SIZE;
+        const int x1 = std::min(x0 + BLOCK_SIZE, width_);
+        const int y1 = std::min(y0 + BLOCK_SIZE, height_);
+        for (int y = y0; y < y1; ++y) {
+            const size_t row = static_cast<size_t>(y) * width_;
+            frame.cells.insert(
+                frame.cells.end(), shadow_.begin() + row + x0, shadow_.begin() + row + x1);
+            std::copy(
+                data.cells.begin() + row + x0,
+                data.cells.begin() + row + x1,
+                shadow_.begin() + row + x0);
+        }
+    }
+    frame.blocks.shrink_to_fit();
+    frame.cells.shrink_to_fit();
+    shadow_timestep_ = data.timestep;
+
+    frame_bytes_ += frameBytes(frame);
+    frames_.push_back(std::move(frame));
+    cursor_ = frames_.size();
+    enforceBudget();
+}
+
+const std::vector<uint32_t>& WorldHistory::stepBack(WorldData& data)
+{
+    if (!canStepBack() || data.width != width_ || data.height != height_) {
+        return empty_;
+    }
+
+    cursor_--;
+    return swapFrame(frames_[cursor_], data);
+}
+
+const std::vector<uint32_t>& WorldHistory::stepForward(WorldData& data)
+{
+    if (!canStepForward() || data.width != width_ || data.height != height_) {
+        return empty_;
+    }
+
+    Frame& frame = frames_[cursor_];
+    cursor_++;
+    return swapFrame(frame, data);
+}
+
+bool WorldHistory::cellsEqual(const Cell& a, const Cell& b)
+{
+    // Color and pending force are recomputed every frame, so they do not count as changes.
+    return a.material_type == b.material_type && a.fill_ratio == b.fill_ratio && a.com == b.com
+        && a.velocity == b.velocity && a.pressure == b.pressure && a.static_load == b.static_load
+        && a.pressure_gradient == b.pressure_gradient && a.render_as == b.render_as;
+}
+
+size_t WorldHistory::frameBytes(const Frame& frame)
+{
+    return sizeof(Frame) + frame.blocks.capacity() * sizeof(uint32_t)
+        + frame.cells.capacity() * sizeof(Cell);
+}
+
+bool WorldHistory::blockEqualsShadow(const WorldData& data, uint32_t block) const
+{
+    const int x0 = static_cast<int>(block % blocks_x_) * BLOCK_SIZE;
+    const int y0 = static_cast<int>(block / blocks_x_) * BLOCK_SIZE;
+    const int x1 = std::min(x0 + BLOCK_SIZE, width_);
+    const int y1 = std::min(y0 + BLOCK_SIZE, height_);
+    for (int y = y0; y < y1; ++y) {
+        const size_t row = static_cast<size_t>(y) * width_;
+        for (int x = x0; x < x1; ++x) {
+            if (!cellsEqual(data.cells[row + x], shadow_[row + x])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void WorldHistory::resetBaseline(const WorldData& data)
+{
+    clear();
+    width_ = data.width;
+    height_ = data.height;
+    blocks_x_ = blockCount(width_);
+    blocks_y_ = blockCount(height_);
+    shadow_ = data.cells;
+    shadow_timestep_ = data.timestep;
+    has_baseline_ = true;
+}
+
+const std::vector<uint32_t>& WorldHistory::swapFrame(Frame& frame, WorldData& data)
+{
+    auto stored = frame.cells.begin();
+    for (const uint32_t block : frame.blocks) {
+        const int x0 = static_cast<int>(block % blocks_x_) * BLOCK_SIZE;
+        const int y0 = static_cast<int>(block / blocks_x_) * BLOCK_SIZE;
+        const int x1 = std::min(x0 + BLOCK_SIZE, width_);
+        const int y1 = std::min(y0 + BLOCK_SIZE, height_);
+        for (int y = y0; y < y1; ++y) {
+            const size_t row = static_cast<size_t>(y) * width_;
+            stored = std::swap_ranges(
+                data.cells.begin() + row + x0, data.cells.begin() + row + x1, stored);
+            std::copy(
+                data.cells.begin() + row + x0,
+                data.cells.begin() + row + x1,
+                shadow_.begin() + row + x0);
+        }
+    }
+    std::swap(frame.timestep, data.timestep);
+    shadow_timestep_ = data.timestep;
+    return frame.blocks;
+}
+
+void WorldHistory::truncateRedo()
+{
+    while (frames_.size() > cursor_) {
+        frame_bytes_ -= frameBytes(frames_.back());
+        frames_.pop_back();
+    }
+}
+
+void WorldHistory::enforceBudget()
+{
+    // Drop the oldest history first, then the farthest redo frames.
+    while (!frames_.empty() && getMemoryBytes() > config_.memory_budget_bytes) {
+        if (cursor_ > 0) {
+            frame_bytes_ -= frameBytes(frames_.front());
+            frames_.pop_front();
+            cursor_--;
+        }
+        else {
+            frame_bytes_ -= frameBytes(frames_.back());
+            frames_.pop_back();
+        }
+    }
+}
+
+} // namespace DirtSim
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Cell.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace DirtSim {
+
+struct WorldData;
+
+/**
+ * Time-reversal history of the cell grid, stored as per-frame deltas of 8x8 blocks.
+ *
+ * A shadow copy of the grid holds the last recorded frame. Each record() compares only
+ * the candidate blocks (those the region activity tracker simulated or touched) against
+ * the shadow and keeps the previous contents of the blocks that changed, so a frame costs
+ * memory in proportion to activity. Every keyframeInterval frames the whole grid is
+ * compared instead, which picks up any change the candidate mask missed.
+ *
+ * Stepping swaps a frame's stored blocks with the grid, so the same frame serves as the
+ * undo record going back and the redo record going forward, and both directions cost
+ * O(blocks in the frame). The oldest frames are dropped when the memory budget is
+ * exceeded. Only cells and the timestep are restored; organisms, water volume, and
+ * physics settings are not part of the history.
+ */
+class WorldHistory {
+public:
+    static constexpr int BLOCK_SIZE = 8;
+
+    struct Config {
+        size_t memory_budget_bytes = 32 * 1024 * 1024;
+        int keyframe_interval = 300;
+    };
+
+    void setConfig(const Config& config);
+    const Config& getConfig() const { return config_; }
+
+    // Drops all frames; the next record() becomes the new baseline.
+    void clear();
+
+    // Records the grid after a frame. candidate_blocks has one entry per block (row-major),
+    // nonzero when the block may have changed; an empty mask compares every block.
+    void record(const WorldData& data, const std::vector<uint8_t>& candidate_blocks);
+
+    bool canStepBack() const { return cursor_ > 0; }
+    bool canStepForward() const { return cursor_ < frames_.size(); }
+
+    // Restore the previous/next frame into data. Return the indices of the blocks that
+    // changed, or an empty list when there is nothing to step to.
+    const std::vector<uint32_t>& stepBack(WorldData& data);
+    const std::vector<uint32_t>& stepForward(WorldData& data);
+
+    size_t getFrameCount() const { return frames_.size(); }
+    size_t getMemoryBytes() const { return frame_bytes_ + shadow_.capacity() * sizeof(Cell); }
+    int getBlocksX() const { return blocks_x_; }
+    int getBlocksY() const { return blocks_y_; }
+
+private:
+    struct Frame {
+        int32_t timestep = 0;          // Timestep on the other side of this frame.
+        std::vector<uint32_t> blocks;  // Block indices, ascending.
+        std::vector<Cell> cells;       // In-bounds cells of each block, row by row.
+    };
+
+    static bool cellsEqual(const Cell& a, const Cell& b);
+    static size_t frameBytes(const Frame& frame);
+
+    bool blockEqualsShadow(const WorldData& data, uint32_t block) const;
+    void resetBaseline(const WorldData& data);
+    const std::vector<uint32_t>& swapFrame(Frame& frame, WorldData& data);
+    void truncateRedo();
+    void enforceBudget();
+
+    Config config_;
+    int width_ = 0;
+    int height_ = 0;
+    int blocks_x_ = 0;
+    int blocks_y_ = 0;
+    bool has_baseline_ = false;
+    int frames_since_keyframe_ = 0;
+
+    std::vector<Cell> shadow_;
+    int32_t shadow_timestep_ = 0;
+
+    // frames_[0, cursor_) lead back from the current state; frames_[cursor_, end) lead forward.
+    std::deque<Frame> frames_;
+    size_t cursor_ = 0;
+    size_t frame_bytes_ = 0;
+
+    std::vector<uint32_t> empty_;
+};
+
+} // namespace DirtSim
@@ -0,0 +1,189 @@
+#include "WorldStateHash.h"
+#include "Cell.h"
+#include "WorldData.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace DirtSim {
+
+namespace {
+
+int blockCount(int cells)
+{
+    return std::max(0, (cells + WorldStateHash::BLOCK_SIZE - 1) / WorldStateHash::BLOCK_SIZE);
+}
+
+uint64_t mix(uint64_t x)
+{
+    // splitmix64 finalizer.
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+uint64_t combine(uint64_t hash, uint64_t value)
+{
+    return mix(hash ^ mix(value));
+}
+
+uint64_t quantize(float value, float quantum)
+{
+    if (quantum <= 0.0f || !std::isfinite(value)) {
+        return std::bit_cast<uint32_t>(value);
+    }
+    return static_cast<uint64_t>(std::llround(static_cast<double>(value) / quantum));
+}
+
+} // namespace
+
+void WorldStateHash::setConfig(const Config& config)
+{
+    config_ = config;
+    config_.full_rescan_interval = std::max(1, config_.full_rescan_interval);
+    clear();
+}
+
+void WorldStateHash::clear()
+{
+    width_ = 0;
+    height_ = 0;
+    blocks_x_ = 0;
+    blocks_y_ = 0;
+    updates_since_rescan_ = 0;
+    levels_.clear();
+}
+
+void WorldStateHash::update(
+    const WorldData& data,
+    const std::vector<uint8_t>& candidate_blocks,
+    std::span<const float> water_volume)
+{
+    const size_t block_total =
+        static_cast<size_t>(blockCount(data.width)) * blockCount(data.height);
+    if (levels_.empty() || data.width != width_ || data.height != height_
+        || candidate_blocks.size() != block_total
+        || ++updates_since_rescan_ >= config_.full_rescan_interval) {
+        rehashAll(data, water_volume);
+        return;
+    }
+
+    std::vector<uint64_t>& blocks = levels_.front();
+    for (size_t block = 0; block < block_total; ++block) {
+        if (candidate_blocks[block] == 0) {
+            continue;
+        }
+        const uint64_t hash = hashBlock(
+            data,
+            static_cast<int>(block % blocks_x_),
+            static_cast<int>(block / blocks_x_),
+            config_.quantum,
+            water_volume);
+        if (hash != blocks[block]) {
+            blocks[block] = hash;
+            updateAncestors(block);
+        }
+    }
+}
+
+void WorldStateHash::rehashAll(const WorldData& data, std::span<const float> water_volume)
+{
+    resize(data);
+    std::vector<uint64_t>& blocks = levels_.front();
+    for (int block_y = 0; block_y < blocks_y_; ++block_y) {
+        for (int block_x = 0; block_x < blocks_x_; ++block_x) {
+            blocks[static_cast<size_t>(block_y) * blocks_x_ + block_x] =
+                hashBlock(data, block_x, block_y, config_.quantum, water_volume);
+        }
+    }
+    rebuildTree();
+    updates_since_rescan_ = 0;
+}
+
+uint64_t WorldStateHash::hashBlock(
+    const WorldData& data,
+    int block_x,
+    int block_y,
+    float quantum,
+    std::span<const float> water_volume)
+{
+    const int x0 = block_x * BLOCK_SIZE;
+    const int y0 = block_y * BLOCK_SIZE;
+    const int x1 = std::min(x0 + BLOCK_SIZE, static_cast<int>(data.width));
+    const int y1 = std::min(y0 + BLOCK_SIZE, static_cast<int>(data.height));
+    const bool has_organisms = data.organism_ids.size() == data.cells.size();
+    const bool has_water_volume = water_volume.size() == data.cells.size();
+
+    // Seeding with the position keeps identical blocks in different places distinct.
+    uint64_t hash = combine(static_cast<uint64_t>(block_x), static_cast<uint64_t>(block_y));
+    for (int y = y0; y < y1; ++y) {
+        const size_t row = static_cast<size_t>(y) * data.width;
+        for (int x = x0; x < x1; ++x) {
+            const Cell& cell = data.cells[row + x];
+            hash = combine(hash, static_cast<uint64_t>(cell.material_type));
+            hash = combine(hash, quantize(cell.fill_ratio, quantum));
+            hash = combine(hash, quantize(cell.com.x, quantum));
+            hash = combine(hash, quantize(cell.com.y, quantum));
+            hash = combine(hash, quantize(cell.velocity.x, quantum));
+            hash = combine(hash, quantize(cell.velocity.y, quantum));
+            hash = combine(hash, quantize(cell.pressure, quantum));
+            if (has_organisms) {
+                hash = combine(hash, static_cast<uint64_t>(data.organism_ids[row + x].get()));
+            }
+            if (has_water_volume) {
+                hash = combine(hash, quantize(water_volume[row + x], quantum));
+            }
+        }
+    }
+    return hash;
+}
+
+const std::vector<uint64_t>& WorldStateHash::leaves() const
+{
+    return levels_.empty() ? empty_ : levels_.front();
+}
+
+void WorldStateHash::resize(const WorldData& data)
+{
+    width_ = data.width;
+    height_ = data.height;
+    blocks_x_ = blockCount(width_);
+    blocks_y_ = blockCount(height_);
+
+    levels_.clear();
+    size_t count = std::max<size_t>(1, static_cast<size_t>(blocks_x_) * blocks_y_);
+    levels_.emplace_back(count, 0);
+    while (count > 1) {
+        count = (count + 1) / 2;
+        levels_.emplace_back(count, 0);
+    }
+}
+
+void WorldStateHash::rebuildTree()
+{
+    for (size_t level = 1; level < levels_.size(); ++level) {
+        const std::vector<uint64_t>& children = levels_[level - 1];
+        std::vector<uint64_t>& parents = levels_[level];
+        for (size_t i = 0; i < parents.size(); ++i) {
+            const size_t left = i * 2;
+            const uint64_t right = left + 1 < children.size() ? children[left + 1] : 0;
+            parents[i] = combine(children[left], right);
+        }
+    }
+}
+
+void WorldStateHash::updateAncestors(size_t leaf)
+{
+    size_t index = leaf;
+    for (size_t level = 1; level < levels_.size(); ++level) {
+        const std::vector<uint64_t>& children = levels_[level - 1];
+        index /= 2;
+        const size_t left = index * 2;
+        const uint64_t right = left + 1 < children.size() ? children[left + 1] : 0;
+        levels_[level][index] = combine(children[left], right);
+    }
+}
+
+} // namespace DirtSim
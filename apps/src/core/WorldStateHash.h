@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace DirtSim {
+
+struct WorldData;
+
+/**
+ * Merkle-style hash of the cell grid, kept per 8x8 block.
+ *
+ * Each block hashes its cells with floats quantized to a fixed step, so results that
+ * differ only below that precision hash the same. Block hashes are the leaves of a
+ * binary tree whose root identifies the whole grid; updating a block rehashes its path
+ * to the root only. update() rehashes just the candidate blocks (those the region
+ * activity tracker simulated or touched), and every fullRescanInterval updates it
+ * rehashes the whole grid to pick up any change the mask missed.
+ *
+ * With the MAC projection water sim, water lives in a per-cell volume field beside the grid;
+ * pass it as water_volume (one entry per cell) so water-only changes move the hash too.
+ */
+class WorldStateHash {
+public:
+    static constexpr int BLOCK_SIZE = 8;
+
+    struct Config {
+        // Quantization step for float fields; 0 hashes the exact bits.
+        float quantum = 1e-4f;
+        int full_rescan_interval = 300;
+    };
+
+    void setConfig(const Config& config);
+    const Config& getConfig() const { return config_; }
+
+    // candidate_blocks has one entry per block (row-major), nonzero when the block may have
+    // changed; an empty mask rehashes every block.
+    void update(
+        const WorldData& data,
+        const std::vector<uint8_t>& candidate_blocks,
+        std::span<const float> water_volume = {});
+    void rehashAll(const WorldData& data, std::span<const float> water_volume = {});
+
+    // Drops all state; the next update() rehashes the whole grid.
+    void clear();
+
+    uint64_t getRoot() const { return levels_.empty() ? 0 : levels_.back().front(); }
+    const std::vector<uint64_t>& getBlockHashes() const { return leaves(); }
+    int getBlocksX() const { return blocks_x_; }
+    int getBlocksY() const { return blocks_y_; }
+
+    static uint64_t hashBlock(
+        const WorldData& data,
+        int block_x,
+        int block_y,
+        float quantum,
+        std::span<const float> water_volume = {});
+
+private:
+    const std::vector<uint64_t>& leaves() const;
+    void resize(const WorldData& data);
+    void rebuildTree();
+    void updateAncestors(size_t leaf);
+
+    Config config_;
+    int width_ = 0;
+    int height_ = 0;
+    int blocks_x_ = 0;
+    int blocks_y_ = 0;
+    int updates_since_rescan_ = 0;
+
+    // levels_[0] holds the block hashes; each level above halves it, ending at the root.
+    std::vector<std::vector<uint64_t>> levels_;
+    std::vector<uint64_t> empty_;
+};
+
+} // namespace DirtSim
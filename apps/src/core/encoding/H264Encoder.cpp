@@ -267,4 +267,36 @@ void H264Encoder::requestKeyframe()
     forceNextKeyframe_ = true;
 }
 
+bool H264Encoder::setRateControl(uint32_t targetBitrate, float frameRate)
+{
+    if (!encoder_) {
+        return false;
+    }
+
+    // Raise the ceiling first so a higher target is never rejected against the old maximum.
+    SBitrateInfo maxBitrate;
+    maxBitrate.iLayer = SPATIAL_LAYER_ALL;
+    maxBitrate.iBitrate = static_cast<int>(targetBitrate * 2);
+    encoder_->SetOption(ENCODER_OPTION_MAX_BITRATE, &maxBitrate);
+
+    SBitrateInfo bitrate;
+    bitrate.iLayer = SPATIAL_LAYER_ALL;
+    bitrate.iBitrate = static_cast<int>(targetBitrate);
+    int rv = encoder_->SetOption(ENCODER_OPTION_BITRATE, &bitrate);
+    if (rv != 0) {
+        spdlog::warn("H264Encoder: Failed to set bitrate {} (rv={})", targetBitrate, rv);
+        return false;
+    }
+
+    float rate = frameRate;
+    rv = encoder_->SetOption(ENCODER_OPTION_FRAME_RATE, &rate);
+    if (rv != 0) {
+        spdlog::warn("H264Encoder: Failed to set frame rate {} (rv={})", frameRate, rv);
+        return false;
+    }
+
+    spdlog::debug("H264Encoder: Rate control {}kbps, {}fps", targetBitrate / 1000, frameRate);
+    return true;
+}
+
 } // namespace DirtSim
@@ -80,6 +80,15 @@ public:
      */
     void requestKeyframe();
 
+    /**
+     * @brief Retarget bitrate and frame rate without reinitializing the encoder.
+     *
+     * @param targetBitrate Target bitrate in bits/second.
+     * @param frameRate Target frame rate.
+     * @return true if the encoder accepted both options.
+     */
+    bool setRateControl(uint32_t targetBitrate, float frameRate);
+
     /**
      * @brief Get the configured width.
      */
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "core/Result.h"
+#include "core/network/MessageType.h"
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <zpp_bits.h>
 
@@ -11,25 +14,63 @@ namespace DirtSim {
 namespace Network {
 
 /**
- * @brief Unified message envelope for binary protocol.
+ * @brief Fixed header at the start of every binary message.
+ *
+ * The payload follows the header directly and runs to the end of the message, so a receiver
+ * can hand out a view of it without copying. The type is a MessageTypeId rather than a name,
+ * and responses reuse the command's type with kEnvelopeFlagResponse set.
+ */
+struct EnvelopeHeader {
+    uint64_t id = 0;        // Correlation ID for request/response matching.
+    MessageTypeId type = 0; // Hashed message type name.
+    uint8_t flags = 0;
+
+    using serialize = zpp::bits::members<3>;
+};
+
+inline constexpr uint8_t kEnvelopeFlagResponse = 1;
+
+inline constexpr std::string_view kResponseSuffix = "_response";
+
+// Pushed by the server to render subscribers; not an API command.
+inline constexpr std::string_view kRenderMessageTypeName = "RenderMessage";
+inline constexpr MessageTypeId kRenderMessageTypeId = messageTypeIdOf(kRenderMessageTypeName);
+inline const MessageTypeId kRenderMessageTypeRegistered =
+    MessageTypeRegistry::registerName(kRenderMessageTypeName);
+
+/**
+ * @brief Decoded header plus a view of the payload inside the received buffer.
+ *
+ * Only valid while the buffer it was parsed from is alive and unchanged.
+ */
+struct EnvelopeView {
+    uint64_t id = 0;
+    MessageTypeId type = 0;
+    bool response = false;
+    std::span<const std::byte> payload;
+};
+
+/**
+ * @brief Owning envelope with the type as a name.
  *
  * Works for both commands (client→server) and responses (server→client).
  * The message_type field determines how to interpret the payload.
  *
  * For commands:
- *   - message_type = command name (e.g., "state_get", "sim_run")
+ *   - message_type = command name (e.g., "StateGet", "SimRun")
  *   - payload = zpp_bits serialized Command struct
  *
  * For responses:
- *   - message_type = command name + "_response" (e.g., "state_get_response")
+ *   - message_type = command name + "_response" (e.g., "StateGet_response")
  *   - payload = zpp_bits serialized SerializableResult<OkayType, ApiError>
+ *
+ * On the wire the name becomes an EnvelopeHeader type ID and the "_response" suffix becomes
+ * the response flag. Hot paths should use write_envelope()/parse_envelope() directly.
  */
 struct MessageEnvelope {
     uint64_t id;                    // Correlation ID for request/response matching.
     std::string message_type;       // Message type identifier.
     std::vector<std::byte> payload; // zpp_bits serialized content.
-
-    using serialize = zpp::bits::members<3>;
 };
 
 /**
@@ -86,6 +127,36 @@ struct SerializableResult {
 // Helper functions for serializing/deserializing envelopes.
 // ============================================================================
 
+/**
+ * @brief Parse the header of a binary message and view its payload in place.
+ * @throws std::system_error (from zpp_bits) if the buffer is shorter than a header.
+ */
+inline EnvelopeView parse_envelope(std::span<const std::byte> data)
+{
+    EnvelopeHeader header;
+    zpp::bits::in in(data);
+    in(header).or_throw();
+
+    return EnvelopeView{
+        .id = header.id,
+        .type = header.type,
+        .response = (header.flags & kEnvelopeFlagResponse) != 0,
+        .payload = data.subspan(in.position()),
+    };
+}
+
+/**
+ * @brief Write header and payload into out in one pass, reusing out's capacity.
+ */
+template <typename T>
+void write_envelope(
+    std::vector<std::byte>& out, uint64_t id, MessageTypeId type, uint8_t flags, const T& payload)
+{
+    out.clear();
+    zpp::bits::out writer(out);
+    writer(EnvelopeHeader{ .id = id, .type = type, .flags = flags }, payload).or_throw();
+}
+
 /**
  * @brief Serialize a MessageEnvelope to bytes.
  * @param envelope The envelope to serialize.
@@ -93,17 +164,37 @@ struct SerializableResult {
  */
 inline std::vector<std::byte> serialize_envelope(const MessageEnvelope& envelope)
 {
+    std::string_view name = envelope.message_type;
+    uint8_t flags = 0;
+    if (name.ends_with(kResponseSuffix)) {
+        name.remove_suffix(kResponseSuffix.size());
+        flags = kEnvelopeFlagResponse;
+    }
+
+    const EnvelopeHeader header{
+        .id = envelope.id,
+        .type = MessageTypeRegistry::registerName(name),
+        .flags = flags,
+    };
+
     std::vector<std::byte> data;
     zpp::bits::out out(data);
-    out(envelope).or_throw();
+    out(header).or_throw();
+    data.insert(data.end(), envelope.payload.begin(), envelope.payload.end());
     return data;
 }
 
-inline MessageEnvelope deserialize_envelope(const std::vector<std::byte>& data)
+inline MessageEnvelope deserialize_envelope(std::span<const std::byte> data)
 {
+    const EnvelopeView view = parse_envelope(data);
+
     MessageEnvelope envelope;
-    zpp::bits::in in(data);
-    in(envelope).or_throw();
+    envelope.id = view.id;
+    envelope.message_type = messageTypeName(view.type);
+    if (view.response) {
+        envelope.message_type += kResponseSuffix;
+    }
+    envelope.payload.assign(view.payload.begin(), view.payload.end());
     return envelope;
 }
 
@@ -117,7 +208,7 @@ std::vector<std::byte> serialize_payload(const T& payload)
 }
 
 template <typename T>
-T deserialize_payload(const std::vector<std::byte>& data)
+T deserialize_payload(std::span<const std::byte> data)
 {
     // Value-initialize to silence GCC 13's -Wmaybe-uninitialized false positive.
     // The warning triggers at call sites after inlining, so pragmas don't help.
@@ -127,6 +218,45 @@ T deserialize_payload(const std::vector<std::byte>& data)
     return payload;
 }
 
+/**
+ * @brief Message type ID for a command type.
+ *
+ * API commands carry a compile-time typeId(); other types (tests, ad-hoc tools) only have a
+ * name(), which gets registered on first use.
+ */
+template <typename CommandT>
+MessageTypeId command_type_id()
+{
+    if constexpr (requires { CommandT::typeId(); }) {
+        return CommandT::typeId();
+    }
+    else {
+        return MessageTypeRegistry::registerName(CommandT::name());
+    }
+}
+
+template <typename CommandT>
+std::vector<std::byte> serialize_command(uint64_t id, const CommandT& cmd)
+{
+    std::vector<std::byte> data;
+    write_envelope(data, id, command_type_id<CommandT>(), 0, cmd);
+    return data;
+}
+
+template <typename OkayT, typename ErrorT>
+std::vector<std::byte> serialize_response(
+    uint64_t id, MessageTypeId commandType, const Result<OkayT, ErrorT>& result)
+{
+    std::vector<std::byte> data;
+    write_envelope(
+        data,
+        id,
+        commandType,
+        kEnvelopeFlagResponse,
+        SerializableResult<OkayT, ErrorT>::from_result(result));
+    return data;
+}
+
 template <typename CommandT>
 MessageEnvelope make_command_envelope(uint64_t id, const CommandT& cmd)
 {
@@ -143,7 +273,7 @@ MessageEnvelope make_response_envelope(
 {
     MessageEnvelope envelope;
     envelope.id = id;
-    envelope.message_type = command_name + "_response";
+    envelope.message_type = command_name + std::string(kResponseSuffix);
     envelope.payload = serialize_payload(SerializableResult<OkayT, ErrorT>::from_result(result));
     return envelope;
 }
@@ -1,19 +1,32 @@
 #pragma once
 
+#include "core/network/MessageType.h"
 #include <cstdint>
+#include <string_view>
+#include <vector>
 #include <zpp_bits.h>
 
 namespace DirtSim {
 namespace Network {
 
-inline constexpr uint32_t kClientHelloProtocolVersion = 1;
+inline constexpr uint32_t kClientHelloProtocolVersion = 2;
+
+inline constexpr std::string_view kClientHelloMessageTypeName = "ClientHello";
+inline constexpr MessageTypeId kClientHelloMessageTypeId =
+    messageTypeIdOf(kClientHelloMessageTypeName);
+inline const MessageTypeId kClientHelloMessageTypeRegistered =
+    MessageTypeRegistry::registerName(kClientHelloMessageTypeName);
 
 struct ClientHello {
     uint32_t protocolVersion = kClientHelloProtocolVersion;
     bool wantsRender = false;
     bool wantsEvents = false;
 
-    using serialize = zpp::bits::members<3>;
+    // The client's message type table, filled in by WebSocketService when the hello is sent.
+    // The server rejects clients whose IDs map to different names than its own.
+    std::vector<MessageTypeName> messageTypes;
+
+    using serialize = zpp::bits::members<4>;
 };
 
 } // namespace Network
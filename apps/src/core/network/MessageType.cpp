@@ -0,0 +1,75 @@
+#include "MessageType.h"
+#include "core/Assert.h"
+
+#include <algorithm>
+#include <mutex>
+#include <spdlog/fmt/fmt.h>
+#include <unordered_map>
+
+namespace DirtSim {
+namespace Network {
+
+namespace {
+
+struct RegistryState {
+    std::mutex mutex;
+    std::unordered_map<MessageTypeId, std::string> names;
+};
+
+// Function-local so registrations from other translation units' static initializers are safe.
+RegistryState& registryState()
+{
+    static RegistryState state;
+    return state;
+}
+
+} // namespace
+
+MessageTypeId MessageTypeRegistry::registerName(std::string_view name)
+{
+    const MessageTypeId id = messageTypeIdOf(name);
+    RegistryState& state = registryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const auto [it, inserted] = state.names.try_emplace(id, name);
+    DIRTSIM_ASSERT(inserted || it->second == name, "Message type ID collision");
+    return id;
+}
+
+std::optional<std::string> MessageTypeRegistry::nameOf(MessageTypeId id)
+{
+    RegistryState& state = registryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const auto it = state.names.find(id);
+    if (it == state.names.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::vector<MessageTypeName> MessageTypeRegistry::entries()
+{
+    std::vector<MessageTypeName> result;
+    {
+        RegistryState& state = registryState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        result.reserve(state.names.size());
+        for (const auto& [id, name] : state.names) {
+            result.push_back(MessageTypeName{ .id = id, .name = name });
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const auto& left, const auto& right) {
+        return left.id < right.id;
+    });
+    return result;
+}
+
+std::string messageTypeName(MessageTypeId id)
+{
+    if (auto name = MessageTypeRegistry::nameOf(id)) {
+        return std::move(name.value());
+    }
+    return fmt::format("type#{:08x}", id);
+}
+
+} // namespace Network
+} // namespace DirtSim
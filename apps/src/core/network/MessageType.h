@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zpp_bits.h>
+
+namespace DirtSim {
+namespace Network {
+
+/**
+ * @brief Numeric message type carried in binary envelopes instead of the type name.
+ *
+ * IDs are a 32-bit FNV-1a hash of the name, so every binary computes the same ID for the same
+ * message without coordination. Names are registered alongside (API types do this through
+ * DEFINE_API_NAME) so IDs can be turned back into names for logs and legacy string dispatch.
+ */
+using MessageTypeId = uint32_t;
+
+constexpr MessageTypeId messageTypeIdOf(std::string_view name)
+{
+    uint32_t hash = 2166136261u;
+    for (const char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+struct MessageTypeName {
+    MessageTypeId id = 0;
+    std::string name;
+
+    using serialize = zpp::bits::members<2>;
+};
+
+/**
+ * @brief Process-wide table of known message type names, keyed by ID.
+ *
+ * Registering two different names that hash to the same ID aborts: it would make dispatch
+ * ambiguous, and it shows up the first time the colliding type is linked in.
+ */
+class MessageTypeRegistry {
+public:
+    static MessageTypeId registerName(std::string_view name);
+    static std::optional<std::string> nameOf(MessageTypeId id);
+
+    // Every registered type, sorted by ID. Sent to the server in ClientHello.
+    static std::vector<MessageTypeName> entries();
+};
+
+// Registered name for the ID, or a "type#xxxxxxxx" placeholder for unknown IDs.
+std::string messageTypeName(MessageTypeId id);
+
+} // namespace Network
+} // namespace DirtSim
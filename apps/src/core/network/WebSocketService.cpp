@@ -5,8 +5,8 @@
 #include "core/WorldData.h"
 #include "core/network/JsonProtocol.h"
 #include "server/api/ApiCommand.h"
+#include <algorithm>
 #include <chrono>
-#include <cstring>
 #include <spdlog/spdlog.h>
 #include <string_view>
 #include <thread>
@@ -16,7 +16,6 @@ namespace DirtSim {
 namespace Network {
 
 namespace {
-constexpr const char* kClientHelloMessageType = "ClientHello";
 constexpr auto kAuthAcceptDelay = std::chrono::milliseconds(100);
 constexpr auto kAuthRejectDelay = std::chrono::milliseconds(500);
 
@@ -25,13 +24,17 @@ bool isUiHello(const ClientHello& hello)
     return hello.wantsRender;
 }
 
-bool isResponseMessageType(const std::string& messageType)
+// First entry in the peer's table whose ID is known locally under a different name.
+std::optional<MessageTypeName> findConflictingMessageType(
+    const std::vector<MessageTypeName>& peerTypes)
 {
-    constexpr std::string_view suffix = "_response";
-    if (messageType.size() < suffix.size()) {
-        return false;
+    for (const auto& entry : peerTypes) {
+        const auto localName = MessageTypeRegistry::nameOf(entry.id);
+        if (localName.has_value() && localName.value() != entry.name) {
+            return entry;
+        }
     }
-    return messageType.compare(messageType.size() - suffix.size(), suffix.size(), suffix) == 0;
+    return std::nullopt;
 }
 
 std::string extractHostFromRemoteAddress(const std::string& remoteAddress)
@@ -157,21 +160,17 @@ Result<std::monostate, std::string> WebSocketService::connect(const std::string&
                 }
             }
             else {
-                // Binary message.
-                const auto& binaryData = std::get<rtc::binary>(data);
+                // Binary message. The envelope is parsed in place; payload views point into
+                // binaryData.
+                auto& binaryData = std::get<rtc::binary>(data);
                 LOG_DEBUG(Network, "Received binary ({} bytes)", binaryData.size());
 
-                // Convert to std::vector<std::byte>.
-                std::vector<std::byte> bytes(binaryData.size());
-                std::memcpy(bytes.data(), binaryData.data(), binaryData.size());
-
-                // Deserialize as MessageEnvelope (all messages use this wrapper now).
                 try {
-                    MessageEnvelope envelope = deserialize_envelope(bytes);
+                    const EnvelopeView envelope = parse_envelope(binaryData);
 
                     // Check if this is a server push (RenderMessage) or a command response.
-                    if (envelope.message_type == "RenderMessage") {
-                        // Server push - extract payload and route to binaryCallback_.
+                    if (envelope.type == kRenderMessageTypeId && !envelope.response) {
+                        // Server push - route the payload to binaryCallback_.
                         LOG_DEBUG(
                             Network,
                             "WebSocketService CLIENT: Received RenderMessage push ({} bytes "
@@ -181,14 +180,14 @@ Result<std::monostate, std::string> WebSocketService::connect(const std::string&
                             binaryCallback_(envelope.payload);
                         }
                     }
-                    else if (envelope.id > 0 && isResponseMessageType(envelope.message_type)) {
+                    else if (envelope.id > 0 && envelope.response) {
                         // Command response - route to pending request by correlation ID.
                         std::lock_guard<std::mutex> lock(pendingMutex_);
                         auto it = pendingRequests_.find(envelope.id);
                         if (it != pendingRequests_.end()) {
                             auto& pending = it->second;
                             std::lock_guard<std::mutex> reqLock(pending->mutex);
-                            pending->response = bytes;
+                            pending->response = std::move(binaryData);
                             pending->isBinary = true;
                             pending->received = true;
                             pending->cv.notify_one();
@@ -203,15 +202,19 @@ Result<std::monostate, std::string> WebSocketService::connect(const std::string&
                     }
                     else if (envelope.id == 0 && serverCommandCallback_) {
                         // Server-pushed command (no correlation ID).
+                        const std::string messageType = messageTypeName(envelope.type);
                         LOG_DEBUG(
                             Network,
                             "WebSocketService CLIENT: Received server command '{}'",
-                            envelope.message_type);
-                        serverCommandCallback_(envelope.message_type, envelope.payload);
+                            messageType);
+                        serverCommandCallback_(
+                            messageType,
+                            std::vector<std::byte>(
+                                envelope.payload.begin(), envelope.payload.end()));
                     }
                     else if (envelope.id > 0) {
                         // Server-initiated command - route to registered handler.
-                        auto it = commandHandlers_.find(envelope.message_type);
+                        auto it = commandHandlers_.find(envelope.type);
                         if (it != commandHandlers_.end()) {
                             it->second(envelope.payload, ws_, envelope.id);
                         }
@@ -219,7 +222,7 @@ Result<std::monostate, std::string> WebSocketService::connect(const std::string&
                             LOG_WARN(
                                 Network,
                                 "WebSocketService CLIENT: No handler for command '{}'",
-                                envelope.message_type);
+                                messageTypeName(envelope.type));
                         }
                     }
                 }
@@ -245,6 +248,7 @@ Result<std::monostate, std::string> WebSocketService::connect(const std::string&
         ws_->onClosed([this]() {
             LOG_DEBUG(Network, "Connection closed");
             connectionFailed_ = true;
+            failPendingRequests("Connection closed");
             if (disconnectedCallback_) {
                 disconnectedCallback_();
             }
@@ -301,13 +305,12 @@ void WebSocketService::sendClientHelloIfNeeded()
         return;
     }
 
-    const auto payload = serialize_payload(clientHello_);
-    MessageEnvelope hello{
-        .id = 0,
-        .message_type = kClientHelloMessageType,
-        .payload = payload,
-    };
-    auto helloResult = sendBinary(serialize_envelope(hello));
+    ClientHello hello = clientHello_;
+    hello.messageTypes = MessageTypeRegistry::entries();
+
+    std::vector<std::byte> bytes;
+    write_envelope(bytes, 0, kClientHelloMessageTypeId, 0, hello);
+    auto helloResult = sendBinary(bytes);
     if (helloResult.isError()) {
         LOG_WARN(Network, "Failed to send binary hello message: {}", helloResult.errorValue());
         helloSent_ = false;
@@ -325,6 +328,29 @@ void WebSocketService::disconnect()
         }
         ws_.reset();
     }
+    failPendingRequests("Disconnected");
+}
+
+void WebSocketService::failPendingRequests(const std::string& reason)
+{
+    std::vector<std::shared_ptr<PendingRequest>> pending;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        for (const auto& [id, request] : pendingRequests_) {
+            pending.push_back(request);
+        }
+    }
+
+    for (const auto& request : pending) {
+        {
+            std::lock_guard<std::mutex> lock(request->mutex);
+            if (request->received) {
+                continue;
+            }
+            request->failure = reason;
+        }
+        request->cv.notify_all();
+    }
 }
 
 bool WebSocketService::isConnected() const
@@ -438,8 +464,10 @@ Result<MessageEnvelope, std::string> WebSocketService::sendBinaryAndReceive(
 
     // Wait for response.
     std::unique_lock<std::mutex> reqLock(pending->mutex);
-    bool received = pending->cv.wait_for(
-        reqLock, std::chrono::milliseconds(timeoutMs), [&pending]() { return pending->received; });
+    bool received =
+        pending->cv.wait_for(reqLock, std::chrono::milliseconds(timeoutMs), [&pending]() {
+            return pending->received || pending->failure.has_value();
+        });
 
     // Clean up.
     {
@@ -450,6 +478,9 @@ Result<MessageEnvelope, std::string> WebSocketService::sendBinaryAndReceive(
     if (!received) {
         return Result<MessageEnvelope, std::string>::error("Response timeout");
     }
+    if (!pending->received) {
+        return Result<MessageEnvelope, std::string>::error(*pending->failure);
+    }
 
     // Parse response.
     if (!pending->isBinary) {
@@ -519,8 +550,10 @@ Result<std::string, ApiError> WebSocketService::sendJsonAndReceive(
 
     // Wait for response.
     std::unique_lock<std::mutex> reqLock(pending->mutex);
-    bool received = pending->cv.wait_for(
-        reqLock, std::chrono::milliseconds(timeoutMs), [&pending]() { return pending->received; });
+    bool received =
+        pending->cv.wait_for(reqLock, std::chrono::milliseconds(timeoutMs), [&pending]() {
+            return pending->received || pending->failure.has_value();
+        });
 
     // Clean up.
     {
@@ -531,6 +564,9 @@ Result<std::string, ApiError> WebSocketService::sendJsonAndReceive(
     if (!received) {
         return Result<std::string, ApiError>::error(ApiError{ "Response timeout" });
     }
+    if (!pending->received) {
+        return Result<std::string, ApiError>::error(ApiError{ *pending->failure });
+    }
 
     if (pending->isBinary) {
         return Result<std::string, ApiError>::error(
@@ -766,10 +802,21 @@ std::shared_ptr<rtc::WebSocket> WebSocketService::getClientByConnectionId(
     return nullptr;
 }
 
+bool WebSocketService::isLocalClient(const std::string& connectionId)
+{
+    const auto ws = getClientByConnectionId(connectionId);
+    if (!ws) {
+        return false;
+    }
+    const auto remoteAddress = ws->remoteAddress();
+    return remoteAddress.has_value()
+        && isLoopbackHost(extractHostFromRemoteAddress(remoteAddress.value()));
+}
+
 void WebSocketService::registerCommandHandler(std::string commandName, CommandHandler handler)
 {
     LOG_DEBUG(Network, "Registering command handler '{}'", commandName);
-    commandHandlers_[std::move(commandName)] = std::move(handler);
+    commandHandlers_[MessageTypeRegistry::registerName(commandName)] = std::move(handler);
 }
 
 std::string WebSocketService::getConnectionId(std::shared_ptr<rtc::WebSocket> ws)
@@ -1032,14 +1079,10 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
         clientProtocols_[ws] = Protocol::BINARY;
     }
 
-    // Convert to std::vector<std::byte>.
-    std::vector<std::byte> bytes(data.size());
-    std::memcpy(bytes.data(), data.data(), data.size());
-
-    // Deserialize envelope.
-    MessageEnvelope envelope;
+    // Parse in place; the payload view points into data.
+    EnvelopeView envelope;
     try {
-        envelope = deserialize_envelope(bytes);
+        envelope = parse_envelope(data);
     }
     catch (const std::exception& e) {
         LOG_ERROR(Network, "Failed to deserialize envelope: {}", e.what());
@@ -1048,18 +1091,19 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
 
     LOG_DEBUG(
         Network,
-        "Command '{}', id={}, payload={} bytes",
-        envelope.message_type,
+        "Command type={:08x}, id={}, response={}, payload={} bytes",
+        envelope.type,
         envelope.id,
+        envelope.response,
         envelope.payload.size());
 
-    if (envelope.id > 0 && isResponseMessageType(envelope.message_type)) {
+    if (envelope.id > 0 && envelope.response) {
         std::lock_guard<std::mutex> lock(pendingMutex_);
         auto it = pendingRequests_.find(envelope.id);
         if (it != pendingRequests_.end()) {
             auto& pending = it->second;
             std::lock_guard<std::mutex> reqLock(pending->mutex);
-            pending->response = bytes;
+            pending->response = std::vector<std::byte>(data.begin(), data.end());
             pending->isBinary = true;
             pending->received = true;
             pending->cv.notify_one();
@@ -1074,7 +1118,7 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
     }
 
     if (envelope.id == 0) {
-        if (envelope.message_type == kClientHelloMessageType) {
+        if (envelope.type == kClientHelloMessageTypeId) {
             ClientHello hello{};
             if (!envelope.payload.empty()) {
                 try {
@@ -1099,6 +1143,17 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
                 return;
             }
 
+            if (const auto conflict = findConflictingMessageType(hello.messageTypes)) {
+                LOG_WARN(
+                    Network,
+                    "ClientHello message type conflict: {:08x} is '{}' on the client, '{}' here",
+                    conflict->id,
+                    conflict->name,
+                    messageTypeName(conflict->id));
+                ws->close();
+                return;
+            }
+
             const bool isUiClient = isUiHello(hello);
             bool reject = false;
             {
@@ -1125,23 +1180,26 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
                 LOG_INFO(
                     Network,
                     "ClientHello accepted (mode={}, protocol_version={}, wants_render={}, "
-                    "wants_events={})",
+                    "wants_events={}, message_types={})",
                     isUiClient ? "ui" : "control-only",
                     hello.protocolVersion,
                     hello.wantsRender,
-                    hello.wantsEvents);
+                    hello.wantsEvents,
+                    hello.messageTypes.size());
             }
 
             return;
         }
-        LOG_WARN(Network, "Ignoring client push '{}'", envelope.message_type);
+        LOG_WARN(
+            Network, "Ignoring client push '{}'", describeClientMessageType(ws, envelope.type));
         return;
     }
 
     // Look up handler.
-    auto it = commandHandlers_.find(envelope.message_type);
+    auto it = commandHandlers_.find(envelope.type);
     if (it == commandHandlers_.end()) {
-        LOG_WARN(Network, "No handler for command '{}'", envelope.message_type);
+        LOG_WARN(
+            Network, "No handler for command '{}'", describeClientMessageType(ws, envelope.type));
         // TODO: Send error response.
         return;
     }
@@ -1150,6 +1208,29 @@ void WebSocketService::onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const
     it->second(envelope.payload, ws, envelope.id);
 }
 
+std::string WebSocketService::describeClientMessageType(
+    const std::shared_ptr<rtc::WebSocket>& ws, MessageTypeId type) const
+{
+    if (auto name = MessageTypeRegistry::nameOf(type)) {
+        return std::move(name.value());
+    }
+
+    // Types this binary doesn't link in can still be named from the client's hello.
+    std::lock_guard<std::mutex> lock(clientsMutex_);
+    const auto helloIt = clientHellos_.find(ws);
+    if (helloIt != clientHellos_.end()) {
+        const auto& types = helloIt->second.messageTypes;
+        const auto it = std::lower_bound(
+            types.begin(), types.end(), type, [](const MessageTypeName& entry, MessageTypeId id) {
+                return entry.id < id;
+            });
+        if (it != types.end() && it->id == type) {
+            return it->name;
+        }
+    }
+    return messageTypeName(type);
+}
+
 void WebSocketService::onClientMessageJson(
     std::shared_ptr<rtc::WebSocket> ws, const std::string& jsonText)
 {
@@ -1222,7 +1303,7 @@ void WebSocketService::onClientMessageJson(
     auto invokeHandler =
         [this,
          ws](std::string commandName, std::vector<std::byte> payload, uint64_t correlationId) {
-            auto it = commandHandlers_.find(commandName);
+            auto it = commandHandlers_.find(messageTypeIdOf(commandName));
             if (it != commandHandlers_.end()) {
                 it->second(payload, ws, correlationId);
             }
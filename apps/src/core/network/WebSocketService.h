@@ -17,9 +17,12 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <rtc/rtc.hpp>
+#include <span>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <unordered_map>
 #include <variant>
 
 namespace DirtSim {
@@ -56,7 +59,7 @@ enum class Protocol {
 class WebSocketService : public WebSocketServiceInterface {
 public:
     using MessageCallback = std::function<void(const std::string&)>;
-    using BinaryCallback = std::function<void(const std::vector<std::byte>&)>;
+    using BinaryCallback = std::function<void(std::span<const std::byte>)>;
     using ConnectionCallback = std::function<void()>;
     using ErrorCallback = std::function<void(const std::string&)>;
     using ClientDisconnectCallback = std::function<void(const std::string& connectionId)>;
@@ -88,6 +91,13 @@ public:
 
     void disconnect() override;
 
+    /**
+     * @brief Wake every request still waiting for a response and fail it with the reason.
+     *
+     * Called when the connection closes; callers may also use it to abandon long requests.
+     */
+    void failPendingRequests(const std::string& reason);
+
     bool isConnected() const override;
 
     std::string getUrl() const override { return url_; }
@@ -116,8 +126,7 @@ public:
     template <typename CommandT>
     Result<std::monostate, std::string> sendCommand(const CommandT& cmd)
     {
-        auto envelope = make_command_envelope(0, cmd);
-        return sendBinaryToDefaultPeer(serialize_envelope(envelope));
+        return sendBinaryToDefaultPeer(serialize_command(0, cmd));
     }
 
     // =========================================================================
@@ -229,6 +238,8 @@ public:
         accessToken_.clear();
     }
 
+    bool isLocalClient(const std::string& connectionId) override;
+
     bool clientWantsEvents(const std::string& connectionId) const override;
     bool clientWantsRender(const std::string& connectionId) const override;
     void onConnected(ConnectionCallback callback) override { connectedCallback_ = callback; }
@@ -365,6 +376,7 @@ private:
         std::variant<std::string, std::vector<std::byte>> response;
         bool received = false;
         bool isBinary = false;
+        std::optional<std::string> failure; // Set when the request was abandoned unanswered.
         std::mutex mutex;
         std::condition_variable cv;
     };
@@ -386,7 +398,7 @@ private:
     // =========================================================================
 
     std::unique_ptr<rtc::WebSocketServer> server_;
-    std::map<std::string, CommandHandler> commandHandlers_;
+    std::unordered_map<MessageTypeId, CommandHandler> commandHandlers_;
     std::vector<std::shared_ptr<rtc::WebSocket>> connectedClients_;
     std::map<std::shared_ptr<rtc::WebSocket>, Protocol> clientProtocols_;
     std::map<std::shared_ptr<rtc::WebSocket>, RenderFormat::EnumType> clientRenderFormats_;
@@ -410,6 +422,10 @@ private:
     void onClientMessage(std::shared_ptr<rtc::WebSocket> ws, const rtc::binary& data);
     void onClientMessageJson(std::shared_ptr<rtc::WebSocket> ws, const std::string& jsonText);
 
+    // Name for a type received from ws, falling back to the table in its ClientHello.
+    std::string describeClientMessageType(
+        const std::shared_ptr<rtc::WebSocket>& ws, MessageTypeId type) const;
+
     // Instrumentation.
     Timers timers_;
 };
@@ -11,6 +11,7 @@
 #include <functional>
 #include <memory>
 #include <rtc/rtc.hpp>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -26,14 +27,15 @@ namespace Network {
 class WebSocketServiceInterface {
 public:
     using MessageCallback = std::function<void(const std::string&)>;
-    using BinaryCallback = std::function<void(const std::vector<std::byte>&)>;
+    // Payload views passed to these callbacks are only valid for the duration of the call.
+    using BinaryCallback = std::function<void(std::span<const std::byte>)>;
     using ConnectionCallback = std::function<void()>;
     using ErrorCallback = std::function<void(const std::string&)>;
     using ServerCommandCallback =
         std::function<void(const std::string& messageType, const std::vector<std::byte>& payload)>;
     using JsonDeserializer = std::function<std::any(const std::string&)>;
     using CommandHandler = std::function<void(
-        const std::vector<std::byte>& payload,
+        std::span<const std::byte> payload,
         std::shared_ptr<rtc::WebSocket> ws,
         uint64_t correlationId)>;
 
@@ -61,6 +63,9 @@ public:
     virtual void clearAccessToken() = 0;
     virtual void closeNonLocalClients() = 0;
 
+    // True when the client is connected over loopback.
+    virtual bool isLocalClient(const std::string& connectionId) = 0;
+
     virtual bool clientWantsEvents(const std::string& connectionId) const = 0;
     virtual bool clientWantsRender(const std::string& connectionId) const = 0;
 
@@ -94,11 +99,12 @@ public:
         using ResponseT = typename CwcType::Response;
 
         std::string cmdName(CommandT::name());
+        const MessageTypeId cmdTypeId = command_type_id<CommandT>();
 
         registerCommandHandler(
             cmdName,
-            [this, handler = std::move(handler), cmdName](
-                const std::vector<std::byte>& payload,
+            [this, handler = std::move(handler), cmdName, cmdTypeId](
+                std::span<const std::byte> payload,
                 std::shared_ptr<rtc::WebSocket> ws,
                 uint64_t correlationId) {
                 CommandT cmd{};
@@ -125,12 +131,10 @@ public:
                             }
                         }
                         else {
-                            auto envelope =
-                                make_response_envelope(correlationId, cmdName, response);
-                            const auto bytes = serialize_envelope(envelope);
-                            rtc::binary binaryMsg(bytes.begin(), bytes.end());
+                            rtc::binary binaryMsg =
+                                serialize_response(correlationId, cmdTypeId, response);
                             try {
-                                ws->send(binaryMsg);
+                                ws->send(std::move(binaryMsg));
                             }
                             catch (const std::exception&) {
                                 return;
@@ -148,7 +152,7 @@ public:
                     cwc.command.connectionId = getConnectionId(ws);
                 }
 
-                cwc.callback = [this, ws, correlationId, cmdName](ResponseT&& response) {
+                cwc.callback = [this, ws, correlationId, cmdTypeId](ResponseT&& response) {
                     if (isJsonClient(ws)) {
                         nlohmann::json jsonResponse = makeJsonResponse(correlationId, response);
                         const std::string jsonText = jsonResponse.dump();
@@ -163,14 +167,13 @@ public:
                         }
                     }
                     else {
-                        auto envelope = make_response_envelope(correlationId, cmdName, response);
-                        const auto bytes = serialize_envelope(envelope);
-                        rtc::binary binaryMsg(bytes.begin(), bytes.end());
                         if (!ws || !ws->isOpen()) {
                             return;
                         }
+                        rtc::binary binaryMsg =
+                            serialize_response(correlationId, cmdTypeId, response);
                         try {
-                            ws->send(binaryMsg);
+                            ws->send(std::move(binaryMsg));
                         }
                         catch (const std::exception&) {
                             return;
@@ -198,8 +201,7 @@ public:
     template <typename Command>
     Result<std::monostate, std::string> sendCommand(const Command& cmd)
     {
-        auto envelope = make_command_envelope(0, cmd);
-        return sendBinary(serialize_envelope(envelope));
+        return sendBinary(serialize_command(0, cmd));
     }
 
     template <typename Okay, typename Command>
@@ -128,6 +128,9 @@ protected:
  */
 class RandomDuckBrain : public DuckBrain {
 public:
+    RandomDuckBrain() = default;
+    explicit RandomDuckBrain(uint32_t seed) : rng_(seed) {}
+
     void think(Duck& duck, const DuckSensoryData& sensory, double deltaTime) override;
 
 private:
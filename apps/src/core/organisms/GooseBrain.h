@@ -2,6 +2,7 @@
 
 #include "core/Vector2d.h"
 #include "core/Vector2i.h"
+#include <cstdint>
 #include <random>
 
 namespace DirtSim {
@@ -61,6 +62,9 @@ protected:
  */
 class RandomGooseBrain : public GooseBrain {
 public:
+    RandomGooseBrain() = default;
+    explicit RandomGooseBrain(uint32_t seed) : rng_(seed) {}
+
     void think(Goose& goose, const GooseSensoryData& sensory, double deltaTime) override;
 
 private:
@@ -215,9 +215,9 @@ OrganismId OrganismManager::createDuck(
 
     OrganismId id = next_id_++;
 
-    // Use default brain if none provided.
+    // Use default brain if none provided, seeded from the world so seeded runs replay.
     if (!brain) {
-        brain = std::make_unique<RandomDuckBrain>();
+        brain = std::make_unique<RandomDuckBrain>((*world.rng_)());
     }
 
     auto duck = std::make_unique<Duck>(id, std::move(brain));
@@ -243,9 +243,9 @@ OrganismId OrganismManager::createGoose(
 {
     OrganismId id = next_id_++;
 
-    // Use default brain if none provided.
+    // Use default brain if none provided, seeded from the world so seeded runs replay.
     if (!brain) {
-        brain = std::make_unique<RandomGooseBrain>();
+        brain = std::make_unique<RandomGooseBrain>((*world.rng_)());
     }
 
     auto goose = std::make_unique<Goose>(id, std::move(brain));
@@ -5,12 +5,133 @@
 #include "core/water/WaterVolumeView.h"
 
 #include <algorithm>
+#include <bit>
+#include <vector>
 
 namespace DirtSim {
 namespace SensoryUtils {
 
 namespace {
 
+constexpr double MATERIAL_THRESHOLD = 0.5;
+constexpr double EMPTY_THRESHOLD = 0.1;
+
+// One bit per grid column; bit c of rows[r] describes grid cell (c, r).
+template <int GridSize>
+using RowBitboard = std::array<uint32_t, GridSize>;
+
+/**
+ * Per-cell template predicates of a sensory grid, packed into row bitboards.
+ */
+template <int GridSize, int NumMaterials>
+struct SensoryBitboards {
+    std::array<RowBitboard<GridSize>, NumMaterials> material{}; // Fill >= MATERIAL_THRESHOLD.
+    RowBitboard<GridSize> empty{};                              // Total fill < EMPTY_THRESHOLD.
+    RowBitboard<GridSize> solid{};  // Dominant material is present and not fluid.
+    RowBitboard<GridSize> liquid{}; // Dominant material is present and fluid.
+};
+
+template <int GridSize, int NumMaterials, typename HistogramValueType>
+SensoryBitboards<GridSize, NumMaterials> buildSensoryBitboards(
+    const std::array<std::array<std::array<HistogramValueType, NumMaterials>, GridSize>, GridSize>&
+        histograms)
+{
+    static_assert(GridSize <= 32, "Sensory bitboards hold one grid row per 32-bit word");
+
+    SensoryBitboards<GridSize, NumMaterials> boards;
+    for (int row = 0; row < GridSize; ++row) {
+        for (int col = 0; col < GridSize; ++col) {
+            const auto& cell_histogram = histograms[row][col];
+            const uint32_t bit = 1u << col;
+
+            double total_fill = 0.0;
+            double max_fill = 0.0;
+            Material::EnumType dominant = Material::EnumType::Air;
+            for (int m = 0; m < NumMaterials; ++m) {
+                total_fill += cell_histogram[m];
+                if (cell_histogram[m] >= MATERIAL_THRESHOLD) {
+                    boards.material[m][row] |= bit;
+                }
+                if (cell_histogram[m] > max_fill) {
+                    max_fill = cell_histogram[m];
+                    dominant = static_cast<Material::EnumType>(m);
+                }
+            }
+
+            if (total_fill < EMPTY_THRESHOLD) {
+                boards.empty[row] |= bit;
+            }
+            if (max_fill >= MATERIAL_THRESHOLD) {
+                if (Material::getProperties(dominant).is_fluid) {
+                    boards.liquid[row] |= bit;
+                }
+                else {
+                    boards.solid[row] |= bit;
+                }
+            }
+        }
+    }
+    return boards;
+}
+
+/**
+ * One non-wildcard template cell, compiled to the bitboard it tests.
+ */
+template <int GridSize>
+struct CompiledCellPattern {
+    RowBitboard<GridSize> board{};
+    bool negate = false; // Cell must be clear in board rather than set.
+    int tx = 0;
+    int ty = 0;
+};
+
+template <int GridSize, int NumMaterials>
+std::vector<CompiledCellPattern<GridSize>> compileTemplate(
+    const SensoryTemplate& template_pattern, const SensoryBitboards<GridSize, NumMaterials>& boards)
+{
+    std::vector<CompiledCellPattern<GridSize>> compiled;
+    for (int ty = 0; ty < template_pattern.height; ++ty) {
+        for (int tx = 0; tx < template_pattern.width; ++tx) {
+            const CellPattern& cell_pattern = template_pattern.pattern[ty][tx];
+            CompiledCellPattern<GridSize> cell{ .tx = tx, .ty = ty };
+
+            switch (cell_pattern.mode) {
+                case MatchMode::Any:
+                    continue;
+                case MatchMode::IsEmpty:
+                    cell.board = boards.empty;
+                    break;
+                case MatchMode::IsNotEmpty:
+                    cell.board = boards.empty;
+                    cell.negate = true;
+                    break;
+                case MatchMode::IsSolid:
+                    cell.board = boards.solid;
+                    break;
+                case MatchMode::IsLiquid:
+                    cell.board = boards.liquid;
+                    break;
+                case MatchMode::Is:
+                case MatchMode::IsNot:
+                    // Union of the listed materials' planes; Is needs any, IsNot needs none.
+                    for (Material::EnumType mat : cell_pattern.materials) {
+                        const int mat_idx = static_cast<int>(mat);
+                        if (mat_idx < 0 || mat_idx >= NumMaterials) {
+                            continue;
+                        }
+                        for (int row = 0; row < GridSize; ++row) {
+                            cell.board[row] |= boards.material[mat_idx][row];
+                        }
+                    }
+                    cell.negate = cell_pattern.mode == MatchMode::IsNot;
+                    break;
+            }
+            compiled.push_back(cell);
+        }
+    }
+    return compiled;
+}
+
 bool tryGetUsableWaterVolumeView(
     const World& world, const WorldData& data, WaterVolumeView& waterView)
 {
@@ -48,13 +169,31 @@ TemplateMatch findTemplate(
         histograms,
     const SensoryTemplate& template_pattern)
 {
-    for (int row = 0; row <= GridSize - template_pattern.height; ++row) {
-        for (int col = 0; col <= GridSize - template_pattern.width; ++col) {
-            if (matchesTemplate<GridSize, NumMaterials, HistogramValueType>(
-                    histograms, template_pattern, col, row)) {
-                return TemplateMatch{ .found = true, .col = col, .row = row };
+    const int col_positions = GridSize - template_pattern.width + 1;
+    const int row_positions = GridSize - template_pattern.height + 1;
+    if (col_positions <= 0 || row_positions <= 0) {
+        return TemplateMatch{ .found = false };
+    }
+
+    // Test every column position of a row at once: bit c of `candidates` survives only if
+    // the template placed at column c satisfies each compiled cell.
+    const auto boards = buildSensoryBitboards<GridSize, NumMaterials>(histograms);
+    const auto compiled = compileTemplate<GridSize, NumMaterials>(template_pattern, boards);
+    const uint32_t all_columns =
+        col_positions >= 32 ? ~0u : (1u << static_cast<uint32_t>(col_positions)) - 1u;
+
+    for (int row = 0; row < row_positions; ++row) {
+        uint32_t candidates = all_columns;
+        for (const auto& cell : compiled) {
+            const uint32_t bits = cell.board[row + cell.ty] >> cell.tx;
+            candidates &= cell.negate ? ~bits : bits;
+            if (candidates == 0) {
+                break;
             }
         }
+        if (candidates != 0) {
+            return TemplateMatch{ .found = true, .col = std::countr_zero(candidates), .row = row };
+        }
     }
     return TemplateMatch{ .found = false };
 }
@@ -67,9 +206,6 @@ bool matchesTemplate(
     int start_col,
     int start_row)
 {
-    constexpr double MATERIAL_THRESHOLD = 0.5;
-    constexpr double EMPTY_THRESHOLD = 0.1;
-
     // Check each cell in the template pattern.
     for (int ty = 0; ty < template_pattern.height; ++ty) {
         for (int tx = 0; tx < template_pattern.width; ++tx) {
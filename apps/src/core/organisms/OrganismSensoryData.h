@@ -70,7 +70,9 @@ struct TemplateMatch {
 /**
  * Find a template in the sensory grid.
  *
- * Scans the entire sensory grid for the pattern and returns the first match.
+ * Scans the entire sensory grid for the pattern and returns the first match in
+ * row-major order. Cell predicates are packed into per-row bitboards and the pattern is
+ * compiled against them, so each row position tests every column at once.
  *
  * @param histograms The sensory material histograms.
  * @param template_pattern The pattern to find.
@@ -8,6 +8,7 @@
 #include "core/ColorNames.h"
 #include "core/LightBuffer.h"
 #include "core/LoggingChannels.h"
+#include "core/MaterialSummedAreaTable.h"
 #include "core/MaterialType.h"
 #include "core/ScopeTimer.h"
 #include "core/World.h"
@@ -668,6 +669,15 @@ TreeSensoryData Tree::gatherSensoryData(const World& world) const
             static_cast<double>(data.actual_height) / TreeSensoryData::GRID_SIZE);
     }
 
+    // Downsampled windows sum whole regions per bin, so they can use box sums from the shared
+    // per-frame area table when enough trees query it to repay its rebuild. A 1:1 window
+    // reads one cell per bin, which is cheaper directly.
+    const MaterialSummedAreaTable* areaTable = data.scale_factor > 1.0
+        ? world.getMaterialSummedAreaTableFor(
+              static_cast<int64_t>(data.actual_width) * data.actual_height)
+        : nullptr;
+    static_assert(TreeSensoryData::NUM_MATERIALS <= MaterialSummedAreaTable::kMaterialCount);
+
     // Populate material histograms by sampling world grid.
     for (int ny = 0; ny < TreeSensoryData::GRID_SIZE; ny++) {
         for (int nx = 0; nx < TreeSensoryData::GRID_SIZE; nx++) {
@@ -696,18 +706,40 @@ TreeSensoryData Tree::gatherSensoryData(const World& world) const
             double light_sum = 0.0;
             int light_cells = 0;
 
-            for (int wy = wy_start; wy < wy_end; wy++) {
-                for (int wx = wx_start; wx < wx_end; wx++) {
-                    const auto& cell = worldData.at(wx, wy);
-                    int mat_idx = static_cast<int>(cell.material_type);
-                    if (mat_idx >= 0 && mat_idx < TreeSensoryData::NUM_MATERIALS) {
-                        counts[mat_idx]++;
-                        total_cells++;
+            if (areaTable) {
+                const auto boxCounts =
+                    areaTable->materialCounts(wx_start, wy_start, wx_end, wy_end);
+                for (int i = 0; i < TreeSensoryData::NUM_MATERIALS; i++) {
+                    counts[i] = boxCounts[i];
+                    total_cells += boxCounts[i];
+                }
+                if (use_light && areaTable->hasLight()) {
+                    light_sum = areaTable->lightSum(wx_start, wy_start, wx_end, wy_end);
+                    light_cells = std::max(0, wx_end - wx_start) * std::max(0, wy_end - wy_start);
+                }
+                else if (use_light) {
+                    for (int wy = wy_start; wy < wy_end; wy++) {
+                        for (int wx = wx_start; wx < wx_end; wx++) {
+                            light_sum += ColorNames::brightness(light.at(wx, wy));
+                            light_cells++;
+                        }
                     }
+                }
+            }
+            else {
+                for (int wy = wy_start; wy < wy_end; wy++) {
+                    for (int wx = wx_start; wx < wx_end; wx++) {
+                        const auto& cell = worldData.at(wx, wy);
+                        int mat_idx = static_cast<int>(cell.material_type);
+                        if (mat_idx >= 0 && mat_idx < TreeSensoryData::NUM_MATERIALS) {
+                            counts[mat_idx]++;
+                            total_cells++;
+                        }
 
-                    if (use_light) {
-                        light_sum += ColorNames::brightness(light.at(wx, wy));
-                        light_cells++;
+                        if (use_light) {
+                            light_sum += ColorNames::brightness(light.at(wx, wy));
+                            light_cells++;
+                        }
                     }
                 }
             }
@@ -1,5 +1,6 @@
 #include "DuckNeuralNetRecurrentBrainV2.h"
 
+#include "WeightQuantization.h"
 #include "WeightType.h"
 #include "core/Assert.h"
 #include "core/organisms/Duck.h"
@@ -104,6 +105,13 @@ struct DuckNeuralNetRecurrentBrainV2::Impl {
     std::vector<WeightType> h2_state;
     std::vector<WeightType> output_buffer;
 
+    InferencePrecision precision = InferencePrecision::Float32;
+    Int8Matrix q_xh1;
+    Int8Matrix q_h1h1;
+    Int8Matrix q_h1h2;
+    Int8Matrix q_h2h2;
+    Int8Matrix q_h2o;
+
     Impl()
         : w_xh1(W_XH1_SIZE, 0.0f),
           w_h1h1(W_H1H1_SIZE, 0.0f),
@@ -175,6 +183,25 @@ struct DuckNeuralNetRecurrentBrainV2::Impl {
 
         std::fill(h1_state.begin(), h1_state.end(), 0.0f);
         std::fill(h2_state.begin(), h2_state.end(), 0.0f);
+        quantizeWeights();
+    }
+
+    void quantizeWeights()
+    {
+        if (precision != InferencePrecision::Int8) {
+            q_xh1 = Int8Matrix{};
+            q_h1h1 = Int8Matrix{};
+            q_h1h2 = Int8Matrix{};
+            q_h2h2 = Int8Matrix{};
+            q_h2o = Int8Matrix{};
+            return;
+        }
+
+        q_xh1 = Int8Matrix::quantize(w_xh1, INPUT_SIZE, H1_SIZE);
+        q_h1h1 = Int8Matrix::quantize(w_h1h1, H1_SIZE, H1_SIZE);
+        q_h1h2 = Int8Matrix::quantize(w_h1h2, H1_SIZE, H2_SIZE);
+        q_h2h2 = Int8Matrix::quantize(w_h2h2, H2_SIZE, H2_SIZE);
+        q_h2o = Int8Matrix::quantize(w_h2o, H2_SIZE, OUTPUT_SIZE);
     }
 
     Genome toGenome() const
@@ -257,25 +284,31 @@ struct DuckNeuralNetRecurrentBrainV2::Impl {
     const std::vector<WeightType>& forward(const std::vector<WeightType>& input)
     {
         std::copy(b_h1.begin(), b_h1.end(), h1_buffer.begin());
-        for (int i = 0; i < INPUT_SIZE; ++i) {
-            const WeightType inputValue = input[i];
-            if (inputValue == 0.0f) {
-                continue;
-            }
-            const WeightType* weights = &w_xh1[i * H1_SIZE];
-            for (int h = 0; h < H1_SIZE; ++h) {
-                h1_buffer[h] += inputValue * weights[h];
-            }
+        if (precision == InferencePrecision::Int8) {
+            accumulateInt8RowProducts(q_xh1, input, h1_buffer);
+            accumulateInt8RowProducts(q_h1h1, h1_state, h1_buffer);
         }
-
-        for (int i = 0; i < H1_SIZE; ++i) {
-            const WeightType recurrentValue = h1_state[i];
-            if (recurrentValue == 0.0f) {
-                continue;
+        else {
+            for (int i = 0; i < INPUT_SIZE; ++i) {
+                const WeightType inputValue = input[i];
+                if (inputValue == 0.0f) {
+                    continue;
+                }
+                const WeightType* weights = &w_xh1[i * H1_SIZE];
+                for (int h = 0; h < H1_SIZE; ++h) {
+                    h1_buffer[h] += inputValue * weights[h];
+                }
             }
-            const WeightType* weights = &w_h1h1[i * H1_SIZE];
-            for (int h = 0; h < H1_SIZE; ++h) {
-                h1_buffer[h] += recurrentValue * weights[h];
+
+            for (int i = 0; i < H1_SIZE; ++i) {
+                const WeightType recurrentValue = h1_state[i];
+                if (recurrentValue == 0.0f) {
+                    continue;
+                }
+                const WeightType* weights = &w_h1h1[i * H1_SIZE];
+                for (int h = 0; h < H1_SIZE; ++h) {
+                    h1_buffer[h] += recurrentValue * weights[h];
+                }
             }
         }
 
@@ -293,25 +326,31 @@ struct DuckNeuralNetRecurrentBrainV2::Impl {
         }
 
         std::copy(b_h2.begin(), b_h2.end(), h2_buffer.begin());
-        for (int i = 0; i < H1_SIZE; ++i) {
-            const WeightType inputValue = h1_state[i];
-            if (inputValue == 0.0f) {
-                continue;
-            }
-            const WeightType* weights = &w_h1h2[i * H2_SIZE];
-            for (int h = 0; h < H2_SIZE; ++h) {
-                h2_buffer[h] += inputValue * weights[h];
-            }
+        if (precision == InferencePrecision::Int8) {
+            accumulateInt8RowProducts(q_h1h2, h1_state, h2_buffer);
+            accumulateInt8RowProducts(q_h2h2, h2_state, h2_buffer);
         }
-
-        for (int i = 0; i < H2_SIZE; ++i) {
-            const WeightType recurrentValue = h2_state[i];
-            if (recurrentValue == 0.0f) {
-                continue;
+        else {
+            for (int i = 0; i < H1_SIZE; ++i) {
+                const WeightType inputValue = h1_state[i];
+                if (inputValue == 0.0f) {
+                    continue;
+                }
+                const WeightType* weights = &w_h1h2[i * H2_SIZE];
+                for (int h = 0; h < H2_SIZE; ++h) {
+                    h2_buffer[h] += inputValue * weights[h];
+                }
             }
-            const WeightType* weights = &w_h2h2[i * H2_SIZE];
-            for (int h = 0; h < H2_SIZE; ++h) {
-                h2_buffer[h] += recurrentValue * weights[h];
+
+            for (int i = 0; i < H2_SIZE; ++i) {
+                const WeightType recurrentValue = h2_state[i];
+                if (recurrentValue == 0.0f) {
+                    continue;
+                }
+                const WeightType* weights = &w_h2h2[i * H2_SIZE];
+                for (int h = 0; h < H2_SIZE; ++h) {
+                    h2_buffer[h] += recurrentValue * weights[h];
+                }
             }
         }
 
@@ -329,6 +368,10 @@ struct DuckNeuralNetRecurrentBrainV2::Impl {
         }
 
         std::copy(b_o.begin(), b_o.end(), output_buffer.begin());
+        if (precision == InferencePrecision::Int8) {
+            accumulateInt8RowProducts(q_h2o, h2_state, output_buffer);
+            return output_buffer;
+        }
         for (int h = 0; h < H2_SIZE; ++h) {
             const WeightType hiddenValue = h2_state[h];
             const WeightType* weights = &w_h2o[h * OUTPUT_SIZE];
@@ -433,6 +476,20 @@ void DuckNeuralNetRecurrentBrainV2::setGenome(const Genome& genome)
     impl_->loadFromGenome(genome);
 }
 
+InferencePrecision DuckNeuralNetRecurrentBrainV2::getInferencePrecision() const
+{
+    return impl_->precision;
+}
+
+void DuckNeuralNetRecurrentBrainV2::setInferencePrecision(InferencePrecision precision)
+{
+    if (impl_->precision == precision) {
+        return;
+    }
+    impl_->precision = precision;
+    impl_->quantizeWeights();
+}
+
 Genome DuckNeuralNetRecurrentBrainV2::randomGenome(std::mt19937& rng)
 {
     Genome genome(static_cast<size_t>(TOTAL_WEIGHTS));
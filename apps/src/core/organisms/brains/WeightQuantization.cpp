@@ -0,0 +1,381 @@
+#include "WeightQuantization.h"
+
+#include "core/Assert.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace DirtSim {
+
+namespace {
+
+constexpr std::array<uint8_t, 4> kBlobMagic{ 'D', 'S', 'Q', 'W' };
+constexpr uint8_t kBlobVersion = 1;
+constexpr size_t kBlobHeaderSize = 12;
+constexpr size_t kBlobSegmentHeaderSize = 8;
+constexpr int kInt8MaxMagnitude = 127;
+
+struct SegmentHeader {
+    uint32_t size = 0;
+    float scale = 0.0f;
+};
+
+size_t bytesPerValue(WeightEncoding encoding)
+{
+    switch (encoding) {
+        case WeightEncoding::Float32:
+            return sizeof(float);
+        case WeightEncoding::Float16:
+            return sizeof(uint16_t);
+        case WeightEncoding::Int8:
+            return sizeof(int8_t);
+    }
+    DIRTSIM_ASSERT(false, "WeightQuantization: Unknown weight encoding");
+    return 0;
+}
+
+// Falls back to a single segment when the layout does not describe this genome.
+std::vector<uint32_t> resolveSegmentSizes(const Genome& genome, const GenomeLayout& layout)
+{
+    std::vector<uint32_t> sizes;
+    if (!layout.segments.empty()
+        && static_cast<size_t>(layout.totalSize()) == genome.weights.size()) {
+        sizes.reserve(layout.segments.size());
+        for (const auto& segment : layout.segments) {
+            sizes.push_back(static_cast<uint32_t>(segment.size));
+        }
+        return sizes;
+    }
+
+    sizes.push_back(static_cast<uint32_t>(genome.weights.size()));
+    return sizes;
+}
+
+float maxAbs(std::span<const WeightType> values)
+{
+    float result = 0.0f;
+    for (const WeightType value : values) {
+        if (std::isfinite(value)) {
+            result = std::max(result, std::abs(static_cast<float>(value)));
+        }
+    }
+    return result;
+}
+
+int8_t quantizeInt8(WeightType value, float inverseScale)
+{
+    if (!std::isfinite(value)) {
+        return 0;
+    }
+    const float scaled = std::round(static_cast<float>(value) * inverseScale);
+    return static_cast<int8_t>(std::clamp(
+        scaled, -static_cast<float>(kInt8MaxMagnitude), static_cast<float>(kInt8MaxMagnitude)));
+}
+
+template <typename T>
+void appendBytes(std::vector<uint8_t>& blob, const T& value)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    blob.insert(blob.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T readBytes(std::span<const uint8_t> blob, size_t offset)
+{
+    T value{};
+    std::memcpy(&value, blob.data() + offset, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+std::optional<WeightEncoding> parseWeightEncoding(const std::string& name)
+{
+    if (name == "float32") return WeightEncoding::Float32;
+    if (name == "fp16" || name == "float16") return WeightEncoding::Float16;
+    if (name == "int8") return WeightEncoding::Int8;
+    return std::nullopt;
+}
+
+const char* toString(WeightEncoding encoding)
+{
+    switch (encoding) {
+        case WeightEncoding::Float32:
+            return "float32";
+        case WeightEncoding::Float16:
+            return "fp16";
+        case WeightEncoding::Int8:
+            return "int8";
+    }
+    DIRTSIM_ASSERT(false, "WeightQuantization: Unknown weight encoding");
+    return "";
+}
+
+std::vector<uint8_t> encodeGenomeWeights(
+    const Genome& genome, const GenomeLayout& layout, WeightEncoding encoding)
+{
+    const std::vector<uint32_t> segmentSizes = resolveSegmentSizes(genome, layout);
+
+    std::vector<uint8_t> blob;
+    blob.reserve(
+        kBlobHeaderSize + segmentSizes.size() * kBlobSegmentHeaderSize
+        + genome.weights.size() * bytesPerValue(encoding));
+    blob.insert(blob.end(), kBlobMagic.begin(), kBlobMagic.end());
+    blob.push_back(kBlobVersion);
+    blob.push_back(static_cast<uint8_t>(encoding));
+    blob.push_back(0);
+    blob.push_back(0);
+    appendBytes(blob, static_cast<uint32_t>(segmentSizes.size()));
+
+    std::vector<SegmentHeader> segments;
+    segments.reserve(segmentSizes.size());
+    size_t offset = 0;
+    for (const uint32_t size : segmentSizes) {
+        const std::span<const WeightType> values(genome.weights.data() + offset, size);
+        const float scale = encoding == WeightEncoding::Int8
+            ? maxAbs(values) / static_cast<float>(kInt8MaxMagnitude)
+            : 1.0f;
+        segments.push_back(SegmentHeader{ .size = size, .scale = scale });
+        appendBytes(blob, size);
+        appendBytes(blob, scale);
+        offset += size;
+    }
+
+    offset = 0;
+    for (const auto& segment : segments) {
+        const std::span<const WeightType> values(genome.weights.data() + offset, segment.size);
+        switch (encoding) {
+            case WeightEncoding::Float32:
+                for (const WeightType value : values) {
+                    appendBytes(blob, static_cast<float>(value));
+                }
+                break;
+            case WeightEncoding::Float16:
+                for (const WeightType value : values) {
+                    appendBytes(blob, floatToHalf(static_cast<float>(value)));
+                }
+                break;
+            case WeightEncoding::Int8: {
+                const float inverseScale = segment.scale > 0.0f ? 1.0f / segment.scale : 0.0f;
+                for (const WeightType value : values) {
+                    blob.push_back(static_cast<uint8_t>(quantizeInt8(value, inverseScale)));
+                }
+                break;
+            }
+        }
+        offset += segment.size;
+    }
+
+    return blob;
+}
+
+std::optional<Genome> decodeGenomeWeights(std::span<const uint8_t> blob)
+{
+    if (blob.size() < kBlobHeaderSize
+        || !std::equal(kBlobMagic.begin(), kBlobMagic.end(), blob.begin())
+        || blob[4] != kBlobVersion) {
+        return std::nullopt;
+    }
+
+    const uint8_t encodingByte = blob[5];
+    if (encodingByte > static_cast<uint8_t>(WeightEncoding::Int8)) {
+        return std::nullopt;
+    }
+    const auto encoding = static_cast<WeightEncoding>(encodingByte);
+    const uint32_t segmentCount = readBytes<uint32_t>(blob, 8);
+
+    size_t offset = kBlobHeaderSize;
+    if (blob.size() < offset + static_cast<size_t>(segmentCount) * kBlobSegmentHeaderSize) {
+        return std::nullopt;
+    }
+
+    std::vector<SegmentHeader> segments;
+    segments.reserve(segmentCount);
+    size_t totalSize = 0;
+    for (uint32_t i = 0; i < segmentCount; ++i) {
+        segments.push_back(
+            SegmentHeader{
+                .size = readBytes<uint32_t>(blob, offset),
+                .scale = readBytes<float>(blob, offset + sizeof(uint32_t)),
+            });
+        totalSize += segments.back().size;
+        offset += kBlobSegmentHeaderSize;
+    }
+
+    if (blob.size() != offset + totalSize * bytesPerValue(encoding)) {
+        return std::nullopt;
+    }
+
+    Genome genome(totalSize);
+    size_t weightIndex = 0;
+    for (const auto& segment : segments) {
+        for (uint32_t i = 0; i < segment.size; ++i) {
+            switch (encoding) {
+                case WeightEncoding::Float32:
+                    genome.weights[weightIndex] = readBytes<float>(blob, offset);
+                    break;
+                case WeightEncoding::Float16:
+                    genome.weights[weightIndex] = halfToFloat(readBytes<uint16_t>(blob, offset));
+                    break;
+                case WeightEncoding::Int8:
+                    genome.weights[weightIndex] =
+                        static_cast<float>(static_cast<int8_t>(blob[offset])) * segment.scale;
+                    break;
+            }
+            offset += bytesPerValue(encoding);
+            weightIndex++;
+        }
+    }
+
+    return genome;
+}
+
+Genome roundTripGenomeWeights(
+    const Genome& genome, const GenomeLayout& layout, WeightEncoding encoding)
+{
+    if (encoding == WeightEncoding::Float32) {
+        return genome;
+    }
+
+    auto decoded = decodeGenomeWeights(encodeGenomeWeights(genome, layout, encoding));
+    DIRTSIM_ASSERT(decoded.has_value(), "WeightQuantization: Round trip failed to decode");
+    return std::move(decoded.value());
+}
+
+uint16_t floatToHalf(float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t floatExponent = (bits >> 23) & 0xffu;
+    uint32_t mantissa = bits & 0x7fffffu;
+
+    if (floatExponent == 0xffu) {
+        return static_cast<uint16_t>(sign | 0x7c00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+
+    const int32_t exponent = static_cast<int32_t>(floatExponent) - 127 + 15;
+    if (exponent >= 0x1f) {
+        return static_cast<uint16_t>(sign | 0x7c00u);
+    }
+
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u) != 0)) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // Rounding may carry into the exponent, which correctly rounds up to the next binade or Inf.
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0)) {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float halfToFloat(uint16_t value)
+{
+    const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1fu;
+    uint32_t mantissa = value & 0x3ffu;
+
+    uint32_t bits = 0;
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        }
+        else {
+            int32_t shift = -1;
+            do {
+                shift++;
+                mantissa <<= 1;
+            } while ((mantissa & 0x400u) == 0);
+            bits = sign | (static_cast<uint32_t>(127 - 15 - shift) << 23)
+                | ((mantissa & 0x3ffu) << 13);
+        }
+    }
+    else if (exponent == 0x1f) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float result = 0.0f;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+Int8Matrix Int8Matrix::quantize(std::span<const WeightType> weights, int rows, int columns)
+{
+    DIRTSIM_ASSERT(
+        weights.size() == static_cast<size_t>(rows) * static_cast<size_t>(columns),
+        "Int8Matrix: Weight count does not match matrix shape");
+
+    Int8Matrix matrix;
+    matrix.rows = rows;
+    matrix.columns = columns;
+    matrix.scale = maxAbs(weights) / static_cast<float>(kInt8MaxMagnitude);
+    matrix.values.resize(weights.size());
+
+    const float inverseScale = matrix.scale > 0.0f ? 1.0f / matrix.scale : 0.0f;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        matrix.values[i] = quantizeInt8(weights[i], inverseScale);
+    }
+    return matrix;
+}
+
+void accumulateInt8RowProducts(
+    const Int8Matrix& matrix, std::span<const WeightType> input, std::span<WeightType> output)
+{
+    DIRTSIM_ASSERT(
+        input.size() >= static_cast<size_t>(matrix.rows), "Int8Matrix: Input smaller than rows");
+    DIRTSIM_ASSERT(
+        output.size() >= static_cast<size_t>(matrix.columns),
+        "Int8Matrix: Output smaller than columns");
+
+    const int columns = matrix.columns;
+    WeightType* out = output.data();
+    for (int r = 0; r < matrix.rows; ++r) {
+        const WeightType inputValue = input[r];
+        if (inputValue == 0.0f) {
+            continue;
+        }
+
+        const float scaledInput = static_cast<float>(inputValue) * matrix.scale;
+        const int8_t* row = &matrix.values[static_cast<size_t>(r) * columns];
+        int c = 0;
+#if defined(__ARM_NEON)
+        const float32x4_t scaled = vdupq_n_f32(scaledInput);
+        for (; c + 8 <= columns; c += 8) {
+            const int16x8_t wide = vmovl_s8(vld1_s8(row + c));
+            const float32x4_t low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(wide)));
+            const float32x4_t high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(wide)));
+            vst1q_f32(out + c, vmlaq_f32(vld1q_f32(out + c), scaled, low));
+            vst1q_f32(out + c + 4, vmlaq_f32(vld1q_f32(out + c + 4), scaled, high));
+        }
+#endif
+        for (; c < columns; ++c) {
+            out[c] += scaledInput * static_cast<float>(row[c]);
+        }
+    }
+}
+
+} // namespace DirtSim
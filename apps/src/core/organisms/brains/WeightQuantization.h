@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Genome.h"
+#include "WeightType.h"
+#include "core/organisms/evolution/GenomeLayout.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace DirtSim {
+
+/**
+ * Compact weight encodings for genome storage and inference.
+ *
+ * Genomes stay float for mutation. Encoded blobs scale each GenomeLayout
+ * segment independently (symmetric max-abs scaling for Int8), so small bias
+ * and gate segments keep their own resolution next to large input matrices.
+ * Blobs are self-describing: a header carries the encoding and per-segment
+ * sizes and scales, followed by the packed values.
+ */
+enum class WeightEncoding : uint8_t {
+    Float32 = 0,
+    Float16 = 1,
+    Int8 = 2,
+};
+
+enum class InferencePrecision : uint8_t {
+    Float32 = 0,
+    Int8 = 1,
+};
+
+std::optional<WeightEncoding> parseWeightEncoding(const std::string& name);
+const char* toString(WeightEncoding encoding);
+
+std::vector<uint8_t> encodeGenomeWeights(
+    const Genome& genome, const GenomeLayout& layout, WeightEncoding encoding);
+std::optional<Genome> decodeGenomeWeights(std::span<const uint8_t> blob);
+
+// Applies the encoding's rounding so in-memory genomes match what persistence returns.
+Genome roundTripGenomeWeights(
+    const Genome& genome, const GenomeLayout& layout, WeightEncoding encoding);
+
+uint16_t floatToHalf(float value);
+float halfToFloat(uint16_t value);
+
+/**
+ * Row-major int8 weight matrix with one scale for the whole layer.
+ */
+struct Int8Matrix {
+    std::vector<int8_t> values;
+    float scale = 0.0f;
+    int rows = 0;
+    int columns = 0;
+
+    static Int8Matrix quantize(std::span<const WeightType> weights, int rows, int columns);
+};
+
+// output[c] += sum_r input[r] * matrix[r][c], skipping zero inputs like the float kernels do.
+void accumulateInt8RowProducts(
+    const Int8Matrix& matrix, std::span<const WeightType> input, std::span<WeightType> output);
+
+} // namespace DirtSim
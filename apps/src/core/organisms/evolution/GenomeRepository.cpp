@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
@@ -23,6 +24,9 @@ constexpr int SCHEMA_VERSION = 1;
 namespace {
 constexpr size_t kRobustFitnessSampleWindow = 7;
 
+// Float32 rows are persisted from the genome directly.
+const std::vector<uint8_t> kNoEncodedBlob;
+
 struct ManagedGenomeBucketKey {
     int organismType = -1;
     std::string brainKind;
@@ -61,6 +65,46 @@ void execDb(sqlite::database& db, const char* operation, Func&& func)
     }
 }
 
+// Wraps a batch of writes in one transaction. Anything that escapes before commit() rolls the
+// batch back, so a failed batch never leaves the connection inside an open transaction.
+class ScopedTransaction {
+public:
+    explicit ScopedTransaction(sqlite::database* db) : db_(db)
+    {
+        if (db_) {
+            *db_ << "BEGIN TRANSACTION";
+        }
+    }
+
+    ~ScopedTransaction()
+    {
+        if (!db_ || committed_) {
+            return;
+        }
+        try {
+            *db_ << "ROLLBACK";
+        }
+        catch (const std::exception& e) {
+            spdlog::error("GenomeRepository: rollback failed: {}", e.what());
+        }
+    }
+
+    ScopedTransaction(const ScopedTransaction&) = delete;
+    ScopedTransaction& operator=(const ScopedTransaction&) = delete;
+
+    void commit()
+    {
+        if (db_) {
+            *db_ << "COMMIT";
+        }
+        committed_ = true;
+    }
+
+private:
+    sqlite::database* db_ = nullptr;
+    bool committed_ = false;
+};
+
 void hashBytes(uint64_t& hash, const void* data, size_t size)
 {
     constexpr uint64_t FNV_PRIME = 1099511628211ull;
@@ -200,13 +244,49 @@ GenomeMetadata mergeMetadata(const GenomeMetadata& existingRaw, const GenomeMeta
 
 } // namespace
 
+struct GenomeRepository::PreparedStatements {
+    sqlite::database_binder deleteGenome;
+    sqlite::database_binder selectWeights;
+    sqlite::database_binder upsertGenome;
+};
+
+namespace {
+
+// Prepared statements are reused; used(true) keeps the binder from executing on destruction.
+sqlite::database_binder prepareStatement(sqlite::database& db, const char* sql)
+{
+    sqlite::database_binder statement = db << sql;
+    statement.used(true);
+    return statement;
+}
+
+} // namespace
+
 GenomeRepository::GenomeRepository() = default;
 
 GenomeRepository::GenomeRepository(const std::filesystem::path& dbPath)
-    : db_(std::make_unique<sqlite::database>(dbPath.string()))
+    : GenomeRepository(dbPath, Config{})
+{}
+
+GenomeRepository::GenomeRepository(const std::filesystem::path& dbPath, const Config& config)
+    : db_(std::make_unique<sqlite::database>(dbPath.string())),
+      weightCache_(config.weightCacheBudgetBytes),
+      weightEncoding_(config.weightEncoding),
+      layoutResolver_(config.layoutResolver)
 {
     spdlog::info("GenomeRepository: Opening database at {}", dbPath.string());
+    configureDb(config);
     initSchema();
+    statements_ = std::make_unique<PreparedStatements>(PreparedStatements{
+        .deleteGenome = prepareStatement(*db_, "DELETE FROM genomes WHERE id = ?"),
+        .selectWeights = prepareStatement(
+            *db_, "SELECT weights, weights_encoding FROM genomes WHERE id = ?"),
+        .upsertGenome = prepareStatement(
+            *db_,
+            "INSERT OR REPLACE INTO genomes "
+            "(id, weights, weights_encoding, metadata_json, content_hash) "
+            "VALUES (?, ?, ?, ?, ?)"),
+    });
     loadFromDb();
 }
 
@@ -215,6 +295,19 @@ GenomeRepository::~GenomeRepository() = default;
 GenomeRepository::GenomeRepository(GenomeRepository&&) noexcept = default;
 GenomeRepository& GenomeRepository::operator=(GenomeRepository&&) noexcept = default;
 
+void GenomeRepository::configureDb(const Config& config)
+{
+    // WAL lets readers page in weights while training writes new genomes, and
+    // NORMAL sync is durable across application crashes in WAL mode.
+    execDb(*db_, "configureDb", [&](sqlite::database& db) {
+        db << "PRAGMA journal_mode = WAL" >> [](std::string) {};
+        db << "PRAGMA synchronous = NORMAL";
+        if (config.mmapSizeBytes > 0) {
+            db << "PRAGMA mmap_size = " + std::to_string(config.mmapSizeBytes) >> [](int64_t) {};
+        }
+    });
+}
+
 void GenomeRepository::initSchema()
 {
     // Create tables if they don't exist.
@@ -241,6 +334,14 @@ void GenomeRepository::initSchema()
     }
     *db_ << "CREATE INDEX IF NOT EXISTS idx_genomes_content_hash ON genomes(content_hash)";
 
+    // Float32 rows store raw weights; other encodings store a self-describing blob.
+    int hasWeightsEncodingColumn = 0;
+    *db_ << "SELECT COUNT(*) FROM pragma_table_info('genomes') WHERE name = 'weights_encoding'" >>
+        [&](int count) { hasWeightsEncodingColumn = count; };
+    if (hasWeightsEncodingColumn == 0) {
+        *db_ << "ALTER TABLE genomes ADD COLUMN weights_encoding INTEGER NOT NULL DEFAULT 0";
+    }
+
     *db_ << R"(
         CREATE TABLE IF NOT EXISTS repository_state (
             key TEXT PRIMARY KEY,
@@ -268,48 +369,26 @@ void GenomeRepository::initSchema()
 void GenomeRepository::loadFromDb()
 {
     int loadedCount = 0;
+    std::vector<std::pair<GenomeId, GenomeMetadata>> missingHashes;
 
-    // Load all genomes.
-    *db_ << "SELECT id, weights, metadata_json, COALESCE(content_hash, '') FROM genomes" >>
-        [&](std::string idStr,
-            std::vector<WeightType> weights,
-            std::string metaJson,
-            std::string contentHash) {
+    // Load metadata only; weights are paged in by get().
+    *db_ << "SELECT id, metadata_json, COALESCE(content_hash, '') FROM genomes" >>
+        [&](std::string idStr, std::string metaJson, std::string contentHash) {
             const GenomeId id = UUID::fromString(idStr);
             if (id == INVALID_GENOME_ID) {
                 spdlog::warn("GenomeRepository: Skipping invalid genome ID: {}", idStr);
                 return;
             }
 
-            Genome genome;
-            genome.weights = std::move(weights);
-
             try {
                 auto json = nlohmann::json::parse(metaJson);
                 GenomeMetadata meta = normalizeRobustMetadata(json.get<GenomeMetadata>());
-                if (contentHash.empty()) {
-                    contentHash = computeContentHash(genome, meta);
-                    persistGenomeHash(id, contentHash);
-                }
-
-                genomes_[id] = genome;
                 metadata_[id] = meta;
-
-                const auto existingHash = hashToId_.find(contentHash);
-                if (existingHash == hashToId_.end()) {
-                    hashToId_[contentHash] = id;
-                    idToHash_[id] = contentHash;
+                if (contentHash.empty()) {
+                    missingHashes.emplace_back(id, std::move(meta));
                 }
                 else {
-                    const GenomeId existingId = existingHash->second;
-                    auto existingMeta = metadata_.find(existingId);
-                    if (existingMeta == metadata_.end()
-                        || effectiveRobustFitness(meta)
-                            > effectiveRobustFitness(existingMeta->second)) {
-                        idToHash_.erase(existingId);
-                        existingHash->second = id;
-                        idToHash_[id] = contentHash;
-                    }
+                    indexContentHashNoLock(id, meta, std::move(contentHash));
                 }
                 loadedCount++;
             }
@@ -319,6 +398,25 @@ void GenomeRepository::loadFromDb()
             }
         };
 
+    // Rows written before content hashing existed need their weights once to backfill the hash.
+    if (!missingHashes.empty()) {
+        execDb(*db_, "backfillContentHashes", [&](sqlite::database& db) {
+            db << "BEGIN TRANSACTION";
+            for (const auto& [id, meta] : missingHashes) {
+                const auto genome = loadWeightsFromDb(id);
+                if (!genome.has_value()) {
+                    continue;
+                }
+                const std::string contentHash = computeContentHash(genome.value(), meta);
+                persistGenomeHash(id, contentHash);
+                indexContentHashNoLock(id, meta, contentHash);
+            }
+            db << "COMMIT";
+        });
+        spdlog::info(
+            "GenomeRepository: Backfilled {} genome content hashes", missingHashes.size());
+    }
+
     // Load best ID if set.
     *db_ << "SELECT value FROM repository_state WHERE key = 'best_id'" >>
         [&](std::string bestIdStr) {
@@ -331,22 +429,69 @@ void GenomeRepository::loadFromDb()
         };
 
     spdlog::info(
-        "GenomeRepository: Loaded {} genomes from database{}",
+        "GenomeRepository: Loaded metadata for {} genomes from database{}",
         loadedCount,
         bestId_ ? " (best: " + bestId_->toString() + ")" : "");
 }
 
+std::optional<Genome> GenomeRepository::loadWeightsFromDb(GenomeId id) const
+{
+    std::optional<Genome> genome;
+    execDb(*db_, "loadWeightsFromDb", [&](sqlite::database&) {
+        statements_->selectWeights << id.toString() >>
+            [&](std::vector<uint8_t> blob, int encoding) {
+                if (encoding != static_cast<int>(WeightEncoding::Float32)) {
+                    genome = decodeGenomeWeights(blob);
+                    if (!genome.has_value()) {
+                        spdlog::warn(
+                            "GenomeRepository: Failed to decode weights for {}", id.toString());
+                    }
+                    return;
+                }
+                genome = Genome(blob.size() / sizeof(WeightType));
+                if (!blob.empty()) {
+                    std::memcpy(
+                        genome->weights.data(),
+                        blob.data(),
+                        genome->weights.size() * sizeof(WeightType));
+                }
+            };
+    });
+    return genome;
+}
+
 void GenomeRepository::persistGenome(
-    GenomeId id, const Genome& genome, const GenomeMetadata& meta, const std::string& contentHash)
+    GenomeId id,
+    const Genome& genome,
+    const std::vector<uint8_t>& encodedBlob,
+    const GenomeMetadata& meta,
+    const std::string& contentHash)
+{
+    execDb(*db_, "persistGenome", [&](sqlite::database&) {
+        writeGenome(id, genome, encodedBlob, meta, contentHash);
+    });
+}
+
+void GenomeRepository::writeGenome(
+    GenomeId id,
+    const Genome& genome,
+    const std::vector<uint8_t>& encodedBlob,
+    const GenomeMetadata& meta,
+    const std::string& contentHash)
 {
     const std::string idStr = id.toString();
     nlohmann::json metaJson = meta;
 
-    execDb(*db_, "persistGenome", [&](sqlite::database& db) {
-        db << "INSERT OR REPLACE INTO genomes (id, weights, metadata_json, content_hash) "
-              "VALUES (?, ?, ?, ?)"
-           << idStr << genome.weights << metaJson.dump() << contentHash;
-    });
+    if (encodedBlob.empty()) {
+        statements_->upsertGenome << idStr << genome.weights
+                                  << static_cast<int>(WeightEncoding::Float32) << metaJson.dump()
+                                  << contentHash;
+    }
+    else {
+        statements_->upsertGenome << idStr << encodedBlob << static_cast<int>(weightEncoding_)
+                                  << metaJson.dump() << contentHash;
+    }
+    statements_->upsertGenome.execute();
 }
 
 void GenomeRepository::persistGenomeHash(GenomeId id, const std::string& contentHash)
@@ -358,8 +503,9 @@ void GenomeRepository::persistGenomeHash(GenomeId id, const std::string& content
 
 void GenomeRepository::deleteGenome(GenomeId id)
 {
-    execDb(*db_, "deleteGenome", [&](sqlite::database& db) {
-        db << "DELETE FROM genomes WHERE id = ?" << id.toString();
+    execDb(*db_, "deleteGenome", [&](sqlite::database&) {
+        statements_->deleteGenome << id.toString();
+        statements_->deleteGenome.execute();
     });
 }
 
@@ -418,7 +564,7 @@ std::string GenomeRepository::computeContentHash(const Genome& genome, const Gen
     return toHexString(hash);
 }
 
-void GenomeRepository::store(GenomeId id, const Genome& genome, const GenomeMetadata& meta)
+void GenomeRepository::store(GenomeId id, const Genome& inputGenome, const GenomeMetadata& meta)
 {
     if (id == INVALID_GENOME_ID) {
         id = UUID::generate();
@@ -426,7 +572,10 @@ void GenomeRepository::store(GenomeId id, const Genome& genome, const GenomeMeta
 
     std::lock_guard<std::mutex> lock(*mutex_);
     const GenomeMetadata normalizedMeta = normalizeRobustMetadata(meta);
-    const std::string contentHash = computeContentHash(genome, normalizedMeta);
+    const auto encoded = encodeForStorage(inputGenome, normalizedMeta);
+    const Genome& genome = encoded.has_value() ? encoded->genome : inputGenome;
+    const std::vector<uint8_t>& encodedBlob = encoded.has_value() ? encoded->blob : kNoEncodedBlob;
+    const std::string contentHash = computeContentHash(inputGenome, normalizedMeta);
 
     const auto oldHashIt = idToHash_.find(id);
     if (oldHashIt != idToHash_.end() && oldHashIt->second != contentHash) {
@@ -436,13 +585,14 @@ void GenomeRepository::store(GenomeId id, const Genome& genome, const GenomeMeta
         }
     }
 
-    genomes_[id] = genome;
+    putWeightsNoLock(id, genome);
     metadata_[id] = normalizedMeta;
     hashToId_[contentHash] = id;
     idToHash_[id] = contentHash;
+    ++revision_;
 
     if (db_) {
-        persistGenome(id, genome, normalizedMeta, contentHash);
+        persistGenome(id, genome, encodedBlob, normalizedMeta, contentHash);
     }
 }
 
@@ -450,51 +600,136 @@ GenomeRepository::StoreByHashResult GenomeRepository::storeOrUpdateByHash(
     const Genome& genome, const GenomeMetadata& meta, std::optional<GenomeId> preferredId)
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    const GenomeMetadata normalizedMeta = normalizeRobustMetadata(meta);
-    const std::string contentHash = computeContentHash(genome, normalizedMeta);
-
-    const auto existing = hashToId_.find(contentHash);
-    if (existing != hashToId_.end()) {
-        const GenomeId existingId = existing->second;
-        const auto existingMetaIt = metadata_.find(existingId);
-        const GenomeMetadata mergedMeta = existingMetaIt != metadata_.end()
-            ? mergeMetadata(existingMetaIt->second, normalizedMeta)
-            : normalizedMeta;
-        genomes_[existingId] = genome;
-        metadata_[existingId] = mergedMeta;
-        idToHash_[existingId] = contentHash;
-        if (db_) {
-            persistGenome(existingId, genome, mergedMeta, contentHash);
+    const PreparedStore prepared = prepareStoreByHashNoLock(genome, meta, preferredId, {});
+    if (db_) {
+        execDb(*db_, "persistGenome", [&](sqlite::database&) { writePreparedStore(prepared); });
+    }
+    applyStoreNoLock(prepared);
+    return prepared.result;
+}
+
+std::vector<GenomeRepository::StoreByHashResult> GenomeRepository::storeOrUpdateByHashBatch(
+    std::span<const StoreByHashEntry> entries)
+{
+    std::vector<PreparedStore> prepared;
+    prepared.reserve(entries.size());
+
+    std::lock_guard<std::mutex> lock(*mutex_);
+    try {
+        ScopedTransaction transaction(db_.get());
+        for (const auto& entry : entries) {
+            DIRTSIM_ASSERT(
+                entry.genome != nullptr, "GenomeRepository: Batch entry missing genome");
+            prepared.push_back(prepareStoreByHashNoLock(
+                *entry.genome, entry.metadata, entry.preferredId, prepared));
+            if (db_) {
+                writePreparedStore(prepared.back());
+            }
         }
-        return StoreByHashResult{
-            .id = existingId,
+        transaction.commit();
+    }
+    catch (const sqlite::sqlite_exception& e) {
+        // The batch has been rolled back and nothing was applied in memory.
+        spdlog::error("GenomeRepository: storeBatch failed: {} (code {})", e.what(), e.get_code());
+        return {};
+    }
+
+    std::vector<StoreByHashResult> results;
+    results.reserve(prepared.size());
+    for (const auto& store : prepared) {
+        applyStoreNoLock(store);
+        results.push_back(store.result);
+    }
+    return results;
+}
+
+GenomeRepository::PreparedStore GenomeRepository::prepareStoreByHashNoLock(
+    const Genome& inputGenome,
+    const GenomeMetadata& meta,
+    std::optional<GenomeId> preferredId,
+    std::span<const PreparedStore> earlier) const
+{
+    PreparedStore prepared{
+        .result = {},
+        .inputGenome = &inputGenome,
+        .encoded = std::nullopt,
+        .metadata = normalizeRobustMetadata(meta),
+        .contentHash = {},
+    };
+    prepared.encoded = encodeForStorage(inputGenome, prepared.metadata);
+    prepared.contentHash = computeContentHash(inputGenome, prepared.metadata);
+
+    const auto earlierMatch = std::find_if(
+        earlier.rbegin(), earlier.rend(), [&prepared](const PreparedStore& store) {
+            return store.contentHash == prepared.contentHash;
+        });
+    const GenomeMetadata* existingMeta = nullptr;
+    std::optional<GenomeId> existingId;
+    if (earlierMatch != earlier.rend()) {
+        existingId = earlierMatch->result.id;
+        existingMeta = &earlierMatch->metadata;
+    }
+    else if (const auto existing = hashToId_.find(prepared.contentHash);
+             existing != hashToId_.end()) {
+        existingId = existing->second;
+        const auto existingMetaIt = metadata_.find(existing->second);
+        if (existingMetaIt != metadata_.end()) {
+            existingMeta = &existingMetaIt->second;
+        }
+    }
+
+    if (existingId.has_value()) {
+        if (existingMeta) {
+            prepared.metadata = mergeMetadata(*existingMeta, prepared.metadata);
+        }
+        prepared.result = StoreByHashResult{
+            .id = existingId.value(),
             .inserted = false,
             .deduplicated = true,
         };
+        return prepared;
     }
 
+    const auto isTaken = [&](GenomeId id) {
+        return metadata_.contains(id)
+            || std::any_of(earlier.begin(), earlier.end(), [id](const PreparedStore& store) {
+                   return store.result.id == id;
+               });
+    };
     GenomeId id = preferredId.has_value() ? preferredId.value() : UUID::generate();
-    if (id == INVALID_GENOME_ID || genomes_.find(id) != genomes_.end()) {
+    if (id == INVALID_GENOME_ID) {
         id = UUID::generate();
     }
-    while (genomes_.find(id) != genomes_.end()) {
+    while (isTaken(id)) {
         id = UUID::generate();
     }
 
-    genomes_[id] = genome;
-    metadata_[id] = normalizedMeta;
-    hashToId_[contentHash] = id;
-    idToHash_[id] = contentHash;
-
-    if (db_) {
-        persistGenome(id, genome, normalizedMeta, contentHash);
-    }
-
-    return StoreByHashResult{
+    prepared.result = StoreByHashResult{
         .id = id,
         .inserted = true,
         .deduplicated = false,
     };
+    return prepared;
+}
+
+void GenomeRepository::writePreparedStore(const PreparedStore& prepared)
+{
+    const Genome& genome =
+        prepared.encoded.has_value() ? prepared.encoded->genome : *prepared.inputGenome;
+    const std::vector<uint8_t>& encodedBlob =
+        prepared.encoded.has_value() ? prepared.encoded->blob : kNoEncodedBlob;
+    writeGenome(prepared.result.id, genome, encodedBlob, prepared.metadata, prepared.contentHash);
+}
+
+void GenomeRepository::applyStoreNoLock(const PreparedStore& prepared)
+{
+    const GenomeId id = prepared.result.id;
+    putWeightsNoLock(
+        id, prepared.encoded.has_value() ? prepared.encoded->genome : *prepared.inputGenome);
+    metadata_[id] = prepared.metadata;
+    hashToId_[prepared.contentHash] = id;
+    idToHash_[id] = prepared.contentHash;
+    ++revision_;
 }
 
 size_t GenomeRepository::pruneManagedByFitness(size_t maxManagedGenomes)
@@ -596,17 +831,13 @@ size_t GenomeRepository::countManagedByBucket(
 bool GenomeRepository::exists(GenomeId id) const
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    return genomes_.find(id) != genomes_.end();
+    return metadata_.find(id) != metadata_.end();
 }
 
 std::optional<Genome> GenomeRepository::get(GenomeId id) const
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    auto it = genomes_.find(id);
-    if (it == genomes_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return getNoLock(id);
 }
 
 std::optional<GenomeMetadata> GenomeRepository::getMetadata(GenomeId id) const
@@ -640,10 +871,12 @@ void GenomeRepository::clear()
 {
     std::lock_guard<std::mutex> lock(*mutex_);
     genomes_.clear();
+    weightCache_.clear();
     hashToId_.clear();
     idToHash_.clear();
     metadata_.clear();
     bestId_ = std::nullopt;
+    ++revision_;
 
     if (db_) {
         clearDb();
@@ -653,7 +886,7 @@ void GenomeRepository::clear()
 void GenomeRepository::markAsBest(GenomeId id)
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    if (genomes_.find(id) != genomes_.end()) {
+    if (metadata_.find(id) != metadata_.end()) {
         bestId_ = id;
         if (db_) {
             persistBestId();
@@ -673,23 +906,25 @@ std::optional<Genome> GenomeRepository::getBest() const
     if (!bestId_) {
         return std::nullopt;
     }
-    auto it = genomes_.find(*bestId_);
-    if (it == genomes_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return getNoLock(*bestId_);
 }
 
 size_t GenomeRepository::count() const
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    return genomes_.size();
+    return metadata_.size();
 }
 
 bool GenomeRepository::empty() const
 {
     std::lock_guard<std::mutex> lock(*mutex_);
-    return genomes_.empty();
+    return metadata_.empty();
+}
+
+uint64_t GenomeRepository::getRevision() const
+{
+    std::lock_guard<std::mutex> lock(*mutex_);
+    return revision_;
 }
 
 bool GenomeRepository::isPersistent() const
@@ -698,10 +933,95 @@ bool GenomeRepository::isPersistent() const
     return db_ != nullptr;
 }
 
+GenomeWeightCache::Stats GenomeRepository::getWeightCacheStats() const
+{
+    std::lock_guard<std::mutex> lock(*mutex_);
+    return weightCache_.getStats();
+}
+
+std::optional<Genome> GenomeRepository::getNoLock(GenomeId id) const
+{
+    if (!db_) {
+        const auto it = genomes_.find(id);
+        if (it == genomes_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    if (metadata_.find(id) == metadata_.end()) {
+        return std::nullopt;
+    }
+    if (const Genome* cached = weightCache_.find(id)) {
+        return *cached;
+    }
+
+    auto genome = loadWeightsFromDb(id);
+    if (genome.has_value()) {
+        weightCache_.put(id, genome.value());
+    }
+    return genome;
+}
+
+GenomeLayout GenomeRepository::resolveLayout(const GenomeMetadata& meta) const
+{
+    return layoutResolver_ ? layoutResolver_(meta) : GenomeLayout{};
+}
+
+std::optional<GenomeRepository::EncodedWeights> GenomeRepository::encodeForStorage(
+    const Genome& genome, const GenomeMetadata& meta) const
+{
+    if (!db_ || weightEncoding_ == WeightEncoding::Float32) {
+        return std::nullopt;
+    }
+
+    // Decode the exact blob being persisted so cached and reloaded weights match bit for bit.
+    EncodedWeights encoded{
+        .genome = {},
+        .blob = encodeGenomeWeights(genome, resolveLayout(meta), weightEncoding_),
+    };
+    auto decoded = decodeGenomeWeights(encoded.blob);
+    DIRTSIM_ASSERT(decoded.has_value(), "GenomeRepository: Encoded weights failed to decode");
+    encoded.genome = std::move(decoded.value());
+    return encoded;
+}
+
+void GenomeRepository::indexContentHashNoLock(
+    GenomeId id, const GenomeMetadata& meta, std::string contentHash)
+{
+    const auto existingHash = hashToId_.find(contentHash);
+    if (existingHash == hashToId_.end()) {
+        idToHash_[id] = contentHash;
+        hashToId_[std::move(contentHash)] = id;
+        return;
+    }
+
+    const GenomeId existingId = existingHash->second;
+    const auto existingMeta = metadata_.find(existingId);
+    if (existingMeta == metadata_.end()
+        || effectiveRobustFitness(meta) > effectiveRobustFitness(existingMeta->second)) {
+        idToHash_.erase(existingId);
+        existingHash->second = id;
+        idToHash_[id] = std::move(contentHash);
+    }
+}
+
+void GenomeRepository::putWeightsNoLock(GenomeId id, const Genome& genome)
+{
+    if (db_) {
+        weightCache_.put(id, genome);
+        return;
+    }
+    genomes_[id] = genome;
+}
+
 void GenomeRepository::removeNoLock(GenomeId id)
 {
     genomes_.erase(id);
-    metadata_.erase(id);
+    weightCache_.erase(id);
+    if (metadata_.erase(id) > 0) {
+        ++revision_;
+    }
 
     const auto hashIt = idToHash_.find(id);
     if (hashIt != idToHash_.end()) {
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "GenomeMetadata.h"
+#include "GenomeWeightCache.h"
 #include "core/organisms/brains/Genome.h"
+#include "core/organisms/brains/WeightQuantization.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -27,9 +33,35 @@ namespace DirtSim {
  * Two modes:
  * - In-memory only (default constructor): For tests and temporary use.
  * - Persistent (path constructor): Write-through to SQLite database.
+ *
+ * Persistent repositories load only metadata and content hashes at startup.
+ * Weights stay on disk and are paged in on demand through a byte-budgeted
+ * LRU cache, so opening a large archive does not read every weights BLOB.
+ *
+ * Persistent repositories can store weights as fp16 or int8 (scaled per
+ * GenomeLayout segment). Lossy encodings are applied before caching, so get()
+ * returns the same weights before and after a reopen. Content hashes cover the
+ * float weights, so distinct genomes never collapse into one archive entry.
  */
 class GenomeRepository {
 public:
+    struct Config {
+        // Resident weight bytes kept by the LRU cache (persistent mode only).
+        size_t weightCacheBudgetBytes = 64 * 1024 * 1024;
+        // SQLite mmap_size; 0 keeps regular read() I/O for weight BLOBs.
+        int64_t mmapSizeBytes = 0;
+        // Encoding for newly written weights. Existing rows keep their own encoding.
+        WeightEncoding weightEncoding = WeightEncoding::Float32;
+        // Segments used for per-layer scaling; an empty layout scales the genome as one segment.
+        std::function<GenomeLayout(const GenomeMetadata&)> layoutResolver;
+    };
+
+    struct StoreByHashEntry {
+        const Genome* genome = nullptr;
+        GenomeMetadata metadata;
+        std::optional<GenomeId> preferredId = std::nullopt;
+    };
+
     struct StoreByHashResult {
         GenomeId id = INVALID_GENOME_ID;
         bool inserted = false;
@@ -41,8 +73,9 @@ public:
 
     // Construct with SQLite persistence at the given path.
     // Creates the database and schema if it doesn't exist.
-    // Loads existing genomes from the database on construction.
+    // Loads existing genome metadata from the database on construction.
     explicit GenomeRepository(const std::filesystem::path& dbPath);
+    GenomeRepository(const std::filesystem::path& dbPath, const Config& config);
 
     ~GenomeRepository();
 
@@ -61,6 +94,12 @@ public:
         const GenomeMetadata& meta,
         std::optional<GenomeId> preferredId = std::nullopt);
 
+    // Same as storeOrUpdateByHash for each entry, committed in a single transaction. Nothing
+    // changes in memory until the commit succeeds. A database error rolls the batch back,
+    // is logged, and returns no results; other exceptions roll back and are rethrown.
+    std::vector<StoreByHashResult> storeOrUpdateByHashBatch(
+        std::span<const StoreByHashEntry> entries);
+
     // Keep only the highest-fitness managed genomes (trainingSessionId set),
     // limited per organismType+brainKind bucket.
     // Returns number of genomes removed.
@@ -95,29 +134,67 @@ public:
     size_t count() const;
     bool empty() const;
 
+    // Bumped whenever stored metadata changes, so callers can cache derived views.
+    uint64_t getRevision() const;
+
     // Check if persistence is enabled.
     bool isPersistent() const;
 
+    // Weight cache counters (all zero for in-memory repositories).
+    GenomeWeightCache::Stats getWeightCacheStats() const;
+
 private:
-    // In-memory storage (always present for fast access).
+    struct PreparedStatements;
+
+    struct EncodedWeights {
+        Genome genome;
+        std::vector<uint8_t> blob;
+    };
+
+    // A storeOrUpdateByHash entry resolved against the index but not applied yet.
+    struct PreparedStore {
+        StoreByHashResult result;
+        const Genome* inputGenome = nullptr;
+        std::optional<EncodedWeights> encoded;
+        GenomeMetadata metadata;
+        std::string contentHash;
+    };
+
+    // Weights for in-memory repositories. Persistent repositories use weightCache_ instead.
     std::unordered_map<GenomeId, Genome> genomes_;
     std::unordered_map<std::string, GenomeId> hashToId_;
     std::unordered_map<GenomeId, std::string> idToHash_;
+    // Authoritative index of stored genomes in both modes.
     std::unordered_map<GenomeId, GenomeMetadata> metadata_;
     std::optional<GenomeId> bestId_;
+    uint64_t revision_ = 0;
 
     // Optional SQLite database for persistence.
     std::unique_ptr<sqlite::database> db_;
+    mutable std::unique_ptr<PreparedStatements> statements_;
+    mutable GenomeWeightCache weightCache_{ 0 };
+    WeightEncoding weightEncoding_ = WeightEncoding::Float32;
+    std::function<GenomeLayout(const GenomeMetadata&)> layoutResolver_;
 
     // Heap-allocated to preserve move semantics.
     mutable std::unique_ptr<std::mutex> mutex_ = std::make_unique<std::mutex>();
 
     // Database operations.
+    void configureDb(const Config& config);
     void initSchema();
     void loadFromDb();
+    std::optional<Genome> loadWeightsFromDb(GenomeId id) const;
     void persistGenome(
         GenomeId id,
         const Genome& genome,
+        const std::vector<uint8_t>& encodedBlob,
+        const GenomeMetadata& meta,
+        const std::string& contentHash);
+    // Same as persistGenome, but database errors propagate to the caller.
+    void writeGenome(
+        GenomeId id,
+        const Genome& genome,
+        const std::vector<uint8_t>& encodedBlob,
         const GenomeMetadata& meta,
         const std::string& contentHash);
     void persistGenomeHash(GenomeId id, const std::string& contentHash);
@@ -126,7 +203,22 @@ private:
     void clearDb();
 
     static std::string computeContentHash(const Genome& genome, const GenomeMetadata& meta);
+    std::optional<Genome> getNoLock(GenomeId id) const;
+    GenomeLayout resolveLayout(const GenomeMetadata& meta) const;
+    // Lossy encodings only; nullopt means the genome is stored as given.
+    std::optional<EncodedWeights> encodeForStorage(
+        const Genome& genome, const GenomeMetadata& meta) const;
+    void indexContentHashNoLock(GenomeId id, const GenomeMetadata& meta, std::string contentHash);
+    void putWeightsNoLock(GenomeId id, const Genome& genome);
     void removeNoLock(GenomeId id);
+    // Entries in earlier (same batch, not applied yet) count as stored.
+    PreparedStore prepareStoreByHashNoLock(
+        const Genome& genome,
+        const GenomeMetadata& meta,
+        std::optional<GenomeId> preferredId,
+        std::span<const PreparedStore> earlier) const;
+    void writePreparedStore(const PreparedStore& prepared);
+    void applyStoreNoLock(const PreparedStore& prepared);
 };
 
 } // namespace DirtSim
@@ -0,0 +1,82 @@
+#include "GenomeWeightCache.h"
+
+namespace DirtSim {
+
+GenomeWeightCache::GenomeWeightCache(size_t budgetBytes) : budgetBytes_(budgetBytes)
+{}
+
+void GenomeWeightCache::clear()
+{
+    entries_.clear();
+    lru_.clear();
+    residentBytes_ = 0;
+}
+
+void GenomeWeightCache::erase(GenomeId id)
+{
+    const auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return;
+    }
+
+    residentBytes_ -= it->second.genome.getSizeBytes();
+    lru_.erase(it->second.lruIt);
+    entries_.erase(it);
+}
+
+const Genome* GenomeWeightCache::find(GenomeId id)
+{
+    const auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        misses_++;
+        return nullptr;
+    }
+
+    hits_++;
+    lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+    return &it->second.genome;
+}
+
+void GenomeWeightCache::put(GenomeId id, const Genome& genome)
+{
+    const auto it = entries_.find(id);
+    if (it != entries_.end()) {
+        residentBytes_ -= it->second.genome.getSizeBytes();
+        it->second.genome = genome;
+        residentBytes_ += genome.getSizeBytes();
+        lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+        evictToBudget();
+        return;
+    }
+
+    lru_.push_front(id);
+    entries_.emplace(id, Entry{ .genome = genome, .lruIt = lru_.begin() });
+    residentBytes_ += genome.getSizeBytes();
+    evictToBudget();
+}
+
+GenomeWeightCache::Stats GenomeWeightCache::getStats() const
+{
+    return Stats{
+        .evictions = evictions_,
+        .hits = hits_,
+        .misses = misses_,
+        .budgetBytes = budgetBytes_,
+        .residentBytes = residentBytes_,
+        .residentCount = entries_.size(),
+    };
+}
+
+void GenomeWeightCache::evictToBudget()
+{
+    while (residentBytes_ > budgetBytes_ && lru_.size() > 1) {
+        const GenomeId victim = lru_.back();
+        const auto it = entries_.find(victim);
+        residentBytes_ -= it->second.genome.getSizeBytes();
+        entries_.erase(it);
+        lru_.pop_back();
+        evictions_++;
+    }
+}
+
+} // namespace DirtSim
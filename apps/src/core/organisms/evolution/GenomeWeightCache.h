@@ -0,0 +1,63 @@
+#pragma once
+
+#include "GenomeMetadata.h"
+#include "core/organisms/brains/Genome.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+namespace DirtSim {
+
+/**
+ * Byte-budgeted LRU cache of genome weights.
+ *
+ * GenomeRepository keeps only metadata resident for persistent archives and
+ * pages weights in through this cache on demand. The most recently inserted
+ * genome is always kept, even when it alone exceeds the budget.
+ * Not thread-safe; the owner serializes access.
+ */
+class GenomeWeightCache {
+public:
+    struct Stats {
+        uint64_t evictions = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t budgetBytes = 0;
+        size_t residentBytes = 0;
+        size_t residentCount = 0;
+    };
+
+    explicit GenomeWeightCache(size_t budgetBytes);
+
+    void clear();
+    void erase(GenomeId id);
+
+    // Returns nullptr on a miss. The pointer is valid until the next mutating call.
+    const Genome* find(GenomeId id);
+
+    void put(GenomeId id, const Genome& genome);
+
+    Stats getStats() const;
+
+private:
+    struct Entry {
+        Genome genome;
+        std::list<GenomeId>::iterator lruIt;
+    };
+
+    size_t budgetBytes_ = 0;
+    size_t residentBytes_ = 0;
+    uint64_t evictions_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+
+    // Front is most recently used.
+    std::list<GenomeId> lru_;
+    std::unordered_map<GenomeId, Entry> entries_;
+
+    void evictToBudget();
+};
+
+} // namespace DirtSim
@@ -8,6 +8,7 @@
 #include "core/organisms/brains/NeuralNetBrain.h"
 #include "core/organisms/brains/RuleBased2Brain.h"
 #include "core/organisms/brains/RuleBasedBrain.h"
+#include "core/organisms/brains/WeightQuantization.h"
 #include "core/scenarios/nes/NesTileRecurrentBrain.h"
 
 namespace DirtSim {
@@ -110,27 +111,35 @@ TrainingBrainRegistry TrainingBrainRegistry::createDefault()
             .getGenomeLayout = []() { return NeuralNetBrain::getGenomeLayout(); },
         });
 
-    registry.registerBrain(
-        OrganismType::DUCK,
-        TrainingBrainKind::DuckNeuralNetRecurrentV2,
-        "",
-        BrainRegistryEntry{
-            .requiresGenome = true,
-            .allowsMutation = true,
-            .spawn = [](World& world, uint32_t x, uint32_t y, const Genome* genome) -> OrganismId {
-                DIRTSIM_ASSERT(
-                    genome != nullptr, "DuckNeuralNetRecurrentV2 brain requires a genome");
-                auto brain = std::make_unique<DuckNeuralNetRecurrentBrainV2>(*genome);
-                return world.getOrganismManager().createDuck(world, x, y, std::move(brain));
-            },
-            .createRandomGenome =
-                [](std::mt19937& rng) { return DuckNeuralNetRecurrentBrainV2::randomGenome(rng); },
-            .isGenomeCompatible =
-                [](const Genome& genome) {
-                    return DuckNeuralNetRecurrentBrainV2::isGenomeCompatible(genome);
+    for (const InferencePrecision precision :
+         { InferencePrecision::Float32, InferencePrecision::Int8 }) {
+        registry.registerBrain(
+            OrganismType::DUCK,
+            TrainingBrainKind::DuckNeuralNetRecurrentV2,
+            precision == InferencePrecision::Int8 ? TrainingBrainVariant::Int8Inference : "",
+            BrainRegistryEntry{
+                .requiresGenome = true,
+                .allowsMutation = true,
+                .spawn = [precision](World& world, uint32_t x, uint32_t y, const Genome* genome)
+                    -> OrganismId {
+                    DIRTSIM_ASSERT(
+                        genome != nullptr, "DuckNeuralNetRecurrentV2 brain requires a genome");
+                    auto brain = std::make_unique<DuckNeuralNetRecurrentBrainV2>(*genome);
+                    brain->setInferencePrecision(precision);
+                    return world.getOrganismManager().createDuck(world, x, y, std::move(brain));
                 },
-            .getGenomeLayout = []() { return DuckNeuralNetRecurrentBrainV2::getGenomeLayout(); },
-        });
+                .createRandomGenome =
+                    [](std::mt19937& rng) {
+                        return DuckNeuralNetRecurrentBrainV2::randomGenome(rng);
+                    },
+                .isGenomeCompatible =
+                    [](const Genome& genome) {
+                        return DuckNeuralNetRecurrentBrainV2::isGenomeCompatible(genome);
+                    },
+                .getGenomeLayout =
+                    []() { return DuckNeuralNetRecurrentBrainV2::getGenomeLayout(); },
+            });
+    }
 
     registry.registerBrain(
         OrganismType::TREE,
@@ -175,7 +184,8 @@ TrainingBrainRegistry TrainingBrainRegistry::createDefault()
             .allowsMutation = false,
             .spawn =
                 [](World& world, uint32_t x, uint32_t y, const Genome* /*genome*/) {
-                    auto brain = std::make_unique<RandomDuckBrain>();
+                    // Drawn from the World RNG so a seeded evaluation replays exactly.
+                    auto brain = std::make_unique<RandomDuckBrain>((*world.rng_)());
                     return world.getOrganismManager().createDuck(world, x, y, std::move(brain));
                 },
             .createRandomGenome = nullptr,
@@ -226,7 +236,7 @@ TrainingBrainRegistry TrainingBrainRegistry::createDefault()
             .allowsMutation = false,
             .spawn =
                 [](World& world, uint32_t x, uint32_t y, const Genome* /*genome*/) {
-                    auto brain = std::make_unique<RandomGooseBrain>();
+                    auto brain = std::make_unique<RandomGooseBrain>((*world.rng_)());
                     return world.getOrganismManager().createGoose(world, x, y, std::move(brain));
                 },
             .createRandomGenome = nullptr,
@@ -234,41 +244,48 @@ TrainingBrainRegistry TrainingBrainRegistry::createDefault()
             .getGenomeLayout = nullptr,
         });
 
-    registry.registerBrain(
-        OrganismType::NES_DUCK,
-        TrainingBrainKind::DuckNeuralNetRecurrentV2,
-        "",
-        BrainRegistryEntry{
-            .controlMode = BrainRegistryEntry::ControlMode::ScenarioDriven,
-            .requiresGenome = true,
-            .allowsMutation = true,
-            .spawn = nullptr,
-            .createRandomGenome =
-                [](std::mt19937& rng) { return DuckNeuralNetRecurrentBrainV2::randomGenome(rng); },
-            .isGenomeCompatible =
-                [](const Genome& genome) {
-                    return DuckNeuralNetRecurrentBrainV2::isGenomeCompatible(genome);
-                },
-            .getGenomeLayout = []() { return DuckNeuralNetRecurrentBrainV2::getGenomeLayout(); },
-        });
+    for (const char* variant : { "", TrainingBrainVariant::Int8Inference }) {
+        registry.registerBrain(
+            OrganismType::NES_DUCK,
+            TrainingBrainKind::DuckNeuralNetRecurrentV2,
+            variant,
+            BrainRegistryEntry{
+                .controlMode = BrainRegistryEntry::ControlMode::ScenarioDriven,
+                .requiresGenome = true,
+                .allowsMutation = true,
+                .spawn = nullptr,
+                .createRandomGenome =
+                    [](std::mt19937& rng) {
+                        return DuckNeuralNetRecurrentBrainV2::randomGenome(rng);
+                    },
+                .isGenomeCompatible =
+                    [](const Genome& genome) {
+                        return DuckNeuralNetRecurrentBrainV2::isGenomeCompatible(genome);
+                    },
+                .getGenomeLayout =
+                    []() { return DuckNeuralNetRecurrentBrainV2::getGenomeLayout(); },
+            });
+    }
 
-    registry.registerBrain(
-        OrganismType::NES_DUCK,
-        TrainingBrainKind::NesTileRecurrent,
-        "",
-        BrainRegistryEntry{
-            .controlMode = BrainRegistryEntry::ControlMode::ScenarioDriven,
-            .requiresGenome = true,
-            .allowsMutation = true,
-            .spawn = nullptr,
-            .createRandomGenome =
-                [](std::mt19937& rng) { return NesTileRecurrentBrain::randomGenome(rng); },
-            .isGenomeCompatible =
-                [](const Genome& genome) {
-                    return NesTileRecurrentBrain::isGenomeCompatible(genome);
-                },
-            .getGenomeLayout = []() { return NesTileRecurrentBrain::getGenomeLayout(); },
-        });
+    for (const char* variant : { "", TrainingBrainVariant::Int8Inference }) {
+        registry.registerBrain(
+            OrganismType::NES_DUCK,
+            TrainingBrainKind::NesTileRecurrent,
+            variant,
+            BrainRegistryEntry{
+                .controlMode = BrainRegistryEntry::ControlMode::ScenarioDriven,
+                .requiresGenome = true,
+                .allowsMutation = true,
+                .spawn = nullptr,
+                .createRandomGenome =
+                    [](std::mt19937& rng) { return NesTileRecurrentBrain::randomGenome(rng); },
+                .isGenomeCompatible =
+                    [](const Genome& genome) {
+                        return NesTileRecurrentBrain::isGenomeCompatible(genome);
+                    },
+                .getGenomeLayout = []() { return NesTileRecurrentBrain::getGenomeLayout(); },
+            });
+    }
 
     return registry;
 }
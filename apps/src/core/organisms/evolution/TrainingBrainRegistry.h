@@ -25,6 +25,11 @@ inline constexpr const char* DuckNeuralNetRecurrentV2 = "DuckNeuralNetRecurrentV
 inline constexpr const char* NesTileRecurrent = "NesTileRecurrent";
 } // namespace TrainingBrainKind
 
+namespace TrainingBrainVariant {
+// Same genome and mutation as the base kind; inference runs on int8-quantized weights.
+inline constexpr const char* Int8Inference = "Int8Inference";
+} // namespace TrainingBrainVariant
+
 std::string defaultTrainingBrainKind(OrganismType organismType, Scenario::EnumType scenarioId);
 
 struct BrainRegistryKey {
@@ -2,6 +2,7 @@
 #include "EvolutionConfig.h"
 #include "FitnessCalculator.h"
 #include "GenomeRepository.h"
+#include "TrainingWorldPool.h"
 #include "core/Assert.h"
 #include "core/LoggingChannels.h"
 #include "core/ScopeTimer.h"
@@ -10,6 +11,7 @@
 #include "core/organisms/Duck.h"
 #include "core/organisms/OrganismManager.h"
 #include "core/organisms/Tree.h"
+#include "core/organisms/brains/WeightQuantization.h"
 #include "core/scenarios/ClockScenario.h"
 #include "core/scenarios/Scenario.h"
 #include "core/scenarios/ScenarioRegistry.h"
@@ -220,6 +222,7 @@ TrainingRunner::TrainingRunner(
     const Config& runnerConfig)
     : trainingSpec_(trainingSpec),
       individual_(individual),
+      worldPool_(runnerConfig.worldPool),
       maxTime_(evolutionConfig.maxSimulationTime),
       brainRegistry_(runnerConfig.brainRegistry),
       nesGameAdapterRegistry_(runnerConfig.nesGameAdapterRegistry),
@@ -257,6 +260,7 @@ TrainingRunner::TrainingRunner(
     scenarioConfig = buildEffectiveScenarioConfig(scenarioConfig);
 
     nesDriver_.reset();
+    nesTilePatternHashCache_.reset();
     nesScenarioConfig_ = ScenarioConfig{};
     nesWorldData_ = WorldData{};
 
@@ -286,6 +290,7 @@ TrainingRunner::TrainingRunner(
             nesDriver_->setApuEnabled(nesApuEnabled_);
             nesDriver_->setDetailedTimingEnabled(nesDetailedTimingEnabled_);
             nesDriver_->setRgbaOutputEnabled(nesRgbaOutputEnabled_);
+            nesDriver_->setPpuSnapshotEnabled(needsNesPpuSnapshots());
         }
 
         nesWorldData_.width = 256;
@@ -297,21 +302,44 @@ TrainingRunner::TrainingRunner(
         nesWorldData_.tree_vision.reset();
     }
     else {
-        scenario_ = registry.createScenario(individual_.scenarioId);
-        DIRTSIM_ASSERT(scenario_, "TrainingRunner: Scenario factory returned null");
+        std::optional<TrainingWorldPool::Entry> pooled;
+        if (worldPool_) {
+            worldPoolConfigKey_ = TrainingWorldPool::makeConfigKey(scenarioConfig);
+            pooled = worldPool_->acquire(individual_.scenarioId, worldPoolConfigKey_);
+        }
 
-        scenarioConfig = scenario_->resolveInitialConfig(scenarioConfig, Vector2s{});
-        const Vector2i defaultWorldSize{ 9, 9 };
-        const Vector2i resolvedWorldSize =
-            scenario_->resolveInitialWorldSize(scenarioConfig, defaultWorldSize);
-        DIRTSIM_ASSERT(
-            resolvedWorldSize.x > 0 && resolvedWorldSize.y > 0,
-            "TrainingRunner: Scenario returned invalid initial world size");
-        world_ = std::make_unique<World>(resolvedWorldSize.x, resolvedWorldSize.y);
+        if (pooled.has_value()) {
+            world_ = std::move(pooled->world);
+            scenario_ = std::move(pooled->scenario);
+            worldSetupSnapshot_ = std::move(pooled->snapshot);
+            worldReusedFromPool_ = true;
+        }
+        else {
+            scenario_ = registry.createScenario(individual_.scenarioId);
+            DIRTSIM_ASSERT(scenario_, "TrainingRunner: Scenario factory returned null");
+
+            scenarioConfig = scenario_->resolveInitialConfig(scenarioConfig, Vector2s{});
+            const Vector2i defaultWorldSize{ 9, 9 };
+            const Vector2i resolvedWorldSize =
+                scenario_->resolveInitialWorldSize(scenarioConfig, defaultWorldSize);
+            DIRTSIM_ASSERT(
+                resolvedWorldSize.x > 0 && resolvedWorldSize.y > 0,
+                "TrainingRunner: Scenario returned invalid initial world size");
+            world_ = std::make_unique<World>(resolvedWorldSize.x, resolvedWorldSize.y);
+
+            scenario_->setConfig(scenarioConfig, *world_);
+            scenario_->setup(*world_);
 
-        scenario_->setConfig(scenarioConfig, *world_);
-        scenario_->setup(*world_);
+            if (worldPool_ && scenario_->isSetupCapturedByWorld()
+                && world_->getOrganismManager().getOrganismCount() == 0) {
+                worldSetupSnapshot_ = world_->captureSetupSnapshot();
+            }
+        }
         world_->setScenario(scenario_.get());
+        if (runnerConfig.worldRngSeed.has_value()) {
+            world_->setRandomSeed(runnerConfig.worldRngSeed.value());
+            scenario_->setRandomSeed(runnerConfig.worldRngSeed.value());
+        }
 
         initDuckClockDoors();
     }
@@ -324,18 +352,24 @@ TrainingRunner::TrainingRunner(
     nesLastControllerTelemetry_.reset();
     nesLastDebugState_.reset();
     if (controlMode_ == BrainRegistryEntry::ControlMode::ScenarioDriven) {
+        const InferencePrecision precision =
+            individual_.brain.brainVariant.value_or("") == TrainingBrainVariant::Int8Inference
+            ? InferencePrecision::Int8
+            : InferencePrecision::Float32;
         if (individual_.brain.brainKind == TrainingBrainKind::DuckNeuralNetRecurrentV2) {
             DIRTSIM_ASSERT(
                 individual_.genome.has_value(),
                 "TrainingRunner: NES duck recurrent V2 controller requires a genome");
             nesDuckBrainV2_ =
                 std::make_unique<DuckNeuralNetRecurrentBrainV2>(individual_.genome.value());
+            nesDuckBrainV2_->setInferencePrecision(precision);
         }
         else if (individual_.brain.brainKind == TrainingBrainKind::NesTileRecurrent) {
             DIRTSIM_ASSERT(
                 individual_.genome.has_value(),
                 "TrainingRunner: NES tile recurrent controller requires a genome");
             nesTileBrain_ = std::make_unique<NesTileRecurrentBrain>(individual_.genome.value());
+            nesTileBrain_->setInferencePrecision(precision);
         }
     }
 
@@ -353,7 +387,21 @@ TrainingRunner::TrainingRunner(
     }
 }
 
-TrainingRunner::~TrainingRunner() = default;
+TrainingRunner::~TrainingRunner()
+{
+    if (!worldPool_ || !worldSetupSnapshot_ || !world_ || !scenario_) {
+        return;
+    }
+
+    worldPool_->release(
+        TrainingWorldPool::Entry{
+            .scenarioId = individual_.scenarioId,
+            .configKey = std::move(worldPoolConfigKey_),
+            .world = std::move(world_),
+            .scenario = std::move(scenario_),
+            .snapshot = std::move(worldSetupSnapshot_),
+        });
+}
 
 TrainingRunner::TrainingRunner(TrainingRunner&&) noexcept = default;
 TrainingRunner& TrainingRunner::operator=(TrainingRunner&&) noexcept = default;
@@ -801,6 +849,8 @@ Result<std::monostate, std::string> TrainingRunner::setScenarioConfig(const Scen
 {
     const ScenarioConfig effectiveConfig = buildEffectiveScenarioConfig(config);
     if (scenario_ && world_) {
+        // The pooled snapshot was keyed on the previous config.
+        worldSetupSnapshot_.reset();
         scenario_->setConfig(effectiveConfig, *world_);
         return Result<std::monostate, std::string>::okay(std::monostate{});
     }
@@ -821,6 +871,7 @@ Result<std::monostate, std::string> TrainingRunner::setScenarioConfig(const Scen
         nesDriver_->setApuEnabled(nesApuEnabled_);
         nesDriver_->setDetailedTimingEnabled(nesDetailedTimingEnabled_);
         nesDriver_->setRgbaOutputEnabled(nesRgbaOutputEnabled_);
+        nesDriver_->setPpuSnapshotEnabled(needsNesPpuSnapshots());
 
         if (nesGameAdapter_) {
             nesGameAdapter_->reset(nesDriver_->getRuntimeResolvedRomId());
@@ -1133,6 +1184,13 @@ DuckSensoryData TrainingRunner::makeNesDuckSensoryData() const
     return nesGameAdapter_->makeDuckSensoryData(sensoryInput);
 }
 
+bool TrainingRunner::needsNesPpuSnapshots() const
+{
+    // Tile brains read the PPU every step; visible runners also serve the tile debug views.
+    return nesRgbaOutputEnabled_
+        || individual_.brain.brainKind == TrainingBrainKind::NesTileRecurrent;
+}
+
 NesTileSensoryData TrainingRunner::makeNesTileSensoryData()
 {
     ScopeTimer totalTimer(nesTimers_, "nes_tile_sensory_total");
@@ -1155,7 +1213,10 @@ NesTileSensoryData TrainingRunner::makeNesTileSensoryData()
 
     const NesTileFrame tileFrame = [this, &ppuSnapshot]() {
         ScopeTimer timer(nesTimers_, "nes_tile_frame_extract");
-        const NesTileFrameBuildOptions options{ .includePatternPixels = false };
+        const NesTileFrameBuildOptions options{
+            .includePatternPixels = false,
+            .patternHashCache = &nesTilePatternHashCache_,
+        };
         return makeNesTileFrame(ppuSnapshot.value(), options, &nesTimers_);
     }();
     const NesTileSensoryBuilderInput tileInput = [this, &tileFrame]() {
@@ -3,6 +3,7 @@
 #include "core/Result.h"
 #include "core/ScenarioConfig.h"
 #include "core/Timers.h"
+#include "core/World.h"
 #include "core/WorldData.h"
 #include "core/organisms/OrganismType.h"
 #include "core/organisms/brains/DuckNeuralNetRecurrentBrainV2.h"
@@ -20,6 +21,7 @@
 #include "core/scenarios/nes/NesGameAdapter.h"
 #include "core/scenarios/nes/NesGameAdapterRegistry.h"
 #include "core/scenarios/nes/NesPaletteFrame.h"
+#include "core/scenarios/nes/NesTileFrame.h"
 #include <array>
 #include <cstdint>
 #include <functional>
@@ -47,6 +49,7 @@ namespace Organism {
 class Body;
 }
 class ScenarioRunner;
+class TrainingWorldPool;
 class World;
 
 /**
@@ -130,6 +133,11 @@ public:
         bool nesDetailedTimingEnabled = false;
         bool nesRgbaOutputEnabled = true;
         std::optional<ScenarioConfig> scenarioConfigOverride = std::nullopt;
+        // Optional per-worker pool; the World is borrowed from it and returned on destruction.
+        TrainingWorldPool* worldPool = nullptr;
+        // Seeds the World and scenario RNGs, and through the World any brain RNG drawn at spawn,
+        // so a pass can be replayed exactly, e.g. to recapture its final snapshot.
+        std::optional<uint32_t> worldRngSeed = std::nullopt;
     };
 
     TrainingRunner(
@@ -158,6 +166,7 @@ public:
     const World* getWorld() const { return world_.get(); }
     World* getWorld() { return world_.get(); }
     bool isNesScenario() const { return nesDriver_ != nullptr; }
+    bool isWorldReusedFromPool() const { return worldReusedFromPool_; }
     const std::optional<ScenarioVideoFrame>& getScenarioVideoFrame() const
     {
         return nesScenarioVideoFrame_;
@@ -202,6 +211,7 @@ public:
 
 private:
     void resolveBrainEntry();
+    bool needsNesPpuSnapshots() const;
     NesFrameTrace runScenarioDrivenStep();
     DuckSensoryData makeNesDuckSensoryData() const;
     NesTileSensoryData makeNesTileSensoryData();
@@ -219,10 +229,15 @@ private:
     Individual individual_;
     std::unique_ptr<World> world_;
     std::unique_ptr<ScenarioRunner> scenario_;
+    TrainingWorldPool* worldPool_ = nullptr;
+    std::vector<std::byte> worldPoolConfigKey_;
+    std::shared_ptr<const World::SetupSnapshot> worldSetupSnapshot_;
+    bool worldReusedFromPool_ = false;
     std::unique_ptr<NesSmolnesScenarioDriver> nesDriver_;
     ScenarioConfig nesScenarioConfig_;
     WorldData nesWorldData_;
     Timers nesTimers_;
+    NesTilePatternHashCache nesTilePatternHashCache_;
     std::optional<ScenarioVideoFrame> nesScenarioVideoFrame_;
     OrganismId organismId_ = INVALID_ORGANISM_ID;
 
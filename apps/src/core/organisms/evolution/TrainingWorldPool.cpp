@@ -0,0 +1,70 @@
+#include "TrainingWorldPool.h"
+
+#include "core/Assert.h"
+#include "core/scenarios/Scenario.h"
+
+#include <algorithm>
+#include <zpp_bits.h>
+
+namespace DirtSim {
+
+TrainingWorldPool::TrainingWorldPool(size_t maxEntries) : maxEntries_(maxEntries)
+{}
+
+TrainingWorldPool::~TrainingWorldPool() = default;
+
+std::optional<TrainingWorldPool::Entry> TrainingWorldPool::acquire(
+    Scenario::EnumType scenarioId, const std::vector<std::byte>& configKey)
+{
+    const auto it = std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry) {
+        return entry.scenarioId == scenarioId && entry.configKey == configKey;
+    });
+    if (it == entries_.end()) {
+        misses_++;
+        return std::nullopt;
+    }
+
+    hits_++;
+    Entry entry = std::move(*it);
+    entries_.erase(it);
+    entry.world->restoreSetupSnapshot(*entry.snapshot);
+    return entry;
+}
+
+void TrainingWorldPool::release(Entry entry)
+{
+    if (maxEntries_ == 0 || !entry.world || !entry.scenario || !entry.snapshot) {
+        return;
+    }
+
+    // Detach so a pooled World never points at a scenario it does not own.
+    entry.world->setScenario(nullptr);
+    entries_.push_front(std::move(entry));
+    while (entries_.size() > maxEntries_) {
+        entries_.pop_back();
+    }
+}
+
+void TrainingWorldPool::clear()
+{
+    entries_.clear();
+}
+
+TrainingWorldPool::Stats TrainingWorldPool::getStats() const
+{
+    return Stats{
+        .hits = hits_,
+        .misses = misses_,
+        .pooledCount = entries_.size(),
+    };
+}
+
+std::vector<std::byte> TrainingWorldPool::makeConfigKey(const ScenarioConfig& config)
+{
+    std::vector<std::byte> key;
+    zpp::bits::out out(key);
+    out(config).or_throw();
+    return key;
+}
+
+} // namespace DirtSim
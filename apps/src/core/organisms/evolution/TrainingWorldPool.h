@@ -0,0 +1,67 @@
+#pragma once
+
+#include "core/ScenarioConfig.h"
+#include "core/ScenarioId.h"
+#include "core/World.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace DirtSim {
+
+class ScenarioRunner;
+
+/**
+ * Per-worker cache of constructed Worlds and their scenarios for training evaluations.
+ *
+ * Only scenarios whose post-setup state lives entirely in the World are pooled.
+ * A pooled World is reset by restoring the snapshot taken after its first setup,
+ * which skips grid, calculator, and light buffer allocation as well as scenario
+ * setup. Not thread-safe; each evaluation worker owns its own pool.
+ */
+class TrainingWorldPool {
+public:
+    struct Entry {
+        Scenario::EnumType scenarioId = Scenario::EnumType::Empty;
+        std::vector<std::byte> configKey;
+        std::unique_ptr<World> world;
+        std::unique_ptr<ScenarioRunner> scenario;
+        std::shared_ptr<const World::SetupSnapshot> snapshot;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t pooledCount = 0;
+    };
+
+    explicit TrainingWorldPool(size_t maxEntries = 2);
+    ~TrainingWorldPool();
+
+    TrainingWorldPool(const TrainingWorldPool&) = delete;
+    TrainingWorldPool& operator=(const TrainingWorldPool&) = delete;
+
+    // Returns a World restored to its setup snapshot, or nullopt when nothing matches.
+    std::optional<Entry> acquire(
+        Scenario::EnumType scenarioId, const std::vector<std::byte>& configKey);
+
+    // Entries without a snapshot are dropped. Oldest entries are evicted past maxEntries.
+    void release(Entry entry);
+
+    void clear();
+    Stats getStats() const;
+
+    static std::vector<std::byte> makeConfigKey(const ScenarioConfig& config);
+
+private:
+    size_t maxEntries_ = 0;
+    std::deque<Entry> entries_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+} // namespace DirtSim
@@ -7,6 +7,8 @@
 #include <filesystem>
 #include <gtest/gtest.h>
 #include <optional>
+#include <sqlite_modern_cpp.h>
+#include <stdexcept>
 #include <thread>
 #include <unordered_set>
 #include <vector>
@@ -131,6 +133,23 @@ TEST_F(GenomeRepositoryTest, ClearRemovesAllGenomes)
     EXPECT_TRUE(repo.empty());
 }
 
+TEST_F(GenomeRepositoryTest, RevisionChangesOnlyWhenMetadataChanges)
+{
+    const uint64_t initial = repo.getRevision();
+
+    const GenomeId id = UUID::generate();
+    repo.store(id, createTestGenome(0.1), createTestMetadata("a", 1.0));
+    const uint64_t afterStore = repo.getRevision();
+    EXPECT_NE(afterStore, initial);
+
+    repo.markAsBest(id);
+    repo.remove(UUID::generate());
+    EXPECT_EQ(repo.getRevision(), afterStore);
+
+    repo.remove(id);
+    EXPECT_NE(repo.getRevision(), afterStore);
+}
+
 TEST_F(GenomeRepositoryTest, BestTrackingWorks)
 {
     // Store two genomes, only use id2.
@@ -501,8 +520,10 @@ protected:
 
     void TearDown() override
     {
-        // Clean up the test database.
+        // Clean up the test database and its WAL side files.
         std::filesystem::remove(dbPath_);
+        std::filesystem::remove(dbPath_.string() + "-shm");
+        std::filesystem::remove(dbPath_.string() + "-wal");
     }
 
     Genome createTestGenome(float value) { return Genome(1, static_cast<WeightType>(value)); }
@@ -712,3 +733,242 @@ TEST_F(GenomeRepositoryPersistenceTest, OverwritePersistsAcrossReopen)
         EXPECT_DOUBLE_EQ(meta->fitness, 9.0);
     }
 }
+
+TEST_F(GenomeRepositoryPersistenceTest, ReopenPagesWeightsInOnDemand)
+{
+    GenomeId id = UUID::generate();
+    {
+        GenomeRepository repo(dbPath_);
+        repo.store(id, Genome(64, 0.25f), createTestMetadata("lazy", 1.0));
+    }
+
+    GenomeRepository repo(dbPath_);
+    EXPECT_EQ(repo.getWeightCacheStats().residentCount, 0u);
+
+    auto cold = repo.get(id);
+    ASSERT_TRUE(cold.has_value());
+    EXPECT_EQ(cold->weights.size(), 64u);
+    EXPECT_FLOAT_EQ(cold->weights[0], 0.25f);
+
+    auto warm = repo.get(id);
+    ASSERT_TRUE(warm.has_value());
+    EXPECT_EQ(*warm, *cold);
+
+    const auto stats = repo.getWeightCacheStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.residentCount, 1u);
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, WeightCacheEvictsToBudgetWithoutLosingGenomes)
+{
+    const GenomeRepository::Config config{
+        .weightCacheBudgetBytes = 2 * 16 * sizeof(WeightType),
+        .mmapSizeBytes = 0,
+        .weightEncoding = WeightEncoding::Float32,
+        .layoutResolver = nullptr,
+    };
+    GenomeRepository repo(dbPath_, config);
+
+    std::vector<GenomeId> ids;
+    for (int i = 0; i < 4; i++) {
+        ids.push_back(UUID::generate());
+        repo.store(
+            ids.back(),
+            Genome(16, static_cast<WeightType>(i)),
+            createTestMetadata("cached_" + std::to_string(i), static_cast<double>(i)));
+    }
+
+    auto stats = repo.getWeightCacheStats();
+    EXPECT_EQ(stats.residentCount, 2u);
+    EXPECT_LE(stats.residentBytes, config.weightCacheBudgetBytes);
+    EXPECT_EQ(stats.evictions, 2u);
+
+    for (int i = 0; i < 4; i++) {
+        auto genome = repo.get(ids[i]);
+        ASSERT_TRUE(genome.has_value());
+        EXPECT_FLOAT_EQ(genome->weights[0], static_cast<WeightType>(i));
+    }
+    EXPECT_LE(repo.getWeightCacheStats().residentBytes, config.weightCacheBudgetBytes);
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, StoreOrUpdateByHashBatchPersistsAllEntries)
+{
+    const Genome first(8, 0.1f);
+    const Genome second(8, 0.2f);
+    std::vector<GenomeRepository::StoreByHashEntry> entries{
+        { .genome = &first, .metadata = createTestMetadata("first", 1.0) },
+        { .genome = &second, .metadata = createTestMetadata("second", 2.0) },
+        { .genome = &first, .metadata = createTestMetadata("first_again", 3.0) },
+    };
+
+    std::vector<GenomeRepository::StoreByHashResult> results;
+    {
+        GenomeRepository repo(dbPath_);
+        results = repo.storeOrUpdateByHashBatch(entries);
+        ASSERT_EQ(results.size(), 3u);
+        EXPECT_TRUE(results[0].inserted);
+        EXPECT_TRUE(results[1].inserted);
+        EXPECT_TRUE(results[2].deduplicated);
+        EXPECT_EQ(results[2].id, results[0].id);
+    }
+
+    GenomeRepository repo(dbPath_);
+    EXPECT_EQ(repo.count(), 2u);
+    auto meta = repo.getMetadata(results[0].id);
+    ASSERT_TRUE(meta.has_value());
+    EXPECT_DOUBLE_EQ(meta->fitness, 3.0);
+    auto genome = repo.get(results[1].id);
+    ASSERT_TRUE(genome.has_value());
+    EXPECT_EQ(*genome, second);
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, StoreOrUpdateByHashBatchRollsBackWhenAnEntryThrows)
+{
+    const Genome first(8, 0.1f);
+    const Genome second(8, 0.2f);
+    const Genome third(8, 0.3f);
+    const GenomeId firstId = UUID::generate();
+    const GenomeId secondId = UUID::generate();
+    const GenomeRepository::Config config{
+        .weightEncoding = WeightEncoding::Int8,
+        .layoutResolver =
+            [](const GenomeMetadata& meta) {
+                if (meta.name == "bad") {
+                    throw std::runtime_error("layout unavailable");
+                }
+                return GenomeLayout{};
+            },
+    };
+    std::vector<GenomeRepository::StoreByHashEntry> failingBatch{
+        { .genome = &first, .metadata = createTestMetadata("first", 1.0), .preferredId = firstId },
+        { .genome = &second, .metadata = createTestMetadata("bad", 2.0), .preferredId = secondId },
+    };
+    std::vector<GenomeRepository::StoreByHashEntry> laterBatch{
+        { .genome = &third, .metadata = createTestMetadata("third", 3.0) },
+    };
+
+    std::vector<GenomeRepository::StoreByHashResult> laterResults;
+    {
+        GenomeRepository repo(dbPath_, config);
+        const uint64_t revision = repo.getRevision();
+        EXPECT_THROW(repo.storeOrUpdateByHashBatch(failingBatch), std::runtime_error);
+
+        // Nothing from the failed batch is visible in memory either.
+        EXPECT_FALSE(repo.exists(firstId));
+        EXPECT_FALSE(repo.get(firstId).has_value());
+        EXPECT_TRUE(repo.list().empty());
+        EXPECT_EQ(repo.getRevision(), revision);
+
+        // The failed batch must not leave a transaction open for the next one.
+        laterResults = repo.storeOrUpdateByHashBatch(laterBatch);
+        ASSERT_EQ(laterResults.size(), 1u);
+    }
+
+    GenomeRepository repo(dbPath_);
+    EXPECT_EQ(repo.count(), 1u);
+    EXPECT_TRUE(repo.exists(laterResults[0].id));
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, StoreOrUpdateByHashBatchReturnsNothingWhenAWriteFails)
+{
+    const Genome first(8, 0.1f);
+    const Genome second(8, 0.2f);
+    const GenomeId firstId = UUID::generate();
+    {
+        GenomeRepository repo(dbPath_);
+    }
+    {
+        sqlite::database db(dbPath_.string());
+        db << "CREATE TRIGGER reject_bad BEFORE INSERT ON genomes"
+              " WHEN NEW.metadata_json LIKE '%\"bad\"%'"
+              " BEGIN SELECT RAISE(ABORT, 'rejected'); END";
+    }
+    std::vector<GenomeRepository::StoreByHashEntry> failingBatch{
+        { .genome = &first, .metadata = createTestMetadata("first", 1.0), .preferredId = firstId },
+        { .genome = &second, .metadata = createTestMetadata("bad", 2.0) },
+    };
+
+    {
+        GenomeRepository repo(dbPath_);
+        const uint64_t revision = repo.getRevision();
+        EXPECT_TRUE(repo.storeOrUpdateByHashBatch(failingBatch).empty());
+        EXPECT_FALSE(repo.exists(firstId));
+        EXPECT_FALSE(repo.get(firstId).has_value());
+        EXPECT_TRUE(repo.list().empty());
+        EXPECT_EQ(repo.getRevision(), revision);
+
+        const auto retry = repo.storeOrUpdateByHashBatch(
+            std::span<const GenomeRepository::StoreByHashEntry>(failingBatch).first(1));
+        ASSERT_EQ(retry.size(), 1u);
+        EXPECT_EQ(retry[0].id, firstId);
+    }
+
+    GenomeRepository repo(dbPath_);
+    EXPECT_EQ(repo.count(), 1u);
+    EXPECT_TRUE(repo.exists(firstId));
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, Int8EncodingKeepsGenomesThatQuantizeAlikeDistinct)
+{
+    Genome genome(64);
+    for (size_t i = 0; i < genome.weights.size(); i++) {
+        genome.weights[i] = static_cast<WeightType>(i) * 0.037f - 1.1f;
+    }
+    // Well under one int8 step, so both genomes encode to the same bytes.
+    Genome nudged = genome;
+    nudged.weights[10] += 1e-4f;
+
+    const GenomeRepository::Config config{
+        .weightEncoding = WeightEncoding::Int8,
+        .layoutResolver = nullptr,
+    };
+    GenomeRepository repo(dbPath_, config);
+    const auto first = repo.storeOrUpdateByHash(genome, createTestMetadata("original", 1.0));
+    const auto second = repo.storeOrUpdateByHash(nudged, createTestMetadata("nudged", 2.0));
+
+    EXPECT_TRUE(first.inserted);
+    EXPECT_TRUE(second.inserted);
+    EXPECT_NE(first.id, second.id);
+    EXPECT_EQ(repo.get(first.id).value(), repo.get(second.id).value());
+    EXPECT_EQ(repo.count(), 2u);
+}
+
+TEST_F(GenomeRepositoryPersistenceTest, Int8EncodedWeightsMatchBeforeAndAfterReopen)
+{
+    Genome genome(64);
+    for (size_t i = 0; i < genome.weights.size(); i++) {
+        genome.weights[i] = static_cast<WeightType>(i) * 0.037f - 1.1f;
+    }
+    const GenomeId floatId = UUID::generate();
+    const GenomeId int8Id = UUID::generate();
+
+    // Rows written before the encoding change keep their float weights.
+    {
+        GenomeRepository repo(dbPath_);
+        repo.store(floatId, genome, createTestMetadata("float", 1.0));
+    }
+
+    std::optional<Genome> storedInt8;
+    {
+        const GenomeRepository::Config config{
+            .weightEncoding = WeightEncoding::Int8,
+            .layoutResolver = nullptr,
+        };
+        GenomeRepository repo(dbPath_, config);
+        repo.store(int8Id, genome, createTestMetadata("int8", 2.0));
+        storedInt8 = repo.get(int8Id);
+        ASSERT_TRUE(storedInt8.has_value());
+        for (size_t i = 0; i < genome.weights.size(); i++) {
+            EXPECT_NEAR(storedInt8->weights[i], genome.weights[i], 1.2f / 127.0f);
+        }
+    }
+
+    GenomeRepository repo(dbPath_);
+    auto reloadedFloat = repo.get(floatId);
+    ASSERT_TRUE(reloadedFloat.has_value());
+    EXPECT_EQ(*reloadedFloat, genome);
+    auto reloadedInt8 = repo.get(int8Id);
+    ASSERT_TRUE(reloadedInt8.has_value());
+    EXPECT_EQ(*reloadedInt8, storedInt8.value());
+}
@@ -1,5 +1,6 @@
 #include "core/World.h"
 #include "core/WorldData.h"
+#include "core/WorldStateHash.h"
 #include "core/organisms/Duck.h"
 #include "core/organisms/DuckBrain.h"
 #include "core/organisms/OrganismManager.h"
@@ -12,10 +13,12 @@
 #include "core/organisms/brains/RuleBased2Brain.h"
 #include "core/organisms/brains/RuleBasedBrain.h"
 #include "core/organisms/evolution/EvolutionConfig.h"
+#include "core/organisms/evolution/FitnessCalculator.h"
 #include "core/organisms/evolution/GenomeRepository.h"
 #include "core/organisms/evolution/TrainingBrainRegistry.h"
 #include "core/organisms/evolution/TrainingRunner.h"
 #include "core/organisms/evolution/TrainingSpec.h"
+#include "core/organisms/evolution/TrainingWorldPool.h"
 #include "core/scenarios/ClockScenario.h"
 #include "core/scenarios/clock_scenario/DoorManager.h"
 #include "core/scenarios/clock_scenario/ObstacleManager.h"
@@ -421,6 +424,59 @@ TEST_F(TrainingRunnerTest, TreeGerminationUsesScenarioInitialWorldSize)
     EXPECT_EQ(world->getData().height, 32);
 }
 
+TEST_F(TrainingRunnerTest, PooledTreeGerminationWorldMatchesFreshSetup)
+{
+    config_.maxSimulationTime = 1.0;
+
+    TrainingSpec spec;
+    spec.scenarioId = Scenario::EnumType::TreeGermination;
+    spec.organismType = OrganismType::TREE;
+
+    TrainingRunner::Individual individual;
+    individual.brain.brainKind = TrainingBrainKind::NeuralNet;
+    individual.genome = NeuralNetBrain::randomGenome(rng_);
+
+    TrainingWorldPool pool;
+    const TrainingRunner::Config runnerConfig{
+        .brainRegistry = TrainingBrainRegistry::createDefault(),
+        .worldPool = &pool,
+    };
+
+    std::vector<Cell> freshCells;
+    const World* firstWorld = nullptr;
+    {
+        TrainingRunner runner(spec, individual, config_, genomeRepository_, runnerConfig);
+        EXPECT_FALSE(runner.isWorldReusedFromPool());
+        firstWorld = runner.getWorld();
+        ASSERT_NE(firstWorld, nullptr);
+        freshCells = firstWorld->getData().cells;
+
+        // Dirty the world so reuse has to restore it.
+        runner.step(30);
+    }
+    EXPECT_EQ(pool.getStats().pooledCount, 1u);
+
+    TrainingRunner reused(spec, individual, config_, genomeRepository_, runnerConfig);
+    EXPECT_TRUE(reused.isWorldReusedFromPool());
+    ASSERT_EQ(reused.getWorld(), firstWorld);
+    EXPECT_EQ(pool.getStats().hits, 1u);
+
+    // The evaluation organism is spawned fresh; every other cell matches the original setup.
+    const auto& reusedCells = reused.getWorld()->getData().cells;
+    ASSERT_EQ(reusedCells.size(), freshCells.size());
+    size_t mismatchedCells = 0;
+    for (size_t i = 0; i < reusedCells.size(); ++i) {
+        if (reusedCells[i].material_type != freshCells[i].material_type) {
+            mismatchedCells++;
+        }
+    }
+    EXPECT_EQ(mismatchedCells, 0u);
+
+    const auto status = reused.step(1);
+    EXPECT_EQ(status.state, TrainingRunner::State::Running);
+    EXPECT_NEAR(reused.getSimTime(), 0.016, 0.001);
+}
+
 TEST_F(TrainingRunnerTest, TrainingBrainRegistryIncludesNesScenarioDrivenEntry)
 {
     TrainingBrainRegistry registry = TrainingBrainRegistry::createDefault();
@@ -1283,6 +1339,140 @@ TEST_F(TrainingRunnerTest, ClockDuckRandomizesSpawnSide)
     EXPECT_TRUE(sawRightSpawn);
 }
 
+TEST_F(TrainingRunnerTest, SeededClockDuckPassReplaysExactly)
+{
+    constexpr uint32_t kEvaluationSeed = 91u;
+    config_.maxSimulationTime = 4.0;
+
+    TrainingSpec spec;
+    spec.scenarioId = Scenario::EnumType::Clock;
+    spec.organismType = OrganismType::DUCK;
+
+    // The random brain and the clock's weather both draw from RNGs that the seed must pin.
+    const auto runPass = [&]() {
+        TrainingRunner::Individual individual;
+        individual.brain.brainKind = TrainingBrainKind::Random;
+        individual.scenarioId = Scenario::EnumType::Clock;
+
+        TrainingRunner::Config runnerConfig{
+            .brainRegistry = TrainingBrainRegistry::createDefault(),
+            .duckClockSpawnLeftFirst = true,
+            .duckClockSpawnRngSeed = kEvaluationSeed,
+        };
+        runnerConfig.worldRngSeed = kEvaluationSeed;
+        TrainingRunner runner(spec, individual, config_, genomeRepository_, runnerConfig);
+
+        World* world = runner.getWorld();
+        EXPECT_NE(world, nullptr);
+        if (!world) {
+            return uint64_t{ 0 };
+        }
+        auto* clock = dynamic_cast<ClockScenario*>(world->getScenario());
+        EXPECT_NE(clock, nullptr);
+        if (clock) {
+            clock->setTimeOverride("1 2 : 3 4");
+        }
+
+        int steps = 0;
+        while (runner.step(16).state == TrainingRunner::State::Running) {
+            if (++steps > 1000) {
+                ADD_FAILURE() << "Clock duck evaluation did not finish";
+                break;
+            }
+        }
+
+        WorldStateHash hash;
+        hash.setConfig(WorldStateHash::Config{ .quantum = 0.0f, .full_rescan_interval = 300 });
+        hash.rehashAll(world->getData());
+        return hash.getRoot();
+    };
+
+    const uint64_t first = runPass();
+    const uint64_t replay = runPass();
+    EXPECT_NE(first, 0u);
+    EXPECT_EQ(first, replay);
+}
+
+TEST_F(TrainingRunnerTest, ClockDuckInt8InferenceFitnessTracksFloatFitness)
+{
+    constexpr int kGenomeCount = 4;
+    constexpr uint32_t kEvaluationSeed = 77u;
+    config_.maxSimulationTime = 5.0;
+
+    TrainingSpec spec;
+    spec.scenarioId = Scenario::EnumType::Clock;
+    spec.organismType = OrganismType::DUCK;
+
+    const auto evaluate = [&](const Genome& genome, const char* variant) {
+        TrainingRunner::Individual individual;
+        individual.brain.brainKind = TrainingBrainKind::DuckNeuralNetRecurrentV2;
+        individual.brain.brainVariant = std::string(variant);
+        individual.scenarioId = Scenario::EnumType::Clock;
+        individual.genome = genome;
+
+        TrainingRunner::Config runnerConfig{
+            .brainRegistry = TrainingBrainRegistry::createDefault(),
+            .duckClockSpawnLeftFirst = true,
+            .duckClockSpawnRngSeed = kEvaluationSeed,
+        };
+        runnerConfig.worldRngSeed = kEvaluationSeed;
+        TrainingRunner runner(spec, individual, config_, genomeRepository_, runnerConfig);
+
+        TrainingRunner::Status status;
+        int steps = 0;
+        while ((status = runner.step(16)).state == TrainingRunner::State::Running) {
+            if (++steps > 1000) {
+                ADD_FAILURE() << "Clock duck evaluation did not finish";
+                break;
+            }
+        }
+
+        const FitnessResult result{
+            .lifespan = status.lifespan,
+            .maxEnergy = status.maxEnergy,
+            .commandsAccepted = status.commandsAccepted,
+            .commandsRejected = status.commandsRejected,
+            .idleCancels = status.idleCancels,
+            .nesRewardTotal = status.nesRewardTotal,
+            .organismDied = status.state == TrainingRunner::State::OrganismDied,
+            .exitedThroughDoor = status.exitedThroughDoor,
+            .exitDoorTime = status.exitDoorTime,
+        };
+        const World* world = runner.getWorld();
+        const FitnessContext context{
+            .result = result,
+            .organismType = OrganismType::DUCK,
+            .worldWidth = world ? world->getData().width : 0,
+            .worldHeight = world ? world->getData().height : 0,
+            .evolutionConfig = config_,
+            .finalOrganism = runner.getOrganism(),
+            .duckArtifacts = runner.getDuckEvaluationArtifacts(),
+            .nesFitnessDetails = nullptr,
+            .organismTrackingHistory = &runner.getOrganismTrackingHistory(),
+            .treeResources = nullptr,
+        };
+        return computeFitnessForOrganism(context);
+    };
+
+    std::mt19937 genomeRng(1234u);
+    double totalAbsDrift = 0.0;
+    double totalAbsFitness = 0.0;
+    for (int g = 0; g < kGenomeCount; ++g) {
+        const Genome genome = DuckNeuralNetRecurrentBrainV2::randomGenome(genomeRng);
+        const double floatFitness = evaluate(genome, "");
+        const double int8Fitness = evaluate(genome, TrainingBrainVariant::Int8Inference);
+        std::cerr << "Genome " << g << ": float fitness " << floatFitness << ", int8 fitness "
+                  << int8Fitness << "\n";
+        totalAbsDrift += std::abs(floatFitness - int8Fitness);
+        totalAbsFitness += std::abs(floatFitness);
+    }
+
+    // Same genomes, same seeds: only inference rounding separates the two evaluations.
+    const double meanAbsDrift = totalAbsDrift / kGenomeCount;
+    const double meanAbsFitness = totalAbsFitness / kGenomeCount;
+    EXPECT_LE(meanAbsDrift, 0.1 * meanAbsFitness + 1e-6);
+}
+
 TEST_F(TrainingRunnerTest, ClockDuckSpawnSideOverrideRespectsRequestedSide)
 {
     TrainingSpec spec;
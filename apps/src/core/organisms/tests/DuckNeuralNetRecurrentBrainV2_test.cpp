@@ -5,11 +5,13 @@
 #include "core/LoggingChannels.h"
 #include "core/organisms/Duck.h"
 #include "core/organisms/OrganismManager.h"
+#include "core/organisms/brains/WeightQuantization.h"
 
 #include <algorithm>
 #include <array>
 #include <cerrno>
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <gtest/gtest.h>
 #include <iomanip>
@@ -529,6 +531,55 @@ TEST(DuckNeuralNetRecurrentBrainV2Test, RandomGenomesProduceCommandDiversity)
     LoggingChannels::get(LogChannel::Brain)->set_level(spdlog::level::info);
 }
 
+TEST(DuckNeuralNetRecurrentBrainV2Test, Int8InferenceTracksFloatOutputs)
+{
+    constexpr int kGenomeCount = 4;
+    constexpr int kSteps = 200;
+
+    std::mt19937 rng(1234u);
+    std::uniform_real_distribution<float> fill(0.0f, 1.0f);
+
+    double totalAbsDrift = 0.0;
+    int samples = 0;
+    int buttonAgreements = 0;
+
+    for (int g = 0; g < kGenomeCount; ++g) {
+        const Genome genome = DuckNeuralNetRecurrentBrainV2::randomGenome(rng);
+        DuckNeuralNetRecurrentBrainV2 floatBrain(genome);
+        DuckNeuralNetRecurrentBrainV2 int8Brain(genome);
+        int8Brain.setInferencePrecision(InferencePrecision::Int8);
+        EXPECT_EQ(int8Brain.getInferencePrecision(), InferencePrecision::Int8);
+
+        for (int step = 0; step < kSteps; ++step) {
+            DuckSensoryData sensory{};
+            for (auto& row : sensory.material_histograms) {
+                for (auto& cell : row) {
+                    cell[static_cast<size_t>(rng() % DuckSensoryData::NUM_MATERIALS)] = fill(rng);
+                }
+            }
+            sensory.energy = fill(rng);
+            sensory.health = fill(rng);
+            sensory.on_ground = (step % 3) != 0;
+
+            const ControllerOutput expected = floatBrain.inferControllerOutput(sensory);
+            const ControllerOutput actual = int8Brain.inferControllerOutput(sensory);
+            totalAbsDrift += std::abs(expected.xRaw - actual.xRaw);
+            totalAbsDrift += std::abs(expected.yRaw - actual.yRaw);
+            samples += 2;
+            buttonAgreements += (expected.a == actual.a) + (expected.b == actual.b);
+        }
+    }
+
+    // Genome weights are unchanged; only inference rounding differs.
+    const double meanAbsDrift = totalAbsDrift / samples;
+    const double buttonAgreement =
+        static_cast<double>(buttonAgreements) / (2.0 * kGenomeCount * kSteps);
+    std::cerr << "Int8 mean |drift|: " << meanAbsDrift << ", button agreement: " << buttonAgreement
+              << "\n";
+    EXPECT_LT(meanAbsDrift, 0.05);
+    EXPECT_GT(buttonAgreement, 0.95);
+}
+
 // Manual benchmark for direct duck recurrent brain profiling.
 //
 // This stays disabled because it prints timing summaries to stderr and is intended for targeted
@@ -8,6 +8,7 @@
 #include "core/organisms/OrganismManager.h"
 #include "core/organisms/OrganismSensoryData.h"
 #include <gtest/gtest.h>
+#include <random>
 
 using namespace DirtSim;
 
@@ -312,6 +313,93 @@ TEST(SensoryUtilsTest, IsEmptyReturnsTrueForOOB)
     EXPECT_TRUE(result4);
 }
 
+// =============================================================================
+// SensoryUtils::findTemplate tests
+// =============================================================================
+
+/**
+ * Test that findTemplate returns the first row-major position matching the pattern.
+ */
+TEST(SensoryUtilsTest, FindTemplateReturnsFirstRowMajorMatch)
+{
+    std::array<std::array<std::array<float, 10>, 21>, 21> histograms = {};
+    const int wall = static_cast<int>(Material::EnumType::Wall);
+    histograms[6][12][wall] = 1.0f;
+    histograms[7][12][wall] = 1.0f;
+    histograms[6][3][wall] = 1.0f;
+    histograms[7][3][wall] = 1.0f;
+    histograms[7][4][static_cast<int>(Material::EnumType::Dirt)] = 1.0f;
+
+    // Wall column with an empty cell to its right.
+    SensoryUtils::SensoryTemplate pattern(2, 2);
+    pattern.pattern[0][0] =
+        SensoryUtils::CellPattern(SensoryUtils::MatchMode::Is, { Material::EnumType::Wall });
+    pattern.pattern[1][0] =
+        SensoryUtils::CellPattern(SensoryUtils::MatchMode::Is, { Material::EnumType::Wall });
+    pattern.pattern[1][1] = SensoryUtils::CellPattern(SensoryUtils::MatchMode::IsEmpty);
+
+    const auto match = SensoryUtils::findTemplate<21, 10>(histograms, pattern);
+    ASSERT_TRUE(match.found);
+    EXPECT_EQ(match.col, 12);
+    EXPECT_EQ(match.row, 6);
+}
+
+/**
+ * Test that the bitboard search agrees with per-position matching for every match mode.
+ */
+TEST(SensoryUtilsTest, FindTemplateMatchesPerPositionSearch)
+{
+    using Histograms = std::array<std::array<std::array<float, 10>, 21>, 21>;
+    using SensoryUtils::CellPattern;
+    using SensoryUtils::MatchMode;
+
+    std::mt19937 rng(17u);
+    std::uniform_int_distribution<int> materialDist(0, 9);
+    std::uniform_int_distribution<int> modeDist(0, 6);
+    std::uniform_real_distribution<float> fillDist(0.0f, 1.0f);
+
+    for (int trial = 0; trial < 200; ++trial) {
+        Histograms histograms = {};
+        for (auto& row : histograms) {
+            for (auto& cell : row) {
+                if (fillDist(rng) < 0.3f) {
+                    continue;
+                }
+                cell[materialDist(rng)] = fillDist(rng);
+                if (fillDist(rng) < 0.2f) {
+                    cell[materialDist(rng)] = fillDist(rng);
+                }
+            }
+        }
+
+        SensoryUtils::SensoryTemplate pattern(1 + trial % 3, 1 + (trial / 3) % 3);
+        for (auto& patternRow : pattern.pattern) {
+            for (auto& cell : patternRow) {
+                const auto mode = static_cast<MatchMode>(modeDist(rng));
+                cell = CellPattern(
+                    mode,
+                    { static_cast<Material::EnumType>(materialDist(rng)),
+                      static_cast<Material::EnumType>(materialDist(rng)) });
+            }
+        }
+
+        SensoryUtils::TemplateMatch expected;
+        for (int row = 0; row <= 21 - pattern.height && !expected.found; ++row) {
+            for (int col = 0; col <= 21 - pattern.width; ++col) {
+                if (SensoryUtils::matchesTemplate<21, 10>(histograms, pattern, col, row)) {
+                    expected = SensoryUtils::TemplateMatch{ .found = true, .col = col, .row = row };
+                    break;
+                }
+            }
+        }
+
+        const auto actual = SensoryUtils::findTemplate<21, 10>(histograms, pattern);
+        ASSERT_EQ(actual.found, expected.found) << "trial " << trial;
+        EXPECT_EQ(actual.col, expected.col) << "trial " << trial;
+        EXPECT_EQ(actual.row, expected.row) << "trial " << trial;
+    }
+}
+
 // =============================================================================
 // Duck::gatherSensoryData tests
 // =============================================================================
@@ -0,0 +1,142 @@
+#include "core/organisms/brains/WeightQuantization.h"
+
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace DirtSim;
+
+namespace {
+
+GenomeLayout makeTwoSegmentLayout()
+{
+    return GenomeLayout{
+        .segments = {
+            GenomeSegment{ .name = "big", .size = 96 },
+            GenomeSegment{ .name = "small", .size = 32 },
+        },
+    };
+}
+
+Genome makeTwoScaleGenome()
+{
+    std::mt19937 rng(7u);
+    std::uniform_real_distribution<float> big(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> small(-0.01f, 0.01f);
+
+    Genome genome(128);
+    for (size_t i = 0; i < 96; ++i) {
+        genome.weights[i] = big(rng);
+    }
+    for (size_t i = 96; i < 128; ++i) {
+        genome.weights[i] = small(rng);
+    }
+    return genome;
+}
+
+} // namespace
+
+TEST(WeightQuantizationTest, ParseWeightEncodingAcceptsKnownNames)
+{
+    EXPECT_EQ(parseWeightEncoding("float32"), WeightEncoding::Float32);
+    EXPECT_EQ(parseWeightEncoding("fp16"), WeightEncoding::Float16);
+    EXPECT_EQ(parseWeightEncoding("int8"), WeightEncoding::Int8);
+    EXPECT_FALSE(parseWeightEncoding("int4").has_value());
+}
+
+TEST(WeightQuantizationTest, HalfRoundTripPreservesRepresentableValues)
+{
+    for (const float value : { 0.0f, -0.0f, 1.0f, -2.5f, 0.000061035156f, 65504.0f }) {
+        EXPECT_EQ(halfToFloat(floatToHalf(value)), value);
+    }
+    EXPECT_TRUE(std::isinf(halfToFloat(floatToHalf(1.0e6f))));
+    EXPECT_TRUE(std::isnan(halfToFloat(floatToHalf(std::nanf("")))));
+}
+
+TEST(WeightQuantizationTest, Float32BlobRoundTripIsExact)
+{
+    const Genome genome = makeTwoScaleGenome();
+    const auto blob = encodeGenomeWeights(genome, makeTwoSegmentLayout(), WeightEncoding::Float32);
+
+    const auto decoded = decodeGenomeWeights(blob);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->weights, genome.weights);
+}
+
+TEST(WeightQuantizationTest, Int8BlobScalesEachSegmentIndependently)
+{
+    const Genome genome = makeTwoScaleGenome();
+    const GenomeLayout layout = makeTwoSegmentLayout();
+    const auto blob = encodeGenomeWeights(genome, layout, WeightEncoding::Int8);
+    const auto float32Blob = encodeGenomeWeights(genome, layout, WeightEncoding::Float32);
+    EXPECT_LT(blob.size() * 3, float32Blob.size());
+
+    const auto decoded = decodeGenomeWeights(blob);
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->weights.size(), genome.weights.size());
+
+    // Each segment's error is bounded by half a step of its own scale.
+    for (size_t i = 0; i < 96; ++i) {
+        EXPECT_NEAR(decoded->weights[i], genome.weights[i], 4.0f / 127.0f);
+    }
+    for (size_t i = 96; i < 128; ++i) {
+        EXPECT_NEAR(decoded->weights[i], genome.weights[i], 0.01f / 127.0f);
+    }
+}
+
+TEST(WeightQuantizationTest, Float16BlobRoundTripMatchesRoundTripHelper)
+{
+    const Genome genome = makeTwoScaleGenome();
+    const GenomeLayout layout = makeTwoSegmentLayout();
+
+    const auto decoded =
+        decodeGenomeWeights(encodeGenomeWeights(genome, layout, WeightEncoding::Float16));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(
+        decoded->weights, roundTripGenomeWeights(genome, layout, WeightEncoding::Float16).weights);
+}
+
+TEST(WeightQuantizationTest, DecodeRejectsTruncatedBlob)
+{
+    const Genome genome = makeTwoScaleGenome();
+    auto blob = encodeGenomeWeights(genome, makeTwoSegmentLayout(), WeightEncoding::Int8);
+    blob.resize(blob.size() - 1);
+
+    EXPECT_FALSE(decodeGenomeWeights(blob).has_value());
+    EXPECT_FALSE(decodeGenomeWeights(std::vector<uint8_t>{ 1, 2, 3 }).has_value());
+}
+
+TEST(WeightQuantizationTest, Int8RowProductsMatchFloatWithinScale)
+{
+    constexpr int kRows = 19;
+    constexpr int kColumns = 13;
+    std::mt19937 rng(11u);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<WeightType> weights(kRows * kColumns);
+    for (auto& w : weights) {
+        w = dist(rng);
+    }
+    std::vector<WeightType> input(kRows);
+    for (auto& v : input) {
+        v = dist(rng);
+    }
+    input[3] = 0.0f;
+
+    std::vector<WeightType> expected(kColumns, 0.0f);
+    for (int r = 0; r < kRows; ++r) {
+        for (int c = 0; c < kColumns; ++c) {
+            expected[c] += input[r] * weights[r * kColumns + c];
+        }
+    }
+
+    const Int8Matrix matrix = Int8Matrix::quantize(weights, kRows, kColumns);
+    std::vector<WeightType> actual(kColumns, 0.0f);
+    accumulateInt8RowProducts(matrix, input, actual);
+
+    for (int c = 0; c < kColumns; ++c) {
+        EXPECT_NEAR(actual[c], expected[c], kRows * matrix.scale * 0.5f);
+    }
+}
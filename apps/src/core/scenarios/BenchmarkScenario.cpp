@@ -6,7 +6,7 @@
 #include "core/water/WaterVolumeView.h"
 #include "spdlog/spdlog.h"
 #include <algorithm>
-#include <cstdlib>
+#include <random>
 
 namespace DirtSim {
 
@@ -110,12 +110,15 @@ void BenchmarkScenario::setup(World& world)
     uint32_t sandCellCount = static_cast<uint32_t>(totalCells * 0.05);
     uint32_t sandAdded = 0;
 
-    // Use simple pseudo-random generation for reproducibility.
-    std::srand(42); // Fixed seed for consistent benchmarks.
+    // Fixed seed for consistent benchmarks. A local engine, so concurrent runs in one process
+    // don't share (and race on) the global std::rand state.
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> xDist(1, world.getData().width - 2);
+    std::uniform_int_distribution<uint32_t> yDist(1, world.getData().height - 2);
 
     while (sandAdded < sandCellCount) {
-        uint32_t x = 1 + (std::rand() % (world.getData().width - 2));
-        uint32_t y = 1 + (std::rand() % (world.getData().height - 2));
+        uint32_t x = xDist(rng);
+        uint32_t y = yDist(rng);
 
         // Only add sand to AIR cells (don't overwrite water, balls, or walls).
         if (world.getData().at(x, y).material_type == Material::EnumType::Air) {
@@ -7,6 +7,7 @@
 #include "core/Cell.h"
 #include "core/ColorNames.h"
 #include "core/FragmentationParams.h"
+#include "core/GlyphAtlas.h"
 #include "core/LightCalculatorBase.h"
 #include "core/LightManager.h"
 #include "core/LightTypes.h"
@@ -112,6 +113,15 @@ uint32_t getMaterialColor(Material::EnumType mat)
     return getLegacyMaterialColor(mat);
 }
 
+// Persist glyphs sampled since the last save so the next boot can skip rasterizing them.
+// The write runs on the atlas's own thread; the server flushes whatever is left on exit.
+void saveGlyphAtlasInBackground()
+{
+    if (auto atlas = GlyphAtlas::shared()) {
+        atlas->saveInBackground();
+    }
+}
+
 } // namespace
 
 static const char* eventTypeName(ClockEventType type);
@@ -220,7 +230,7 @@ void ClockScenario::ensureFontSamplerInitialized() const
         return;
     }
 
-    // FontSampler::initCanvas() handles LVGL initialization and headless display creation.
+    // FontSampler::ensureCanvas() handles LVGL initialization and headless display creation.
     // Do not create a display here - FontSampler's ensureHeadlessDisplay() properly
     // calls lv_init() before creating the display.
 
@@ -234,6 +244,11 @@ void ClockScenario::ensureFontSamplerInitialized() const
             ClockFonts::NOTO_EMOJI_HEIGHT + 4,
             0.3f);
 
+        if (auto atlas = GlyphAtlas::shared()) {
+            font_sampler_->setGlyphAtlas(
+                atlas, "noto_color_emoji_" + std::to_string(ClockFonts::NOTO_EMOJI_HEIGHT));
+        }
+
         spdlog::info("ClockScenario: FontSampler initialized for NotoColorEmoji");
     }
     else {
@@ -246,6 +261,10 @@ void ClockScenario::ensureFontSamplerInitialized() const
             48,
             0.3f);
 
+        if (auto atlas = GlyphAtlas::shared()) {
+            font_sampler_->setGlyphAtlas(atlas, "montserrat_24");
+        }
+
         spdlog::info("ClockScenario: FontSampler initialized for Montserrat 24pt");
     }
 
@@ -255,6 +274,7 @@ void ClockScenario::ensureFontSamplerInitialized() const
     for (char c = '0'; c <= '9'; ++c) {
         font_sampler_->getCachedPatternTrimmed(c);
     }
+    saveGlyphAtlasInBackground();
 }
 
 const std::vector<std::vector<bool>>& ClockScenario::getSampledDigitPattern(int digit) const
@@ -823,6 +843,7 @@ void ClockScenario::drawCharacterWithMaterials(
     int dh = getDigitHeight();
 
     auto materialGrid = font_sampler_->sampleAndDownsample(utf8Char, dw, dh, 0.5f);
+    saveGlyphAtlasInBackground();
 
     if (materialGrid.width == 0 || materialGrid.height == 0) {
         spdlog::warn("ClockScenario: Failed to sample character '{}'", utf8Char);
@@ -927,6 +948,11 @@ std::string ClockScenario::getCurrentTimeString() const
     return std::string(buffer);
 }
 
+void ClockScenario::setRandomSeed(uint32_t seed)
+{
+    rng_.seed(seed);
+}
+
 void ClockScenario::setTimeOverride(const std::string& time_str)
 {
     time_override_ = time_str;
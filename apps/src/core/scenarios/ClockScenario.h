@@ -58,6 +58,7 @@ public:
     void setup(World& world) override;
     void reset(World& world) override;
     void tick(World& world, double deltaTime) override;
+    void setRandomSeed(uint32_t seed) override;
 
     // Event state accessors.
     bool isEventActive(ClockEventType type) const;
@@ -19,6 +19,7 @@ public:
     void setup(World& world) override;
     void reset(World& world) override;
     void tick(World& world, double deltaTime) override;
+    bool isSetupCapturedByWorld() const override { return true; }
 
 private:
     ScenarioMetadata metadata_;
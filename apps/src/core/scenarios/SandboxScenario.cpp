@@ -146,6 +146,11 @@ void SandboxScenario::reset(World& world)
     setup(world);
 }
 
+void SandboxScenario::setRandomSeed(uint32_t seed)
+{
+    rng_.seed(seed);
+}
+
 void SandboxScenario::tick(World& world, double deltaTime)
 {
     const double simTime = lastSimTime_ + deltaTime;
@@ -20,6 +20,7 @@ public:
     void setup(World& world) override;
     void reset(World& world) override;
     void tick(World& world, double deltaTime) override;
+    void setRandomSeed(uint32_t seed) override;
 
 private:
     ScenarioMetadata metadata_;
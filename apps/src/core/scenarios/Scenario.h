@@ -40,6 +40,14 @@ public:
     virtual void setup(World& world) = 0;
     virtual void reset(World& world) = 0;
     virtual void tick(World& world, double deltaTime) = 0;
+
+    // Seeds scenario-local randomness so a run can be replayed exactly. Scenarios that draw
+    // nothing random ignore it.
+    virtual void setRandomSeed(uint32_t seed) { (void)seed; }
+
+    // True when setup() leaves no state outside the World, so restoring a
+    // World::SetupSnapshot is equivalent to running setup() again.
+    virtual bool isSetupCapturedByWorld() const { return false; }
 };
 
 } // namespace DirtSim
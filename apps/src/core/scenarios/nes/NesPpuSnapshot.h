@@ -17,6 +17,8 @@ struct NesPpuSnapshot {
     uint8_t mirror = 0;
     uint8_t ppuCtrl = 0;
     uint8_t ppuMask = 0;
+    // Changes whenever chr changes within one runtime. Zero means unknown (never cached).
+    uint64_t chrVersion = 0;
     std::array<uint8_t, ChrBytes> chr{};
     std::array<uint8_t, OamBytes> oam{};
     std::array<uint8_t, VramBytes> vram{};
@@ -411,6 +411,15 @@ std::optional<SmolnesRuntime::Savestate> NesSmolnesScenarioDriver::copyRuntimeSa
     return runtime_->copySavestate();
 }
 
+std::optional<SmolnesRuntime::Savestate> NesSmolnesScenarioDriver::
+    copyRuntimeCompactSavestate() const
+{
+    if (!runtime_ || !runtime_->isRunning() || !runtime_->isHealthy()) {
+        return std::nullopt;
+    }
+    return runtime_->copyCompactSavestate();
+}
+
 std::optional<SmolnesRuntime::ProfilingSnapshot> NesSmolnesScenarioDriver::
     copyRuntimeProfilingSnapshot() const
 {
@@ -544,6 +553,13 @@ void NesSmolnesScenarioDriver::setPixelOutputEnabled(bool enabled)
     }
 }
 
+void NesSmolnesScenarioDriver::setPpuSnapshotEnabled(bool enabled)
+{
+    if (runtime_) {
+        runtime_->setPpuSnapshotEnabled(enabled);
+    }
+}
+
 void NesSmolnesScenarioDriver::setRgbaOutputEnabled(bool enabled)
 {
     if (runtime_) {
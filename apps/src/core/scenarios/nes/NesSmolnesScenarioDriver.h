@@ -80,6 +80,7 @@ public:
     std::optional<SmolnesRuntime::MemorySnapshot> copyRuntimeMemorySnapshot() const override;
     std::optional<NesPpuSnapshot> copyRuntimePpuSnapshot() const;
     std::optional<SmolnesRuntime::Savestate> copyRuntimeSavestate() const;
+    std::optional<SmolnesRuntime::Savestate> copyRuntimeCompactSavestate() const;
     std::optional<SmolnesRuntime::ProfilingSnapshot> copyRuntimeProfilingSnapshot() const;
     std::optional<SmolnesRuntime::ApuSnapshot> copyRuntimeApuSnapshot() const;
     uint32_t copyRuntimeApuSamples(float* buffer, uint32_t maxSamples) const;
@@ -94,6 +95,7 @@ public:
     void setApuEnabled(bool enabled);
     void setAudioPlaybackEnabled(bool enabled);
     void setPixelOutputEnabled(bool enabled);
+    void setPpuSnapshotEnabled(bool enabled);
     void setRgbaOutputEnabled(bool enabled);
     void setAudioVolumePercent(int percent);
     void setDetailedTimingEnabled(bool enabled);
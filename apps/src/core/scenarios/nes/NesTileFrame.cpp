@@ -52,14 +52,8 @@ size_t mirroredNametableOffset(uint16_t logicalOffset, uint8_t mirror)
     }
 }
 
-uint8_t readNametableTileIdAtWorldPixel(
-    const NesPpuSnapshot& snapshot, uint16_t scrollX, uint16_t scrollY, uint16_t x, uint16_t y)
+uint8_t readNametableTileId(const NesPpuSnapshot& snapshot, uint16_t tileX, uint16_t tileY)
 {
-    const uint16_t worldX = static_cast<uint16_t>((scrollX + x) % 512u);
-    const uint16_t worldY = static_cast<uint16_t>((scrollY + y) % 480u);
-
-    const uint16_t tileX = static_cast<uint16_t>(worldX / kTileSizePixels);
-    const uint16_t tileY = static_cast<uint16_t>(worldY / kTileSizePixels);
     const uint16_t nametableX = static_cast<uint16_t>((tileX / 32u) & 0x01u);
     const uint16_t nametableY = static_cast<uint16_t>((tileY / 30u) & 0x01u);
     const uint16_t localTileX = static_cast<uint16_t>(tileX % 32u);
@@ -69,6 +63,17 @@ uint8_t readNametableTileIdAtWorldPixel(
     return snapshot.vram[mirroredNametableOffset(logicalOffset, snapshot.mirror)];
 }
 
+uint8_t readNametableTileIdAtWorldPixel(
+    const NesPpuSnapshot& snapshot, uint16_t scrollX, uint16_t scrollY, uint16_t x, uint16_t y)
+{
+    const uint16_t worldX = static_cast<uint16_t>((scrollX + x) % 512u);
+    const uint16_t worldY = static_cast<uint16_t>((scrollY + y) % 480u);
+    return readNametableTileId(
+        snapshot,
+        static_cast<uint16_t>(worldX / kTileSizePixels),
+        static_cast<uint16_t>(worldY / kTileSizePixels));
+}
+
 size_t tilePatternBaseOffset(const NesPpuSnapshot& snapshot, uint8_t tileId)
 {
     const size_t patternBase = (snapshot.ppuCtrl & 0x10u) != 0u ? 0x1000u : 0u;
@@ -113,8 +118,41 @@ uint16_t scrollYFromV(const NesPpuSnapshot& snapshot)
         + (((snapshot.v >> 5u) & 0x001Fu) * kTileSizePixels) + ((snapshot.v >> 12u) & 0x07u));
 }
 
+uint8_t patternTableSelect(const NesPpuSnapshot& snapshot)
+{
+    return static_cast<uint8_t>(snapshot.ppuCtrl & 0x10u);
+}
+
 } // namespace
 
+const std::array<uint64_t, 256u>& NesTilePatternHashCache::getHashes(
+    const NesPpuSnapshot& snapshot)
+{
+    if (valid_ && snapshot.chrVersion != 0u && snapshot.chrVersion == chrVersion_
+        && patternTableSelect(snapshot) == patternTableSelect_) {
+        hitCount_++;
+        return hashes_;
+    }
+
+    hashes_ = makeNesTileIdPatternHashes(snapshot);
+    chrVersion_ = snapshot.chrVersion;
+    patternTableSelect_ = patternTableSelect(snapshot);
+    valid_ = true;
+    missCount_++;
+    return hashes_;
+}
+
+double NesTilePatternHashCache::getHitRate() const
+{
+    const uint64_t total = hitCount_ + missCount_;
+    return total == 0u ? 0.0 : static_cast<double>(hitCount_) / static_cast<double>(total);
+}
+
+void NesTilePatternHashCache::reset()
+{
+    *this = NesTilePatternHashCache{};
+}
+
 std::array<uint64_t, 256u> makeNesTileIdPatternHashes(const NesPpuSnapshot& snapshot)
 {
     std::array<uint64_t, 256u> tilePatternHashes{};
@@ -169,26 +207,44 @@ NesTileFrame makeNesTileFrame(
     }
 
     {
+        // Tile IDs come straight from the nametables, sampling each cell at its center.
         OptionalScopeTimer timer(timers, "nes_tile_frame_tile_ids");
         for (uint16_t gy = 0; gy < NesTileFrame::VisibleTileRows; ++gy) {
+            const uint16_t sampleY =
+                static_cast<uint16_t>(gy * kTileSizePixels + 4u + kTopCropPixels);
+            const uint16_t worldY = static_cast<uint16_t>((frame.scrollY + sampleY) % 480u);
+            const uint16_t tileY = static_cast<uint16_t>(worldY / kTileSizePixels);
+            const size_t rowBase = static_cast<size_t>(gy) * NesTileFrame::VisibleTileColumns;
             for (uint16_t gx = 0; gx < NesTileFrame::VisibleTileColumns; ++gx) {
                 const uint16_t sampleX = static_cast<uint16_t>(gx * kTileSizePixels + 4u);
-                const uint16_t sampleY =
-                    static_cast<uint16_t>(gy * kTileSizePixels + 4u + kTopCropPixels);
-                const uint8_t tileId = readNametableTileIdAtWorldPixel(
-                    snapshot, frame.scrollX, frame.scrollY, sampleX, sampleY);
-                const size_t cellIndex =
-                    static_cast<size_t>(gy) * NesTileFrame::VisibleTileColumns + gx;
-                frame.tileIds[cellIndex] = tileId;
+                const uint16_t worldX = static_cast<uint16_t>((frame.scrollX + sampleX) % 512u);
+                frame.tileIds[rowBase + gx] = readNametableTileId(
+                    snapshot, static_cast<uint16_t>(worldX / kTileSizePixels), tileY);
             }
         }
     }
 
     {
         OptionalScopeTimer timer(timers, "nes_tile_frame_tile_hashes");
+        // Hashing all 256 tile IDs once is cheaper than hashing each of the 896 cells.
+        std::array<uint64_t, 256u> uncachedHashes;
+        const std::array<uint64_t, 256u>* tileIdPatternHashes = &uncachedHashes;
+        if (options.patternHashCache != nullptr) {
+            const uint64_t missesBefore = options.patternHashCache->getMissCount();
+            tileIdPatternHashes = &options.patternHashCache->getHashes(snapshot);
+            if (timers != nullptr) {
+                const bool hit = options.patternHashCache->getMissCount() == missesBefore;
+                timers->addSample(
+                    hit ? "nes_tile_pattern_hash_cache_hit" : "nes_tile_pattern_hash_cache_miss",
+                    0.0);
+            }
+        }
+        else {
+            uncachedHashes = makeNesTileIdPatternHashes(snapshot);
+        }
+
         for (size_t cellIndex = 0; cellIndex < frame.tileIds.size(); ++cellIndex) {
-            frame.tilePatternHashes[cellIndex] =
-                tilePatternHash(snapshot, frame.tileIds[cellIndex]);
+            frame.tilePatternHashes[cellIndex] = (*tileIdPatternHashes)[frame.tileIds[cellIndex]];
         }
     }
 
@@ -24,8 +24,34 @@ struct NesTileFrame {
     std::array<uint8_t, VisibleTileColumns * VisibleTileRows> tileIds{};
 };
 
+class NesTilePatternHashCache;
+
 struct NesTileFrameBuildOptions {
     bool includePatternPixels = true;
+    // Reuses tile-id pattern hashes across frames from the same runtime when set.
+    NesTilePatternHashCache* patternHashCache = nullptr;
+};
+
+// Tile-id -> pattern hash table for the active background pattern table. The table is rebuilt
+// only when the snapshot's chrVersion or pattern table select changes; snapshots with
+// chrVersion 0 are always rehashed. Keep one cache per runtime, since versions from different
+// runtimes are unrelated.
+class NesTilePatternHashCache final {
+public:
+    const std::array<uint64_t, 256u>& getHashes(const NesPpuSnapshot& snapshot);
+
+    uint64_t getHitCount() const { return hitCount_; }
+    uint64_t getMissCount() const { return missCount_; }
+    double getHitRate() const;
+    void reset();
+
+private:
+    std::array<uint64_t, 256u> hashes_{};
+    uint64_t chrVersion_ = 0;
+    uint8_t patternTableSelect_ = 0;
+    bool valid_ = false;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
 };
 
 std::array<uint64_t, 256u> makeNesTileIdPatternHashes(const NesPpuSnapshot& snapshot);
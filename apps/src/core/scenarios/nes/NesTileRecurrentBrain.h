@@ -4,11 +4,14 @@
 #include "core/organisms/brains/Genome.h"
 #include "core/organisms/evolution/GenomeLayout.h"
 
+#include <cstdint>
 #include <memory>
 #include <random>
 
 namespace DirtSim {
 
+enum class InferencePrecision : uint8_t;
+
 struct NesTileSensoryData;
 
 class NesTileRecurrentBrain final {
@@ -38,6 +41,10 @@ public:
     Genome getGenome() const;
     void setGenome(const Genome& genome);
 
+    // Int8 runs inference on per-layer quantized copies; the genome itself stays float.
+    InferencePrecision getInferencePrecision() const;
+    void setInferencePrecision(InferencePrecision precision);
+
     static Genome randomGenome(std::mt19937& rng);
     static bool isGenomeCompatible(const Genome& genome);
     static GenomeLayout getGenomeLayout();
@@ -232,6 +232,7 @@ std::optional<NesPpuSnapshot> SmolnesRuntime::copyPpuSnapshot() const
     snapshot.mirror = raw.mirror;
     snapshot.ppuCtrl = raw.ppuctrl;
     snapshot.ppuMask = raw.ppumask;
+    snapshot.chrVersion = raw.chr_version;
     std::copy(std::begin(raw.chr), std::end(raw.chr), snapshot.chr.begin());
     std::copy(std::begin(raw.oam), std::end(raw.oam), snapshot.oam.begin());
     std::copy(std::begin(raw.vram), std::end(raw.vram), snapshot.vram.begin());
@@ -276,6 +277,25 @@ std::optional<SmolnesRuntime::Savestate> SmolnesRuntime::copySavestate() const
     return savestate;
 }
 
+std::optional<SmolnesRuntime::Savestate> SmolnesRuntime::copyCompactSavestate() const
+{
+    if (runtimeHandle_ == nullptr) {
+        return std::nullopt;
+    }
+
+    Savestate savestate{};
+    const uint32_t savestateSize = smolnesRuntimeGetCompactSavestateSize();
+    savestate.bytes.resize(savestateSize);
+    if (!smolnesRuntimeCopyCompactSavestate(
+            runtimeHandle_,
+            reinterpret_cast<uint8_t*>(savestate.bytes.data()),
+            savestateSize,
+            &savestate.frameId)) {
+        return std::nullopt;
+    }
+    return savestate;
+}
+
 std::optional<SmolnesRuntime::ApuSnapshot> SmolnesRuntime::copyApuSnapshot() const
 {
     if (runtimeHandle_ == nullptr) {
@@ -376,6 +396,14 @@ void SmolnesRuntime::setPixelOutputEnabled(bool enabled)
     smolnesRuntimeSetPixelOutputEnabled(runtimeHandle_, enabled);
 }
 
+void SmolnesRuntime::setPpuSnapshotEnabled(bool enabled)
+{
+    if (runtimeHandle_ == nullptr) {
+        return;
+    }
+    smolnesRuntimeSetPpuSnapshotEnabled(runtimeHandle_, enabled);
+}
+
 void SmolnesRuntime::setRgbaOutputEnabled(bool enabled)
 {
     if (runtimeHandle_ == nullptr) {
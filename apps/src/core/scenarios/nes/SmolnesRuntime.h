@@ -151,6 +151,8 @@ public:
 
     virtual std::optional<MemorySnapshot> copyMemorySnapshot() const;
     virtual std::optional<Savestate> copySavestate() const;
+    // Omits output buffers (video, palette, APU samples); loadSavestate() accepts either form.
+    virtual std::optional<Savestate> copyCompactSavestate() const;
     virtual std::optional<ProfilingSnapshot> copyProfilingSnapshot() const;
     virtual std::optional<ApuSnapshot> copyApuSnapshot() const;
     virtual uint32_t copyApuSamples(float* buffer, uint32_t maxSamples) const;
@@ -159,6 +161,7 @@ public:
     virtual void setApuEnabled(bool enabled);
     virtual void setDetailedTimingEnabled(bool enabled);
     virtual void setPixelOutputEnabled(bool enabled);
+    virtual void setPpuSnapshotEnabled(bool enabled);
     virtual void setRgbaOutputEnabled(bool enabled);
     virtual void setPacingMode(SmolnesRuntimePacingMode mode);
     virtual std::string getLastError() const;
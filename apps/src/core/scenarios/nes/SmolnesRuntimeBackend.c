@@ -6,6 +6,7 @@
 #include <math.h>
 #include <pthread.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +25,24 @@ extern SMOLNES_THREAD_LOCAL uint8_t frame_buffer_palette[61440];
 
 static SMOLNES_THREAD_LOCAL SmolnesApuState gApuState;
 
+#define SMOLNES_FRAME_STATE_SLOTS 3u
+#define SMOLNES_FRAME_STATE_NONE UINT32_MAX
+#define SMOLNES_FRAME_STATE_READ_ATTEMPTS 4u
+
+// Completed-frame state published by the runtime thread. Readers copy from the most recently
+// published slot without runtimeMutex and retry if sequence changed underneath them; sequence is
+// odd while the runtime thread is writing the slot. With three slots the writer only reuses a
+// slot two publishes after it was the latest, so retries are rare.
+typedef struct SmolnesRuntimeFrameState {
+    uint64_t sequence;
+    uint64_t frameId;
+    bool hasPpu;
+    SmolnesRuntimeControllerSnapshot controller;
+    uint8_t cpuRam[SMOLNES_RUNTIME_CPU_RAM_BYTES];
+    uint8_t prgRam[SMOLNES_RUNTIME_PRG_RAM_BYTES];
+    SmolnesRuntimePpuSnapshot ppu;
+} SmolnesRuntimeFrameState;
+
 struct SmolnesRuntimeHandle {
     pthread_cond_t runtimeCond;
     pthread_mutex_t runtimeMutex;
@@ -31,8 +50,6 @@ struct SmolnesRuntimeHandle {
     pthread_t runtimeThread;
     bool hasLatestFrame;
     bool hasLatestPaletteFrame;
-    bool hasMemorySnapshot;
-    bool hasPpuSnapshot;
     bool healthy;
     bool stopRequested;
     bool threadJoinable;
@@ -110,21 +127,26 @@ struct SmolnesRuntimeHandle {
     uint64_t latestFrameController1SequenceId;
     uint8_t latestFrameController1State;
     uint64_t nextController1SequenceId;
-    uint8_t cpuRamSnapshot[SMOLNES_RUNTIME_CPU_RAM_BYTES];
-    uint8_t chrSnapshot[SMOLNES_RUNTIME_PPU_CHR_BYTES];
     uint8_t latestFrame[SMOLNES_RUNTIME_FRAME_BYTES];
     uint8_t latestPaletteFrame[SMOLNES_RUNTIME_PALETTE_FRAME_BYTES];
-    uint8_t oamSnapshot[SMOLNES_RUNTIME_PPU_OAM_BYTES];
-    uint8_t prgRamSnapshot[SMOLNES_RUNTIME_PRG_RAM_BYTES];
-    uint8_t vramSnapshot[SMOLNES_RUNTIME_PPU_VRAM_BYTES];
     uint8_t rendererStub;
     uint8_t textureStub;
     uint8_t windowStub;
-    uint16_t ppuVSnapshot;
-    uint8_t ppuFineXSnapshot;
-    uint8_t ppuMirrorSnapshot;
-    uint8_t ppuCtrlSnapshot;
-    uint8_t ppuMaskSnapshot;
+
+    // Written by the runtime thread under runtimeMutex; publishedFrameState is accessed
+    // atomically and is SMOLNES_FRAME_STATE_NONE while no state is readable.
+    SmolnesRuntimeFrameState frameStates[SMOLNES_FRAME_STATE_SLOTS];
+    uint32_t publishedFrameState;
+    // Bumped whenever published CHR bytes change.
+    uint64_t chrVersion;
+    // CHR as of the last capture, with the mapping and CHR RAM it was read from. Publishing
+    // reads CHR through the mapper again only when these no longer match.
+    uint8_t chrCapture[SMOLNES_RUNTIME_PPU_CHR_BYTES];
+    uint8_t chrCaptureRam[SMOLNES_RUNTIME_PPU_CHR_BYTES];
+    uint8_t chrCaptureBanks[8];
+    uint8_t chrCaptureBits;
+    const uint8_t* chrCaptureRom;
+    bool chrCaptureValid;
 
     SmolnesApuSnapshot apuSnapshot;
     bool hasApuSnapshot;
@@ -139,6 +161,7 @@ struct SmolnesRuntimeHandle {
     void* apuSampleCallbackUserdata;
 
     bool apuEnabled;
+    bool ppuSnapshotEnabled;
     bool pixelOutputEnabled;
     bool rgbaOutputEnabled;
     bool detailedTimingEnabled;
@@ -151,6 +174,7 @@ struct SmolnesRuntimeHandle {
     void* pendingSavestate;
     bool hasSavestate;
     bool savestateLoadPending;
+    bool pendingSavestateCompact;
     uint64_t savestateRequestSequence;
     uint64_t savestateAppliedSequence;
 };
@@ -494,7 +518,8 @@ static SmolnesRuntimeHandle* getCurrentRuntime(void)
 }
 
 static void captureSavestateLocked(SmolnesRuntimeHandle* runtime);
-static void refreshMemorySnapshotLocked(SmolnesRuntimeHandle* runtime);
+static void invalidateFrameStatesLocked(SmolnesRuntimeHandle* runtime);
+static void publishFrameStateLocked(SmolnesRuntimeHandle* runtime);
 static bool tryApplyPendingSavestateLocked(SmolnesRuntimeHandle* runtime);
 
 static void* runtimeThreadMain(void* arg)
@@ -529,6 +554,7 @@ static void* runtimeThreadMain(void* arg)
 
     pthread_mutex_lock(&runtime->runtimeMutex);
     runtime->threadRunning = false;
+    invalidateFrameStatesLocked(runtime);
     if (!runtime->stopRequested && exitCode != 0) {
         runtime->healthy = false;
         setLastErrorLocked(runtime, "smolnes runtime exited with an error.");
@@ -1075,7 +1101,6 @@ void smolnesRuntimeWrappedRenderPresent(SDL_Renderer* renderer)
             gApuState.sampleCallback = runtime->apuSampleCallback;
             gApuState.sampleCallbackUserdata = runtime->apuSampleCallbackUserdata;
             const double presentStartMs = monotonicNowMs();
-            refreshMemorySnapshotLocked(runtime);
             ++runtime->renderedFrames;
             runtime->latestFrameId = runtime->renderedFrames;
             runtime->latestFrameController1AppliedFrameId =
@@ -1088,6 +1113,7 @@ void smolnesRuntimeWrappedRenderPresent(SDL_Renderer* renderer)
                 runtime->latchedController1RequestTimestampNs;
             runtime->latestFrameController1SequenceId = runtime->latchedController1SequenceId;
             runtime->latestFrameController1State = runtime->latchedController1State;
+            publishFrameStateLocked(runtime);
             if (runtime->targetFrames < runtime->renderedFrames) {
                 runtime->targetFrames = runtime->renderedFrames;
             }
@@ -1120,7 +1146,6 @@ void smolnesRuntimeWrappedRenderPresent(SDL_Renderer* renderer)
             gApuState.sampleCallback = runtime->apuSampleCallback;
             gApuState.sampleCallbackUserdata = runtime->apuSampleCallbackUserdata;
             const double presentStartMs = monotonicNowMs();
-            refreshMemorySnapshotLocked(runtime);
             ++runtime->renderedFrames;
             runtime->latestFrameId = runtime->renderedFrames;
             runtime->latestFrameController1AppliedFrameId =
@@ -1133,6 +1158,7 @@ void smolnesRuntimeWrappedRenderPresent(SDL_Renderer* renderer)
                 runtime->latchedController1RequestTimestampNs;
             runtime->latestFrameController1SequenceId = runtime->latchedController1SequenceId;
             runtime->latestFrameController1State = runtime->latchedController1State;
+            publishFrameStateLocked(runtime);
             captureSavestateLocked(runtime);
             runtime->runtimeThreadPresentMs += monotonicNowMs() - presentStartMs;
             runtime->runtimeThreadPresentCalls++;
@@ -1293,7 +1319,7 @@ static void smolnesRuntimeWrappedApuClock(uint32_t cycles)
 
 enum {
     kSmolnesRuntimeSavestateMagic = 0x44535631u,
-    kSmolnesRuntimeSavestateVersion = 1u,
+    kSmolnesRuntimeSavestateVersion = 2u,
 };
 
 typedef struct SmolnesRuntimeSavestateBlob {
@@ -1363,9 +1389,7 @@ typedef struct SmolnesRuntimeSavestateBlob {
     uint8_t scanline_sprite_pixels[256];
     uint8_t scanline_has_sprite_pixels;
 
-    uint8_t latestFrame[SMOLNES_RUNTIME_FRAME_BYTES];
-    uint8_t latestPaletteFrame[SMOLNES_RUNTIME_PALETTE_FRAME_BYTES];
-
+    // sampleBuffer is zeroed here; the samples live in apuSampleBuffer below.
     SmolnesApuState apuState;
 
     uint8_t pendingController1State;
@@ -1385,6 +1409,11 @@ typedef struct SmolnesRuntimeSavestateBlob {
     uint64_t latestFrameController1SequenceId;
     uint8_t latestFrameController1State;
     uint64_t nextController1SequenceId;
+
+    // Emulator output, regenerated by the next frame. Compact savestates end here.
+    uint8_t latestFrame[SMOLNES_RUNTIME_FRAME_BYTES];
+    uint8_t latestPaletteFrame[SMOLNES_RUNTIME_PALETTE_FRAME_BYTES];
+    float apuSampleBuffer[SMOLNES_APU_SAMPLE_BUFFER_SIZE];
 } SmolnesRuntimeSavestateBlob;
 
 uint32_t smolnesRuntimeGetSavestateSize(void)
@@ -1392,6 +1421,11 @@ uint32_t smolnesRuntimeGetSavestateSize(void)
     return (uint32_t)sizeof(SmolnesRuntimeSavestateBlob);
 }
 
+uint32_t smolnesRuntimeGetCompactSavestateSize(void)
+{
+    return (uint32_t)offsetof(SmolnesRuntimeSavestateBlob, latestFrame);
+}
+
 static uint64_t computeApuSampleWindowStart(const SmolnesApuState* state)
 {
     const uint64_t totalSamples = smolnesApuGetSampleCount(state);
@@ -1489,15 +1523,10 @@ static void captureSavestateLocked(SmolnesRuntimeHandle* runtime)
         sizeof(savestate->scanline_sprite_pixels));
     savestate->scanline_has_sprite_pixels = scanline_has_sprite_pixels;
 
-    memcpy(savestate->latestFrame, runtime->latestFrame, sizeof(savestate->latestFrame));
-    memcpy(
-        savestate->latestPaletteFrame,
-        runtime->latestPaletteFrame,
-        sizeof(savestate->latestPaletteFrame));
-
     savestate->apuState = gApuState;
     savestate->apuState.sampleCallback = NULL;
     savestate->apuState.sampleCallbackUserdata = NULL;
+    memset(savestate->apuState.sampleBuffer, 0, sizeof(savestate->apuState.sampleBuffer));
 
     savestate->pendingController1State = runtime->pendingController1State;
     savestate->pendingController1ObservedTimestampNs = 0;
@@ -1518,11 +1547,21 @@ static void captureSavestateLocked(SmolnesRuntimeHandle* runtime)
     savestate->latestFrameController1State = runtime->latestFrameController1State;
     savestate->nextController1SequenceId = runtime->nextController1SequenceId;
 
+    memcpy(savestate->latestFrame, runtime->latestFrame, sizeof(savestate->latestFrame));
+    memcpy(
+        savestate->latestPaletteFrame,
+        runtime->latestPaletteFrame,
+        sizeof(savestate->latestPaletteFrame));
+    memcpy(
+        savestate->apuSampleBuffer, gApuState.sampleBuffer, sizeof(savestate->apuSampleBuffer));
+
     runtime->hasSavestate = true;
 }
 
+// Compact savestates carry no output buffers: the current frame stays until the next one replaces
+// it, and the APU sample ring restarts silent.
 static void applySavestateLocked(
-    SmolnesRuntimeHandle* runtime, const SmolnesRuntimeSavestateBlob* savestate)
+    SmolnesRuntimeHandle* runtime, const SmolnesRuntimeSavestateBlob* savestate, bool compact)
 {
     if (runtime == NULL || savestate == NULL) {
         return;
@@ -1594,6 +1633,10 @@ static void applySavestateLocked(
     scanline_has_sprite_pixels = savestate->scanline_has_sprite_pixels;
 
     gApuState = savestate->apuState;
+    if (!compact) {
+        memcpy(
+            gApuState.sampleBuffer, savestate->apuSampleBuffer, sizeof(gApuState.sampleBuffer));
+    }
     gApuState.sampleCallback = runtime->apuSampleCallback;
     gApuState.sampleCallbackUserdata = runtime->apuSampleCallbackUserdata;
 
@@ -1628,17 +1671,19 @@ static void applySavestateLocked(
     runtime->latestFrameController1SequenceId = savestate->latestFrameController1SequenceId;
     runtime->latestFrameController1State = savestate->latestFrameController1State;
     runtime->nextController1SequenceId = savestate->nextController1SequenceId;
-    memcpy(runtime->latestFrame, savestate->latestFrame, sizeof(runtime->latestFrame));
-    memcpy(
-        runtime->latestPaletteFrame,
-        savestate->latestPaletteFrame,
-        sizeof(runtime->latestPaletteFrame));
-    runtime->hasLatestFrame = true;
-    runtime->hasLatestPaletteFrame = true;
+    if (!compact) {
+        memcpy(runtime->latestFrame, savestate->latestFrame, sizeof(runtime->latestFrame));
+        memcpy(
+            runtime->latestPaletteFrame,
+            savestate->latestPaletteFrame,
+            sizeof(runtime->latestPaletteFrame));
+        runtime->hasLatestFrame = true;
+        runtime->hasLatestPaletteFrame = true;
+    }
 
     latchThreadKeyboardStateFromRuntime(runtime);
     runtime->apuSampleBufferLastIndex = computeApuSampleWindowStart(&gApuState);
-    refreshMemorySnapshotLocked(runtime);
+    publishFrameStateLocked(runtime);
     captureSavestateLocked(runtime);
 }
 
@@ -1649,7 +1694,7 @@ static bool tryApplyPendingSavestateLocked(SmolnesRuntimeHandle* runtime)
     }
 
     const SmolnesRuntimeSavestateBlob* savestate = getPendingSavestateBlob(runtime);
-    applySavestateLocked(runtime, savestate);
+    applySavestateLocked(runtime, savestate, runtime->pendingSavestateCompact);
     runtime->savestateLoadPending = false;
     runtime->savestateAppliedSequence = runtime->savestateRequestSequence;
     clearLastErrorLocked(runtime);
@@ -1657,22 +1702,93 @@ static bool tryApplyPendingSavestateLocked(SmolnesRuntimeHandle* runtime)
     return true;
 }
 
-static void refreshMemorySnapshotLocked(SmolnesRuntimeHandle* runtime)
+static void invalidateFrameStatesLocked(SmolnesRuntimeHandle* runtime)
 {
-    const double snapshotStartMs = monotonicNowMs();
-    memcpy(runtime->cpuRamSnapshot, ram, SMOLNES_RUNTIME_CPU_RAM_BYTES);
-    memcpy(runtime->prgRamSnapshot, prgram, SMOLNES_RUNTIME_PRG_RAM_BYTES);
-    memcpy(runtime->oamSnapshot, oam, SMOLNES_RUNTIME_PPU_OAM_BYTES);
-    memcpy(runtime->vramSnapshot, vram, SMOLNES_RUNTIME_PPU_VRAM_BYTES);
-    runtime->ppuVSnapshot = V;
-    runtime->ppuFineXSnapshot = fine_x;
-    runtime->ppuMirrorSnapshot = mirror;
-    runtime->ppuCtrlSnapshot = ppuctrl;
-    runtime->ppuMaskSnapshot = ppumask;
+    __atomic_store_n(&runtime->publishedFrameState, SMOLNES_FRAME_STATE_NONE, __ATOMIC_RELEASE);
+    // A ROM reload can reuse the same buffers with different contents.
+    runtime->chrCaptureValid = false;
+}
+
+// Brings the CHR capture up to date and bumps chrVersion if its bytes changed. CHR ROM only
+// changes with the bank mapping; CHR RAM is also compared against the copy taken last time.
+static void refreshChrCaptureLocked(SmolnesRuntimeHandle* runtime)
+{
+    const bool usesChrRam = chrrom == chrram;
+    if (runtime->chrCaptureValid && runtime->chrCaptureRom == chrrom
+        && runtime->chrCaptureBits == chrbits
+        && memcmp(runtime->chrCaptureBanks, chr, sizeof(runtime->chrCaptureBanks)) == 0
+        && (!usesChrRam
+            || memcmp(runtime->chrCaptureRam, chrram, SMOLNES_RUNTIME_PPU_CHR_BYTES) == 0)) {
+        return;
+    }
+
+    uint8_t captured[SMOLNES_RUNTIME_PPU_CHR_BYTES];
     for (uint16_t addr = 0; addr < SMOLNES_RUNTIME_PPU_CHR_BYTES; ++addr) {
-        runtime->chrSnapshot[addr] = *get_chr_byte(addr);
+        captured[addr] = *get_chr_byte(addr);
     }
-    runtime->hasPpuSnapshot = true;
+    if (!runtime->chrCaptureValid
+        || memcmp(runtime->chrCapture, captured, SMOLNES_RUNTIME_PPU_CHR_BYTES) != 0) {
+        memcpy(runtime->chrCapture, captured, SMOLNES_RUNTIME_PPU_CHR_BYTES);
+        runtime->chrVersion++;
+    }
+    if (usesChrRam) {
+        memcpy(runtime->chrCaptureRam, chrram, SMOLNES_RUNTIME_PPU_CHR_BYTES);
+    }
+    memcpy(runtime->chrCaptureBanks, chr, sizeof(runtime->chrCaptureBanks));
+    runtime->chrCaptureBits = chrbits;
+    runtime->chrCaptureRom = chrrom;
+    runtime->chrCaptureValid = true;
+}
+
+static void publishFrameStateLocked(SmolnesRuntimeHandle* runtime)
+{
+    const double snapshotStartMs = monotonicNowMs();
+    const uint32_t published = runtime->publishedFrameState;
+    const uint32_t slot = published == SMOLNES_FRAME_STATE_NONE
+        ? 0u
+        : (published + 1u) % SMOLNES_FRAME_STATE_SLOTS;
+    SmolnesRuntimeFrameState* state = &runtime->frameStates[slot];
+
+    // Seqlock write: odd sequence, then data, then even sequence.
+    __atomic_store_n(&state->sequence, state->sequence + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    state->frameId = runtime->latestFrameId;
+    state->controller.latest_frame_id = runtime->latestFrameId;
+    state->controller.controller1_applied_frame_id = runtime->latestFrameController1AppliedFrameId;
+    state->controller.controller1_observed_timestamp_ns =
+        runtime->latestFrameController1ObservedTimestampNs;
+    state->controller.controller1_latch_timestamp_ns =
+        runtime->latestFrameController1LatchTimestampNs;
+    state->controller.controller1_request_timestamp_ns =
+        runtime->latestFrameController1RequestTimestampNs;
+    state->controller.controller1_sequence_id = runtime->latestFrameController1SequenceId;
+    state->controller.controller1_state = runtime->latestFrameController1State;
+    memcpy(state->cpuRam, ram, SMOLNES_RUNTIME_CPU_RAM_BYTES);
+    memcpy(state->prgRam, prgram, SMOLNES_RUNTIME_PRG_RAM_BYTES);
+
+    // PPU capture reads all of CHR through the mapper, so it is skipped unless subscribed.
+    state->hasPpu = runtime->ppuSnapshotEnabled;
+    if (state->hasPpu) {
+        SmolnesRuntimePpuSnapshot* ppu = &state->ppu;
+        ppu->frame_id = runtime->latestFrameId;
+        ppu->v = V;
+        ppu->fine_x = fine_x;
+        ppu->mirror = mirror;
+        ppu->ppuctrl = ppuctrl;
+        ppu->ppumask = ppumask;
+        refreshChrCaptureLocked(runtime);
+        // The slot may already hold this CHR from two publishes ago.
+        if (ppu->chr_version != runtime->chrVersion) {
+            memcpy(ppu->chr, runtime->chrCapture, SMOLNES_RUNTIME_PPU_CHR_BYTES);
+            ppu->chr_version = runtime->chrVersion;
+        }
+        memcpy(ppu->oam, oam, SMOLNES_RUNTIME_PPU_OAM_BYTES);
+        memcpy(ppu->vram, vram, SMOLNES_RUNTIME_PPU_VRAM_BYTES);
+    }
+
+    __atomic_store_n(&state->sequence, state->sequence + 1u, __ATOMIC_RELEASE);
+    __atomic_store_n(&runtime->publishedFrameState, slot, __ATOMIC_RELEASE);
 
     // Copy APU snapshot and samples.
     smolnesApuGetSnapshot(&gApuState, &runtime->apuSnapshot);
@@ -1686,7 +1802,6 @@ static void refreshMemorySnapshotLocked(SmolnesRuntimeHandle* runtime)
 
     runtime->memorySnapshotCopyMs += monotonicNowMs() - snapshotStartMs;
     runtime->memorySnapshotCopyCalls++;
-    runtime->hasMemorySnapshot = true;
 }
 
 SmolnesRuntimeHandle* smolnesRuntimeCreate(void)
@@ -1717,6 +1832,7 @@ SmolnesRuntimeHandle* smolnesRuntimeCreate(void)
         return NULL;
     }
 
+    runtime->publishedFrameState = SMOLNES_FRAME_STATE_NONE;
     return runtime;
 }
 
@@ -1768,6 +1884,7 @@ bool smolnesRuntimeStart(SmolnesRuntimeHandle* runtime, const char* romPath)
 
     runtime->stopRequested = false;
     runtime->apuEnabled = true;
+    runtime->ppuSnapshotEnabled = true;
     runtime->pixelOutputEnabled = true;
     runtime->rgbaOutputEnabled = true;
     runtime->detailedTimingEnabled = false;
@@ -1778,8 +1895,7 @@ bool smolnesRuntimeStart(SmolnesRuntimeHandle* runtime, const char* romPath)
     runtime->latestFrameId = 0;
     runtime->hasLatestFrame = false;
     runtime->hasLatestPaletteFrame = false;
-    runtime->hasMemorySnapshot = false;
-    runtime->hasPpuSnapshot = false;
+    invalidateFrameStatesLocked(runtime);
     runtime->runFramesWaitMs = 0.0;
     runtime->runFramesWaitCalls = 0;
     runtime->runtimeThreadIdleWaitMs = 0.0;
@@ -1843,17 +1959,7 @@ bool smolnesRuntimeStart(SmolnesRuntimeHandle* runtime, const char* romPath)
     runtime->memorySnapshotCopyCalls = 0;
     memset(runtime->latestFrame, 0, sizeof(runtime->latestFrame));
     memset(runtime->latestPaletteFrame, 0, sizeof(runtime->latestPaletteFrame));
-    memset(runtime->cpuRamSnapshot, 0, sizeof(runtime->cpuRamSnapshot));
-    memset(runtime->chrSnapshot, 0, sizeof(runtime->chrSnapshot));
-    memset(runtime->oamSnapshot, 0, sizeof(runtime->oamSnapshot));
-    memset(runtime->prgRamSnapshot, 0, sizeof(runtime->prgRamSnapshot));
-    memset(runtime->vramSnapshot, 0, sizeof(runtime->vramSnapshot));
     memset(&runtime->apuSnapshot, 0, sizeof(runtime->apuSnapshot));
-    runtime->ppuVSnapshot = 0;
-    runtime->ppuFineXSnapshot = 0;
-    runtime->ppuMirrorSnapshot = 0;
-    runtime->ppuCtrlSnapshot = 0;
-    runtime->ppuMaskSnapshot = 0;
     runtime->hasApuSnapshot = false;
     memset(runtime->apuSampleBuffer, 0, sizeof(runtime->apuSampleBuffer));
     runtime->apuSampleBufferCount = 0;
@@ -1898,6 +2004,7 @@ bool smolnesRuntimeStart(SmolnesRuntimeHandle* runtime, const char* romPath)
     if (createResult != 0) {
         runtime->threadRunning = false;
         runtime->healthy = false;
+        invalidateFrameStatesLocked(runtime);
         setLastErrorLocked(runtime, "Failed to start smolnes runtime thread.");
         pthread_mutex_unlock(&runtime->runtimeMutex);
         return false;
@@ -1946,6 +2053,7 @@ bool smolnesRuntimeRunFrames(SmolnesRuntimeHandle* runtime, uint32_t frameCount,
 
         if (waitResult == ETIMEDOUT) {
             runtime->healthy = false;
+            invalidateFrameStatesLocked(runtime);
             setLastErrorLocked(runtime, "Timed out waiting for smolnes frame progression.");
             pthread_mutex_unlock(&runtime->runtimeMutex);
             return false;
@@ -1954,6 +2062,7 @@ bool smolnesRuntimeRunFrames(SmolnesRuntimeHandle* runtime, uint32_t frameCount,
 
     if (runtime->renderedFrames < requestedFrames) {
         runtime->healthy = false;
+        invalidateFrameStatesLocked(runtime);
         setLastErrorLocked(runtime, "smolnes runtime stopped before requested frames completed.");
         pthread_mutex_unlock(&runtime->runtimeMutex);
         return false;
@@ -1982,6 +2091,7 @@ void smolnesRuntimeStop(SmolnesRuntimeHandle* runtime)
     pthread_mutex_lock(&runtime->runtimeMutex);
     runtime->threadJoinable = false;
     runtime->threadRunning = false;
+    invalidateFrameStatesLocked(runtime);
     runtime->stopRequested = false;
     runtime->targetFrames = runtime->renderedFrames;
     runtime->savestateLoadPending = false;
@@ -2097,24 +2207,80 @@ bool smolnesRuntimeCopyLatestPaletteIndices(
     return true;
 }
 
-bool smolnesRuntimeCopyCpuRam(
-    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize)
+typedef void (*SmolnesFrameStateCopyFn)(const SmolnesRuntimeFrameState* state, void* context);
+
+// Copies from the latest published frame state without runtimeMutex. If the runtime thread keeps
+// lapping the reader, falls back to copying under runtimeMutex, which publishing holds.
+static bool readPublishedFrameState(
+    const SmolnesRuntimeHandle* runtime, bool needsPpu, SmolnesFrameStateCopyFn copy, void* context)
 {
-    if (runtime == NULL || buffer == NULL || bufferSize < SMOLNES_RUNTIME_CPU_RAM_BYTES) {
-        return false;
+    for (uint32_t attempt = 0; attempt < SMOLNES_FRAME_STATE_READ_ATTEMPTS; ++attempt) {
+        const uint32_t slot = __atomic_load_n(&runtime->publishedFrameState, __ATOMIC_ACQUIRE);
+        if (slot == SMOLNES_FRAME_STATE_NONE) {
+            return false;
+        }
+
+        const SmolnesRuntimeFrameState* state = &runtime->frameStates[slot];
+        const uint64_t sequence = __atomic_load_n(&state->sequence, __ATOMIC_ACQUIRE);
+        if ((sequence & 1u) != 0u) {
+            continue;
+        }
+        const bool available = !needsPpu || state->hasPpu;
+        if (available) {
+            copy(state, context);
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&state->sequence, __ATOMIC_RELAXED) == sequence) {
+            return available;
+        }
     }
 
     SmolnesRuntimeHandle* mutableRuntime = (SmolnesRuntimeHandle*)runtime;
     pthread_mutex_lock(&mutableRuntime->runtimeMutex);
-    if (!mutableRuntime->threadRunning || !mutableRuntime->healthy
-        || !mutableRuntime->hasMemorySnapshot) {
-        pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
+    const uint32_t slot = mutableRuntime->publishedFrameState;
+    const bool available = slot != SMOLNES_FRAME_STATE_NONE
+        && (!needsPpu || mutableRuntime->frameStates[slot].hasPpu);
+    if (available) {
+        copy(&mutableRuntime->frameStates[slot], context);
+    }
+    pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
+    return available;
+}
+
+typedef struct SmolnesMemoryCopyContext {
+    uint8_t* cpuRam;
+    uint8_t* prgRam;
+    uint64_t* frameId;
+} SmolnesMemoryCopyContext;
+
+static void copyMemoryFromFrameState(const SmolnesRuntimeFrameState* state, void* context)
+{
+    SmolnesMemoryCopyContext* memory = (SmolnesMemoryCopyContext*)context;
+    if (memory->cpuRam != NULL) {
+        memcpy(memory->cpuRam, state->cpuRam, SMOLNES_RUNTIME_CPU_RAM_BYTES);
+    }
+    if (memory->prgRam != NULL) {
+        memcpy(memory->prgRam, state->prgRam, SMOLNES_RUNTIME_PRG_RAM_BYTES);
+    }
+    if (memory->frameId != NULL) {
+        *memory->frameId = state->frameId;
+    }
+}
+
+static void copyPpuFromFrameState(const SmolnesRuntimeFrameState* state, void* context)
+{
+    memcpy(context, &state->ppu, sizeof(state->ppu));
+}
+
+bool smolnesRuntimeCopyCpuRam(
+    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize)
+{
+    if (runtime == NULL || buffer == NULL || bufferSize < SMOLNES_RUNTIME_CPU_RAM_BYTES) {
         return false;
     }
 
-    memcpy(buffer, mutableRuntime->cpuRamSnapshot, SMOLNES_RUNTIME_CPU_RAM_BYTES);
-    pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-    return true;
+    SmolnesMemoryCopyContext context = { .cpuRam = buffer, .prgRam = NULL, .frameId = NULL };
+    return readPublishedFrameState(runtime, false, copyMemoryFromFrameState, &context);
 }
 
 bool smolnesRuntimeCopyMemorySnapshot(
@@ -2131,21 +2297,12 @@ bool smolnesRuntimeCopyMemorySnapshot(
         return false;
     }
 
-    SmolnesRuntimeHandle* mutableRuntime = (SmolnesRuntimeHandle*)runtime;
-    pthread_mutex_lock(&mutableRuntime->runtimeMutex);
-    if (!mutableRuntime->threadRunning || !mutableRuntime->healthy
-        || !mutableRuntime->hasMemorySnapshot) {
-        pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-        return false;
-    }
-
-    memcpy(cpuRamBuffer, mutableRuntime->cpuRamSnapshot, SMOLNES_RUNTIME_CPU_RAM_BYTES);
-    memcpy(prgRamBuffer, mutableRuntime->prgRamSnapshot, SMOLNES_RUNTIME_PRG_RAM_BYTES);
-    if (frameId != NULL) {
-        *frameId = mutableRuntime->latestFrameId;
-    }
-    pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-    return true;
+    SmolnesMemoryCopyContext context = {
+        .cpuRam = cpuRamBuffer,
+        .prgRam = prgRamBuffer,
+        .frameId = frameId,
+    };
+    return readPublishedFrameState(runtime, false, copyMemoryFromFrameState, &context);
 }
 
 bool smolnesRuntimeCopyPpuSnapshot(
@@ -2155,25 +2312,7 @@ bool smolnesRuntimeCopyPpuSnapshot(
         return false;
     }
 
-    SmolnesRuntimeHandle* mutableRuntime = (SmolnesRuntimeHandle*)runtime;
-    pthread_mutex_lock(&mutableRuntime->runtimeMutex);
-    if (!mutableRuntime->threadRunning || !mutableRuntime->healthy
-        || !mutableRuntime->hasPpuSnapshot) {
-        pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-        return false;
-    }
-
-    snapshotOut->frame_id = mutableRuntime->latestFrameId;
-    snapshotOut->v = mutableRuntime->ppuVSnapshot;
-    snapshotOut->fine_x = mutableRuntime->ppuFineXSnapshot;
-    snapshotOut->mirror = mutableRuntime->ppuMirrorSnapshot;
-    snapshotOut->ppuctrl = mutableRuntime->ppuCtrlSnapshot;
-    snapshotOut->ppumask = mutableRuntime->ppuMaskSnapshot;
-    memcpy(snapshotOut->chr, mutableRuntime->chrSnapshot, SMOLNES_RUNTIME_PPU_CHR_BYTES);
-    memcpy(snapshotOut->oam, mutableRuntime->oamSnapshot, SMOLNES_RUNTIME_PPU_OAM_BYTES);
-    memcpy(snapshotOut->vram, mutableRuntime->vramSnapshot, SMOLNES_RUNTIME_PPU_VRAM_BYTES);
-    pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-    return true;
+    return readPublishedFrameState(runtime, true, copyPpuFromFrameState, snapshotOut);
 }
 
 bool smolnesRuntimeCopyPrgRam(
@@ -2183,17 +2322,8 @@ bool smolnesRuntimeCopyPrgRam(
         return false;
     }
 
-    SmolnesRuntimeHandle* mutableRuntime = (SmolnesRuntimeHandle*)runtime;
-    pthread_mutex_lock(&mutableRuntime->runtimeMutex);
-    if (!mutableRuntime->threadRunning || !mutableRuntime->healthy
-        || !mutableRuntime->hasMemorySnapshot) {
-        pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-        return false;
-    }
-
-    memcpy(buffer, mutableRuntime->prgRamSnapshot, SMOLNES_RUNTIME_PRG_RAM_BYTES);
-    pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
-    return true;
+    SmolnesMemoryCopyContext context = { .cpuRam = NULL, .prgRam = buffer, .frameId = NULL };
+    return readPublishedFrameState(runtime, false, copyMemoryFromFrameState, &context);
 }
 
 bool smolnesRuntimeCopyProfilingSnapshot(
@@ -2341,34 +2471,27 @@ bool smolnesRuntimeCopyLiveSnapshot(
         return false;
     }
 
+    // Frames are written under runtimeMutex, and holding it keeps the published state
+    // matched to them.
     SmolnesRuntimeHandle* mutableRuntime = (SmolnesRuntimeHandle*)runtime;
     pthread_mutex_lock(&mutableRuntime->runtimeMutex);
+    const uint32_t slot = mutableRuntime->publishedFrameState;
     if (!mutableRuntime->threadRunning || !mutableRuntime->healthy
         || !mutableRuntime->hasLatestFrame || !mutableRuntime->hasLatestPaletteFrame
-        || !mutableRuntime->hasMemorySnapshot) {
+        || slot == SMOLNES_FRAME_STATE_NONE) {
         pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
         return false;
     }
 
+    const SmolnesRuntimeFrameState* state = &mutableRuntime->frameStates[slot];
     memcpy(frameBuffer, mutableRuntime->latestFrame, SMOLNES_RUNTIME_FRAME_BYTES);
     memcpy(paletteBuffer, mutableRuntime->latestPaletteFrame, SMOLNES_RUNTIME_PALETTE_FRAME_BYTES);
-    memcpy(cpuRamBuffer, mutableRuntime->cpuRamSnapshot, SMOLNES_RUNTIME_CPU_RAM_BYTES);
-    memcpy(prgRamBuffer, mutableRuntime->prgRamSnapshot, SMOLNES_RUNTIME_PRG_RAM_BYTES);
+    memcpy(cpuRamBuffer, state->cpuRam, SMOLNES_RUNTIME_CPU_RAM_BYTES);
+    memcpy(prgRamBuffer, state->prgRam, SMOLNES_RUNTIME_PRG_RAM_BYTES);
     if (frameId != NULL) {
-        *frameId = mutableRuntime->latestFrameId;
+        *frameId = state->frameId;
     }
-    controllerSnapshotOut->latest_frame_id = mutableRuntime->latestFrameId;
-    controllerSnapshotOut->controller1_applied_frame_id =
-        mutableRuntime->latestFrameController1AppliedFrameId;
-    controllerSnapshotOut->controller1_observed_timestamp_ns =
-        mutableRuntime->latestFrameController1ObservedTimestampNs;
-    controllerSnapshotOut->controller1_latch_timestamp_ns =
-        mutableRuntime->latestFrameController1LatchTimestampNs;
-    controllerSnapshotOut->controller1_request_timestamp_ns =
-        mutableRuntime->latestFrameController1RequestTimestampNs;
-    controllerSnapshotOut->controller1_sequence_id =
-        mutableRuntime->latestFrameController1SequenceId;
-    controllerSnapshotOut->controller1_state = mutableRuntime->latestFrameController1State;
+    *controllerSnapshotOut = state->controller;
     pthread_mutex_unlock(&mutableRuntime->runtimeMutex);
     return true;
 }
@@ -2435,10 +2558,14 @@ bool smolnesRuntimeCopyApuSamples(
     return true;
 }
 
-bool smolnesRuntimeCopySavestate(
-    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize, uint64_t* frameId)
+static bool copySavestateBytes(
+    const SmolnesRuntimeHandle* runtime,
+    uint8_t* buffer,
+    uint32_t bufferSize,
+    uint32_t savestateSize,
+    uint64_t* frameId)
 {
-    if (runtime == NULL || buffer == NULL || bufferSize < smolnesRuntimeGetSavestateSize()) {
+    if (runtime == NULL || buffer == NULL || bufferSize < savestateSize) {
         return false;
     }
 
@@ -2451,7 +2578,7 @@ bool smolnesRuntimeCopySavestate(
     }
 
     const SmolnesRuntimeSavestateBlob* savestate = getLatestSavestateBlob(mutableRuntime);
-    memcpy(buffer, savestate, (size_t)smolnesRuntimeGetSavestateSize());
+    memcpy(buffer, savestate, (size_t)savestateSize);
     if (frameId != NULL) {
         *frameId = savestate->frameId;
     }
@@ -2459,10 +2586,26 @@ bool smolnesRuntimeCopySavestate(
     return true;
 }
 
+bool smolnesRuntimeCopySavestate(
+    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize, uint64_t* frameId)
+{
+    return copySavestateBytes(
+        runtime, buffer, bufferSize, smolnesRuntimeGetSavestateSize(), frameId);
+}
+
+bool smolnesRuntimeCopyCompactSavestate(
+    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize, uint64_t* frameId)
+{
+    return copySavestateBytes(
+        runtime, buffer, bufferSize, smolnesRuntimeGetCompactSavestateSize(), frameId);
+}
+
 bool smolnesRuntimeLoadSavestate(
     SmolnesRuntimeHandle* runtime, const uint8_t* buffer, uint32_t bufferSize, uint32_t timeoutMs)
 {
-    if (runtime == NULL || buffer == NULL || bufferSize != smolnesRuntimeGetSavestateSize()) {
+    if (runtime == NULL || buffer == NULL
+        || (bufferSize != smolnesRuntimeGetSavestateSize()
+            && bufferSize != smolnesRuntimeGetCompactSavestateSize())) {
         return false;
     }
 
@@ -2481,6 +2624,7 @@ bool smolnesRuntimeLoadSavestate(
     }
 
     memcpy(runtime->pendingSavestate, buffer, (size_t)bufferSize);
+    runtime->pendingSavestateCompact = bufferSize != smolnesRuntimeGetSavestateSize();
     runtime->savestateRequestSequence++;
     if (runtime->savestateRequestSequence == 0) {
         runtime->savestateRequestSequence = 1;
@@ -2504,6 +2648,7 @@ bool smolnesRuntimeLoadSavestate(
         if (waitResult == ETIMEDOUT) {
             runtime->savestateLoadPending = false;
             runtime->healthy = false;
+            invalidateFrameStatesLocked(runtime);
             setLastErrorLocked(runtime, "Timed out waiting for smolnes savestate load.");
             pthread_mutex_unlock(&runtime->runtimeMutex);
             return false;
@@ -2556,6 +2701,16 @@ void smolnesRuntimeSetPixelOutputEnabled(SmolnesRuntimeHandle* runtime, bool ena
     pthread_mutex_unlock(&runtime->runtimeMutex);
 }
 
+void smolnesRuntimeSetPpuSnapshotEnabled(SmolnesRuntimeHandle* runtime, bool enabled)
+{
+    if (runtime == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&runtime->runtimeMutex);
+    runtime->ppuSnapshotEnabled = enabled;
+    pthread_mutex_unlock(&runtime->runtimeMutex);
+}
+
 void smolnesRuntimeSetRgbaOutputEnabled(SmolnesRuntimeHandle* runtime, bool enabled)
 {
     if (runtime == NULL) {
@@ -97,6 +97,7 @@ typedef struct SmolnesRuntimePpuSnapshot {
     uint8_t mirror;
     uint8_t ppuctrl;
     uint8_t ppumask;
+    uint64_t chr_version;
     uint8_t chr[SMOLNES_RUNTIME_PPU_CHR_BYTES];
     uint8_t oam[SMOLNES_RUNTIME_PPU_OAM_BYTES];
     uint8_t vram[SMOLNES_RUNTIME_PPU_VRAM_BYTES];
@@ -112,6 +113,8 @@ typedef struct SmolnesRuntimePpuSnapshot {
 #define SMOLNES_RUNTIME_BUTTON_RIGHT (1u << 7)
 
 uint32_t smolnesRuntimeGetSavestateSize(void);
+// Compact savestates omit the video, palette, and APU sample buffers; load accepts either size.
+uint32_t smolnesRuntimeGetCompactSavestateSize(void);
 
 SmolnesRuntimeHandle* smolnesRuntimeCreate(void);
 void smolnesRuntimeDestroy(SmolnesRuntimeHandle* runtime);
@@ -166,6 +169,8 @@ bool smolnesRuntimeCopyApuSamples(
     const SmolnesRuntimeHandle* runtime, float* buffer, uint32_t maxSamples, uint32_t* samplesOut);
 bool smolnesRuntimeCopySavestate(
     const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize, uint64_t* frameId);
+bool smolnesRuntimeCopyCompactSavestate(
+    const SmolnesRuntimeHandle* runtime, uint8_t* buffer, uint32_t bufferSize, uint64_t* frameId);
 bool smolnesRuntimeLoadSavestate(
     SmolnesRuntimeHandle* runtime, const uint8_t* buffer, uint32_t bufferSize, uint32_t timeoutMs);
 void smolnesRuntimeGetLastErrorCopy(
@@ -175,6 +180,8 @@ void smolnesRuntimeSetApuSampleCallback(
 void smolnesRuntimeSetApuEnabled(SmolnesRuntimeHandle* runtime, bool enabled);
 void smolnesRuntimeSetDetailedTimingEnabled(SmolnesRuntimeHandle* runtime, bool enabled);
 void smolnesRuntimeSetPixelOutputEnabled(SmolnesRuntimeHandle* runtime, bool enabled);
+// PPU snapshots (CHR, OAM, VRAM) are published each frame only while enabled (the default).
+void smolnesRuntimeSetPpuSnapshotEnabled(SmolnesRuntimeHandle* runtime, bool enabled);
 void smolnesRuntimeSetRgbaOutputEnabled(SmolnesRuntimeHandle* runtime, bool enabled);
 void smolnesRuntimeSetPacingMode(SmolnesRuntimeHandle* runtime, SmolnesRuntimePacingModeValue mode);
 
@@ -143,3 +143,63 @@ TEST(NesTileFrameTest, OptionalPatternPixelsSkipsOnlyPatternPanelData)
     EXPECT_EQ(timers.getCallCount("nes_tile_frame_tile_ids"), 1u);
     EXPECT_EQ(timers.getCallCount("nes_tile_frame_tile_hashes"), 1u);
 }
+
+TEST(NesTileFrameTest, PatternHashCacheReusesHashesUntilChrVersionChanges)
+{
+    NesPpuSnapshot snapshot;
+    snapshot.chrVersion = 1u;
+    snapshot.mirror = 2u;
+    setSolidTilePattern(snapshot, 1u, 1u);
+    snapshot.vram[32u] = 1u;
+
+    NesTilePatternHashCache cache;
+    Timers timers;
+    const NesTileFrameBuildOptions options{ .patternHashCache = &cache };
+    const NesTileFrame uncached = makeNesTileFrame(snapshot);
+    const NesTileFrame first = makeNesTileFrame(snapshot, options, &timers);
+    const NesTileFrame second = makeNesTileFrame(snapshot, options, &timers);
+
+    EXPECT_EQ(first.tilePatternHashes, uncached.tilePatternHashes);
+    EXPECT_EQ(second.tilePatternHashes, uncached.tilePatternHashes);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+    EXPECT_DOUBLE_EQ(cache.getHitRate(), 0.5);
+    EXPECT_EQ(timers.getCallCount("nes_tile_pattern_hash_cache_miss"), 1u);
+    EXPECT_EQ(timers.getCallCount("nes_tile_pattern_hash_cache_hit"), 1u);
+
+    setSolidTilePattern(snapshot, 1u, 2u);
+    snapshot.chrVersion = 2u;
+    const NesTileFrame changed = makeNesTileFrame(snapshot, options);
+
+    EXPECT_EQ(cache.getMissCount(), 2u);
+    EXPECT_EQ(changed.tilePatternHashes, makeNesTileFrame(snapshot).tilePatternHashes);
+    EXPECT_NE(
+        changed.tilePatternHashes[tileCellIndex(0u, 0u)],
+        first.tilePatternHashes[tileCellIndex(0u, 0u)]);
+}
+
+TEST(NesTileFrameTest, PatternHashCacheTracksPatternTableSelectAndUnknownVersions)
+{
+    NesPpuSnapshot snapshot;
+    snapshot.chrVersion = 3u;
+    snapshot.mirror = 2u;
+    setSolidTilePattern(snapshot, 1u, 1u);
+    snapshot.vram[32u] = 1u;
+
+    NesTilePatternHashCache cache;
+    const NesTileFrameBuildOptions options{ .patternHashCache = &cache };
+    makeNesTileFrame(snapshot, options);
+
+    // Switching the background pattern table reads different CHR bytes.
+    snapshot.ppuCtrl = 0x10u;
+    const NesTileFrame switched = makeNesTileFrame(snapshot, options);
+    EXPECT_EQ(cache.getMissCount(), 2u);
+    EXPECT_EQ(switched.tilePatternHashes, makeNesTileFrame(snapshot).tilePatternHashes);
+
+    // Snapshots without a CHR version never trust the cached table.
+    snapshot.chrVersion = 0u;
+    makeNesTileFrame(snapshot, options);
+    makeNesTileFrame(snapshot, options);
+    EXPECT_EQ(cache.getMissCount(), 4u);
+    EXPECT_EQ(cache.getHitCount(), 0u);
+}
@@ -1,5 +1,6 @@
 #include "core/scenarios/nes/NesTileRecurrentBrain.h"
 
+#include "core/organisms/brains/WeightQuantization.h"
 #include "core/organisms/brains/WeightType.h"
 #include "core/scenarios/nes/NesTileSensoryData.h"
 
@@ -189,3 +190,46 @@ TEST(NesTileRecurrentBrainTest, HandAuthoredGenomeProducesDeterministicControlle
     EXPECT_NEAR(output.aRaw, 0.75f, 1e-6f);
     EXPECT_NEAR(output.bRaw, -0.75f, 1e-6f);
 }
+
+TEST(NesTileRecurrentBrainTest, Int8InferenceTracksFloatOutputs)
+{
+    constexpr int kGenomeCount = 4;
+    constexpr int kSteps = 200;
+
+    std::mt19937 rng(4321u);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    double totalAbsDrift = 0.0;
+    int samples = 0;
+    int buttonAgreements = 0;
+
+    for (int g = 0; g < kGenomeCount; ++g) {
+        const Genome genome = NesTileRecurrentBrain::randomGenome(rng);
+        NesTileRecurrentBrain floatBrain(genome);
+        NesTileRecurrentBrain int8Brain(genome);
+        int8Brain.setInferencePrecision(InferencePrecision::Int8);
+
+        for (int step = 0; step < kSteps; ++step) {
+            NesTileSensoryData sensory;
+            for (auto& token : sensory.tileFrame.tokens) {
+                token = static_cast<NesTileTokenizer::TileToken>(
+                    rng() % NesTileRecurrentBrain::TileVocabularySize);
+            }
+            sensory.facingX = unit(rng) < 0.5f ? -1.0f : 1.0f;
+            sensory.energy = unit(rng);
+
+            const ControllerOutput expected = floatBrain.inferControllerOutput(sensory);
+            const ControllerOutput actual = int8Brain.inferControllerOutput(sensory);
+            totalAbsDrift += std::abs(expected.xRaw - actual.xRaw);
+            totalAbsDrift += std::abs(expected.yRaw - actual.yRaw);
+            samples += 2;
+            buttonAgreements += (expected.a == actual.a) + (expected.b == actual.b);
+        }
+    }
+
+    const double meanAbsDrift = totalAbsDrift / samples;
+    const double buttonAgreement =
+        static_cast<double>(buttonAgreements) / (2.0 * kGenomeCount * kSteps);
+    EXPECT_LT(meanAbsDrift, 0.05);
+    EXPECT_GT(buttonAgreement, 0.95);
+}
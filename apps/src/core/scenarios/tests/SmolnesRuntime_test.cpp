@@ -1,6 +1,7 @@
 #include "core/scenarios/nes/SmolnesRuntime.h"
 
 #include <algorithm>
+#include <atomic>
 #include <array>
 #include <cstdint>
 #include <filesystem>
@@ -9,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 using namespace DirtSim;
@@ -21,6 +23,8 @@ constexpr uint8_t kSpritePaletteIndex = 0x02u;
 constexpr uint8_t kSpriteScreenX = 32u;
 constexpr uint8_t kSpriteScreenY = 32u;
 constexpr uint8_t kSpriteOamY = kSpriteScreenY - 1u;
+constexpr uint16_t kFrameCounterAddr = 0x0010u;
+constexpr uint16_t kFrameFillPageAddr = 0x0200u;
 
 class TestRomAssembler {
 public:
@@ -31,6 +35,13 @@ public:
 
     void label(std::string_view name) { labels_[std::string(name)] = pc(); }
 
+    uint16_t labelAddress(std::string_view name) const
+    {
+        const auto labelIt = labels_.find(name);
+        EXPECT_NE(labelIt, labels_.end());
+        return labelIt == labels_.end() ? kProgramStart : labelIt->second;
+    }
+
     void ldaAbsXLabel(std::string_view labelName)
     {
         bytes({ 0xBDu, 0x00u, 0x00u });
@@ -124,6 +135,41 @@ std::array<uint8_t, 32> buildPaletteData()
     return palette;
 }
 
+std::filesystem::path writeTestRom(const char* stem, std::vector<uint8_t> prg, uint16_t nmiVector)
+{
+    prg.resize(16u * 1024u, 0xEAu);
+    prg[0x3FFAu] = static_cast<uint8_t>(nmiVector & 0xFFu);
+    prg[0x3FFBu] = static_cast<uint8_t>(nmiVector >> 8);
+    prg[0x3FFCu] = static_cast<uint8_t>(kProgramStart & 0xFFu);
+    prg[0x3FFDu] = static_cast<uint8_t>(kProgramStart >> 8);
+    prg[0x3FFEu] = static_cast<uint8_t>(kProgramStart & 0xFFu);
+    prg[0x3FFFu] = static_cast<uint8_t>(kProgramStart >> 8);
+
+    std::vector<uint8_t> chr(8u * 1024u, 0x00u);
+    for (int row = 0; row < 8; ++row) {
+        chr[row] = 0xFFu;
+        chr[16u + static_cast<size_t>(row)] = 0xFFu;
+    }
+
+    const std::filesystem::path romPath =
+        std::filesystem::path(::testing::TempDir()) / (std::string(stem) + ".nes");
+    std::ofstream stream(romPath, std::ios::binary | std::ios::trunc);
+    EXPECT_TRUE(stream.is_open());
+
+    const std::array<uint8_t, 16> header = {
+        'N',   'E',   'S',   0x1A,  0x01u, 0x01u, 0x00u, 0x00u,
+        0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    };
+    stream.write(
+        reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    stream.write(
+        reinterpret_cast<const char*>(prg.data()), static_cast<std::streamsize>(prg.size()));
+    stream.write(
+        reinterpret_cast<const char*>(chr.data()), static_cast<std::streamsize>(chr.size()));
+    EXPECT_TRUE(stream.good());
+    return romPath;
+}
+
 std::filesystem::path writeSpriteMaskTestRom(const char* stem, bool spritesEnabled)
 {
     TestRomAssembler assembler;
@@ -166,38 +212,29 @@ std::filesystem::path writeSpriteMaskTestRom(const char* stem, bool spritesEnabl
         assembler.bytes({ value });
     }
 
-    std::vector<uint8_t> prg = assembler.build();
-    prg.resize(16u * 1024u, 0xEAu);
-    prg[0x3FFAu] = static_cast<uint8_t>(kProgramStart & 0xFFu);
-    prg[0x3FFBu] = static_cast<uint8_t>(kProgramStart >> 8);
-    prg[0x3FFCu] = static_cast<uint8_t>(kProgramStart & 0xFFu);
-    prg[0x3FFDu] = static_cast<uint8_t>(kProgramStart >> 8);
-    prg[0x3FFEu] = static_cast<uint8_t>(kProgramStart & 0xFFu);
-    prg[0x3FFFu] = static_cast<uint8_t>(kProgramStart >> 8);
-
-    std::vector<uint8_t> chr(8u * 1024u, 0x00u);
-    for (int row = 0; row < 8; ++row) {
-        chr[row] = 0xFFu;
-        chr[16u + static_cast<size_t>(row)] = 0xFFu;
-    }
-
-    const std::filesystem::path romPath =
-        std::filesystem::path(::testing::TempDir()) / (std::string(stem) + ".nes");
-    std::ofstream stream(romPath, std::ios::binary | std::ios::trunc);
-    EXPECT_TRUE(stream.is_open());
+    return writeTestRom(stem, assembler.build(), kProgramStart);
+}
 
-    const std::array<uint8_t, 16> header = {
-        'N',   'E',   'S',   0x1A,  0x01u, 0x01u, 0x00u, 0x00u,
-        0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-    };
-    stream.write(
-        reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
-    stream.write(
-        reinterpret_cast<const char*>(prg.data()), static_cast<std::streamsize>(prg.size()));
-    stream.write(
-        reinterpret_cast<const char*>(chr.data()), static_cast<std::streamsize>(chr.size()));
-    EXPECT_TRUE(stream.good());
-    return romPath;
+// Each vblank NMI bumps a counter and fills one RAM page with it. Frames are published at vblank
+// start, before the NMI runs, so every published frame holds one counter value in the whole page
+// and the counter trails frameId by a fixed offset.
+std::filesystem::path writeFrameCounterTestRom(const char* stem)
+{
+    TestRomAssembler assembler;
+    assembler.bytes({ 0x78u, 0xD8u, 0xA2u, 0xFFu, 0x9Au });
+    assembler.ldaImmStaAbs(0x80u, 0x2000u);
+    assembler.label("idle");
+    assembler.jmpLabel("idle");
+    assembler.label("nmi");
+    assembler.bytes({ 0x48u, 0x8Au, 0x48u });
+    assembler.bytes({ 0xE6u, static_cast<uint8_t>(kFrameCounterAddr) });
+    assembler.bytes({ 0xA5u, static_cast<uint8_t>(kFrameCounterAddr), 0xA2u, 0x00u });
+    assembler.label("fillLoop");
+    assembler.bytes({ 0x9Du, 0x00u, static_cast<uint8_t>(kFrameFillPageAddr >> 8), 0xE8u });
+    assembler.branchToLabel(0xD0u, "fillLoop");
+    assembler.bytes({ 0x68u, 0xAAu, 0x68u, 0x40u });
+
+    return writeTestRom(stem, assembler.build(), assembler.labelAddress("nmi"));
 }
 
 struct SpriteMaskObservation {
@@ -283,3 +320,58 @@ TEST(SmolnesRuntimeTest, CopyPpuSnapshotProvidesChrAndNametableState)
         return value != 0u;
     }));
 }
+
+TEST(SmolnesRuntimeTest, ConcurrentMemorySnapshotsAreNeverTorn)
+{
+    const std::filesystem::path romPath = writeFrameCounterTestRom("smolnes_frame_counter");
+
+    SmolnesRuntime runtime;
+    ASSERT_TRUE(runtime.start(romPath.string())) << runtime.getLastError();
+    runtime.setApuEnabled(false);
+    ASSERT_TRUE(runtime.runFrames(3u, 2000u)) << runtime.getLastError();
+
+    const auto baseline = runtime.copyMemorySnapshot();
+    ASSERT_TRUE(baseline.has_value());
+    const uint8_t counterOffset =
+        static_cast<uint8_t>(baseline->frameId - baseline->cpuRam[kFrameCounterAddr]);
+
+    std::atomic<bool> running{ true };
+    std::atomic<uint64_t> readCount{ 0 };
+    std::atomic<uint64_t> tornCount{ 0 };
+    std::atomic<uint64_t> lastFrameId{ 0 };
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; ++i) {
+        readers.emplace_back([&]() {
+            while (running.load()) {
+                const auto snapshot = runtime.copyMemorySnapshot();
+                if (!snapshot.has_value()) {
+                    continue;
+                }
+                const uint8_t counter = snapshot->cpuRam[kFrameCounterAddr];
+                const auto page = snapshot->cpuRam.begin() + kFrameFillPageAddr;
+                const bool pageMatches =
+                    std::all_of(page, page + 256, [&](uint8_t value) { return value == counter; });
+                const bool frameMatches =
+                    static_cast<uint8_t>(snapshot->frameId - counter) == counterOffset;
+                if (!pageMatches || !frameMatches) {
+                    tornCount.fetch_add(1);
+                }
+                readCount.fetch_add(1);
+                lastFrameId.store(snapshot->frameId);
+            }
+        });
+    }
+
+    const bool ran = runtime.runFrames(600u, 10000u);
+    running.store(false);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    const std::string lastError = runtime.getLastError();
+    runtime.stop();
+
+    ASSERT_TRUE(ran) << lastError;
+    EXPECT_GT(readCount.load(), 0u);
+    EXPECT_GT(lastFrameId.load(), baseline->frameId);
+    EXPECT_EQ(tornCount.load(), 0u);
+}
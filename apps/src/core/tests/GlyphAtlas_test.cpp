@@ -0,0 +1,148 @@
+#include "core/GlyphAtlas.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+namespace DirtSim {
+namespace {
+
+class GlyphAtlasTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        dir_ = std::filesystem::temp_directory_path()
+            / ("glyph_atlas_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(dir_);
+        path_ = dir_ / "glyph-atlas.bin";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir_); }
+
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+};
+
+std::vector<std::vector<bool>> makeCheckerPattern(int width, int height)
+{
+    std::vector<std::vector<bool>> pattern(height, std::vector<bool>(width));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            pattern[y][x] = ((x + y) % 3) == 0;
+        }
+    }
+    return pattern;
+}
+
+TEST_F(GlyphAtlasTest, SavedPatternsAreFoundAfterReopen)
+{
+    const std::string key = GlyphAtlas::makeKey("montserrat_24", 48, 48, 0.3f, "trimmed", "7");
+    const auto pattern = makeCheckerPattern(13, 17);
+
+    {
+        GlyphAtlas atlas(path_);
+        EXPECT_FALSE(atlas.findPattern(key).has_value());
+
+        atlas.storePattern(key, pattern);
+        EXPECT_TRUE(atlas.isDirty());
+        ASSERT_EQ(atlas.findPattern(key).value(), pattern);
+
+        ASSERT_TRUE(atlas.save().isValue());
+        EXPECT_FALSE(atlas.isDirty());
+    }
+
+    GlyphAtlas reopened(path_);
+    EXPECT_EQ(reopened.getEntryCount(), 1u);
+    const auto found = reopened.findPattern(key);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found.value(), pattern);
+
+    // Same glyph under a different threshold is a different entry.
+    EXPECT_FALSE(reopened
+                     .findPattern(
+                         GlyphAtlas::makeKey("montserrat_24", 48, 48, 0.5f, "trimmed", "7"))
+                     .has_value());
+}
+
+TEST_F(GlyphAtlasTest, MaterialGridsRoundTripAlongsideMappedEntries)
+{
+    const std::string bitsKey = GlyphAtlas::makeKey("emoji", 120, 120, 0.3f, "trimmed", "1");
+    const std::string gridKey = GlyphAtlas::makeKey("emoji", 120, 120, 0.5f, "material", "1");
+
+    GridBuffer<Material::EnumType> grid;
+    grid.resize(4, 3);
+    grid.set(1, 2, Material::EnumType::Sand);
+    grid.set(3, 0, Material::EnumType::Water);
+
+    {
+        GlyphAtlas atlas(path_);
+        atlas.storePattern(bitsKey, makeCheckerPattern(5, 5));
+        ASSERT_TRUE(atlas.save().isValue());
+    }
+    {
+        // Adding to a mapped atlas keeps the entries that were already on disk.
+        GlyphAtlas atlas(path_);
+        EXPECT_FALSE(atlas.findMaterialGrid(bitsKey).has_value());
+        atlas.storeMaterialGrid(gridKey, grid);
+        ASSERT_TRUE(atlas.save().isValue());
+    }
+
+    GlyphAtlas reopened(path_);
+    EXPECT_EQ(reopened.getEntryCount(), 2u);
+    EXPECT_TRUE(reopened.findPattern(bitsKey).has_value());
+    const auto found = reopened.findMaterialGrid(gridKey);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->width, 4);
+    EXPECT_EQ(found->height, 3);
+    EXPECT_EQ(found->data, grid.data);
+}
+
+TEST_F(GlyphAtlasTest, IgnoresFileFromAnotherVersion)
+{
+    {
+        std::ofstream file(path_, std::ios::binary);
+        const char header[16] = { 'D', 'S', 'G', 'A', 99, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 };
+        file.write(header, sizeof(header));
+    }
+
+    GlyphAtlas atlas(path_);
+    EXPECT_EQ(atlas.getEntryCount(), 0u);
+
+    const std::string key = GlyphAtlas::makeKey("font", 8, 8, 0.3f, "bits", "a");
+    atlas.storePattern(key, makeCheckerPattern(8, 8));
+    ASSERT_TRUE(atlas.save().isValue());
+
+    GlyphAtlas reopened(path_);
+    EXPECT_TRUE(reopened.findPattern(key).has_value());
+}
+
+TEST_F(GlyphAtlasTest, BackgroundSaveKeepsEntriesStoredWhileWriting)
+{
+    const std::string first = GlyphAtlas::makeKey("montserrat_24", 48, 48, 0.3f, "trimmed", "1");
+    const std::string second = GlyphAtlas::makeKey("montserrat_24", 48, 48, 0.3f, "trimmed", "2");
+    const auto pattern = makeCheckerPattern(9, 11);
+
+    {
+        GlyphAtlas atlas(path_);
+        atlas.storePattern(first, pattern);
+        atlas.saveInBackground();
+        atlas.storePattern(second, pattern);
+
+        // Whether or not the write has finished, both entries stay visible.
+        EXPECT_TRUE(atlas.findPattern(first).has_value());
+        EXPECT_TRUE(atlas.findPattern(second).has_value());
+
+        // A foreground save waits for the background one and picks up the rest.
+        ASSERT_TRUE(atlas.save().isValue());
+        EXPECT_FALSE(atlas.isDirty());
+    }
+
+    GlyphAtlas reopened(path_);
+    EXPECT_EQ(reopened.getEntryCount(), 2u);
+    EXPECT_TRUE(reopened.findPattern(first).has_value());
+    EXPECT_TRUE(reopened.findPattern(second).has_value());
+}
+
+} // namespace
+} // namespace DirtSim
@@ -0,0 +1,175 @@
+#include "core/MaterialSummedAreaTable.h"
+#include "core/World.h"
+#include "core/WorldData.h"
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace DirtSim;
+
+namespace {
+
+// Matches the tree sensing layout: a 15x15 bin grid over a downsampled window.
+constexpr int kWorldWidth = 400;
+constexpr int kWorldHeight = 300;
+constexpr int kBins = 15;
+constexpr int kBinCells = 6;
+constexpr int kWindowCells = kBins * kBinCells;
+constexpr int kFrameCount = 50;
+
+struct Window {
+    int x = 0;
+    int y = 0;
+};
+
+void fillRandomMaterials(WorldData& data, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> material(0, MaterialSummedAreaTable::kMaterialCount - 1);
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            const auto type = static_cast<Material::EnumType>(material(rng));
+            if (type == Material::EnumType::Air) {
+                data.at(x, y).clear();
+            }
+            else {
+                data.at(x, y).replaceMaterial(type, 1.0);
+            }
+        }
+    }
+}
+
+std::vector<Window> makeWindows(int count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> xs(0, kWorldWidth - kWindowCells);
+    std::uniform_int_distribution<int> ys(0, kWorldHeight - kWindowCells);
+    std::vector<Window> windows(static_cast<size_t>(count));
+    for (auto& window : windows) {
+        window.x = xs(rng);
+        window.y = ys(rng);
+    }
+    return windows;
+}
+
+int64_t scanWindowDirect(const WorldData& data, const Window& window)
+{
+    int64_t checksum = 0;
+    for (int by = 0; by < kBins; ++by) {
+        for (int bx = 0; bx < kBins; ++bx) {
+            MaterialSummedAreaTable::MaterialCounts counts{};
+            const int x0 = window.x + bx * kBinCells;
+            const int y0 = window.y + by * kBinCells;
+            for (int y = y0; y < y0 + kBinCells; ++y) {
+                for (int x = x0; x < x0 + kBinCells; ++x) {
+                    counts[static_cast<int>(data.at(x, y).material_type)]++;
+                }
+            }
+            for (int m = 0; m < MaterialSummedAreaTable::kMaterialCount; ++m) {
+                checksum += counts[m] * (m + 1);
+            }
+        }
+    }
+    return checksum;
+}
+
+int64_t scanWindowTable(const MaterialSummedAreaTable& table, const Window& window)
+{
+    int64_t checksum = 0;
+    for (int by = 0; by < kBins; ++by) {
+        for (int bx = 0; bx < kBins; ++bx) {
+            const int x0 = window.x + bx * kBinCells;
+            const int y0 = window.y + by * kBinCells;
+            const auto counts = table.materialCounts(x0, y0, x0 + kBinCells, y0 + kBinCells);
+            for (int m = 0; m < MaterialSummedAreaTable::kMaterialCount; ++m) {
+                checksum += counts[m] * (m + 1);
+            }
+        }
+    }
+    return checksum;
+}
+
+double msPerFrame(std::chrono::steady_clock::duration elapsed)
+{
+    return std::chrono::duration<double, std::milli>(elapsed).count() / kFrameCount;
+}
+
+} // namespace
+
+class MaterialSummedAreaTablePerformance : public testing::TestWithParam<int> {};
+
+// Times one frame of tree window sensing three ways: always scanning cells, always rebuilding
+// the table, and letting World choose. Every frame is a new timestep, so the table rebuilds.
+TEST_P(MaterialSummedAreaTablePerformance, TreeWindowsPerFrame)
+{
+    const int organismCount = GetParam();
+    World world(kWorldWidth, kWorldHeight);
+    WorldData& data = world.getData();
+    fillRandomMaterials(data, 3u);
+    const std::vector<Window> windows = makeWindows(organismCount, 11u);
+
+    int64_t directChecksum = 0;
+    const auto directStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        for (const auto& window : windows) {
+            directChecksum += scanWindowDirect(data, window);
+        }
+    }
+    const double directMs = msPerFrame(std::chrono::steady_clock::now() - directStart);
+
+    int64_t tableChecksum = 0;
+    MaterialSummedAreaTable table;
+    const auto tableStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        table.rebuild(data, nullptr);
+        for (const auto& window : windows) {
+            tableChecksum += scanWindowTable(table, window);
+        }
+    }
+    const double tableMs = msPerFrame(std::chrono::steady_clock::now() - tableStart);
+
+    int64_t gatedChecksum = 0;
+    int tableFrames = 0;
+    const auto gatedStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        data.timestep++;
+        bool usedTable = false;
+        for (const auto& window : windows) {
+            const MaterialSummedAreaTable* areaTable = world.getMaterialSummedAreaTableFor(
+                static_cast<int64_t>(kWindowCells) * kWindowCells);
+            if (areaTable) {
+                gatedChecksum += scanWindowTable(*areaTable, window);
+                usedTable = true;
+            }
+            else {
+                gatedChecksum += scanWindowDirect(data, window);
+            }
+        }
+        tableFrames += usedTable ? 1 : 0;
+    }
+    const double gatedMs = msPerFrame(std::chrono::steady_clock::now() - gatedStart);
+
+    std::cout << "[Perf] organisms=" << organismCount << " world=" << kWorldWidth << "x"
+              << kWorldHeight << " window=" << kWindowCells << "x" << kWindowCells
+              << " direct=" << directMs << "ms table=" << tableMs << "ms gated=" << gatedMs
+              << "ms tableFrames=" << tableFrames << "/" << kFrameCount << "\n";
+
+    EXPECT_EQ(directChecksum, tableChecksum);
+    EXPECT_EQ(directChecksum, gatedChecksum);
+
+    const double coverage = static_cast<double>(organismCount) * kWindowCells * kWindowCells
+        / (static_cast<double>(kWorldWidth) * kWorldHeight);
+    if (coverage < World::kMaterialSummedAreaTableBreakEvenCoverage) {
+        EXPECT_EQ(tableFrames, 0);
+    }
+    else {
+        // The first frame only switches once its running total crosses the threshold.
+        EXPECT_EQ(tableFrames, kFrameCount);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    OrganismCounts, MaterialSummedAreaTablePerformance, testing::Values(50, 200));
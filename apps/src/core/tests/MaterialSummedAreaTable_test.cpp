@@ -0,0 +1,136 @@
+#include "core/ColorNames.h"
+#include "core/LightBuffer.h"
+#include "core/MaterialSummedAreaTable.h"
+#include "core/World.h"
+#include "core/WorldData.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+
+using namespace DirtSim;
+
+namespace {
+
+void fillRandomMaterials(WorldData& data, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> material(0, MaterialSummedAreaTable::kMaterialCount - 1);
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            const auto type = static_cast<Material::EnumType>(material(rng));
+            if (type == Material::EnumType::Air) {
+                data.at(x, y).clear();
+            }
+            else {
+                data.at(x, y).replaceMaterial(type, 1.0);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(MaterialSummedAreaTableTest, BoxCountsMatchDirectScan)
+{
+    World world(23, 17);
+    WorldData& data = world.getData();
+    fillRandomMaterials(data, 5u);
+
+    MaterialSummedAreaTable table;
+    table.rebuild(data, nullptr);
+    EXPECT_FALSE(table.hasLight());
+
+    std::mt19937 rng(9u);
+    for (int trial = 0; trial < 200; ++trial) {
+        std::uniform_int_distribution<int> xs(0, data.width);
+        std::uniform_int_distribution<int> ys(0, data.height);
+        int x0 = xs(rng);
+        int x1 = xs(rng);
+        int y0 = ys(rng);
+        int y1 = ys(rng);
+        if (x0 > x1) {
+            std::swap(x0, x1);
+        }
+        if (y0 > y1) {
+            std::swap(y0, y1);
+        }
+
+        MaterialSummedAreaTable::MaterialCounts expected{};
+        for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                expected[static_cast<int>(data.at(x, y).material_type)]++;
+            }
+        }
+        EXPECT_EQ(table.materialCounts(x0, y0, x1, y1), expected)
+            << "box [" << x0 << "," << x1 << ")x[" << y0 << "," << y1 << ")";
+    }
+}
+
+TEST(MaterialSummedAreaTableTest, LightSumsMatchDirectScanWhenBufferMatchesGrid)
+{
+    World world(12, 9);
+    WorldData& data = world.getData();
+
+    LightBuffer light;
+    light.resize(data.width, data.height);
+    std::mt19937 rng(3u);
+    for (auto& value : light.data) {
+        value = rng() | 0xFFu;
+    }
+
+    MaterialSummedAreaTable table;
+    table.rebuild(data, &light);
+    ASSERT_TRUE(table.hasLight());
+
+    double expected = 0.0;
+    for (int y = 2; y < 7; ++y) {
+        for (int x = 3; x < 11; ++x) {
+            expected += ColorNames::brightness(light.at(x, y));
+        }
+    }
+    EXPECT_NEAR(table.lightSum(3, 2, 11, 7), expected, 1e-9);
+
+    LightBuffer mismatched;
+    mismatched.resize(data.width - 1, data.height);
+    table.rebuild(data, &mismatched);
+    EXPECT_FALSE(table.hasLight());
+    EXPECT_EQ(table.lightSum(0, 0, 4, 4), 0.0);
+}
+
+TEST(MaterialSummedAreaTableTest, WorldRebuildsTableAfterCellEdits)
+{
+    World world(10, 10);
+    const int wallsBefore = world.getMaterialSummedAreaTable().materialCounts(
+        0, 0, 10, 10)[static_cast<int>(Material::EnumType::Wall)];
+
+    world.replaceMaterialAtCell(Vector2s{ 4, 4 }, Material::EnumType::Metal);
+
+    const auto counts = world.getMaterialSummedAreaTable().materialCounts(4, 4, 5, 5);
+    EXPECT_EQ(counts[static_cast<int>(Material::EnumType::Metal)], 1);
+    EXPECT_EQ(
+        world.getMaterialSummedAreaTable()
+            .materialCounts(0, 0, 10, 10)[static_cast<int>(Material::EnumType::Wall)],
+        wallsBefore);
+}
+
+TEST(MaterialSummedAreaTableTest, WorldOnlyBuildsTableWhenSensingRepaysRebuild)
+{
+    World world(40, 30);
+    const double worldCells = 40.0 * 30.0;
+    const auto cellsFor = [&](double coverage) {
+        return static_cast<int64_t>(coverage * worldCells);
+    };
+    const double breakEven = World::kMaterialSummedAreaTableBreakEvenCoverage;
+
+    world.getData().timestep = 1;
+    EXPECT_EQ(world.getMaterialSummedAreaTableFor(cellsFor(breakEven * 0.5)), nullptr);
+    EXPECT_NE(world.getMaterialSummedAreaTableFor(cellsFor(breakEven * 0.6)), nullptr);
+
+    // Last frame's total carries over, so the first query of the next frame uses the table.
+    world.getData().timestep = 2;
+    EXPECT_NE(world.getMaterialSummedAreaTableFor(cellsFor(0.1)), nullptr);
+
+    // A frame with little sensing drops the forecast again.
+    world.getData().timestep = 3;
+    EXPECT_EQ(world.getMaterialSummedAreaTableFor(cellsFor(0.1)), nullptr);
+}
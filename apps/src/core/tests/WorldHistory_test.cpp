@@ -0,0 +1,146 @@
+#include "core/World.h"
+#include "core/WorldData.h"
+#include "core/WorldHistory.h"
+#include "core/WorldRegionActivityTracker.h"
+
+#include <gtest/gtest.h>
+
+using namespace DirtSim;
+
+namespace {
+
+WorldData makeWorldData(int width, int height)
+{
+    WorldData data;
+    data.width = static_cast<int16_t>(width);
+    data.height = static_cast<int16_t>(height);
+    data.cells.resize(static_cast<size_t>(width) * height);
+    return data;
+}
+
+std::vector<uint8_t> allBlocks(const WorldHistory& history)
+{
+    return std::vector<uint8_t>(
+        static_cast<size_t>(history.getBlocksX()) * history.getBlocksY(), 1);
+}
+
+void advance(WorldData& data, int x, int y, Material::EnumType material)
+{
+    data.at(x, y).replaceMaterial(material, 1.0f);
+    data.timestep++;
+}
+
+} // namespace
+
+TEST(WorldHistoryTest, StepsRestoreCellsAndTimestepInBothDirections)
+{
+    WorldHistory history;
+    WorldData data = makeWorldData(20, 12);
+    history.record(data, {});
+    EXPECT_EQ(history.getBlocksX(), 3);
+    EXPECT_EQ(history.getBlocksY(), 2);
+
+    advance(data, 3, 3, Material::EnumType::Dirt);
+    history.record(data, allBlocks(history));
+    advance(data, 17, 10, Material::EnumType::Sand);
+    history.record(data, allBlocks(history));
+    ASSERT_EQ(history.getFrameCount(), 2u);
+
+    const auto& lastBlocks = history.stepBack(data);
+    ASSERT_EQ(lastBlocks.size(), 1u);
+    EXPECT_EQ(lastBlocks[0], 5u);
+    EXPECT_EQ(data.timestep, 1);
+    EXPECT_TRUE(data.at(17, 10).isAir());
+    EXPECT_EQ(data.at(3, 3).material_type, Material::EnumType::Dirt);
+
+    history.stepBack(data);
+    EXPECT_EQ(data.timestep, 0);
+    EXPECT_TRUE(data.at(3, 3).isAir());
+    EXPECT_FALSE(history.canStepBack());
+    EXPECT_TRUE(history.stepBack(data).empty());
+
+    history.stepForward(data);
+    history.stepForward(data);
+    EXPECT_FALSE(history.canStepForward());
+    EXPECT_EQ(data.timestep, 2);
+    EXPECT_EQ(data.at(3, 3).material_type, Material::EnumType::Dirt);
+    EXPECT_EQ(data.at(17, 10).material_type, Material::EnumType::Sand);
+}
+
+TEST(WorldHistoryTest, FramesStoreOnlyChangedCandidateBlocksUntilKeyframe)
+{
+    WorldHistory history;
+    history.setConfig({ .memory_budget_bytes = 1 << 20, .keyframe_interval = 3 });
+    WorldData data = makeWorldData(32, 32);
+    history.record(data, {});
+    const size_t baselineBytes = history.getMemoryBytes();
+
+    // Block 0 is a candidate but unchanged; block 5 changed but is not a candidate.
+    std::vector<uint8_t> candidates(16, 0);
+    candidates[0] = 1;
+    advance(data, 9, 9, Material::EnumType::Wall);
+    history.record(data, candidates);
+    history.record(data, candidates);
+    const size_t quietBytes = history.getMemoryBytes() - baselineBytes;
+    EXPECT_LT(quietBytes, 64 * sizeof(Cell));
+
+    // The keyframe scan compares every block and picks up the missed change.
+    history.record(data, candidates);
+    EXPECT_GE(history.getMemoryBytes() - baselineBytes, quietBytes + 64 * sizeof(Cell));
+
+    const auto& restored = history.stepBack(data);
+    ASSERT_EQ(restored.size(), 1u);
+    EXPECT_EQ(restored[0], 5u);
+    EXPECT_TRUE(data.at(9, 9).isAir());
+}
+
+TEST(WorldHistoryTest, RecordingAfterStepBackDropsRedoAndBudgetDropsOldest)
+{
+    WorldHistory history;
+    WorldData data = makeWorldData(16, 16);
+    history.record(data, {});
+    for (int i = 0; i < 4; ++i) {
+        advance(data, i, 0, Material::EnumType::Dirt);
+        history.record(data, allBlocks(history));
+    }
+
+    history.stepBack(data);
+    history.stepBack(data);
+    advance(data, 15, 15, Material::EnumType::Water);
+    history.record(data, allBlocks(history));
+    EXPECT_EQ(history.getFrameCount(), 3u);
+    EXPECT_FALSE(history.canStepForward());
+
+    history.setConfig(
+        { .memory_budget_bytes = history.getMemoryBytes() - 1, .keyframe_interval = 300 });
+    EXPECT_EQ(history.getFrameCount(), 2u);
+    history.stepBack(data);
+    history.stepBack(data);
+    EXPECT_FALSE(history.canStepBack());
+    EXPECT_EQ(data.at(0, 0).material_type, Material::EnumType::Dirt);
+    EXPECT_TRUE(data.at(1, 0).isAir());
+}
+
+TEST(WorldHistoryTest, WorldStepsBackOverAnEditToASleepingBlock)
+{
+    World world(24, 16);
+    world.enableTimeReversal(true);
+    const WorldRegionActivityTracker& tracker = world.getRegionActivityTracker();
+    for (int frame = 0; frame < 120 && tracker.getRegionState(0, 0) != RegionState::Sleeping;
+         ++frame) {
+        world.advanceTime(0.016);
+    }
+    ASSERT_EQ(tracker.getRegionState(0, 0), RegionState::Sleeping);
+
+    // Toggling the walls edits the boundary without waking its blocks.
+    const bool hadWall = world.getData().at(0, 0).isWall();
+    world.setWallsEnabled(!hadWall);
+    ASSERT_NE(world.getData().at(0, 0).isWall(), hadWall);
+    world.advanceTime(0.016);
+
+    world.goBackward();
+    EXPECT_EQ(world.getData().at(0, 0).isWall(), hadWall);
+    EXPECT_EQ(world.getData().at(3, 0).isWall(), hadWall);
+    world.goForward();
+    EXPECT_NE(world.getData().at(0, 0).isWall(), hadWall);
+}
@@ -0,0 +1,76 @@
+#include "core/LightManager.h"
+#include "core/MaterialType.h"
+#include "core/World.h"
+#include "core/WorldData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace DirtSim;
+
+namespace {
+
+constexpr int kWidth = 24;
+constexpr int kHeight = 16;
+constexpr uint32_t kSeed = 1234u;
+constexpr double kDeltaTime = 0.016;
+
+// Stands in for scenario setup: walls, a dirt pile, a water pool, and a light.
+std::unique_ptr<World> makeSetUpWorld()
+{
+    auto world = std::make_unique<World>(kWidth, kHeight);
+    world->setRandomSeed(kSeed);
+    world->enableStateHashing(true);
+    world->enableTimeReversal(true);
+
+    WorldData& data = world->getData();
+    for (int x = 0; x < kWidth; ++x) {
+        data.at(x, kHeight - 1).replaceMaterial(Material::EnumType::Wall, 1.0f);
+    }
+    for (int y = 2; y < 8; ++y) {
+        for (int x = 4; x < 9; ++x) {
+            data.at(x, y).replaceMaterial(Material::EnumType::Dirt, 1.0f);
+        }
+        for (int x = 14; x < 20; ++x) {
+            data.at(x, y).replaceMaterial(Material::EnumType::Water, 1.0f);
+        }
+    }
+    PointLight light;
+    light.position = Vector2f{ 12.0f, 3.0f };
+    light.intensity = 0.8f;
+    world->getLightManager().addLight(light);
+    return world;
+}
+
+void step(World& world, int frames)
+{
+    for (int i = 0; i < frames; ++i) {
+        world.advanceTime(kDeltaTime);
+    }
+}
+
+} // namespace
+
+TEST(WorldSetupSnapshotTest, RestoreThenStepMatchesFreshSetupThenStep)
+{
+    auto fresh = makeSetUpWorld();
+    step(*fresh, 40);
+    const uint64_t freshHash = fresh->getStateHash();
+
+    auto reused = makeSetUpWorld();
+    const auto snapshot = reused->captureSetupSnapshot();
+
+    // Dirty everything the restore must put back.
+    step(*reused, 25);
+    reused->getLightManager().addLight(PointLight{});
+    ASSERT_EQ(reused->getLightManager().count(), 2u);
+
+    reused->restoreSetupSnapshot(*snapshot);
+    EXPECT_EQ(reused->getLightManager().count(), 1u);
+    EXPECT_EQ(reused->getHistorySize(), 1u);
+    EXPECT_FALSE(reused->canGoBackward());
+
+    step(*reused, 40);
+    EXPECT_EQ(reused->getData().timestep, fresh->getData().timestep);
+    EXPECT_EQ(reused->getStateHash(), freshHash);
+}
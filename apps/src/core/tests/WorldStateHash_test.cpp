@@ -0,0 +1,126 @@
+#include "core/WorldData.h"
+#include "core/WorldHashTrace.h"
+#include "core/WorldStateHash.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+using namespace DirtSim;
+
+namespace {
+
+WorldData makeWorldData(int width, int height)
+{
+    WorldData data;
+    data.width = static_cast<int16_t>(width);
+    data.height = static_cast<int16_t>(height);
+    data.cells.resize(static_cast<size_t>(width) * height);
+    return data;
+}
+
+uint64_t fullRoot(const WorldData& data)
+{
+    WorldStateHash hash;
+    hash.rehashAll(data);
+    return hash.getRoot();
+}
+
+} // namespace
+
+TEST(WorldStateHashTest, QuantizationIgnoresNoiseBelowTheStep)
+{
+    WorldData data = makeWorldData(16, 16);
+    data.at(4, 4).replaceMaterial(Material::EnumType::Water, 0.5f);
+    const uint64_t base = fullRoot(data);
+
+    data.at(4, 4).velocity.x += 1e-6f;
+    EXPECT_EQ(fullRoot(data), base);
+
+    data.at(4, 4).velocity.x += 1e-2f;
+    EXPECT_NE(fullRoot(data), base);
+
+    WorldStateHash exact;
+    exact.setConfig({ .quantum = 0.0f, .full_rescan_interval = 300 });
+    exact.rehashAll(data);
+    const uint64_t exactBase = exact.getRoot();
+    data.at(4, 4).velocity.x += 1e-6f;
+    exact.rehashAll(data);
+    EXPECT_NE(exact.getRoot(), exactBase);
+}
+
+TEST(WorldStateHashTest, IncrementalUpdateMatchesFullRehash)
+{
+    WorldData data = makeWorldData(40, 20);
+    WorldStateHash hash;
+    hash.update(data, {});
+    ASSERT_EQ(hash.getBlocksX(), 5);
+    ASSERT_EQ(hash.getBlocksY(), 3);
+
+    std::vector<uint8_t> candidates(15, 0);
+    candidates[0] = 1;
+    candidates[14] = 1;
+    data.at(1, 1).replaceMaterial(Material::EnumType::Dirt, 1.0f);
+    data.at(39, 19).replaceMaterial(Material::EnumType::Sand, 1.0f);
+    hash.update(data, candidates);
+    EXPECT_EQ(hash.getRoot(), fullRoot(data));
+
+    // A change outside the mask is missed until the next full rescan.
+    hash.setConfig({ .quantum = 1e-4f, .full_rescan_interval = 2 });
+    hash.update(data, {});
+    data.at(20, 10).replaceMaterial(Material::EnumType::Wall, 1.0f);
+    hash.update(data, std::vector<uint8_t>(15, 0));
+    EXPECT_NE(hash.getRoot(), fullRoot(data));
+    hash.update(data, std::vector<uint8_t>(15, 0));
+    EXPECT_EQ(hash.getRoot(), fullRoot(data));
+}
+
+TEST(WorldStateHashTest, WaterVolumeChangesMoveTheRoot)
+{
+    const WorldData data = makeWorldData(16, 16);
+    std::vector<float> volume(data.cells.size(), 0.0f);
+    WorldStateHash hash;
+    hash.rehashAll(data, volume);
+    const uint64_t dry = hash.getRoot();
+
+    volume[5 * 16 + 9] = 0.75f;
+    hash.rehashAll(data, volume);
+    EXPECT_NE(hash.getRoot(), dry);
+
+    // A volume field that doesn't match the grid is ignored.
+    hash.rehashAll(data, std::vector<float>(3, 1.0f));
+    EXPECT_EQ(hash.getRoot(), fullRoot(data));
+}
+
+TEST(WorldStateHashTest, TraceReportsFirstDivergingTimestepAndBlock)
+{
+    WorldData expectedData = makeWorldData(24, 16);
+    WorldData actualData = makeWorldData(24, 16);
+    WorldStateHash expectedHash;
+    WorldStateHash actualHash;
+    WorldHashTrace expected;
+    WorldHashTrace actual;
+
+    for (int32_t step = 0; step < 5; ++step) {
+        expectedData.at(step, 0).replaceMaterial(Material::EnumType::Dirt, 1.0f);
+        actualData.at(step, 0).replaceMaterial(Material::EnumType::Dirt, 1.0f);
+        if (step == 3) {
+            actualData.at(17, 9).replaceMaterial(Material::EnumType::Sand, 1.0f);
+        }
+        expectedHash.rehashAll(expectedData);
+        actualHash.rehashAll(actualData);
+        expected.record(step, expectedHash);
+        actual.record(step, actualHash);
+    }
+
+    EXPECT_FALSE(WorldHashTrace::findFirstDivergence(expected, expected).has_value());
+
+    const WorldHashTrace golden = WorldHashTrace::fromJson(expected.toJson());
+    EXPECT_EQ(golden.getFinalRoot(), expected.getFinalRoot());
+
+    const auto divergence = WorldHashTrace::findFirstDivergence(golden, actual);
+    ASSERT_TRUE(divergence.has_value());
+    EXPECT_EQ(divergence->timestep, 3);
+    EXPECT_EQ(divergence->block_x, 2);
+    EXPECT_EQ(divergence->block_y, 1);
+}
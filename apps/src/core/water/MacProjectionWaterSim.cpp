@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include "core/Cell.h"
+#include "core/GridOfCells.h"
 #include "core/PhysicsSettings.h"
 #include "core/World.h"
 #include "core/WorldData.h"
@@ -11,6 +12,9 @@
 namespace DirtSim {
 namespace {
 
+constexpr int kParallelMinCells = 2500;
+constexpr int kTileSize = MacProjectionWaterSim::TILE_SIZE;
+
 size_t cellIndex(int width, int x, int y)
 {
     return static_cast<size_t>(y) * width + x;
@@ -26,6 +30,39 @@ size_t vFaceIndex(int width, int x, int y)
     return static_cast<size_t>(y) * width + x;
 }
 
+struct TileBounds {
+    int x0 = 0;
+    int x1 = 0;
+    int y0 = 0;
+    int y1 = 0;
+    // Each tile owns the u face left of and the v face above each of its cells; the last tile
+    // in a row or column also owns the far boundary faces.
+    int uX1 = 0;
+    int vY1 = 0;
+};
+
+TileBounds tileBounds(int tile, int tilesX, int width, int height)
+{
+    TileBounds bounds;
+    bounds.x0 = (tile % tilesX) * kTileSize;
+    bounds.y0 = (tile / tilesX) * kTileSize;
+    bounds.x1 = std::min(bounds.x0 + kTileSize, width);
+    bounds.y1 = std::min(bounds.y0 + kTileSize, height);
+    bounds.uX1 = bounds.x1 == width ? width + 1 : bounds.x1;
+    bounds.vY1 = bounds.y1 == height ? height + 1 : bounds.y1;
+    return bounds;
+}
+
+template <typename Fn>
+void forEachTile(const std::vector<int>& tiles, bool parallel, const Fn& fn)
+{
+    const int count = static_cast<int>(tiles.size());
+#pragma omp parallel for schedule(static) if (parallel)
+    for (int i = 0; i < count; ++i) {
+        fn(tiles[i]);
+    }
+}
+
 } // namespace
 
 void MacProjectionWaterSim::reset()
@@ -42,6 +79,9 @@ void MacProjectionWaterSim::reset()
     std::fill(projectionMask_.begin(), projectionMask_.end(), 0);
     std::fill(projectionMaskScratch_.begin(), projectionMaskScratch_.end(), 0);
     std::fill(solidMask_.begin(), solidMask_.end(), 0);
+    std::fill(tileAwake_.begin(), tileAwake_.end(), 1);
+    std::fill(tileQuietSteps_.begin(), tileQuietSteps_.end(), 0);
+    std::fill(settledVolume_.begin(), settledVolume_.end(), 0.0f);
 }
 
 void MacProjectionWaterSim::resize(int worldWidth, int worldHeight)
@@ -65,6 +105,17 @@ void MacProjectionWaterSim::resize(int worldWidth, int worldHeight)
     projectionMask_.assign(cellCount, 0);
     projectionMaskScratch_.assign(cellCount, 0);
     solidMask_.assign(cellCount, 0);
+
+    tilesX_ = std::max(0, (width_ + kTileSize - 1) / kTileSize);
+    tilesY_ = std::max(0, (height_ + kTileSize - 1) / kTileSize);
+    const size_t tileCount = static_cast<size_t>(tilesX_) * tilesY_;
+    tileAwake_.assign(tileCount, 1);
+    tileQuietSteps_.assign(tileCount, 0);
+    tileSimulated_.assign(tileCount, 0);
+    tileTouched_.assign(tileCount, 0);
+    simulatedTiles_.clear();
+    touchedTiles_.clear();
+    settledVolume_.assign(cellCount, 0.0f);
 }
 
 bool MacProjectionWaterSim::tryGetWaterVolumeView(WaterVolumeView& out) const
@@ -100,252 +151,171 @@ void MacProjectionWaterSim::syncToSettings(const PhysicsSettings& settings)
         std::max(0.0f, static_cast<float>(settings.mac_water_velocity_sleep_epsilon));
 }
 
-void MacProjectionWaterSim::advanceTime(World& world, double deltaTimeSeconds)
+void MacProjectionWaterSim::wakeTile(int tile)
 {
-    if (width_ <= 0 || height_ <= 0) {
-        return;
-    }
-    if (deltaTimeSeconds <= 0.0) {
-        return;
-    }
-
-    const float dt = static_cast<float>(deltaTimeSeconds);
-    const WorldData& data = world.getData();
-
-    const float gravity = static_cast<float>(world.getPhysicsSettings().gravity);
-    const Parameters& parameters = parameters_;
+    tileAwake_[tile] = 1;
+    tileQuietSteps_[tile] = 0;
+}
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            const Cell& cell = data.at(x, y);
-            const bool solid = !cell.isEmpty() && cell.material_type != Material::EnumType::Air;
-            solidMask_[idx] = solid ? 1 : 0;
-        }
-    }
+void MacProjectionWaterSim::wakeTileAtCell(int x, int y)
+{
+    wakeTile((y / kTileSize) * tilesX_ + x / kTileSize);
+}
 
-    float totalWaterVolume = 0.0f;
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            if (solidMask_[idx] == 0) {
-                totalWaterVolume += waterVolume_[idx];
-                continue;
-            }
+void MacProjectionWaterSim::rebuildTileSets()
+{
+    std::fill(tileSimulated_.begin(), tileSimulated_.end(), 0);
+    std::fill(tileTouched_.begin(), tileTouched_.end(), 0);
 
-            float remaining = waterVolume_[idx];
-            if (remaining <= 0.0f) {
+    for (int ty = 0; ty < tilesY_; ++ty) {
+        for (int tx = 0; tx < tilesX_; ++tx) {
+            if (tileAwake_[ty * tilesX_ + tx] == 0) {
                 continue;
             }
 
-            waterVolume_[idx] = 0.0f;
-
-            const auto tryDisplace = [&](int nx, int ny) {
-                if (remaining <= 0.0f) {
-                    return;
-                }
-                if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) {
-                    return;
-                }
-
-                const size_t nIdx = cellIndex(width_, nx, ny);
-                if (solidMask_[nIdx] != 0) {
-                    return;
-                }
-
-                const float capacity = std::max(0.0f, 1.0f - waterVolume_[nIdx]);
-                if (capacity <= 0.0f) {
-                    return;
-                }
-
-                const float transfer = std::min(capacity, remaining);
-                waterVolume_[nIdx] += transfer;
-                remaining -= transfer;
-            };
-
-            tryDisplace(x - 1, y);
-            tryDisplace(x + 1, y);
-            tryDisplace(x, y - 1);
-            tryDisplace(x, y + 1);
-
-            for (int radius = 2; radius <= parameters.displacementMaxRadius && remaining > 0.0f;
-                 ++radius) {
-                const int xMin = x - radius;
-                const int xMax = x + radius;
-                const int yMin = y - radius;
-                const int yMax = y + radius;
-
-                for (int nx = xMin; nx <= xMax; ++nx) {
-                    tryDisplace(nx, yMin);
-                    tryDisplace(nx, yMax);
-                }
-
-                for (int ny = yMin + 1; ny <= yMax - 1; ++ny) {
-                    tryDisplace(xMin, ny);
-                    tryDisplace(xMax, ny);
+            for (int ny = std::max(0, ty - 2); ny <= std::min(tilesY_ - 1, ty + 2); ++ny) {
+                for (int nx = std::max(0, tx - 2); nx <= std::min(tilesX_ - 1, tx + 2); ++nx) {
+                    const int neighbor = ny * tilesX_ + nx;
+                    tileTouched_[neighbor] = 1;
+                    if (std::abs(nx - tx) <= 1 && std::abs(ny - ty) <= 1) {
+                        tileSimulated_[neighbor] = 1;
+                    }
                 }
             }
         }
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            fluidMask_[idx] =
-                (solidMask_[idx] == 0 && waterVolume_[idx] > parameters.fluidMaskVolumeEpsilon) ? 1
-                                                                                                : 0;
+    simulatedTiles_.clear();
+    touchedTiles_.clear();
+    for (int tile = 0; tile < tilesX_ * tilesY_; ++tile) {
+        if (tileSimulated_[tile] != 0) {
+            simulatedTiles_.push_back(tile);
+        }
+        if (tileTouched_[tile] != 0) {
+            touchedTiles_.push_back(tile);
         }
     }
+}
 
-    for (int x = 0; x < width_; ++x) {
-        float depthToBottom = 0.0f;
-        for (int y = 0; y < height_; ++y) {
-            const size_t idx = cellIndex(width_, x, y);
-            if (solidMask_[idx] != 0 || fluidMask_[idx] == 0) {
-                depthToBottom = 0.0f;
-                hydroPressure_[idx] = 0.0f;
-                continue;
+void MacProjectionWaterSim::updateTileSleep()
+{
+    const int sleepSteps = parameters_.tileSleepSteps;
+    const bool parallel = GridOfCells::USE_OPENMP
+        && static_cast<int>(touchedTiles_.size()) * kTileSize * kTileSize >= kParallelMinCells;
+
+    forEachTile(touchedTiles_, parallel, [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        bool volumeMoved = false;
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                const float change = std::abs(waterVolume_[idx] - settledVolume_[idx]);
+                volumeMoved = volumeMoved || change > parameters_.tileSleepVolumeEpsilon;
+                settledVolume_[idx] = waterVolume_[idx];
             }
-
-            const float cellVolume = waterVolume_[idx];
-            depthToBottom += cellVolume;
-            hydroPressure_[idx] = gravity * depthToBottom;
         }
-    }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            if (solidMask_[idx] != 0) {
-                projectionMask_[idx] = 0;
-                continue;
+        // Tiles in the outer ring only see volume spill over from their simulated neighbors.
+        if (tileSimulated_[tile] == 0) {
+            if (volumeMoved) {
+                wakeTile(tile);
             }
+            return;
+        }
 
-            projectionMask_[idx] = fluidMask_[idx] != 0 ? 1 : 0;
+        if (volumeMoved) {
+            tileQuietSteps_[tile] = 0;
         }
-    }
+        else {
+            tileQuietSteps_[tile] = std::min(tileQuietSteps_[tile] + 1, std::max(0, sleepSteps));
+        }
+        tileAwake_[tile] = (sleepSteps <= 0 || tileQuietSteps_[tile] < sleepSteps) ? 1 : 0;
+    });
+}
 
-    if (totalWaterVolume <= 0.0f) {
-        std::fill(uFaceVelocity_.begin(), uFaceVelocity_.end(), 0.0f);
-        std::fill(vFaceVelocity_.begin(), vFaceVelocity_.end(), 0.0f);
+void MacProjectionWaterSim::advanceTime(World& world, double deltaTimeSeconds)
+{
+    if (width_ <= 0 || height_ <= 0) {
         return;
     }
-
-    for (int y = 0; y <= height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            if (y == 0 || y == height_) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
-
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
-
-            if (fluidMask_[topIdx] == 0 && fluidMask_[bottomIdx] == 0) {
-                continue;
-            }
-
-            vFaceVelocity_[faceIdx] += gravity * dt;
-        }
+    if (deltaTimeSeconds <= 0.0) {
+        return;
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 1; x < width_; ++x) {
-            const size_t faceIdx = uFaceIndex(width_, x, y);
-            const size_t leftIdx = cellIndex(width_, x - 1, y);
-            const size_t rightIdx = cellIndex(width_, x, y);
-            if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
-                continue;
-            }
+    const float dt = static_cast<float>(deltaTimeSeconds);
+    const WorldData& data = world.getData();
 
-            uFaceVelocity_[faceIdx] -= dt * (hydroPressure_[rightIdx] - hydroPressure_[leftIdx]);
-        }
-    }
+    const float gravity = static_cast<float>(world.getPhysicsSettings().gravity);
+    const Parameters& parameters = parameters_;
 
-    for (int y = 1; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                continue;
-            }
+    const int tileCount = tilesX_ * tilesY_;
+    const bool parallelGrid = GridOfCells::USE_OPENMP && width_ * height_ >= kParallelMinCells;
 
-            vFaceVelocity_[faceIdx] -= dt * (hydroPressure_[bottomIdx] - hydroPressure_[topIdx]);
-        }
+    // Hydrostatic pressure scales with gravity everywhere, so a change invalidates every tile.
+    if (gravity != lastGravity_) {
+        lastGravity_ = gravity;
+        std::fill(tileAwake_.begin(), tileAwake_.end(), 1);
+        std::fill(tileQuietSteps_.begin(), tileQuietSteps_.end(), 0);
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x <= width_; ++x) {
-            const size_t faceIdx = uFaceIndex(width_, x, y);
-            if (x == 0 || x == width_) {
-                uFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
-
-            const size_t leftIdx = cellIndex(width_, x - 1, y);
-            const size_t rightIdx = cellIndex(width_, x, y);
-            if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
-                uFaceVelocity_[faceIdx] = 0.0f;
+    // The solid mask is refreshed everywhere since the world can change under a sleeping tile.
+    // The same pass wakes tiles whose volume was edited through the mutable view.
+#pragma omp parallel for schedule(static) if (parallelGrid)
+    for (int tile = 0; tile < tileCount; ++tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        bool changed = false;
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                const Cell& cell = data.at(x, y);
+                const bool solid = !cell.isEmpty() && cell.material_type != Material::EnumType::Air;
+                const uint8_t solidValue = solid ? 1 : 0;
+                if (solidMask_[idx] != solidValue) {
+                    solidMask_[idx] = solidValue;
+                    changed = true;
+                }
+                if (waterVolume_[idx] != settledVolume_[idx]) {
+                    settledVolume_[idx] = waterVolume_[idx];
+                    changed = true;
+                }
             }
         }
-    }
-
-    for (int y = 0; y <= height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            if (y == 0 || y == height_) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
 
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-            }
+        if (changed) {
+            wakeTile(tile);
         }
     }
 
-    const float invDt = 1.0f / dt;
+    rebuildTileSets();
+
+    // Only simulated tiles can hold water under a solid, because a solid or volume change
+    // wakes its tile. Row-major order keeps displacement identical to a full-grid sweep.
+    bool displaced = false;
     for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            if (projectionMask_[idx] == 0) {
-                divergence_[idx] = 0.0f;
+        const int ty = y / kTileSize;
+        for (int tx = 0; tx < tilesX_; ++tx) {
+            if (tileSimulated_[ty * tilesX_ + tx] == 0) {
                 continue;
             }
 
-            const float uRight = uFaceVelocity_[uFaceIndex(width_, x + 1, y)];
-            const float uLeft = uFaceVelocity_[uFaceIndex(width_, x, y)];
-            const float vDown = vFaceVelocity_[vFaceIndex(width_, x, y + 1)];
-            const float vUp = vFaceVelocity_[vFaceIndex(width_, x, y)];
-
-            divergence_[idx] = (uRight - uLeft + vDown - vUp) * invDt;
-        }
-    }
-
-    std::fill(pressure_.begin(), pressure_.end(), 0.0f);
-    std::fill(pressureScratch_.begin(), pressureScratch_.end(), 0.0f);
-
-    for (int iter = 0; iter < parameters.pressureIterations; ++iter) {
-        for (int y = 0; y < height_; ++y) {
-            for (int x = 0; x < width_; ++x) {
+            const int xEnd = std::min((tx + 1) * kTileSize, width_);
+            for (int x = tx * kTileSize; x < xEnd; ++x) {
                 const size_t idx = cellIndex(width_, x, y);
-                if (projectionMask_[idx] == 0) {
-                    pressureScratch_[idx] = 0.0f;
+                if (solidMask_[idx] == 0) {
+                    continue;
+                }
+
+                float remaining = waterVolume_[idx];
+                if (remaining <= 0.0f) {
                     continue;
                 }
 
-                float sum = 0.0f;
-                float denom = 0.0f;
+                waterVolume_[idx] = 0.0f;
 
-                const auto visitNeighbor = [&](int nx, int ny) {
+                const auto tryDisplace = [&](int nx, int ny) {
+                    if (remaining <= 0.0f) {
+                        return;
+                    }
                     if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) {
                         return;
                     }
@@ -355,259 +325,448 @@ void MacProjectionWaterSim::advanceTime(World& world, double deltaTimeSeconds)
                         return;
                     }
 
-                    denom += 1.0f;
-                    if (projectionMask_[nIdx] != 0) {
-                        sum += pressure_[nIdx];
+                    const float capacity = std::max(0.0f, 1.0f - waterVolume_[nIdx]);
+                    if (capacity <= 0.0f) {
+                        return;
                     }
+
+                    const float transfer = std::min(capacity, remaining);
+                    waterVolume_[nIdx] += transfer;
+                    remaining -= transfer;
+                    wakeTileAtCell(nx, ny);
+                    displaced = true;
                 };
 
-                visitNeighbor(x - 1, y);
-                visitNeighbor(x + 1, y);
-                visitNeighbor(x, y - 1);
-                visitNeighbor(x, y + 1);
+                tryDisplace(x - 1, y);
+                tryDisplace(x + 1, y);
+                tryDisplace(x, y - 1);
+                tryDisplace(x, y + 1);
+
+                for (int radius = 2;
+                     radius <= parameters.displacementMaxRadius && remaining > 0.0f;
+                     ++radius) {
+                    const int xMin = x - radius;
+                    const int xMax = x + radius;
+                    const int yMin = y - radius;
+                    const int yMax = y + radius;
+
+                    for (int nx = xMin; nx <= xMax; ++nx) {
+                        tryDisplace(nx, yMin);
+                        tryDisplace(nx, yMax);
+                    }
 
-                if (denom <= 0.0f) {
-                    pressureScratch_[idx] = 0.0f;
-                    continue;
+                    for (int ny = yMin + 1; ny <= yMax - 1; ++ny) {
+                        tryDisplace(xMin, ny);
+                        tryDisplace(xMax, ny);
+                    }
                 }
-
-                pressureScratch_[idx] = (sum - divergence_[idx]) / denom;
             }
         }
+    }
 
-        std::swap(pressure_, pressureScratch_);
+    if (displaced) {
+        rebuildTileSets();
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x <= width_; ++x) {
-            const size_t faceIdx = uFaceIndex(width_, x, y);
-            if (x == 0 || x == width_) {
-                uFaceVelocity_[faceIdx] = 0.0f;
-                continue;
+    // Masks of tiles outside the simulated set are still valid: nothing under them changed.
+    const auto parallelFor = [](const std::vector<int>& tiles) {
+        return GridOfCells::USE_OPENMP
+            && static_cast<int>(tiles.size()) * kTileSize * kTileSize >= kParallelMinCells;
+    };
+    forEachTile(simulatedTiles_, parallelFor(simulatedTiles_), [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                fluidMask_[idx] =
+                    (solidMask_[idx] == 0 && waterVolume_[idx] > parameters.fluidMaskVolumeEpsilon)
+                    ? 1
+                    : 0;
+                projectionMask_[idx] = fluidMask_[idx];
             }
+        }
+    });
+
+    // Hydrostatic pressure integrates whole columns, so it is recomputed for every tile column
+    // holding a simulated tile. A sleeping tile is woken once the water above it has shifted
+    // by more than a quiet tile may drift.
+    const float hydroWakeThreshold = std::abs(gravity) * parameters.tileSleepVolumeEpsilon;
+#pragma omp parallel for schedule(static) if (parallelGrid)
+    for (int tx = 0; tx < tilesX_; ++tx) {
+        bool columnSimulated = false;
+        for (int ty = 0; ty < tilesY_ && !columnSimulated; ++ty) {
+            columnSimulated = tileSimulated_[ty * tilesX_ + tx] != 0;
+        }
+        if (!columnSimulated) {
+            continue;
+        }
 
-            const size_t leftIdx = cellIndex(width_, x - 1, y);
-            const size_t rightIdx = cellIndex(width_, x, y);
-            if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
-                uFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
+        const int xEnd = std::min((tx + 1) * kTileSize, width_);
+        for (int x = tx * kTileSize; x < xEnd; ++x) {
+            float depthToBottom = 0.0f;
+            for (int y = 0; y < height_; ++y) {
+                const size_t idx = cellIndex(width_, x, y);
+                float hydroPressure = 0.0f;
+                if (solidMask_[idx] != 0 || fluidMask_[idx] == 0) {
+                    depthToBottom = 0.0f;
+                }
+                else {
+                    depthToBottom += waterVolume_[idx];
+                    hydroPressure = gravity * depthToBottom;
+                }
 
-            if (projectionMask_[leftIdx] == 0 && projectionMask_[rightIdx] == 0) {
-                uFaceVelocity_[faceIdx] = 0.0f;
-                continue;
+                const float change = std::abs(hydroPressure - hydroPressure_[idx]);
+                hydroPressure_[idx] = hydroPressure;
+                const int tile = (y / kTileSize) * tilesX_ + tx;
+                if (change > hydroWakeThreshold && tileSimulated_[tile] == 0) {
+                    wakeTile(tile);
+                }
             }
-
-            const float pL = projectionMask_[leftIdx] != 0 ? pressure_[leftIdx] : 0.0f;
-            const float pR = projectionMask_[rightIdx] != 0 ? pressure_[rightIdx] : 0.0f;
-            uFaceVelocity_[faceIdx] -= dt * parameters.pressureGradientVelocityScale * (pR - pL);
         }
     }
 
-    for (int y = 0; y <= height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            if (y == 0 || y == height_) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
+    rebuildTileSets();
 
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
-            }
+    const bool parallelTiles = parallelFor(simulatedTiles_);
 
-            if (projectionMask_[topIdx] == 0 && projectionMask_[bottomIdx] == 0) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
+    bool hasWater = false;
+    for (const int tile : simulatedTiles_) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1 && !hasWater; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                if (solidMask_[idx] == 0 && waterVolume_[idx] > 0.0f) {
+                    hasWater = true;
+                    break;
+                }
             }
-
-            const float pT = projectionMask_[topIdx] != 0 ? pressure_[topIdx] : 0.0f;
-            const float pB = projectionMask_[bottomIdx] != 0 ? pressure_[bottomIdx] : 0.0f;
-            vFaceVelocity_[faceIdx] -= dt * parameters.pressureGradientVelocityScale * (pB - pT);
+        }
+        if (hasWater) {
+            break;
         }
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x <= width_; ++x) {
-            const size_t faceIdx = uFaceIndex(width_, x, y);
-            if (x == 0 || x == width_) {
-                uFaceVelocity_[faceIdx] = 0.0f;
-                continue;
+    if (!hasWater) {
+        forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+            const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+            for (int y = bounds.y0; y < bounds.y1; ++y) {
+                for (int x = bounds.x0; x < bounds.uX1; ++x) {
+                    uFaceVelocity_[uFaceIndex(width_, x, y)] = 0.0f;
+                }
             }
+            for (int y = bounds.y0; y < bounds.vY1; ++y) {
+                for (int x = bounds.x0; x < bounds.x1; ++x) {
+                    vFaceVelocity_[vFaceIndex(width_, x, y)] = 0.0f;
+                }
+            }
+        });
+        updateTileSleep();
+        return;
+    }
+
+    // Body forces. Every face is owned by exactly one tile and only reads cell state, so
+    // tiles update their faces independently.
+    forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+
+        for (int y = bounds.y0; y < bounds.vY1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t faceIdx = vFaceIndex(width_, x, y);
+                if (y == 0 || y == height_) {
+                    vFaceVelocity_[faceIdx] = 0.0f;
+                    continue;
+                }
 
-            const size_t leftIdx = cellIndex(width_, x - 1, y);
-            const size_t rightIdx = cellIndex(width_, x, y);
-            if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
-                uFaceVelocity_[faceIdx] = 0.0f;
+                const size_t topIdx = cellIndex(width_, x, y - 1);
+                const size_t bottomIdx = cellIndex(width_, x, y);
+                if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
+                    vFaceVelocity_[faceIdx] = 0.0f;
+                    continue;
+                }
+
+                if (fluidMask_[topIdx] != 0 || fluidMask_[bottomIdx] != 0) {
+                    vFaceVelocity_[faceIdx] += gravity * dt;
+                }
+
+                vFaceVelocity_[faceIdx] -=
+                    dt * (hydroPressure_[bottomIdx] - hydroPressure_[topIdx]);
             }
         }
-    }
 
-    for (int y = 0; y <= height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            if (y == 0 || y == height_) {
-                vFaceVelocity_[faceIdx] = 0.0f;
-                continue;
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.uX1; ++x) {
+                const size_t faceIdx = uFaceIndex(width_, x, y);
+                if (x == 0 || x == width_) {
+                    uFaceVelocity_[faceIdx] = 0.0f;
+                    continue;
+                }
+
+                const size_t leftIdx = cellIndex(width_, x - 1, y);
+                const size_t rightIdx = cellIndex(width_, x, y);
+                if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
+                    uFaceVelocity_[faceIdx] = 0.0f;
+                    continue;
+                }
+
+                uFaceVelocity_[faceIdx] -=
+                    dt * (hydroPressure_[rightIdx] - hydroPressure_[leftIdx]);
             }
+        }
+    });
+
+    const float invDt = 1.0f / dt;
+    forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                if (projectionMask_[idx] == 0) {
+                    divergence_[idx] = 0.0f;
+                    continue;
+                }
 
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                vFaceVelocity_[faceIdx] = 0.0f;
+                const float uRight = uFaceVelocity_[uFaceIndex(width_, x + 1, y)];
+                const float uLeft = uFaceVelocity_[uFaceIndex(width_, x, y)];
+                const float vDown = vFaceVelocity_[vFaceIndex(width_, x, y + 1)];
+                const float vUp = vFaceVelocity_[vFaceIndex(width_, x, y)];
+
+                divergence_[idx] = (uRight - uLeft + vDown - vUp) * invDt;
             }
         }
+    });
+
+    // Pressure is zero outside the simulated tiles between steps (see the end of this
+    // function), which is what a sleeping neighbor contributes to the Jacobi stencil.
+    for (int iter = 0; iter < parameters.pressureIterations; ++iter) {
+        forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+            const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+            for (int y = bounds.y0; y < bounds.y1; ++y) {
+                for (int x = bounds.x0; x < bounds.x1; ++x) {
+                    const size_t idx = cellIndex(width_, x, y);
+                    if (projectionMask_[idx] == 0) {
+                        pressureScratch_[idx] = 0.0f;
+                        continue;
+                    }
+
+                    float sum = 0.0f;
+                    float denom = 0.0f;
+
+                    const auto visitNeighbor = [&](int nx, int ny) {
+                        if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) {
+                            return;
+                        }
+
+                        const size_t nIdx = cellIndex(width_, nx, ny);
+                        if (solidMask_[nIdx] != 0) {
+                            return;
+                        }
+
+                        denom += 1.0f;
+                        if (projectionMask_[nIdx] != 0) {
+                            sum += pressure_[nIdx];
+                        }
+                    };
+
+                    visitNeighbor(x - 1, y);
+                    visitNeighbor(x + 1, y);
+                    visitNeighbor(x, y - 1);
+                    visitNeighbor(x, y + 1);
+
+                    if (denom <= 0.0f) {
+                        pressureScratch_[idx] = 0.0f;
+                        continue;
+                    }
+
+                    pressureScratch_[idx] = (sum - divergence_[idx]) / denom;
+                }
+            }
+        });
+
+        std::swap(pressure_, pressureScratch_);
     }
 
     const float dampingFactor =
         std::clamp(1.0f - parameters.velocityDampingPerSecond * dt, 0.0f, 1.0f);
     const float maxFaceSpeed = parameters.velocityCflLimit / dt;
-
-    for (float& u : uFaceVelocity_) {
-        if (!std::isfinite(u)) {
-            u = 0.0f;
-            continue;
+    const auto settleFace = [&](float& velocity) {
+        if (!std::isfinite(velocity)) {
+            velocity = 0.0f;
+            return;
         }
 
-        u *= dampingFactor;
-        u = std::clamp(u, -maxFaceSpeed, maxFaceSpeed);
-        if (std::abs(u) < parameters.velocitySleepEpsilon) {
-            u = 0.0f;
+        velocity *= dampingFactor;
+        velocity = std::clamp(velocity, -maxFaceSpeed, maxFaceSpeed);
+        if (std::abs(velocity) < parameters.velocitySleepEpsilon) {
+            velocity = 0.0f;
         }
-    }
-
-    for (float& v : vFaceVelocity_) {
-        if (!std::isfinite(v)) {
-            v = 0.0f;
-            continue;
+    };
+
+    // Pressure gradient, then damping and the CFL clamp, face by face.
+    forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.uX1; ++x) {
+                float& u = uFaceVelocity_[uFaceIndex(width_, x, y)];
+                const size_t leftIdx = cellIndex(width_, std::max(0, x - 1), y);
+                const size_t rightIdx = cellIndex(width_, std::min(width_ - 1, x), y);
+                if (x == 0 || x == width_ || solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0
+                    || (projectionMask_[leftIdx] == 0 && projectionMask_[rightIdx] == 0)) {
+                    u = 0.0f;
+                }
+                else {
+                    const float pL = projectionMask_[leftIdx] != 0 ? pressure_[leftIdx] : 0.0f;
+                    const float pR = projectionMask_[rightIdx] != 0 ? pressure_[rightIdx] : 0.0f;
+                    u -= dt * parameters.pressureGradientVelocityScale * (pR - pL);
+                }
+                settleFace(u);
+            }
         }
 
-        v *= dampingFactor;
-        v = std::clamp(v, -maxFaceSpeed, maxFaceSpeed);
-        if (std::abs(v) < parameters.velocitySleepEpsilon) {
-            v = 0.0f;
+        for (int y = bounds.y0; y < bounds.vY1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                float& v = vFaceVelocity_[vFaceIndex(width_, x, y)];
+                const size_t topIdx = cellIndex(width_, x, std::max(0, y - 1));
+                const size_t bottomIdx = cellIndex(width_, x, std::min(height_ - 1, y));
+                if (y == 0 || y == height_ || solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0
+                    || (projectionMask_[topIdx] == 0 && projectionMask_[bottomIdx] == 0)) {
+                    v = 0.0f;
+                }
+                else {
+                    const float pT = projectionMask_[topIdx] != 0 ? pressure_[topIdx] : 0.0f;
+                    const float pB = projectionMask_[bottomIdx] != 0 ? pressure_[bottomIdx] : 0.0f;
+                    v -= dt * parameters.pressureGradientVelocityScale * (pB - pT);
+                }
+                settleFace(v);
+            }
         }
-    }
+    });
+
+    forEachTile(simulatedTiles_, parallelTiles, [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            const size_t rowBegin = cellIndex(width_, bounds.x0, y);
+            const size_t rowEnd = cellIndex(width_, bounds.x1, y);
+            std::fill(pressure_.begin() + rowBegin, pressure_.begin() + rowEnd, 0.0f);
+            std::fill(pressureScratch_.begin() + rowBegin, pressureScratch_.begin() + rowEnd, 0.0f);
+        }
+    });
 
     // Advect from the pre-step volume field into a separate output field.
     // The prior in-place update plus 8x horizontal scaling was turning coherent
     // pools into a low-density haze across the basin.
-    volumeScratch_ = waterVolume_;
-
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 1; x < width_; ++x) {
-            const size_t leftIdx = cellIndex(width_, x - 1, y);
-            const size_t rightIdx = cellIndex(width_, x, y);
-            if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
-                continue;
-            }
-
-            const size_t faceIdx = uFaceIndex(width_, x, y);
-            const float u = uFaceVelocity_[faceIdx];
-            if (u == 0.0f) {
-                continue;
-            }
-
-            const float cfl =
-                std::clamp(u * dt, -parameters.advectionCflLimit, parameters.advectionCflLimit);
-            if (cfl == 0.0f) {
-                continue;
-            }
+    forEachTile(touchedTiles_, parallelFor(touchedTiles_), [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            const size_t rowBegin = cellIndex(width_, bounds.x0, y);
+            const size_t rowEnd = cellIndex(width_, bounds.x1, y);
+            std::copy(
+                waterVolume_.begin() + rowBegin,
+                waterVolume_.begin() + rowEnd,
+                volumeScratch_.begin() + rowBegin);
+        }
+    });
 
-            const bool flowRight = u > 0.0f;
-            const size_t donorIdx = flowRight ? leftIdx : rightIdx;
-            const size_t receiverIdx = flowRight ? rightIdx : leftIdx;
+    const auto advectAcrossFace = [&](float velocity, size_t fromIdx, size_t toIdx) {
+        if (velocity == 0.0f) {
+            return;
+        }
 
-            const float donorSourceVol = waterVolume_[donorIdx];
-            if (donorSourceVol <= parameters.advectionVolumeEpsilon) {
-                continue;
-            }
+        const float cfl =
+            std::clamp(velocity * dt, -parameters.advectionCflLimit, parameters.advectionCflLimit);
+        if (cfl == 0.0f) {
+            return;
+        }
 
-            const float donorAvailable = volumeScratch_[donorIdx];
-            if (donorAvailable <= parameters.advectionVolumeEpsilon) {
-                continue;
-            }
+        const bool forward = velocity > 0.0f;
+        const size_t donorIdx = forward ? fromIdx : toIdx;
+        const size_t receiverIdx = forward ? toIdx : fromIdx;
 
-            const float receiverCapacity = std::max(0.0f, 1.0f - volumeScratch_[receiverIdx]);
-            if (receiverCapacity <= 0.0f) {
-                continue;
-            }
+        const float donorSourceVol = waterVolume_[donorIdx];
+        if (donorSourceVol <= parameters.advectionVolumeEpsilon) {
+            return;
+        }
 
-            const float desired = std::abs(cfl) * donorSourceVol;
-            const float transfer = std::min(std::min(desired, donorAvailable), receiverCapacity);
-            if (transfer <= 0.0f) {
-                continue;
-            }
+        const float donorAvailable = volumeScratch_[donorIdx];
+        if (donorAvailable <= parameters.advectionVolumeEpsilon) {
+            return;
+        }
 
-            volumeScratch_[donorIdx] -= transfer;
-            volumeScratch_[receiverIdx] += transfer;
+        const float receiverCapacity = std::max(0.0f, 1.0f - volumeScratch_[receiverIdx]);
+        if (receiverCapacity <= 0.0f) {
+            return;
         }
-    }
 
-    for (int y = 1; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t topIdx = cellIndex(width_, x, y - 1);
-            const size_t bottomIdx = cellIndex(width_, x, y);
-            if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
-                continue;
-            }
+        const float desired = std::abs(cfl) * donorSourceVol;
+        const float transfer = std::min(std::min(desired, donorAvailable), receiverCapacity);
+        if (transfer <= 0.0f) {
+            return;
+        }
 
-            const size_t faceIdx = vFaceIndex(width_, x, y);
-            const float v = vFaceVelocity_[faceIdx];
-            if (v == 0.0f) {
-                continue;
-            }
+        volumeScratch_[donorIdx] -= transfer;
+        volumeScratch_[receiverIdx] += transfer;
+    };
 
-            const float cfl =
-                std::clamp(v * dt, -parameters.advectionCflLimit, parameters.advectionCflLimit);
-            if (cfl == 0.0f) {
+    // Horizontal transfers only couple cells within a row and vertical ones within a column,
+    // so rows (then columns) run in parallel while each keeps the sequential sweep order.
+#pragma omp parallel for schedule(static) if (parallelTiles)
+    for (int y = 0; y < height_; ++y) {
+        const int ty = y / kTileSize;
+        for (int tx = 0; tx < tilesX_; ++tx) {
+            if (tileSimulated_[ty * tilesX_ + tx] == 0) {
                 continue;
             }
 
-            const bool flowDown = v > 0.0f;
-            const size_t donorIdx = flowDown ? topIdx : bottomIdx;
-            const size_t receiverIdx = flowDown ? bottomIdx : topIdx;
+            const int xEnd = std::min((tx + 1) * kTileSize, width_);
+            for (int x = std::max(1, tx * kTileSize); x < xEnd; ++x) {
+                const size_t leftIdx = cellIndex(width_, x - 1, y);
+                const size_t rightIdx = cellIndex(width_, x, y);
+                if (solidMask_[leftIdx] != 0 || solidMask_[rightIdx] != 0) {
+                    continue;
+                }
 
-            const float donorSourceVol = waterVolume_[donorIdx];
-            if (donorSourceVol <= parameters.advectionVolumeEpsilon) {
-                continue;
+                advectAcrossFace(uFaceVelocity_[uFaceIndex(width_, x, y)], leftIdx, rightIdx);
             }
+        }
+    }
 
-            const float donorAvailable = volumeScratch_[donorIdx];
-            if (donorAvailable <= parameters.advectionVolumeEpsilon) {
+#pragma omp parallel for schedule(static) if (parallelTiles)
+    for (int x = 0; x < width_; ++x) {
+        const int tx = x / kTileSize;
+        for (int ty = 0; ty < tilesY_; ++ty) {
+            if (tileSimulated_[ty * tilesX_ + tx] == 0) {
                 continue;
             }
 
-            const float receiverCapacity = std::max(0.0f, 1.0f - volumeScratch_[receiverIdx]);
-            if (receiverCapacity <= 0.0f) {
-                continue;
-            }
+            const int yEnd = std::min((ty + 1) * kTileSize, height_);
+            for (int y = std::max(1, ty * kTileSize); y < yEnd; ++y) {
+                const size_t topIdx = cellIndex(width_, x, y - 1);
+                const size_t bottomIdx = cellIndex(width_, x, y);
+                if (solidMask_[topIdx] != 0 || solidMask_[bottomIdx] != 0) {
+                    continue;
+                }
 
-            const float desired = std::abs(cfl) * donorSourceVol;
-            const float transfer = std::min(std::min(desired, donorAvailable), receiverCapacity);
-            if (transfer <= 0.0f) {
-                continue;
+                advectAcrossFace(vFaceVelocity_[vFaceIndex(width_, x, y)], topIdx, bottomIdx);
             }
-
-            volumeScratch_[donorIdx] -= transfer;
-            volumeScratch_[receiverIdx] += transfer;
         }
     }
 
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            const size_t idx = cellIndex(width_, x, y);
-            if (solidMask_[idx] != 0) {
-                waterVolume_[idx] = 0.0f;
-                continue;
-            }
+    forEachTile(touchedTiles_, parallelFor(touchedTiles_), [&](int tile) {
+        const TileBounds bounds = tileBounds(tile, tilesX_, width_, height_);
+        for (int y = bounds.y0; y < bounds.y1; ++y) {
+            for (int x = bounds.x0; x < bounds.x1; ++x) {
+                const size_t idx = cellIndex(width_, x, y);
+                if (solidMask_[idx] != 0) {
+                    waterVolume_[idx] = 0.0f;
+                    continue;
+                }
 
-            waterVolume_[idx] = std::clamp(volumeScratch_[idx], 0.0f, 1.0f);
+                waterVolume_[idx] = std::clamp(volumeScratch_[idx], 0.0f, 1.0f);
+            }
         }
-    }
+    });
+
+    updateTileSleep();
 }
 
 } // namespace DirtSim
@@ -7,8 +7,24 @@
 
 namespace DirtSim {
 
+/**
+ * MAC-grid water with a pressure projection, stepped in 16x16 cell tiles.
+ *
+ * A tile sleeps once no cell volume in it has changed by more than tileSleepVolumeEpsilon for
+ * tileSleepSteps consecutive steps. Face velocities are not part of the test: thin films keep
+ * faces above velocitySleepEpsilon indefinitely without moving any water, and a sleeping
+ * tile keeps its faces as they were so it resumes where it stopped.
+ *
+ * Only awake tiles plus a one-tile halo are simulated, so a settled pond costs a solid-mask
+ * scan and a volume compare per step. A tile wakes when its solid mask, its volume (including
+ * edits through the mutable view), or its hydrostatic pressure changes. Simulated tiles run in
+ * parallel; advection keeps its row/column order, so results with every tile awake match the
+ * untiled solver exactly.
+ */
 class MacProjectionWaterSim final : public IWaterSim {
 public:
+    static constexpr int TILE_SIZE = 16;
+
     struct Parameters {
         float advectionCflLimit = 0.90f;
         float advectionVolumeEpsilon = 0.0001f;
@@ -19,6 +35,10 @@ public:
         float velocityCflLimit = 0.95f;
         float velocityDampingPerSecond = 0.05f;
         float velocitySleepEpsilon = 0.00005f;
+        // Quiet steps before a tile sleeps; 0 keeps every tile awake.
+        int tileSleepSteps = 8;
+        // Largest per-step volume change in any cell that still counts as quiet.
+        float tileSleepVolumeEpsilon = 0.00001f;
     };
 
     WaterSimMode getMode() const override { return WaterSimMode::MacProjection; }
@@ -33,8 +53,17 @@ public:
 
     void setParametersForTesting(const Parameters& parameters) { parameters_ = parameters; }
     const Parameters& getParametersForTesting() const { return parameters_; }
+    int getSimulatedTileCountForTesting() const
+    {
+        return static_cast<int>(simulatedTiles_.size());
+    }
 
 private:
+    void wakeTile(int tile);
+    void wakeTileAtCell(int x, int y);
+    void rebuildTileSets();
+    void updateTileSleep();
+
     int width_ = 0;
     int height_ = 0;
     Parameters parameters_{};
@@ -52,6 +81,20 @@ private:
     std::vector<uint8_t> projectionMask_;
     std::vector<uint8_t> projectionMaskScratch_;
     std::vector<uint8_t> solidMask_;
+
+    int tilesX_ = 0;
+    int tilesY_ = 0;
+    std::vector<uint8_t> tileAwake_;
+    std::vector<int> tileQuietSteps_;
+    // Awake tiles plus a one-tile halo; these run the full solver this step.
+    std::vector<uint8_t> tileSimulated_;
+    std::vector<int> simulatedTiles_;
+    // Simulated tiles plus one more ring: advection can move volume one cell into it.
+    std::vector<uint8_t> tileTouched_;
+    std::vector<int> touchedTiles_;
+    // Volume as of the last sleep check, to spot changes made outside advanceTime().
+    std::vector<float> settledVolume_;
+    float lastGravity_ = 0.0f;
 };
 
 } // namespace DirtSim
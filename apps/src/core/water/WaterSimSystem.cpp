@@ -49,6 +49,15 @@ void WaterSimSystem::advanceTime(World& world, double deltaTimeSeconds)
     sim_->advanceTime(world, deltaTimeSeconds);
 }
 
+void WaterSimSystem::reset()
+{
+    if (!sim_) {
+        return;
+    }
+
+    sim_->reset();
+}
+
 bool WaterSimSystem::tryGetWaterVolumeView(WaterVolumeView& out) const
 {
     if (!sim_) {
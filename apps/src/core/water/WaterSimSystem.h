@@ -18,6 +18,7 @@ public:
 
     void syncToSettings(const PhysicsSettings& settings, int worldWidth, int worldHeight);
     void advanceTime(World& world, double deltaTimeSeconds);
+    void reset();
     bool tryGetWaterVolumeView(WaterVolumeView& out) const;
     bool tryGetMutableWaterVolumeView(WaterVolumeMutableView& out);
 
@@ -0,0 +1,132 @@
+#include "GenomeListIndex.h"
+#include "core/organisms/evolution/GenomeRepository.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace DirtSim {
+namespace Server {
+
+namespace {
+
+bool isMissingTimestamp(uint64_t timestamp)
+{
+    return timestamp == 0;
+}
+
+bool compareEntries(
+    const Api::GenomeList::GenomeEntry& left,
+    const Api::GenomeList::GenomeEntry& right,
+    GenomeSortKey sortKey,
+    GenomeSortDirection sortDirection)
+{
+    const auto leftId = left.id.toString();
+    const auto rightId = right.id.toString();
+    const auto idLess = leftId < rightId;
+
+    const auto compareValue = [&](const auto& leftValue, const auto& rightValue) {
+        if (leftValue == rightValue) {
+            return idLess;
+        }
+        if (sortDirection == GenomeSortDirection::Asc) {
+            return leftValue < rightValue;
+        }
+        return leftValue > rightValue;
+    };
+
+    switch (sortKey) {
+        case GenomeSortKey::CreatedTimestamp: {
+            const bool leftMissing = isMissingTimestamp(left.metadata.createdTimestamp);
+            const bool rightMissing = isMissingTimestamp(right.metadata.createdTimestamp);
+            if (leftMissing != rightMissing) {
+                return !leftMissing;
+            }
+            return compareValue(left.metadata.createdTimestamp, right.metadata.createdTimestamp);
+        }
+        case GenomeSortKey::Fitness:
+            return compareValue(left.metadata.fitness, right.metadata.fitness);
+        case GenomeSortKey::Generation:
+            return compareValue(left.metadata.generation, right.metadata.generation);
+    }
+
+    return idLess;
+}
+
+bool matchesFilters(const GenomeMetadata& meta, const Api::GenomeList::Command& command)
+{
+    if (command.organismType.has_value() && meta.organismType != command.organismType) {
+        return false;
+    }
+    if (command.brainKind.has_value() && meta.brainKind != command.brainKind) {
+        return false;
+    }
+    if (command.genomePoolId.has_value() && meta.genomePoolId != command.genomePoolId.value()) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+Api::GenomeList::Okay GenomeListIndex::query(
+    const GenomeRepository& repository, const Api::GenomeList::Command& command)
+{
+    const uint64_t revision = repository.getRevision();
+    if (revision_ != revision) {
+        refresh(repository);
+        revision_ = revision;
+    }
+
+    const auto& order = getOrder(command.sortKey, command.sortDirection);
+    const bool filtered = command.organismType.has_value() || command.brainKind.has_value()
+        || command.genomePoolId.has_value();
+    const size_t limit = command.limit > 0 ? command.limit : order.size();
+
+    Api::GenomeList::Okay response;
+    response.genomes.reserve(std::min<size_t>(limit, order.size()));
+
+    size_t matched = 0;
+    for (const uint32_t entryIndex : order) {
+        const auto& entry = entries_[entryIndex];
+        if (filtered && !matchesFilters(entry.metadata, command)) {
+            continue;
+        }
+        if (matched >= command.offset && response.genomes.size() < limit) {
+            response.genomes.push_back(entry);
+        }
+        ++matched;
+    }
+
+    response.totalCount = static_cast<uint32_t>(matched);
+    return response;
+}
+
+void GenomeListIndex::refresh(const GenomeRepository& repository)
+{
+    entries_.clear();
+    for (auto& [id, meta] : repository.list()) {
+        entries_.push_back(Api::GenomeList::GenomeEntry{ .id = id, .metadata = std::move(meta) });
+    }
+    for (auto& order : orders_) {
+        order.reset();
+    }
+    ++refreshCount_;
+}
+
+const std::vector<uint32_t>& GenomeListIndex::getOrder(
+    GenomeSortKey key, GenomeSortDirection direction)
+{
+    const size_t slot = static_cast<size_t>(key) * 2 + static_cast<size_t>(direction);
+    auto& order = orders_.at(slot);
+    if (!order.has_value()) {
+        order.emplace(entries_.size());
+        std::iota(order->begin(), order->end(), 0u);
+        std::sort(order->begin(), order->end(), [&](uint32_t left, uint32_t right) {
+            return compareEntries(entries_[left], entries_[right], key, direction);
+        });
+    }
+    return order.value();
+}
+
+} // namespace Server
+} // namespace DirtSim
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "server/api/GenomeList.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace DirtSim {
+
+class GenomeRepository;
+
+namespace Server {
+
+/**
+ * Answers GenomeList queries from a cached copy of the repository's metadata.
+ *
+ * The copy is refreshed only when the repository revision changes. Sort orders are built
+ * lazily per (sort key, direction) and kept until the next refresh, so paging through a large
+ * archive costs a filter pass and a copy of the requested window rather than a full sort.
+ */
+class GenomeListIndex {
+public:
+    Api::GenomeList::Okay query(
+        const GenomeRepository& repository, const Api::GenomeList::Command& command);
+
+    // Number of times the cached metadata has been reloaded from the repository.
+    uint64_t getRefreshCount() const { return refreshCount_; }
+
+private:
+    static constexpr size_t kSortKeyCount = static_cast<size_t>(GenomeSortKey::Generation) + 1;
+    static constexpr size_t kOrderCount = kSortKeyCount * 2;
+
+    void refresh(const GenomeRepository& repository);
+    const std::vector<uint32_t>& getOrder(GenomeSortKey key, GenomeSortDirection direction);
+
+    std::optional<uint64_t> revision_;
+    std::vector<Api::GenomeList::GenomeEntry> entries_;
+    std::array<std::optional<std::vector<uint32_t>>, kOrderCount> orders_;
+    uint64_t refreshCount_ = 0;
+};
+
+} // namespace Server
+} // namespace DirtSim
@@ -0,0 +1,92 @@
+#include "ReadOnlyQueryExecutor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+#include <utility>
+
+namespace DirtSim {
+namespace Server {
+
+ReadOnlyQueryExecutor::ReadOnlyQueryExecutor(int workerCount)
+{
+    const int count = std::max(1, workerCount);
+    workers_.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        workers_.emplace_back([this] { run(); });
+    }
+}
+
+ReadOnlyQueryExecutor::~ReadOnlyQueryExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    queryReady_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ReadOnlyQueryExecutor::submit(Query query)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(query));
+        stats_.submitted++;
+        stats_.maxQueueDepth = std::max(stats_.maxQueueDepth, queue_.size());
+    }
+    queryReady_.notify_one();
+}
+
+void ReadOnlyQueryExecutor::waitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return queue_.empty() && running_ == 0; });
+}
+
+ReadOnlyQueryExecutor::Stats ReadOnlyQueryExecutor::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ReadOnlyQueryExecutor::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        queryReady_.wait(lock, [this] { return !queue_.empty() || stopping_; });
+        // Queued queries are dropped on shutdown; their connections are going away too.
+        if (stopping_) {
+            return;
+        }
+
+        Query query = std::move(queue_.front());
+        queue_.pop_front();
+        running_++;
+        lock.unlock();
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            query();
+        }
+        catch (const std::exception& e) {
+            spdlog::error("ReadOnlyQueryExecutor: Query threw: {}", e.what());
+        }
+        const double elapsedMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count();
+
+        lock.lock();
+        running_--;
+        stats_.completed++;
+        stats_.busyTotalMs += elapsedMs;
+        if (queue_.empty() && running_ == 0) {
+            idle_.notify_all();
+        }
+    }
+}
+
+} // namespace Server
+} // namespace DirtSim
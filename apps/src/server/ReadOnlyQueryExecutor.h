@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DirtSim {
+namespace Server {
+
+/**
+ * Runs read-only API queries on a small worker pool, off both the simulation thread and the
+ * network threads.
+ *
+ * Queries must only touch immutable snapshots (such as the published WorldData) or state that
+ * carries its own lock, and answer through their Cwc. Anything that mutates the world still
+ * goes through the state machine's event queue.
+ */
+class ReadOnlyQueryExecutor {
+public:
+    using Query = std::function<void()>;
+
+    struct Stats {
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        size_t maxQueueDepth = 0;
+        double busyTotalMs = 0.0;
+    };
+
+    explicit ReadOnlyQueryExecutor(int workerCount);
+    ~ReadOnlyQueryExecutor();
+
+    ReadOnlyQueryExecutor(const ReadOnlyQueryExecutor&) = delete;
+    ReadOnlyQueryExecutor& operator=(const ReadOnlyQueryExecutor&) = delete;
+
+    void submit(Query query);
+
+    // Blocks until every submitted query has finished.
+    void waitUntilIdle();
+
+    Stats getStats() const;
+
+private:
+    void run();
+
+    mutable std::mutex mutex_;
+    std::condition_variable queryReady_;
+    std::condition_variable idle_;
+    std::deque<Query> queue_;
+    size_t running_ = 0;
+    bool stopping_ = false;
+    Stats stats_;
+
+    // Declared last so the queue and state above exist for the workers' whole life.
+    std::vector<std::thread> workers_;
+};
+
+} // namespace Server
+} // namespace DirtSim
@@ -0,0 +1,123 @@
+#include "RenderBroadcastPipeline.h"
+
+#include <spdlog/spdlog.h>
+#include <utility>
+
+namespace DirtSim {
+namespace Server {
+
+RenderBroadcastPipeline::RenderBroadcastPipeline(BroadcastFn broadcast)
+    : broadcast_(std::move(broadcast)), thread_([this] { run(); })
+{}
+
+RenderBroadcastPipeline::~RenderBroadcastPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    frameReady_.notify_one();
+    thread_.join();
+}
+
+RenderFrame& RenderBroadcastPipeline::beginFrame()
+{
+    // Only publishFrame() moves writeIndex_, and it runs on this same thread.
+    return frames_[writeIndex_];
+}
+
+void RenderBroadcastPipeline::publishFrame()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::swap(writeIndex_, pendingIndex_);
+        if (hasPending_) {
+            stats_.dropped++;
+        }
+        hasPending_ = true;
+        stats_.published++;
+    }
+    frameReady_.notify_one();
+}
+
+void RenderBroadcastPipeline::beginPhysics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    physicsStartBusyMs_ = busyMsUntil(Clock::now());
+    inPhysics_ = true;
+}
+
+void RenderBroadcastPipeline::endPhysics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!inPhysics_) {
+        return;
+    }
+    stats_.overlapMs += busyMsUntil(Clock::now()) - physicsStartBusyMs_;
+    inPhysics_ = false;
+}
+
+void RenderBroadcastPipeline::waitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return !hasPending_ && !busy_; });
+}
+
+RenderBroadcastPipeline::Stats RenderBroadcastPipeline::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+double RenderBroadcastPipeline::busyMsUntil(Clock::time_point now) const
+{
+    double busyMs = stats_.broadcastTotalMs;
+    if (busy_) {
+        busyMs += std::chrono::duration<double, std::milli>(now - busySince_).count();
+    }
+    return busyMs;
+}
+
+void RenderBroadcastPipeline::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        frameReady_.wait(lock, [this] { return hasPending_ || stopping_; });
+        if (stopping_) {
+            return;
+        }
+
+        std::swap(pendingIndex_, sendIndex_);
+        hasPending_ = false;
+        busy_ = true;
+        busySince_ = Clock::now();
+        lock.unlock();
+
+        // A throwing send must not take the broadcaster thread down with it.
+        bool sent = true;
+        try {
+            broadcast_(frames_[sendIndex_]);
+        }
+        catch (const std::exception& e) {
+            spdlog::error("RenderBroadcastPipeline: Broadcast threw: {}", e.what());
+            sent = false;
+        }
+
+        lock.lock();
+        stats_.broadcastTotalMs +=
+            std::chrono::duration<double, std::milli>(Clock::now() - busySince_).count();
+        if (sent) {
+            stats_.broadcast++;
+        }
+        else {
+            stats_.dropped++;
+        }
+        busy_ = false;
+        if (!hasPending_) {
+            idle_.notify_all();
+        }
+    }
+}
+
+} // namespace Server
+} // namespace DirtSim
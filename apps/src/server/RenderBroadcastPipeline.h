@@ -0,0 +1,125 @@
+#pragma once
+
+#include "core/RenderFormat.h"
+#include "core/RenderMessage.h"
+#include "core/ScenarioConfig.h"
+#include "core/WorldData.h"
+#include "core/organisms/OrganismType.h"
+#include "core/scenarios/nes/NesControllerTelemetry.h"
+#include "core/scenarios/nes/NesSuperMarioBrosResponseTelemetry.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace DirtSim {
+namespace Server {
+
+/**
+ * Everything one render broadcast needs, copied out of the simulation so it can be packed
+ * and sent while the next physics step runs.
+ */
+struct RenderFrame {
+    struct Target {
+        std::string connectionId;
+        RenderFormat::EnumType format = RenderFormat::EnumType::Basic;
+    };
+
+    WorldData data;
+    std::vector<OrganismId> organismGrid;
+    Scenario::EnumType scenarioId = Scenario::EnumType::Empty;
+    ScenarioConfig scenarioConfig;
+    std::optional<NesControllerTelemetry> nesControllerTelemetry;
+    std::optional<ScenarioVideoFrame> scenarioVideoFrame;
+    std::optional<NesSuperMarioBrosResponseTelemetry> nesSmbResponseTelemetry;
+
+    // MAC water volume for the overlay; empty when the world has none.
+    int waterWidth = 0;
+    int waterHeight = 0;
+    std::vector<float> waterVolume;
+
+    std::vector<Target> targets;
+};
+
+/**
+ * Hands render frames from the simulation thread to a broadcaster thread.
+ *
+ * The simulation fills the frame returned by beginFrame() and calls publishFrame(); the
+ * broadcaster picks up the most recent published frame and runs the broadcast callback on
+ * it. Three frames rotate (being written, pending, being sent), so neither side waits on the
+ * other: when the broadcaster is still busy, a newer publish replaces the pending frame and
+ * the replaced one counts as dropped. A frame whose broadcast throws is logged and counted as
+ * dropped too.
+ *
+ * beginPhysics()/endPhysics() bracket each physics step so the stats can report how much
+ * broadcast work ran concurrently with physics.
+ */
+class RenderBroadcastPipeline {
+public:
+    using BroadcastFn = std::function<void(const RenderFrame&)>;
+
+    struct Stats {
+        uint64_t published = 0;
+        uint64_t broadcast = 0;
+        // Superseded while pending, or the broadcast callback threw.
+        uint64_t dropped = 0;
+        double broadcastTotalMs = 0.0;
+        // Broadcaster busy time that fell inside physics steps.
+        double overlapMs = 0.0;
+    };
+
+    explicit RenderBroadcastPipeline(BroadcastFn broadcast);
+    ~RenderBroadcastPipeline();
+
+    RenderBroadcastPipeline(const RenderBroadcastPipeline&) = delete;
+    RenderBroadcastPipeline& operator=(const RenderBroadcastPipeline&) = delete;
+
+    // Simulation thread only. The returned frame stays valid until publishFrame().
+    RenderFrame& beginFrame();
+    void publishFrame();
+
+    void beginPhysics();
+    void endPhysics();
+
+    // Blocks until every published frame has been broadcast or dropped.
+    void waitUntilIdle();
+
+    Stats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void run();
+    double busyMsUntil(Clock::time_point now) const;
+
+    BroadcastFn broadcast_;
+
+    std::array<RenderFrame, 3> frames_;
+    size_t writeIndex_ = 0;
+    size_t pendingIndex_ = 1;
+    size_t sendIndex_ = 2;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frameReady_;
+    std::condition_variable idle_;
+    bool hasPending_ = false;
+    bool busy_ = false;
+    bool stopping_ = false;
+    Clock::time_point busySince_;
+    double physicsStartBusyMs_ = 0.0;
+    bool inPhysics_ = false;
+    Stats stats_;
+
+    // Declared last so the frames and state above exist for the thread's whole life.
+    std::thread thread_;
+};
+
+} // namespace Server
+} // namespace DirtSim
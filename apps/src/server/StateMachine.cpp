@@ -1,13 +1,18 @@
 #include "StateMachine.h"
 #include "Event.h"
 #include "EventProcessor.h"
+#include "GenomeListIndex.h"
 #include "PlanRepository.h"
+#include "ReadOnlyQueryExecutor.h"
+#include "RenderBroadcastPipeline.h"
 #include "TrainingResultRepository.h"
 #include "UserSettings.h"
 #include "UserSettingsDiskCompat.h"
+#include "api/EvaluationRun.h"
 #include "api/PlanGet.h"
 #include "api/PlanList.h"
 #include "api/SearchProgress.h"
+#include "api/StateRegionGet.h"
 #include "api/TrainingBestSnapshotGet.h"
 #include "api/TrainingResult.h"
 #include "api/TrainingResultDelete.h"
@@ -21,6 +26,7 @@
 #include "api/UserSettingsUpdated.h"
 #include "api/WebSocketAccessSet.h"
 #include "api/WebUiAccessSet.h"
+#include "core/GlyphAtlas.h"
 #include "core/LoggingChannels.h"
 #include "core/RenderMessage.h"
 #include "core/RenderMessageFull.h"
@@ -30,6 +36,7 @@
 #include "core/SystemMetrics.h"
 #include "core/Timers.h"
 #include "core/World.h" // Must be first for complete type in variant.
+#include "core/WorldDiagramGeneratorEmoji.h"
 #include "core/WorldData.h"
 #include "core/input/GamepadManager.h"
 #include "core/network/BinaryProtocol.h"
@@ -42,6 +49,7 @@
 #include "core/scenarios/Scenario.h"
 #include "core/scenarios/ScenarioRegistry.h"
 #include "core/water/WaterVolumeView.h"
+#include "evolution/RemoteEvaluation.h"
 #include "network/CommandDeserializerJson.h"
 #include "network/HttpServer.h"
 #include "states/State.h"
@@ -90,6 +98,9 @@ constexpr int kStartMenuIdleTimeoutMaxMs = 3600000;
 constexpr int kGenomeArchiveMaxSizePerBucketMax = 1000;
 constexpr double kNtscNesFramePeriodMs = 1000.0 / 60.0988;
 constexpr double kNtscNesFrameDelayMaxMs = kNtscNesFramePeriodMs - 0.001;
+// Read-only queries mostly copy and serialize snapshots; two workers keep one large StateGet
+// from holding up the rest without competing with physics for cores.
+constexpr int kReadOnlyQueryWorkerCount = 2;
 
 std::filesystem::path getUserSettingsPath(const std::filesystem::path& dataDir)
 {
@@ -687,59 +698,6 @@ void applyScenarioConfigUpdatesToActiveState(
         fsmState.getVariant());
 }
 
-bool isMissingTimestamp(uint64_t timestamp)
-{
-    return timestamp == 0;
-}
-
-bool compareGenomeListEntries(
-    const Api::GenomeList::GenomeEntry& left,
-    const Api::GenomeList::GenomeEntry& right,
-    GenomeSortKey sortKey,
-    GenomeSortDirection sortDirection)
-{
-    const auto leftId = left.id.toString();
-    const auto rightId = right.id.toString();
-    const auto idLess = leftId < rightId;
-
-    const auto compareValue = [&](const auto& leftValue, const auto& rightValue) {
-        if (leftValue == rightValue) {
-            return idLess;
-        }
-        if (sortDirection == GenomeSortDirection::Asc) {
-            return leftValue < rightValue;
-        }
-        return leftValue > rightValue;
-    };
-
-    switch (sortKey) {
-        case GenomeSortKey::CreatedTimestamp: {
-            const bool leftMissing = isMissingTimestamp(left.metadata.createdTimestamp);
-            const bool rightMissing = isMissingTimestamp(right.metadata.createdTimestamp);
-            if (leftMissing != rightMissing) {
-                return !leftMissing;
-            }
-            return compareValue(left.metadata.createdTimestamp, right.metadata.createdTimestamp);
-        }
-        case GenomeSortKey::Fitness:
-            return compareValue(left.metadata.fitness, right.metadata.fitness);
-        case GenomeSortKey::Generation:
-            return compareValue(left.metadata.generation, right.metadata.generation);
-    }
-
-    return idLess;
-}
-
-void sortGenomeListEntries(
-    std::vector<Api::GenomeList::GenomeEntry>& entries,
-    GenomeSortKey sortKey,
-    GenomeSortDirection sortDirection)
-{
-    std::sort(entries.begin(), entries.end(), [&](const auto& left, const auto& right) {
-        return compareGenomeListEntries(left, right, sortKey, sortDirection);
-    });
-}
-
 } // namespace
 
 struct StateMachine::Impl {
@@ -747,6 +705,8 @@ struct StateMachine::Impl {
     std::filesystem::path dataDir_;
     std::unique_ptr<GamepadManager> gamepadManager_;
     GenomeRepository genomeRepository_;
+    GenomeListIndex genomeListIndex_;
+    std::mutex genomeListIndexMutex_;
     PlanRepository planRepository_;
     TrainingResultRepository trainingResultRepository_;
     ScenarioRegistry scenarioRegistry_;
@@ -761,8 +721,9 @@ struct StateMachine::Impl {
     std::unique_ptr<Network::WebSocketServiceInterface> wsServiceOwned_;
     Network::WebSocketServiceInterface* wsService_ = nullptr;
     uint16_t webSocketPort_ = 8080;
+    std::string webSocketBindAddress_ = "127.0.0.1";
     uint16_t httpPort_ = 8081;
-    std::shared_ptr<WorldData> cachedWorldData_;
+    std::shared_ptr<const WorldData> cachedWorldData_;
     mutable std::mutex cachedWorldDataMutex_;
     std::optional<Api::TrainingBestSnapshot> cachedTrainingBestSnapshot_;
     mutable std::mutex cachedTrainingBestSnapshotMutex_;
@@ -770,12 +731,29 @@ struct StateMachine::Impl {
     std::vector<SubscribedClient> subscribedClients_;
     std::vector<std::string> eventSubscribers_;
     mutable std::mutex trainingResultsMutex_;
-    std::vector<std::byte> renderEnvelopeDataScratch_;
-    Network::MessageEnvelope renderEnvelopeScratch_;
-
-    explicit Impl(const std::optional<std::filesystem::path>& dataDir)
+    std::vector<std::byte> renderEnvelopeScratch_;
+
+    std::vector<std::string> remoteEvaluationPeers_;
+    int remoteEvaluationPeerSlots_ = 1;
+    std::string remoteEvaluationClientPubkey_;
+    std::shared_ptr<const EvolutionSupport::RemoteEvaluationPeerTrust> remoteEvaluationPeerTrust_ =
+        std::make_shared<EvolutionSupport::RemoteEvaluationPeerTrust>();
+    // Declared after genomeRepository_ so it stops before the repository goes away.
+    std::unique_ptr<EvolutionSupport::RemoteEvaluationHost> remoteEvaluationHost_;
+    std::mutex remoteEvaluationHostMutex_;
+
+    // Declared after the snapshots and repositories its queries read, so its workers stop
+    // before those go away.
+    std::unique_ptr<ReadOnlyQueryExecutor> readOnlyQueries_ =
+        std::make_unique<ReadOnlyQueryExecutor>(kReadOnlyQueryWorkerCount);
+
+    // Declared last so its thread stops before anything it sends through goes away.
+    // renderEnvelopeScratch_ belongs to that thread once the pipeline exists.
+    std::unique_ptr<RenderBroadcastPipeline> renderPipeline_;
+
+    Impl(const std::optional<std::filesystem::path>& dataDir, WeightEncoding genomeWeightEncoding)
         : dataDir_(dataDir.value_or(getDefaultDataDir())),
-          genomeRepository_(initGenomeRepository(dataDir_)),
+          genomeRepository_(initGenomeRepository(dataDir_, genomeWeightEncoding)),
           planRepository_(initPlanRepository(dataDir_)),
           trainingResultRepository_(initTrainingResultRepository(dataDir_)),
           scenarioRegistry_(ScenarioRegistry::createDefault(genomeRepository_)),
@@ -785,8 +763,6 @@ struct StateMachine::Impl {
     {
         nesFrameDelayEnabled_ = userSettings_.nesSessionSettings.frameDelayEnabled;
         nesFrameDelayMs_ = userSettings_.nesSessionSettings.frameDelayMs;
-        renderEnvelopeScratch_.id = 0;
-        renderEnvelopeScratch_.message_type = "RenderMessage";
 
         if (userSettings_.evolutionConfig.genomeArchiveMaxSize > 0) {
             const size_t pruned = genomeRepository_.pruneManagedByFitness(
@@ -800,15 +776,44 @@ struct StateMachine::Impl {
             }
         }
         LOG_INFO(State, "User settings file: {}", userSettingsPath_.string());
+
+        GlyphAtlas::setSharedPath(dataDir_ / "glyph-atlas.bin");
     }
 
+    void sendRenderFrame(const RenderFrame& frame);
+
 private:
-    static GenomeRepository initGenomeRepository(const std::filesystem::path& dataDir)
+    static GenomeRepository initGenomeRepository(
+        const std::filesystem::path& dataDir, WeightEncoding weightEncoding)
     {
         std::filesystem::create_directories(dataDir);
         auto dbPath = dataDir / "genomes.db";
         spdlog::info("GenomeRepository: Using database at {}", dbPath.string());
-        return GenomeRepository(dbPath);
+
+        // Per-layer scaling follows the brain's genome layout when the metadata identifies it.
+        auto registry = std::make_shared<TrainingBrainRegistry>(
+            TrainingBrainRegistry::createDefault());
+        const GenomeRepository::Config config{
+            .weightEncoding = weightEncoding,
+            .layoutResolver = [registry](const GenomeMetadata& meta) -> GenomeLayout {
+                if (!meta.organismType.has_value() || !meta.brainKind.has_value()) {
+                    return GenomeLayout{};
+                }
+                const BrainRegistryEntry* entry = registry->find(
+                    meta.organismType.value(),
+                    meta.brainKind.value(),
+                    meta.brainVariant.value_or(""));
+                if (!entry || !entry->getGenomeLayout) {
+                    return GenomeLayout{};
+                }
+                return entry->getGenomeLayout();
+            },
+        };
+        if (config.weightEncoding != WeightEncoding::Float32) {
+            spdlog::info(
+                "GenomeRepository: Persisting weights as {}", toString(config.weightEncoding));
+        }
+        return GenomeRepository(dbPath, config);
     }
 
     static TrainingResultRepository initTrainingResultRepository(
@@ -836,8 +841,9 @@ constexpr auto applyNesSessionSettingsToLiveState = [](auto& impl) {
 
 StateMachine::StateMachine(
     std::unique_ptr<Network::WebSocketServiceInterface> webSocketService,
-    const std::optional<std::filesystem::path>& dataDir)
-    : pImpl(dataDir)
+    const std::optional<std::filesystem::path>& dataDir,
+    WeightEncoding genomeWeightEncoding)
+    : pImpl(dataDir, genomeWeightEncoding)
 {
     pImpl->httpServer_ = std::make_unique<HttpServer>(pImpl->httpPort_);
 
@@ -852,8 +858,9 @@ StateMachine::StateMachine(
         getCurrentStateName());
 }
 
-StateMachine::StateMachine(const std::optional<std::filesystem::path>& dataDir)
-    : StateMachine(nullptr, dataDir)
+StateMachine::StateMachine(
+    const std::optional<std::filesystem::path>& dataDir, WeightEncoding genomeWeightEncoding)
+    : StateMachine(nullptr, dataDir, genomeWeightEncoding)
 {}
 
 StateMachine::~StateMachine()
@@ -898,6 +905,40 @@ void StateMachine::setWebSocketPort(uint16_t port)
     pImpl->webSocketPort_ = port;
 }
 
+void StateMachine::setWebSocketBindAddress(std::string address)
+{
+    pImpl->webSocketBindAddress_ = std::move(address);
+}
+
+void StateMachine::setRemoteEvaluationPeers(
+    std::vector<std::string> peers, int slotsPerPeer, std::string clientPubkey)
+{
+    pImpl->remoteEvaluationPeers_ = std::move(peers);
+    pImpl->remoteEvaluationPeerSlots_ = std::max(1, slotsPerPeer);
+    pImpl->remoteEvaluationClientPubkey_ = std::move(clientPubkey);
+}
+
+void StateMachine::setRemoteEvaluationPeerTrust(EvolutionSupport::RemoteEvaluationPeerTrust trust)
+{
+    pImpl->remoteEvaluationPeerTrust_ =
+        std::make_shared<const EvolutionSupport::RemoteEvaluationPeerTrust>(std::move(trust));
+}
+
+const std::vector<std::string>& StateMachine::getRemoteEvaluationPeers() const
+{
+    return pImpl->remoteEvaluationPeers_;
+}
+
+const std::string& StateMachine::getRemoteEvaluationClientPubkey() const
+{
+    return pImpl->remoteEvaluationClientPubkey_;
+}
+
+int StateMachine::getRemoteEvaluationPeerSlots() const
+{
+    return pImpl->remoteEvaluationPeerSlots_;
+}
+
 void StateMachine::setupWebSocketService(Network::WebSocketService& service)
 {
     spdlog::info("StateMachine: Setting up WebSocketService command handlers...");
@@ -979,6 +1020,7 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
         DISPATCH_JSON_CMD_WITH_RESP(Api::CellGet);
         DISPATCH_JSON_CMD_EMPTY(Api::CellSet);
         DISPATCH_JSON_CMD_WITH_RESP(Api::DiagramGet);
+        DISPATCH_JSON_CMD_WITH_RESP(Api::EvaluationRun);
         DISPATCH_JSON_CMD_WITH_RESP(Api::EventSubscribe);
         DISPATCH_JSON_CMD_WITH_RESP(Api::EvolutionMutationControlsSet);
         DISPATCH_JSON_CMD_WITH_RESP(Api::EvolutionPauseSet);
@@ -1007,6 +1049,7 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
         DISPATCH_JSON_CMD_EMPTY(Api::SimStop);
         DISPATCH_JSON_CMD_EMPTY(Api::SpawnDirtBall);
         DISPATCH_JSON_CMD_WITH_RESP(Api::StateGet);
+        DISPATCH_JSON_CMD_WITH_RESP(Api::StateRegionGet);
         DISPATCH_JSON_CMD_WITH_RESP(Api::StatusGet);
         DISPATCH_JSON_CMD_WITH_RESP(Api::TrainingBestSnapshotGet);
         DISPATCH_JSON_CMD_WITH_RESP(Api::TimerStatsGet);
@@ -1025,20 +1068,163 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
     });
 
     // =========================================================================
-    // Immediate handlers - respond right away without queuing.
+    // Read-only handlers - run on the query workers against published snapshots or
+    // self-locking repositories, so neither the simulation nor the network threads copy and
+    // serialize large responses.
     // =========================================================================
 
     // StateGet - return cached world data.
     service.registerHandler<Api::StateGet::Cwc>([this](Api::StateGet::Cwc cwc) {
-        auto cachedPtr = getCachedWorldData();
-        if (!cachedPtr) {
-            cwc.sendResponse(Api::StateGet::Response::error(ApiError{ "No world data available" }));
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            auto cachedPtr = getCachedWorldData();
+            if (!cachedPtr) {
+                cwc.sendResponse(
+                    Api::StateGet::Response::error(ApiError{ "No world data available" }));
+                return;
+            }
+
+            // Serialized straight from the published snapshot rather than a per-request copy.
+            Api::StateGet::Okay okay;
+            okay.sharedWorldData = std::move(cachedPtr);
+            cwc.sendResponse(Api::StateGet::Response::okay(std::move(okay)));
+        });
+    });
+
+    // StateRegionGet - project a region of the cached snapshot.
+    service.registerHandler<Api::StateRegionGet::Cwc>([this](Api::StateRegionGet::Cwc cwc) {
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            auto cachedPtr = getCachedWorldData();
+            if (!cachedPtr) {
+                cwc.sendResponse(
+                    Api::StateRegionGet::Response::error(ApiError{ "No world data available" }));
+                return;
+            }
+
+            cwc.sendResponse(Api::StateRegionGet::extractRegion(*cachedPtr, cwc.command));
+        });
+    });
+
+    // DiagramGet - render the cached snapshot rather than the live world.
+    service.registerHandler<Api::DiagramGet::Cwc>([this](Api::DiagramGet::Cwc cwc) {
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            using Response = Api::DiagramGet::Response;
+
+            auto cachedPtr = getCachedWorldData();
+            if (!cachedPtr) {
+                cwc.sendResponse(Response::error(ApiError{ "No world data available" }));
+                return;
+            }
+
+            std::string diagram;
+            switch (cwc.command.style) {
+                case Api::DiagramGet::DiagramStyle::Mixed:
+                    diagram = WorldDiagramGeneratorEmoji::generateMixedDiagram(*cachedPtr);
+                    break;
+                case Api::DiagramGet::DiagramStyle::Ansi:
+                    diagram = WorldDiagramGeneratorEmoji::generateAnsiDiagram(
+                        *cachedPtr, cwc.command.useLitColors);
+                    break;
+                case Api::DiagramGet::DiagramStyle::Emoji:
+                default:
+                    diagram = WorldDiagramGeneratorEmoji::generateEmojiDiagram(*cachedPtr);
+                    break;
+            }
+
+            spdlog::info("DiagramGet: Generated diagram ({} bytes):\n{}", diagram.size(), diagram);
+
+            cwc.sendResponse(Response::okay({ diagram }));
+        });
+    });
+
+    // GenomeList - the repository locks internally; the index has its own lock.
+    service.registerHandler<Api::GenomeList::Cwc>([this](Api::GenomeList::Cwc cwc) {
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            Api::GenomeList::Okay response;
+            {
+                std::lock_guard<std::mutex> lock(pImpl->genomeListIndexMutex_);
+                response = pImpl->genomeListIndex_.query(getGenomeRepository(), cwc.command);
+            }
+            cwc.sendResponse(Api::GenomeList::Response::okay(std::move(response)));
+        });
+    });
+
+    service.registerHandler<Api::TrainingResultList::Cwc>([this](Api::TrainingResultList::Cwc cwc) {
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            Result<std::vector<Api::TrainingResultList::Entry>, std::string> listResult;
+            {
+                std::lock_guard<std::mutex> lock(pImpl->trainingResultsMutex_);
+                listResult = pImpl->trainingResultRepository_.list();
+            }
+            if (listResult.isError()) {
+                cwc.sendResponse(
+                    Api::TrainingResultList::Response::error(ApiError(listResult.errorValue())));
+                return;
+            }
+
+            Api::TrainingResultList::Okay response;
+            response.results = std::move(listResult).value();
+            cwc.sendResponse(Api::TrainingResultList::Response::okay(std::move(response)));
+        });
+    });
+
+    service.registerHandler<Api::TrainingResultGet::Cwc>([this](Api::TrainingResultGet::Cwc cwc) {
+        pImpl->readOnlyQueries_->submit([this, cwc = std::move(cwc)] {
+            Result<std::optional<Api::TrainingResult>, std::string> getResult;
+            {
+                std::lock_guard<std::mutex> lock(pImpl->trainingResultsMutex_);
+                getResult = pImpl->trainingResultRepository_.get(cwc.command.trainingSessionId);
+            }
+
+            if (getResult.isError()) {
+                cwc.sendResponse(
+                    Api::TrainingResultGet::Response::error(ApiError(getResult.errorValue())));
+                return;
+            }
+            auto found = std::move(getResult).value();
+            if (!found.has_value()) {
+                cwc.sendResponse(Api::TrainingResultGet::Response::error(ApiError(
+                    "TrainingResultGet not found: "
+                    + cwc.command.trainingSessionId.toString())));
+                return;
+            }
+
+            Api::TrainingResultGet::Okay response;
+            response.summary = found->summary;
+            response.candidates = found->candidates;
+            cwc.sendResponse(Api::TrainingResultGet::Response::okay(std::move(response)));
+        });
+    });
+
+    // =========================================================================
+    // Immediate handlers - respond right away without queuing.
+    // =========================================================================
+
+    // EvaluationRun - evaluate on behalf of a coordinating peer. Runs on a dedicated worker
+    // pool independent of the current state, so a peer can serve while idle or training.
+    // Remote clients already passed the access token check; beyond that only coordinators
+    // whose peer client key is allowlisted may run evaluations here.
+    service.registerHandler<Api::EvaluationRun::Cwc>([this](Api::EvaluationRun::Cwc cwc) {
+        const bool trusted =
+            (pImpl->wsService_ && pImpl->wsService_->isLocalClient(cwc.command.connectionId))
+            || pImpl->remoteEvaluationPeerTrust_->isTrustedKey(cwc.command.peerClientPubkey);
+        if (!trusted) {
+            LOG_WARN(
+                Network,
+                "EvaluationRun rejected from untrusted client {}",
+                cwc.command.connectionId);
+            cwc.sendResponse(
+                Api::EvaluationRun::Response::error(ApiError{ "EvaluationRun peer not trusted" }));
             return;
         }
 
-        Api::StateGet::Okay okay;
-        okay.worldData = *cachedPtr;
-        cwc.sendResponse(Api::StateGet::Response::okay(std::move(okay)));
+        std::lock_guard<std::mutex> lock(pImpl->remoteEvaluationHostMutex_);
+        if (!pImpl->remoteEvaluationHost_) {
+            const int workerCount =
+                std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+            pImpl->remoteEvaluationHost_ = std::make_unique<EvolutionSupport::RemoteEvaluationHost>(
+                pImpl->genomeRepository_, workerCount);
+        }
+        pImpl->remoteEvaluationHost_->submit(std::move(cwc));
     });
 
     // StatusGet - return lightweight status (always includes state, world data if available).
@@ -1111,7 +1297,8 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
         okay.enabled = cwc.command.enabled;
         cwc.sendResponse(Response::okay(std::move(okay)));
 
-        const std::string bindAddress = cwc.command.enabled ? "0.0.0.0" : "127.0.0.1";
+        const std::string bindAddress =
+            cwc.command.enabled ? "0.0.0.0" : pImpl->webSocketBindAddress_;
         if (cwc.command.enabled) {
             pImpl->wsService_->setAccessToken(cwc.command.token);
         }
@@ -1162,49 +1349,6 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
         cwc.sendResponse(Api::RenderFormatGet::Response::okay(std::move(okay)));
     });
 
-    service.registerHandler<Api::TrainingResultList::Cwc>([this](Api::TrainingResultList::Cwc cwc) {
-        Result<std::vector<Api::TrainingResultList::Entry>, std::string> listResult;
-        {
-            std::lock_guard<std::mutex> lock(pImpl->trainingResultsMutex_);
-            listResult = pImpl->trainingResultRepository_.list();
-        }
-        if (listResult.isError()) {
-            cwc.sendResponse(
-                Api::TrainingResultList::Response::error(ApiError(listResult.errorValue())));
-            return;
-        }
-
-        Api::TrainingResultList::Okay response;
-        response.results = std::move(listResult).value();
-        cwc.sendResponse(Api::TrainingResultList::Response::okay(std::move(response)));
-    });
-
-    service.registerHandler<Api::TrainingResultGet::Cwc>([this](Api::TrainingResultGet::Cwc cwc) {
-        Result<std::optional<Api::TrainingResult>, std::string> getResult;
-        {
-            std::lock_guard<std::mutex> lock(pImpl->trainingResultsMutex_);
-            getResult = pImpl->trainingResultRepository_.get(cwc.command.trainingSessionId);
-        }
-
-        if (getResult.isError()) {
-            cwc.sendResponse(
-                Api::TrainingResultGet::Response::error(ApiError(getResult.errorValue())));
-            return;
-        }
-        auto found = std::move(getResult).value();
-        if (!found.has_value()) {
-            cwc.sendResponse(
-                Api::TrainingResultGet::Response::error(ApiError(
-                    "TrainingResultGet not found: " + cwc.command.trainingSessionId.toString())));
-            return;
-        }
-
-        Api::TrainingResultGet::Okay response;
-        response.summary = found->summary;
-        response.candidates = found->candidates;
-        cwc.sendResponse(Api::TrainingResultGet::Response::okay(std::move(response)));
-    });
-
     service.registerHandler<Api::EventSubscribe::Cwc>(
         [this](Api::EventSubscribe::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::RenderFormatSet::Cwc>(
@@ -1223,8 +1367,6 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
     service.registerHandler<Api::CellSet::Cwc>([this](Api::CellSet::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::ClockEventTrigger::Cwc>(
         [this](Api::ClockEventTrigger::Cwc cwc) { queueEvent(cwc); });
-    service.registerHandler<Api::DiagramGet::Cwc>(
-        [this](Api::DiagramGet::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::EvolutionMutationControlsSet::Cwc>(
         [this](Api::EvolutionMutationControlsSet::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::EvolutionPauseSet::Cwc>(
@@ -1244,8 +1386,6 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
         [this](Api::GenomeDelete::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::GenomeGet::Cwc>(
         [this](Api::GenomeGet::Cwc cwc) { queueEvent(cwc); });
-    service.registerHandler<Api::GenomeList::Cwc>(
-        [this](Api::GenomeList::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::GenomeSet::Cwc>(
         [this](Api::GenomeSet::Cwc cwc) { queueEvent(cwc); });
     service.registerHandler<Api::GravitySet::Cwc>(
@@ -1317,11 +1457,18 @@ void StateMachine::setupWebSocketService(Network::WebSocketService& service)
 
 void StateMachine::updateCachedWorldData(const WorldData& data)
 {
+    updateCachedWorldData(WorldData(data));
+}
+
+void StateMachine::updateCachedWorldData(WorldData&& data)
+{
+    // Build the snapshot before taking the lock; readers only ever swap the pointer.
+    auto snapshot = std::make_shared<const WorldData>(std::move(data));
     std::lock_guard<std::mutex> lock(pImpl->cachedWorldDataMutex_);
-    pImpl->cachedWorldData_ = std::make_shared<WorldData>(data);
+    pImpl->cachedWorldData_ = std::move(snapshot);
 }
 
-std::shared_ptr<WorldData> StateMachine::getCachedWorldData() const
+std::shared_ptr<const WorldData> StateMachine::getCachedWorldData() const
 {
     std::lock_guard<std::mutex> lock(pImpl->cachedWorldDataMutex_);
     return pImpl->cachedWorldData_; // Returns shared_ptr (may be nullptr).
@@ -1655,22 +1802,6 @@ void StateMachine::handleEvent(const Event& event)
         return;
     }
 
-    // Handle GenomeList globally (read-only, works in any state).
-    if (std::holds_alternative<Api::GenomeList::Cwc>(event.getVariant())) {
-        const auto& cwc = std::get<Api::GenomeList::Cwc>(event.getVariant());
-        auto& repo = getGenomeRepository();
-
-        Api::GenomeList::Okay response;
-        for (const auto& [id, meta] : repo.list()) {
-            response.genomes.push_back(Api::GenomeList::GenomeEntry{ .id = id, .metadata = meta });
-        }
-
-        sortGenomeListEntries(response.genomes, cwc.command.sortKey, cwc.command.sortDirection);
-
-        cwc.sendResponse(Api::GenomeList::Response::okay(std::move(response)));
-        return;
-    }
-
     // Handle GenomeSet globally (works in any state).
     if (std::holds_alternative<Api::GenomeSet::Cwc>(event.getVariant())) {
         const auto& cwc = std::get<Api::GenomeSet::Cwc>(event.getVariant());
@@ -2276,48 +2407,78 @@ void StateMachine::broadcastRenderMessage(
         return (data.timestep % everyN) == 0;
     };
 
-    bool hasEligibleClient = false;
+    std::vector<RenderFrame::Target> targets;
     for (const auto& client : pImpl->subscribedClients_) {
         if (pImpl->wsService_ && !pImpl->wsService_->clientWantsRender(client.connectionId)) {
             continue;
         }
         if (shouldSendForClient(client)) {
-            hasEligibleClient = true;
-            break;
+            targets.push_back(
+                { .connectionId = client.connectionId, .format = client.renderFormat });
         }
     }
-    if (!hasEligibleClient) {
+    if (targets.empty()) {
         return;
     }
 
     spdlog::debug(
         "StateMachine: Broadcasting to {} subscribed clients (step {})",
-        pImpl->subscribedClients_.size(),
+        targets.size(),
         data.timestep);
 
-    for (const auto& client : pImpl->subscribedClients_) {
-        if (pImpl->wsService_ && !pImpl->wsService_->clientWantsRender(client.connectionId)) {
-            continue;
-        }
-        if (!shouldSendForClient(client)) {
-            continue;
-        }
+    if (!pImpl->renderPipeline_) {
+        pImpl->renderPipeline_ = std::make_unique<RenderBroadcastPipeline>(
+            [impl = pImpl.get()](const RenderFrame& frame) { impl->sendRenderFrame(frame); });
+    }
+
+    // Copy assignment reuses each buffer's capacity, so steady-state frames do not allocate.
+    RenderFrame& frame = pImpl->renderPipeline_->beginFrame();
+    frame.data = data;
+    frame.organismGrid = organism_grid;
+    frame.scenarioId = scenario_id;
+    frame.scenarioConfig = scenario_config;
+    frame.nesControllerTelemetry = nesControllerTelemetry;
+    frame.scenarioVideoFrame = scenarioVideoFrame;
+    frame.nesSmbResponseTelemetry = nesSmbResponseTelemetry;
+    frame.targets = std::move(targets);
+    if (waterVolumeView) {
+        frame.waterWidth = waterVolumeView->width;
+        frame.waterHeight = waterVolumeView->height;
+        frame.waterVolume.assign(waterVolumeView->volume.begin(), waterVolumeView->volume.end());
+    }
+    else {
+        frame.waterWidth = 0;
+        frame.waterHeight = 0;
+        frame.waterVolume.clear();
+    }
+    pImpl->renderPipeline_->publishFrame();
+}
 
-        RenderMessage msg = scenarioVideoFrame.has_value()
+// Runs on the render broadcast thread.
+void StateMachine::Impl::sendRenderFrame(const RenderFrame& frame)
+{
+    if (!wsService_) {
+        return;
+    }
+
+    const WorldData& data = frame.data;
+    const bool hasWaterVolume = frame.waterWidth > 0 && frame.waterHeight > 0
+        && static_cast<size_t>(frame.waterWidth) * frame.waterHeight == frame.waterVolume.size();
+
+    for (const auto& target : frame.targets) {
+        RenderMessage msg = frame.scenarioVideoFrame.has_value()
             ? RenderMessageUtils::packVideoRenderMessage(
-                  data, client.renderFormat, organism_grid, scenarioVideoFrame.value())
-            : RenderMessageUtils::packCellRenderMessage(data, client.renderFormat, organism_grid);
+                  data, target.format, frame.organismGrid, frame.scenarioVideoFrame.value())
+            : RenderMessageUtils::packCellRenderMessage(data, target.format, frame.organismGrid);
 
-        if (waterVolumeView && !msg.scenario_video_frame.has_value()
-            && waterVolumeView->width == msg.width && waterVolumeView->height == msg.height
-            && static_cast<size_t>(waterVolumeView->width) * waterVolumeView->height
-                == waterVolumeView->volume.size()) {
+        if (hasWaterVolume && !msg.scenario_video_frame.has_value()
+            && frame.waterWidth == msg.width && frame.waterHeight == msg.height) {
             if (msg.format == RenderFormat::EnumType::Basic) {
                 const size_t cellCount = static_cast<size_t>(msg.width) * msg.height;
                 if (msg.payload.size() == cellCount * sizeof(BasicCell)) {
                     auto* cells = reinterpret_cast<BasicCell*>(msg.payload.data());
                     for (size_t idx = 0; idx < cellCount; ++idx) {
-                        const float volume = (*waterVolumeView).volume[idx];
+                        const float volume = frame.waterVolume[idx];
                         if (volume <= 0.0f) {
                             continue;
                         }
@@ -2345,35 +2506,31 @@ void StateMachine::broadcastRenderMessage(
         // Bundle with scenario metadata for transport.
         RenderMessageFull fullMsg;
         fullMsg.render_data = std::move(msg);
-        fullMsg.scenario_id = scenario_id;
-        fullMsg.scenario_config = scenario_config;
-        fullMsg.nes_controller_telemetry = nesControllerTelemetry;
-        fullMsg.nes_smb_response_telemetry = nesSmbResponseTelemetry;
+        fullMsg.scenario_id = frame.scenarioId;
+        fullMsg.scenario_config = frame.scenarioConfig;
+        fullMsg.nes_controller_telemetry = frame.nesControllerTelemetry;
+        fullMsg.nes_smb_response_telemetry = frame.nesSmbResponseTelemetry;
         fullMsg.server_send_timestamp_ns = steadyClockNowNs();
 
-        Network::MessageEnvelope& envelope = pImpl->renderEnvelopeScratch_;
-        envelope.id = 0;
-        envelope.payload.clear();
-
-        // Serialize RenderMessageFull into reusable envelope payload storage.
-        zpp::bits::out payloadOut(envelope.payload);
-        payloadOut(fullMsg).or_throw();
+        // Header and payload go straight into the reused send buffer.
+        Network::write_envelope(
+            renderEnvelopeScratch_, 0, Network::kRenderMessageTypeId, 0, fullMsg);
 
-        pImpl->renderEnvelopeDataScratch_.clear();
-        zpp::bits::out envelopeOut(pImpl->renderEnvelopeDataScratch_);
-        envelopeOut(envelope).or_throw();
-
-        auto result =
-            pImpl->wsService_->sendToClient(client.connectionId, pImpl->renderEnvelopeDataScratch_);
+        auto result = wsService_->sendToClient(target.connectionId, renderEnvelopeScratch_);
         if (result.isError()) {
             spdlog::error(
                 "StateMachine: Failed to send RenderMessage to '{}': {}",
-                client.connectionId,
+                target.connectionId,
                 result.errorValue());
         }
     }
 }
 
+RenderBroadcastPipeline* StateMachine::getRenderBroadcastPipeline()
+{
+    return pImpl->renderPipeline_.get();
+}
+
 void StateMachine::broadcastCommand(const std::string& messageType)
 {
     broadcastEventData(messageType, {});
@@ -7,6 +7,7 @@
 #include "core/StateMachineBase.h"
 #include "core/StateMachineInterface.h"
 #include "core/organisms/OrganismType.h"
+#include "core/organisms/brains/WeightQuantization.h"
 #include "core/scenarios/ClockConfig.h"
 #include "core/scenarios/nes/NesControllerTelemetry.h"
 #include "core/scenarios/nes/NesSuperMarioBrosResponseTelemetry.h"
@@ -46,21 +47,30 @@ namespace Server {
 class Event;
 class EventProcessor;
 class PlanRepository;
+class RenderBroadcastPipeline;
 class WebSocketServer;
 struct QuitApplicationCommand;
 struct GetFPSCommand;
 struct GetSimStatsCommand;
 
+namespace EvolutionSupport {
+class RemoteEvaluationPeerTrust;
+}
+
 namespace State {
 class Any;
 }
 
 class StateMachine : public StateMachineBase, public StateMachineInterface<Event> {
 public:
-    explicit StateMachine(const std::optional<std::filesystem::path>& dataDir = std::nullopt);
+    // genomeWeightEncoding is how the genome archive encodes newly written weights.
+    explicit StateMachine(
+        const std::optional<std::filesystem::path>& dataDir = std::nullopt,
+        WeightEncoding genomeWeightEncoding = WeightEncoding::Float32);
     StateMachine(
         std::unique_ptr<Network::WebSocketServiceInterface> webSocketService,
-        const std::optional<std::filesystem::path>& dataDir = std::nullopt);
+        const std::optional<std::filesystem::path>& dataDir = std::nullopt,
+        WeightEncoding genomeWeightEncoding = WeightEncoding::Float32);
     ~StateMachine();
 
     void mainLoopRun();
@@ -78,6 +88,19 @@ public:
     Network::WebSocketServiceInterface* getWebSocketService();
     void setWebSocketService(Network::WebSocketServiceInterface* service);
     void setWebSocketPort(uint16_t port);
+    // Address to listen on when remote WebSocket access is off (default 127.0.0.1).
+    void setWebSocketBindAddress(std::string address);
+
+    // Peer servers (ws://host:port/?token=...) that evolution ships evaluations to, how many
+    // evaluations each runs at once, and the peer client key sent to identify this server.
+    void setRemoteEvaluationPeers(
+        std::vector<std::string> peers, int slotsPerPeer, std::string clientPubkey);
+    // Coordinator keys this server accepts EvaluationRun from. Call before listening;
+    // without it only loopback clients may run evaluations.
+    void setRemoteEvaluationPeerTrust(EvolutionSupport::RemoteEvaluationPeerTrust trust);
+    const std::vector<std::string>& getRemoteEvaluationPeers() const;
+    const std::string& getRemoteEvaluationClientPubkey() const;
+    int getRemoteEvaluationPeerSlots() const;
 
     /**
      * @brief Setup WebSocketService with command handlers.
@@ -85,8 +108,10 @@ public:
      */
     void setupWebSocketService(Network::WebSocketService& service);
 
+    // Published snapshots are immutable, so readers on any thread can hold one without locking.
     void updateCachedWorldData(const WorldData& data);
-    std::shared_ptr<WorldData> getCachedWorldData() const;
+    void updateCachedWorldData(WorldData&& data);
+    std::shared_ptr<const WorldData> getCachedWorldData() const;
     void updateCachedTrainingBestSnapshot(const Api::TrainingBestSnapshot& snapshot);
     std::optional<Api::TrainingBestSnapshot> getCachedTrainingBestSnapshot() const;
     void clearCachedTrainingBestSnapshot();
@@ -122,6 +147,9 @@ public:
             std::nullopt,
         const WaterVolumeView* waterVolumeView = nullptr);
 
+    // Null until the first frame is broadcast; render packing and sends run on its thread.
+    RenderBroadcastPipeline* getRenderBroadcastPipeline();
+
     void broadcastCommand(const std::string& messageType);
     void broadcastEventData(const std::string& messageType, const std::vector<std::byte>& payload);
 
@@ -5,6 +5,7 @@
 #include "CellSet.h"
 #include "ClockEventTrigger.h"
 #include "DiagramGet.h"
+#include "EvaluationRun.h"
 #include "EventSubscribe.h"
 #include "EvolutionMutationControlsSet.h"
 #include "EvolutionPauseSet.h"
@@ -46,6 +47,7 @@
 #include "SimStop.h"
 #include "SpawnDirtBall.h"
 #include "StateGet.h"
+#include "StateRegionGet.h"
 #include "StatusGet.h"
 #include "TimerStatsGet.h"
 #include "TrainingBestSnapshotGet.h"
@@ -94,6 +96,7 @@ using ApiCommand = std::variant<
     Api::ClockEventTrigger::Command,
     Api::DiagramGet::Command,
     Api::EventSubscribe::Command,
+    Api::EvaluationRun::Command,
     Api::EvolutionMutationControlsSet::Command,
     Api::EvolutionPauseSet::Command,
     Api::EvolutionStart::Command,
@@ -134,6 +137,7 @@ using ApiCommand = std::variant<
     Api::SimStop::Command,
     Api::SpawnDirtBall::Command,
     Api::StateGet::Command,
+    Api::StateRegionGet::Command,
     Api::StatusGet::Command,
     Api::TimerStatsGet::Command,
     Api::TrainingBestSnapshotGet::Command,
@@ -1,21 +1,27 @@
 #pragma once
 
 #include "core/ReflectSerializer.h"
+#include "core/network/MessageType.h"
 #include "core/reflect.h"
 
 namespace DirtSim {
 
 /**
- * @brief Define API name marker type and cached name.
+ * @brief Define API name marker type, cached name and binary message type ID.
  *
  * Usage: DEFINE_API_NAME(SimRun) at the top of the API namespace.
- * Creates a marker struct and cached api_name using reflect::type_name.
+ * Creates a marker struct and cached api_name using reflect::type_name, the matching
+ * api_type_id, and registers the name so received IDs can be mapped back to it.
  */
-#define DEFINE_API_NAME(Name)                                           \
-    struct Name {};                                                     \
-    inline static constexpr auto api_name = reflect::type_name<Name>(); \
-    static_assert(!api_name.empty(), "API name must not be empty");     \
-    static_assert(api_name.size() > 0, "API name extraction failed")
+#define DEFINE_API_NAME(Name)                                                                \
+    struct Name {};                                                                          \
+    inline static constexpr auto api_name = reflect::type_name<Name>();                      \
+    static_assert(!api_name.empty(), "API name must not be empty");                          \
+    static_assert(api_name.size() > 0, "API name extraction failed");                        \
+    inline static constexpr ::DirtSim::Network::MessageTypeId api_type_id =                  \
+        ::DirtSim::Network::messageTypeIdOf(api_name);                                       \
+    inline const ::DirtSim::Network::MessageTypeId api_type_registered =                     \
+        ::DirtSim::Network::MessageTypeRegistry::registerName(api_name)
 
 /**
  * @brief Add name() method to Command or Okay structs.
@@ -23,10 +29,14 @@ namespace DirtSim {
  * Usage: API_COMMAND_NAME() inside Command/Okay struct definitions.
  * Returns the cached api_name from the namespace.
  */
-#define API_COMMAND_NAME()                   \
-    static constexpr std::string_view name() \
-    {                                        \
-        return api_name;                     \
+#define API_COMMAND_NAME()                                          \
+    static constexpr std::string_view name()                        \
+    {                                                               \
+        return api_name;                                            \
+    }                                                               \
+    static constexpr ::DirtSim::Network::MessageTypeId typeId()     \
+    {                                                               \
+        return api_type_id;                                         \
     }
 
 /**
@@ -36,11 +46,15 @@ namespace DirtSim {
  * Provides name() method and OkayType typedef for type-safe mock testing.
  * For commands with custom OkayType (e.g., std::monostate), use API_COMMAND_T(Type).
  */
-#define API_COMMAND()                        \
-    static constexpr std::string_view name() \
-    {                                        \
-        return api_name;                     \
-    }                                        \
+#define API_COMMAND()                                               \
+    static constexpr std::string_view name()                        \
+    {                                                               \
+        return api_name;                                            \
+    }                                                               \
+    static constexpr ::DirtSim::Network::MessageTypeId typeId()     \
+    {                                                               \
+        return api_type_id;                                         \
+    }                                                               \
     using OkayType = Okay
 
 /**
@@ -48,11 +62,15 @@ namespace DirtSim {
  *
  * Usage: API_COMMAND_T(std::monostate) for commands without an Okay struct.
  */
-#define API_COMMAND_T(Type)                  \
-    static constexpr std::string_view name() \
-    {                                        \
-        return api_name;                     \
-    }                                        \
+#define API_COMMAND_T(Type)                                         \
+    static constexpr std::string_view name()                        \
+    {                                                               \
+        return api_name;                                            \
+    }                                                               \
+    static constexpr ::DirtSim::Network::MessageTypeId typeId()     \
+    {                                                               \
+        return api_type_id;                                         \
+    }                                                               \
     using OkayType = Type
 
 /**
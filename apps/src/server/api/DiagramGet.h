@@ -12,6 +12,14 @@
 namespace DirtSim {
 namespace Api {
 
+/**
+ * @brief Text diagram of the world.
+ *
+ * Rendered on the read-only query workers from the most recently published world snapshot,
+ * like StateGet, so it answers in any state once a world has been published: SimRunning,
+ * SimPaused, PlanPlayback and SearchActive, and after a run stops it shows the last frame.
+ * It errors with "No world data available" only before any world has been published.
+ */
 namespace DiagramGet {
 
 DEFINE_API_NAME(DiagramGet);
@@ -0,0 +1,73 @@
+#include "EvaluationRun.h"
+
+namespace DirtSim {
+namespace Api {
+namespace EvaluationRun {
+
+nlohmann::json Command::toJson() const
+{
+    nlohmann::json j{
+        { "trainingSpec", trainingSpec },
+        { "evolution", evolution },
+        { "taskType", taskType },
+        { "robustSampleOrdinal", robustSampleOrdinal },
+        { "brainKind", brainKind },
+        { "scenarioId", Scenario::toString(scenarioId) },
+    };
+    if (brainVariant.has_value()) {
+        j["brainVariant"] = *brainVariant;
+    }
+    if (genomeWeights.has_value()) {
+        j["genomeWeights"] = *genomeWeights;
+    }
+    if (!peerClientPubkey.empty()) {
+        j["peerClientPubkey"] = peerClientPubkey;
+    }
+    return j;
+}
+
+Command Command::fromJson(const nlohmann::json& j)
+{
+    Command cmd;
+    if (j.contains("trainingSpec")) {
+        j.at("trainingSpec").get_to(cmd.trainingSpec);
+    }
+    if (j.contains("evolution")) {
+        j.at("evolution").get_to(cmd.evolution);
+    }
+    cmd.taskType = j.value("taskType", cmd.taskType);
+    cmd.robustSampleOrdinal = j.value("robustSampleOrdinal", cmd.robustSampleOrdinal);
+    cmd.brainKind = j.value("brainKind", cmd.brainKind);
+    if (j.contains("brainVariant") && !j["brainVariant"].is_null()) {
+        cmd.brainVariant = j["brainVariant"].get<std::string>();
+    }
+    if (j.contains("scenarioId")) {
+        cmd.scenarioId = Scenario::fromString(j["scenarioId"].get<std::string>())
+                             .value_or(cmd.scenarioId);
+    }
+    if (j.contains("genomeWeights") && !j["genomeWeights"].is_null()) {
+        cmd.genomeWeights = j["genomeWeights"].get<std::vector<WeightType>>();
+    }
+    cmd.peerClientPubkey = j.value("peerClientPubkey", cmd.peerClientPubkey);
+    return cmd;
+}
+
+nlohmann::json Okay::toJson() const
+{
+    nlohmann::json timersJson = nlohmann::json::object();
+    for (const auto& timer : timers) {
+        timersJson[timer.name] = { { "totalMs", timer.totalMs }, { "calls", timer.calls } };
+    }
+
+    return nlohmann::json{
+        { "totalFitness", fitnessEvaluation.totalFitness },
+        { "simTime", simTime },
+        { "commandsAccepted", commandsAccepted },
+        { "commandsRejected", commandsRejected },
+        { "timers", std::move(timersJson) },
+    };
+}
+
+} // namespace EvaluationRun
+} // namespace Api
+} // namespace DirtSim
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "ApiError.h"
+#include "ApiMacros.h"
+#include "core/CommandWithCallback.h"
+#include "core/Result.h"
+#include "core/ScenarioConfig.h"
+#include "core/organisms/brains/WeightType.h"
+#include "core/organisms/evolution/EvolutionConfig.h"
+#include "core/organisms/evolution/TrainingSpec.h"
+#include "server/evolution/FitnessEvaluation.h"
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+#include <zpp_bits.h>
+
+namespace DirtSim {
+namespace Api {
+
+/**
+ * @brief Run one training evaluation on behalf of a coordinating peer.
+ *
+ * Sent server-to-server over the binary protocol. The peer evaluates the individual with
+ * its own workers and replies with the fitness and counters only; snapshots stay on the
+ * coordinator. The JSON form omits the scenario config override. The connection still needs
+ * the access token; peers then only run it from loopback clients or from coordinators whose
+ * peer client key is in their --peer-allowlist.
+ */
+namespace EvaluationRun {
+
+DEFINE_API_NAME(EvaluationRun);
+
+struct Okay; // Forward declaration for API_COMMAND() macro.
+
+struct Command {
+    TrainingSpec trainingSpec; // Only scenarioId and organismType are used.
+    EvolutionConfig evolution;
+    std::optional<ScenarioConfig> scenarioConfigOverride;
+    uint8_t taskType = 0; // EvolutionSupport::EvaluationTaskType.
+    int robustSampleOrdinal = 0;
+    std::string brainKind;
+    std::optional<std::string> brainVariant;
+    Scenario::EnumType scenarioId = Scenario::EnumType::TreeGermination;
+    std::optional<std::vector<WeightType>> genomeWeights;
+    std::string peerClientPubkey; // Coordinator's os-manager peer key ("type body [comment]").
+    std::string connectionId;     // Filled in by the receiving server.
+
+    API_COMMAND();
+    nlohmann::json toJson() const;
+    static Command fromJson(const nlohmann::json& j);
+
+    using serialize = zpp::bits::members<11>;
+};
+
+struct SignatureCount {
+    std::string signature;
+    int count = 0;
+
+    using serialize = zpp::bits::members<2>;
+};
+
+struct TimerEntry {
+    std::string name;
+    double totalMs = 0.0;
+    uint32_t calls = 0;
+
+    using serialize = zpp::bits::members<3>;
+};
+
+struct Okay {
+    Server::EvolutionSupport::FitnessEvaluation fitnessEvaluation;
+    double simTime = 0.0;
+    int commandsAccepted = 0;
+    int commandsRejected = 0;
+    std::vector<SignatureCount> topCommandSignatures;
+    std::vector<SignatureCount> topCommandOutcomeSignatures;
+    std::vector<TimerEntry> timers;
+
+    API_COMMAND_NAME();
+    nlohmann::json toJson() const;
+
+    using serialize = zpp::bits::members<7>;
+};
+
+using OkayType = Okay;
+using Response = Result<OkayType, ApiError>;
+using Cwc = CommandWithCallback<Command, Response>;
+
+} // namespace EvaluationRun
+} // namespace Api
+} // namespace DirtSim
@@ -91,11 +91,15 @@ struct EvolutionProgress {
     int lastGenerationPhenotypeUniqueEliteCarryoverCount = 0;
     int lastGenerationPhenotypeUniqueOffspringMutatedCount = 0;
     int lastGenerationPhenotypeNovelOffspringMutatedCount = 0;
+    // Share of worker time spent evaluating, and time from the first idle worker to the
+    // final result, for the most recently completed generation.
+    double lastGenerationCoreUtilization = 0.0;
+    double lastGenerationTailIdleSeconds = 0.0;
 
     nlohmann::json toJson() const;
     static constexpr const char* name() { return "EvolutionProgress"; }
 
-    using serialize = zpp::bits::members<47>;
+    using serialize = zpp::bits::members<49>;
 };
 
 } // namespace Api
@@ -6,7 +6,10 @@
 #include "core/Result.h"
 #include "core/organisms/evolution/GenomeMetadata.h"
 #include "core/organisms/evolution/GenomeSort.h"
+#include <cstdint>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
 #include <vector>
 #include <zpp_bits.h>
 
@@ -23,11 +26,20 @@ struct Command {
     GenomeSortKey sortKey = GenomeSortKey::CreatedTimestamp;
     GenomeSortDirection sortDirection = GenomeSortDirection::Desc;
 
+    // Page window into the sorted, filtered list. limit 0 returns everything from offset on.
+    uint32_t offset = 0;
+    uint32_t limit = 0;
+
+    // Filters; unset matches every genome.
+    std::optional<OrganismType> organismType;
+    std::optional<std::string> brainKind;
+    std::optional<GenomePoolId> genomePoolId;
+
     API_COMMAND();
     nlohmann::json toJson() const;
     static Command fromJson(const nlohmann::json& j);
 
-    using serialize = zpp::bits::members<2>;
+    using serialize = zpp::bits::members<7>;
 };
 
 struct GenomeEntry {
@@ -42,11 +54,13 @@ void from_json(const nlohmann::json& j, GenomeEntry& e);
 
 struct Okay {
     std::vector<GenomeEntry> genomes;
+    // Genomes matching the filters, before offset/limit are applied.
+    uint32_t totalCount = 0;
 
     API_COMMAND_NAME();
     nlohmann::json toJson() const;
 
-    using serialize = zpp::bits::members<1>;
+    using serialize = zpp::bits::members<2>;
 };
 
 using OkayType = Okay;
@@ -5,6 +5,7 @@
 #include "core/CommandWithCallback.h"
 #include "core/Result.h"
 #include <nlohmann/json.hpp>
+#include <string>
 #include <zpp_bits.h>
 
 namespace DirtSim {
@@ -42,10 +43,22 @@ struct Okay {
     double network_send_total_ms = 0.0;
     uint32_t network_send_calls = 0;
 
+    // Render packing and sends, on the broadcast thread. overlap is the part of that time
+    // that ran during physics steps; dropped counts frames superseded before being sent.
+    double broadcast_avg_ms = 0.0;
+    double broadcast_total_ms = 0.0;
+    uint32_t broadcast_calls = 0;
+    uint32_t broadcast_dropped = 0;
+    double broadcast_overlap_ms = 0.0;
+
+    // Root of the world's WorldStateHash (hex); empty when no grid world is running.
+    std::string state_hash;
+    int32_t state_hash_timestep = 0;
+
     API_COMMAND_NAME();
     nlohmann::json toJson() const;
 
-    using serialize = zpp::bits::members<13>;
+    using serialize = zpp::bits::members<20>;
 };
 
 using OkayType = Okay;
@@ -26,6 +26,7 @@ enum class SearchProgressEvent : uint8_t {
     PrunedBelowScreen = 12,
     PrunedTransposition = 13,
     PrunedNonGameplay = 14,
+    PrunedBeamWidth = 15,
 };
 
 struct SearchProgress {
@@ -18,7 +18,7 @@ Command Command::fromJson(const nlohmann::json& j)
 nlohmann::json Okay::toJson() const
 {
     // WorldData uses automatic serialization via ADL.
-    return ReflectSerializer::to_json(worldData);
+    return ReflectSerializer::to_json(worldDataToSend());
 }
 
 } // namespace StateGet
@@ -5,7 +5,9 @@
 #include "core/CommandWithCallback.h"
 #include "core/Result.h"
 #include "core/WorldData.h"
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <type_traits>
 #include <zpp_bits.h>
 
 namespace DirtSim {
@@ -27,11 +29,27 @@ struct Command {
 
 struct Okay {
     WorldData worldData; // Changed from World to WorldData.
+    // Sent in place of worldData when set, so the server can reply from its published
+    // snapshot without copying it. Receivers always get worldData.
+    std::shared_ptr<const WorldData> sharedWorldData;
 
     API_COMMAND_NAME();
     nlohmann::json toJson() const;
 
-    using serialize = zpp::bits::members<1>;
+    const WorldData& worldDataToSend() const
+    {
+        return sharedWorldData ? *sharedWorldData : worldData;
+    }
+
+    constexpr static auto serialize(auto& archive, auto& self)
+    {
+        if constexpr (std::remove_cvref_t<decltype(archive)>::kind() == zpp::bits::kind::out) {
+            return archive(self.worldDataToSend());
+        }
+        else {
+            return archive(self.worldData);
+        }
+    }
 };
 
 using OkayType = Okay;
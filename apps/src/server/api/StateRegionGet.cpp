@@ -0,0 +1,258 @@
+#include "StateRegionGet.h"
+#include "core/ReflectSerializer.h"
+#include "core/WorldData.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace DirtSim {
+namespace Api {
+namespace StateRegionGet {
+
+namespace {
+
+struct FieldName {
+    Field field;
+    const char* name;
+};
+
+constexpr FieldName kFieldNames[] = {
+    { Field::Material, "material" }, { Field::Fill, "fill" },
+    { Field::Velocity, "velocity" }, { Field::Pressure, "pressure" },
+    { Field::Color, "color" },       { Field::OrganismId, "organism_id" },
+};
+
+std::string base64Encode(const std::vector<uint8_t>& data)
+{
+    static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+    encoded.reserve((data.size() + 2) / 3 * 4);
+    size_t i = 0;
+    for (; i + 2 < data.size(); i += 3) {
+        const uint32_t triple = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        encoded += chars[(triple >> 18) & 0x3F];
+        encoded += chars[(triple >> 12) & 0x3F];
+        encoded += chars[(triple >> 6) & 0x3F];
+        encoded += chars[triple & 0x3F];
+    }
+
+    const size_t remaining = data.size() - i;
+    if (remaining > 0) {
+        const uint32_t triple = (data[i] << 16) | (remaining == 2 ? data[i + 1] << 8 : 0);
+        encoded += chars[(triple >> 18) & 0x3F];
+        encoded += chars[(triple >> 12) & 0x3F];
+        encoded += remaining == 2 ? chars[(triple >> 6) & 0x3F] : '=';
+        encoded += '=';
+    }
+    return encoded;
+}
+
+struct Region {
+    int x0 = 0;
+    int y0 = 0;
+    int x1 = 0;
+    int y1 = 0;
+};
+
+// Fills one plane row by row. valueOf(gridIndex, component) yields the element stored in
+// binary planes; JSON planes widen it to a double.
+template <typename T, typename ValueFn>
+void fillPlane(
+    Plane& plane, Encoding encoding, const WorldData& data, const Region& region, ValueFn valueOf)
+{
+    const int components = componentsPerCell(plane.field);
+    const size_t elements = static_cast<size_t>(region.x1 - region.x0)
+        * static_cast<size_t>(region.y1 - region.y0) * components;
+    uint8_t* out = nullptr;
+    if (encoding == Encoding::Json) {
+        plane.values.reserve(elements);
+    }
+    else {
+        plane.bytes.resize(elements * sizeof(T));
+        out = plane.bytes.data();
+    }
+
+    for (int y = region.y0; y < region.y1; y++) {
+        const size_t rowStart = static_cast<size_t>(y) * data.width;
+        for (int x = region.x0; x < region.x1; x++) {
+            for (int c = 0; c < components; c++) {
+                const T value = valueOf(rowStart + x, c);
+                if (out) {
+                    std::memcpy(out, &value, sizeof(T));
+                    out += sizeof(T);
+                }
+                else {
+                    plane.values.push_back(static_cast<double>(value));
+                }
+            }
+        }
+    }
+}
+
+void fillPlane(Plane& plane, Encoding encoding, const WorldData& data, const Region& region)
+{
+    const auto& cells = data.cells;
+    const bool hasOrganismIds = data.organism_ids.size() == cells.size();
+    switch (plane.field) {
+        case Field::Material:
+            fillPlane<uint8_t>(plane, encoding, data, region, [&](size_t i, int) {
+                return static_cast<uint8_t>(cells[i].material_type);
+            });
+            return;
+        case Field::Fill:
+            fillPlane<float>(plane, encoding, data, region, [&](size_t i, int) {
+                return static_cast<float>(cells[i].fill_ratio);
+            });
+            return;
+        case Field::Velocity:
+            fillPlane<float>(plane, encoding, data, region, [&](size_t i, int c) {
+                return static_cast<float>(c == 0 ? cells[i].velocity.x : cells[i].velocity.y);
+            });
+            return;
+        case Field::Pressure:
+            fillPlane<float>(plane, encoding, data, region, [&](size_t i, int) {
+                return static_cast<float>(cells[i].pressure);
+            });
+            return;
+        case Field::Color:
+            fillPlane<uint32_t>(
+                plane, encoding, data, region, [&](size_t i, int) { return cells[i].getColor(); });
+            return;
+        case Field::OrganismId:
+            fillPlane<uint32_t>(plane, encoding, data, region, [&](size_t i, int) {
+                return hasOrganismIds ? static_cast<uint32_t>(data.organism_ids[i].get()) : 0u;
+            });
+            return;
+    }
+}
+
+} // namespace
+
+void to_json(nlohmann::json& j, const Field& field)
+{
+    for (const auto& entry : kFieldNames) {
+        if (entry.field == field) {
+            j = entry.name;
+            return;
+        }
+    }
+    j = static_cast<int>(field);
+}
+
+void from_json(const nlohmann::json& j, Field& field)
+{
+    if (j.is_number()) {
+        field = static_cast<Field>(j.get<uint8_t>());
+        return;
+    }
+
+    const std::string name = j.get<std::string>();
+    for (const auto& entry : kFieldNames) {
+        if (name == entry.name) {
+            field = entry.field;
+            return;
+        }
+    }
+    throw std::runtime_error("Invalid StateRegionGet field: " + name);
+}
+
+void to_json(nlohmann::json& j, const Encoding& encoding)
+{
+    j = encoding == Encoding::Binary ? "binary" : "json";
+}
+
+void from_json(const nlohmann::json& j, Encoding& encoding)
+{
+    if (j.is_number()) {
+        encoding = static_cast<Encoding>(j.get<uint8_t>());
+        return;
+    }
+    encoding = j.get<std::string>() == "binary" ? Encoding::Binary : Encoding::Json;
+}
+
+int componentsPerCell(Field field)
+{
+    return field == Field::Velocity ? 2 : 1;
+}
+
+size_t bytesPerComponent(Field field)
+{
+    return field == Field::Material ? sizeof(uint8_t) : sizeof(uint32_t);
+}
+
+Response extractRegion(const WorldData& data, const Command& command)
+{
+    if (command.fields.empty()) {
+        return Response::error(ApiError{ "StateRegionGet requires at least one field" });
+    }
+
+    const int x0 = std::max(0, command.x);
+    const int y0 = std::max(0, command.y);
+    const int x1 = command.width > 0 ? std::min<int>(data.width, command.x + command.width)
+                                     : data.width;
+    const int y1 = command.height > 0 ? std::min<int>(data.height, command.y + command.height)
+                                      : data.height;
+    if (x1 <= x0 || y1 <= y0) {
+        return Response::error(ApiError{ "StateRegionGet region is outside the world" });
+    }
+
+    Okay okay{
+        .x = x0,
+        .y = y0,
+        .width = x1 - x0,
+        .height = y1 - y0,
+        .timestep = data.timestep,
+        .encoding = command.encoding,
+        .planes = {},
+    };
+
+    const Region region{ .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1 };
+    okay.planes.reserve(command.fields.size());
+    for (const Field field : command.fields) {
+        Plane& plane = okay.planes.emplace_back(Plane{ .field = field, .values = {}, .bytes = {} });
+        fillPlane(plane, command.encoding, data, region);
+    }
+
+    return Response::okay(std::move(okay));
+}
+
+nlohmann::json Command::toJson() const
+{
+    return ReflectSerializer::to_json(*this);
+}
+
+Command Command::fromJson(const nlohmann::json& j)
+{
+    return ReflectSerializer::from_json<Command>(j);
+}
+
+nlohmann::json Okay::toJson() const
+{
+    nlohmann::json j{
+        { "x", x },
+        { "y", y },
+        { "width", width },
+        { "height", height },
+        { "timestep", timestep },
+        { "encoding", encoding },
+    };
+
+    nlohmann::json planesJson = nlohmann::json::array();
+    for (const Plane& plane : planes) {
+        nlohmann::json planeJson{ { "field", plane.field } };
+        if (encoding == Encoding::Binary) {
+            planeJson["data"] = base64Encode(plane.bytes);
+        }
+        else {
+            planeJson["values"] = plane.values;
+        }
+        planesJson.push_back(std::move(planeJson));
+    }
+    j["planes"] = std::move(planesJson);
+    return j;
+}
+
+} // namespace StateRegionGet
+} // namespace Api
+} // namespace DirtSim
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "ApiError.h"
+#include "ApiMacros.h"
+#include "core/CommandWithCallback.h"
+#include "core/Result.h"
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+#include <zpp_bits.h>
+
+namespace DirtSim {
+
+struct WorldData;
+
+namespace Api {
+
+/**
+ * @brief Projected, columnar extraction of a world rectangle.
+ *
+ * StateGet ships every field of every cell. StateRegionGet returns one plane per
+ * requested field, row-major over the region, so bulk consumers (functional tests,
+ * dashboards) only pay for what they read. It is answered from the cached world
+ * snapshot on the read-only query workers and never touches the simulation.
+ */
+namespace StateRegionGet {
+
+DEFINE_API_NAME(StateRegionGet);
+
+struct Okay; // Forward declaration for API_COMMAND() macro.
+
+// Per-cell fields a plane can carry. Binary element layout in parentheses.
+enum class Field : uint8_t {
+    Material = 0,   // Material enum value (u8).
+    Fill = 1,       // Fill ratio (f32).
+    Velocity = 2,   // Interleaved x, y (2 x f32).
+    Pressure = 3,   // Pressure (f32).
+    Color = 4,      // Lit color, packed RGBA (u32).
+    OrganismId = 5, // Owning organism, 0 when none (u32).
+};
+
+enum class Encoding : uint8_t {
+    Json = 0,   // Planes as arrays of numbers.
+    Binary = 1, // Planes as packed little-endian bytes (base64 in JSON responses).
+};
+
+void to_json(nlohmann::json& j, const Field& field);
+void from_json(const nlohmann::json& j, Field& field);
+void to_json(nlohmann::json& j, const Encoding& encoding);
+void from_json(const nlohmann::json& j, Encoding& encoding);
+
+// Number of values per cell in a plane.
+int componentsPerCell(Field field);
+
+// Size in bytes of one binary plane element.
+size_t bytesPerComponent(Field field);
+
+struct Command {
+    int x = 0;
+    int y = 0;
+    int width = 0;  // 0 extends the region to the right edge of the world.
+    int height = 0; // 0 extends the region to the bottom edge of the world.
+    std::vector<Field> fields = { Field::Material };
+    Encoding encoding = Encoding::Json;
+
+    API_COMMAND();
+    nlohmann::json toJson() const;
+    static Command fromJson(const nlohmann::json& j);
+
+    using serialize = zpp::bits::members<6>;
+};
+
+struct Plane {
+    Field field = Field::Material;
+    std::vector<double> values; // Json encoding: componentsPerCell() values per cell.
+    std::vector<uint8_t> bytes; // Binary encoding: packed elements, same order.
+
+    using serialize = zpp::bits::members<3>;
+};
+
+struct Okay {
+    int x = 0; // Region after clamping to the world.
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    int32_t timestep = 0;
+    Encoding encoding = Encoding::Json;
+    std::vector<Plane> planes; // One per requested field, in request order.
+
+    API_COMMAND_NAME();
+    nlohmann::json toJson() const;
+
+    using serialize = zpp::bits::members<7>;
+};
+
+using OkayType = Okay;
+using Response = Result<OkayType, ApiError>;
+using Cwc = CommandWithCallback<Command, Response>;
+
+// Builds the response for a command from a world snapshot; clamps the region to the grid.
+Response extractRegion(const WorldData& data, const Command& command);
+
+} // namespace StateRegionGet
+} // namespace Api
+} // namespace DirtSim
@@ -1,12 +1,16 @@
 #include "EvaluationExecutor.h"
+#include "EvaluationScheduler.h"
+#include "RemoteEvaluation.h"
 
 #include "core/Assert.h"
+#include "core/LoggingChannels.h"
 #include "core/PhysicsSettings.h"
 #include "core/Timers.h"
 #include "core/World.h"
 #include "core/organisms/evolution/FitnessResult.h"
 #include "core/organisms/evolution/GenomeRepository.h"
 #include "core/organisms/evolution/TrainingRunner.h"
+#include "core/organisms/evolution/TrainingWorldPool.h"
 #include "core/scenarios/nes/NesTileTokenizer.h"
 #include "core/scenarios/nes/NesTileTokenizerBootstrapper.h"
 
@@ -16,8 +20,10 @@
 #include <cmath>
 #include <condition_variable>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <thread>
 
 namespace DirtSim::Server::EvolutionSupport {
@@ -25,6 +31,28 @@ namespace DirtSim::Server::EvolutionSupport {
 namespace {
 
 constexpr size_t kTopCommandSignatureLimit = 20;
+constexpr size_t kWorldPoolEntriesPerWorker = 2;
+constexpr auto kRemoteRetryInitialDelay = std::chrono::seconds(1);
+constexpr auto kRemoteRetryMaxDelay = std::chrono::seconds(30);
+
+enum class SnapshotCapture : uint8_t {
+    Never = 0,
+    IfCandidateBest = 1,
+    Always = 2,
+};
+
+// Raises the running threshold when fitness could still become the generation's best.
+// Ties are kept, since the consumer keeps whichever equal result it drains first.
+bool snapshotThresholdClaim(std::atomic<double>& threshold, double fitness)
+{
+    double current = threshold.load();
+    while (fitness >= current) {
+        if (threshold.compare_exchange_weak(current, fitness)) {
+            return true;
+        }
+    }
+    return false;
+}
 
 bool isDuckClockScenario(OrganismType organismType, Scenario::EnumType scenarioId)
 {
@@ -196,13 +224,38 @@ struct EvaluationPassResult {
     std::vector<std::pair<std::string, int>> topCommandOutcomeSignatures;
     std::optional<EvaluationSnapshot> snapshot;
     std::unordered_map<std::string, EvaluationTimerAggregate> timerStats;
+    // Runner construction through the final step; feeds the scheduler cost model.
+    double wallMs = 0.0;
 };
 
+struct EvaluationPassSeeds {
+    uint32_t spawnRngSeed = 0;
+    uint32_t worldRngSeed = 0;
+};
+
+struct DuckClockPassGroup;
+
 struct QueuedEvaluation {
     EvaluationRequest request;
     EvolutionConfig evolutionConfig;
     std::shared_ptr<NesTileTokenizer> nesTileTokenizer = nullptr;
     std::optional<ScenarioConfig> scenarioConfigOverride = std::nullopt;
+    // Set when this task is one pass of a split duck clock evaluation.
+    std::shared_ptr<DuckClockPassGroup> passGroup = nullptr;
+    int passOrdinal = 0;
+};
+
+// Shared by the passes of a duck clock evaluation that was split across workers.
+// The worker that finishes the last pass merges them.
+struct DuckClockPassGroup {
+    std::mutex mutex;
+    QueuedEvaluation queued;
+    std::optional<bool> primarySpawnSide;
+    std::vector<EvaluationPassSeeds> seeds;
+    std::vector<std::optional<CompletedEvaluation>> passResults;
+    int remainingPasses = 0;
+    bool includeGenerationDetails = false;
+    bool snapshotEligible = false;
 };
 
 struct VisibleEvaluationHandle {
@@ -252,7 +305,9 @@ EvaluationPassResult buildEvaluationPassResult(
     OrganismType organismType,
     const EvolutionConfig& evolutionConfig,
     const FitnessModelBundle& fitnessModel,
-    bool includeGenerationDetails)
+    bool includeGenerationDetails,
+    SnapshotCapture snapshotCapture,
+    std::atomic<double>* snapshotThreshold)
 {
     EvaluationPassResult pass;
     pass.commandsAccepted = status.commandsAccepted;
@@ -271,7 +326,15 @@ EvaluationPassResult buildEvaluationPassResult(
     if (const Timers* timers = runner.getTimers()) {
         pass.timerStats = collectTimerStats(*timers);
     }
-    pass.snapshot = buildEvaluationSnapshotForRunner(runner);
+
+    // Full WorldData copies are only worth making for results that can become the best.
+    const bool captureSnapshot = snapshotCapture == SnapshotCapture::Always
+        || (snapshotCapture == SnapshotCapture::IfCandidateBest && snapshotThreshold
+            && snapshotThresholdClaim(
+                *snapshotThreshold, pass.fitnessEvaluation.totalFitness));
+    if (captureSnapshot) {
+        pass.snapshot = buildEvaluationSnapshotForRunner(runner);
+    }
     return pass;
 }
 
@@ -284,9 +347,13 @@ std::optional<EvaluationPassResult> runEvaluationPass(
     const std::optional<ScenarioConfig>& scenarioConfigOverride,
     const std::shared_ptr<NesTileTokenizer>& nesTileTokenizer,
     std::optional<bool> duckClockSpawnLeftFirst,
+    std::optional<EvaluationPassSeeds> seeds,
     const FitnessModelBundle& fitnessModel,
     bool includeGenerationDetails,
+    SnapshotCapture snapshotCapture,
+    std::atomic<double>* snapshotThreshold,
     const std::shared_ptr<VisibleEvaluationHandle>& visibleHandle,
+    TrainingWorldPool* worldPool,
     std::atomic<bool>* stopRequested,
     std::condition_variable* pauseCv,
     std::mutex* pauseMutex,
@@ -296,16 +363,32 @@ std::optional<EvaluationPassResult> runEvaluationPass(
         .brainRegistry = brainRegistry,
         .nesTileTokenizer = nesTileTokenizer,
         .duckClockSpawnLeftFirst = duckClockSpawnLeftFirst,
-        .duckClockSpawnRngSeed = std::nullopt,
+        .duckClockSpawnRngSeed = seeds.has_value()
+            ? std::optional<uint32_t>(seeds->spawnRngSeed)
+            : std::nullopt,
         .nesRgbaOutputEnabled = visibleHandle != nullptr,
         .scenarioConfigOverride = scenarioConfigOverride,
+        .worldPool = worldPool,
+        .worldRngSeed = seeds.has_value() ? std::optional<uint32_t>(seeds->worldRngSeed)
+                                          : std::nullopt,
     };
+    const auto setupStart = std::chrono::steady_clock::now();
     TrainingRunner runner(
         trainingSpec,
         makeRunnerIndividual(individual),
         evolutionConfig,
         genomeRepository,
         runnerConfig);
+    if (World* world = runner.getWorld()) {
+        // Recorded in the World's timers so it shows up in the evaluation timerStats.
+        const double setupMs = std::chrono::duration<double, std::milli>(
+                                   std::chrono::steady_clock::now() - setupStart)
+                                   .count();
+        world->getTimers().addSample("evaluation_setup", setupMs);
+        world->getTimers().addSample(
+            runner.isWorldReusedFromPool() ? "evaluation_setup_pooled" : "evaluation_setup_fresh",
+            setupMs);
+    }
 
     if (visibleHandle) {
         std::lock_guard<std::mutex> lock(visibleHandle->mutex);
@@ -371,13 +454,19 @@ std::optional<EvaluationPassResult> runEvaluationPass(
         return std::nullopt;
     }
 
-    return buildEvaluationPassResult(
+    EvaluationPassResult pass = buildEvaluationPassResult(
         runner,
         status,
         trainingSpec.organismType,
         evolutionConfig,
         fitnessModel,
-        includeGenerationDetails);
+        includeGenerationDetails,
+        snapshotCapture,
+        snapshotThreshold);
+    pass.wallMs = std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - setupStart)
+                      .count();
+    return pass;
 }
 
 void mergeTimerStats(
@@ -466,7 +555,12 @@ const CompletedEvaluation& selectRepresentativeDuckClockPass(
                                                                                          : second;
 }
 
-CompletedEvaluation mergeDuckClockGenerationPasses(
+struct MergedDuckClockPasses {
+    CompletedEvaluation merged;
+    const CompletedEvaluation* representative = nullptr;
+};
+
+MergedDuckClockPasses mergeDuckClockGenerationPasses(
     const FitnessModelBundle& fitnessModel,
     const CompletedEvaluation& primaryPassOne,
     const CompletedEvaluation& oppositePassOne,
@@ -514,7 +608,7 @@ CompletedEvaluation mergeDuckClockGenerationPasses(
     mergeTimerStats(merged.timerStats, oppositePassOne.timerStats);
     mergeTimerStats(merged.timerStats, primaryPassTwo.timerStats);
     mergeTimerStats(merged.timerStats, oppositePassTwo.timerStats);
-    return merged;
+    return MergedDuckClockPasses{ .merged = std::move(merged), .representative = &representative };
 }
 
 } // namespace
@@ -526,7 +620,11 @@ struct EvaluationExecutor::Impl {
     int backgroundWorkerCount = 0;
     int maxParallelEvaluations = 1;
     std::vector<std::thread> workers;
-    std::deque<QueuedEvaluation> taskQueue;
+    std::atomic<int> remoteWorkersRunning{ 0 };
+    // scheduler, costModel, and scheduleTracker are guarded by taskMutex.
+    EvaluationScheduler<QueuedEvaluation> scheduler;
+    EvaluationCostModel costModel;
+    EvaluationScheduleTracker scheduleTracker;
     std::mutex taskMutex;
     std::condition_variable taskCv;
     std::deque<CompletedEvaluation> resultQueue;
@@ -538,10 +636,25 @@ struct EvaluationExecutor::Impl {
     std::atomic<int> allowedConcurrency{ 0 };
     std::atomic<int> activeEvaluations{ 0 };
     VisibleEvaluationState visible;
+    // One per background worker; only touched by that worker's thread.
+    std::vector<std::unique_ptr<TrainingWorldPool>> worldPools;
+    // Fitness a generation result must reach to keep its snapshot.
+    std::atomic<double> snapshotFitnessThreshold{ std::numeric_limits<double>::lowest() };
 };
 
 namespace {
 
+void resultQueuePush(EvaluationExecutor::Impl& impl, CompletedEvaluation result)
+{
+    {
+        std::lock_guard<std::mutex> lock(impl.resultMutex);
+        impl.resultQueue.push_back(std::move(result));
+    }
+    if (impl.config.resultReadyCallback) {
+        impl.config.resultReadyCallback();
+    }
+}
+
 std::shared_ptr<VisibleEvaluationHandle> visibleEvaluationTryClaim(
     EvaluationExecutor::Impl& impl, const QueuedEvaluation& queued)
 {
@@ -610,14 +723,174 @@ QueuedEvaluation visibleQueuedSnapshot(
     return handle->queued;
 }
 
+std::string evaluationCostKey(const EvaluationIndividual& individual)
+{
+    return Scenario::toString(individual.scenarioId) + "/" + individual.brainKind
+        + "/" + individual.brainVariant.value_or("");
+}
+
+double expectedTaskCostMsLocked(EvaluationExecutor::Impl& impl, const QueuedEvaluation& queued)
+{
+    const double passMs = impl.costModel.estimateMs(evaluationCostKey(queued.request.individual));
+    if (queued.passGroup) {
+        return passMs;
+    }
+    if (isDuckClockScenario(
+            impl.config.trainingSpec.organismType, queued.request.individual.scenarioId)) {
+        return passMs * duckClockPassCountForTask(queued.request.taskType);
+    }
+    return passMs;
+}
+
+void evaluationCostObserve(
+    EvaluationExecutor::Impl& impl, const EvaluationIndividual& individual, double passMs)
+{
+    std::lock_guard<std::mutex> lock(impl.taskMutex);
+    impl.costModel.observe(evaluationCostKey(individual), passMs);
+}
+
+void scheduleBatch(EvaluationExecutor::Impl& impl, std::vector<QueuedEvaluation> queuedEvaluations)
+{
+    std::vector<std::pair<QueuedEvaluation, double>> batch;
+    batch.reserve(queuedEvaluations.size());
+    for (auto& queued : queuedEvaluations) {
+        const double expectedMs = expectedTaskCostMsLocked(impl, queued);
+        batch.emplace_back(std::move(queued), expectedMs);
+    }
+    impl.scheduler.pushBatch(std::move(batch));
+}
+
+std::optional<CompletedEvaluation> finishDuckClockEvaluation(
+    EvaluationExecutor::Impl& impl,
+    const QueuedEvaluation& replayQueued,
+    std::vector<CompletedEvaluation>& passResults,
+    std::optional<bool> primarySpawnSide,
+    const std::vector<EvaluationPassSeeds>& passSeeds,
+    bool includeGenerationDetails,
+    bool snapshotEligible,
+    TrainingWorldPool& worldPool)
+{
+    DIRTSIM_ASSERT(passResults.size() == 4, "EvaluationExecutor: duck clock pass count must be 4");
+    MergedDuckClockPasses mergedPasses = mergeDuckClockGenerationPasses(
+        impl.config.fitnessModel, passResults[0], passResults[1], passResults[2], passResults[3]);
+    CompletedEvaluation merged = std::move(mergedPasses.merged);
+    if (!snapshotEligible
+        || !snapshotThresholdClaim(
+            impl.snapshotFitnessThreshold, merged.fitnessEvaluation.totalFitness)) {
+        return merged;
+    }
+
+    // Replay the representative pass from its seeds to capture its final world.
+    const int representativeOrdinal =
+        static_cast<int>(mergedPasses.representative - passResults.data());
+    std::optional<EvaluationPassResult> replay = runEvaluationPass(
+        impl.config.trainingSpec,
+        replayQueued.request.individual,
+        replayQueued.evolutionConfig,
+        *impl.config.genomeRepository,
+        impl.config.brainRegistry,
+        replayQueued.scenarioConfigOverride,
+        replayQueued.nesTileTokenizer,
+        resolveDuckClockSpawnSideForPass(primarySpawnSide, representativeOrdinal),
+        passSeeds[static_cast<size_t>(representativeOrdinal)],
+        impl.config.fitnessModel,
+        includeGenerationDetails,
+        SnapshotCapture::Always,
+        nullptr,
+        nullptr,
+        &worldPool,
+        &impl.stopRequested,
+        &impl.pauseCv,
+        &impl.pauseMutex,
+        &impl.paused);
+    if (!replay.has_value()) {
+        return std::nullopt;
+    }
+
+    merged.snapshot = std::move(replay->snapshot);
+    auto& replayStats = merged.timerStats["evaluation_snapshot_replay"];
+    const auto replayTotal = replay->timerStats.find("total_simulation");
+    if (replayTotal != replay->timerStats.end()) {
+        replayStats.totalMs += replayTotal->second.totalMs;
+    }
+    replayStats.calls++;
+    return merged;
+}
+
+// Runs one pass of a split duck clock evaluation. Returns the merged result from the
+// worker that completes the last pass.
+std::optional<CompletedEvaluation> runDuckClockPassTask(
+    EvaluationExecutor::Impl& impl, QueuedEvaluation task, TrainingWorldPool& worldPool)
+{
+    DuckClockPassGroup& group = *task.passGroup;
+    const int passOrdinal = task.passOrdinal;
+    std::optional<EvaluationPassResult> pass = runEvaluationPass(
+        impl.config.trainingSpec,
+        task.request.individual,
+        task.evolutionConfig,
+        *impl.config.genomeRepository,
+        impl.config.brainRegistry,
+        task.scenarioConfigOverride,
+        task.nesTileTokenizer,
+        resolveDuckClockSpawnSideForPass(group.primarySpawnSide, passOrdinal),
+        group.seeds[static_cast<size_t>(passOrdinal)],
+        impl.config.fitnessModel,
+        group.includeGenerationDetails,
+        SnapshotCapture::Never,
+        nullptr,
+        nullptr,
+        &worldPool,
+        &impl.stopRequested,
+        &impl.pauseCv,
+        &impl.pauseMutex,
+        &impl.paused);
+    if (!pass.has_value()) {
+        return std::nullopt;
+    }
+    evaluationCostObserve(impl, task.request.individual, pass->wallMs);
+
+    std::vector<CompletedEvaluation> passResults;
+    {
+        std::lock_guard<std::mutex> lock(group.mutex);
+        group.passResults[static_cast<size_t>(passOrdinal)] = buildCompletedEvaluationFromPass(
+            task.request, std::move(*pass), group.includeGenerationDetails);
+        if (--group.remainingPasses > 0) {
+            return std::nullopt;
+        }
+        passResults.reserve(group.passResults.size());
+        for (auto& passResult : group.passResults) {
+            passResults.push_back(std::move(passResult.value()));
+        }
+    }
+
+    return finishDuckClockEvaluation(
+        impl,
+        group.queued,
+        passResults,
+        group.primarySpawnSide,
+        group.seeds,
+        group.includeGenerationDetails,
+        group.snapshotEligible,
+        worldPool);
+}
+
 std::optional<CompletedEvaluation> runEvaluationTask(
-    EvaluationExecutor::Impl& impl, QueuedEvaluation queued)
+    EvaluationExecutor::Impl& impl,
+    QueuedEvaluation queued,
+    TrainingWorldPool& worldPool,
+    size_t workerIndex)
 {
     DIRTSIM_ASSERT(queued.request.index >= 0, "EvaluationExecutor: Invalid evaluation index");
     DIRTSIM_ASSERT(
         impl.config.genomeRepository != nullptr, "EvaluationExecutor: GenomeRepository missing");
 
-    const auto visibleHandle = visibleEvaluationTryClaim(impl, queued);
+    if (queued.passGroup) {
+        return runDuckClockPassTask(impl, std::move(queued), worldPool);
+    }
+
+    const auto visibleHandle = impl.config.visiblePreviewEnabled
+        ? visibleEvaluationTryClaim(impl, queued)
+        : nullptr;
     const auto finishResult =
         [&](CompletedEvaluation result) -> std::optional<CompletedEvaluation> {
         if (!visibleHandle) {
@@ -636,11 +909,63 @@ std::optional<CompletedEvaluation> runEvaluationTask(
     const QueuedEvaluation initialQueued = visibleQueuedSnapshot(visibleHandle, queued);
     const bool includeGenerationDetails =
         initialQueued.request.taskType == EvaluationTaskType::GenerationEval;
+    const bool duckClock = isDuckClockScenario(
+        impl.config.trainingSpec.organismType, initialQueued.request.individual.scenarioId);
+    // Individuals without a genome never become the pending best, so they never need a snapshot.
+    const bool snapshotEligible =
+        includeGenerationDetails && initialQueued.request.individual.genome.has_value();
     const std::optional<bool> primarySpawnSide = resolvePrimaryDuckClockSpawnSide(
         initialQueued.request.taskType,
         impl.config.trainingSpec.organismType,
         initialQueued.request.individual.scenarioId,
         initialQueued.request.robustSampleOrdinal);
+
+    // Duck clock passes are seeded so the representative pass can be replayed for its snapshot.
+    const int passCount = duckClock ? duckClockPassCountForTask(initialQueued.request.taskType) : 1;
+    std::mt19937 seedRng(std::random_device{}());
+    std::vector<EvaluationPassSeeds> passSeeds;
+    if (duckClock) {
+        passSeeds.reserve(static_cast<size_t>(passCount));
+        for (int passOrdinal = 0; passOrdinal < passCount; ++passOrdinal) {
+            passSeeds.push_back(
+                EvaluationPassSeeds{
+                    .spawnRngSeed = static_cast<uint32_t>(seedRng()),
+                    .worldRngSeed = static_cast<uint32_t>(seedRng()),
+                });
+        }
+    }
+
+    // Background duck clock evaluations are split so idle workers can take the later
+    // passes. Previews stay on one worker so they play back pass by pass.
+    if (duckClock && !visibleHandle) {
+        auto group = std::make_shared<DuckClockPassGroup>();
+        group->queued = initialQueued;
+        group->primarySpawnSide = primarySpawnSide;
+        group->seeds = passSeeds;
+        group->passResults.resize(static_cast<size_t>(passCount));
+        group->remainingPasses = passCount;
+        group->includeGenerationDetails = includeGenerationDetails;
+        group->snapshotEligible = snapshotEligible;
+
+        {
+            std::lock_guard<std::mutex> lock(impl.taskMutex);
+            for (int passOrdinal = 1; passOrdinal < passCount; ++passOrdinal) {
+                QueuedEvaluation passTask = initialQueued;
+                passTask.passGroup = group;
+                passTask.passOrdinal = passOrdinal;
+                const double expectedMs = expectedTaskCostMsLocked(impl, passTask);
+                impl.scheduler.pushToWorker(workerIndex, std::move(passTask), expectedMs);
+            }
+            impl.scheduleTracker.passesSplit(static_cast<uint32_t>(passCount - 1));
+        }
+        impl.taskCv.notify_all();
+
+        QueuedEvaluation firstPass = initialQueued;
+        firstPass.passGroup = std::move(group);
+        firstPass.passOrdinal = 0;
+        return runDuckClockPassTask(impl, std::move(firstPass), worldPool);
+    }
+
     std::optional<EvaluationPassResult> primaryPass = runEvaluationPass(
         impl.config.trainingSpec,
         initialQueued.request.individual,
@@ -650,9 +975,13 @@ std::optional<CompletedEvaluation> runEvaluationTask(
         initialQueued.scenarioConfigOverride,
         initialQueued.nesTileTokenizer,
         primarySpawnSide,
+        duckClock ? std::optional<EvaluationPassSeeds>(passSeeds[0]) : std::nullopt,
         impl.config.fitnessModel,
         includeGenerationDetails,
+        snapshotEligible && !duckClock ? SnapshotCapture::IfCandidateBest : SnapshotCapture::Never,
+        &impl.snapshotFitnessThreshold,
         visibleHandle,
+        &worldPool,
         &impl.stopRequested,
         &impl.pauseCv,
         &impl.pauseMutex,
@@ -661,15 +990,14 @@ std::optional<CompletedEvaluation> runEvaluationTask(
         visibleEvaluationRelease(impl, visibleHandle);
         return std::nullopt;
     }
+    evaluationCostObserve(impl, initialQueued.request.individual, primaryPass->wallMs);
 
     CompletedEvaluation result = buildCompletedEvaluationFromPass(
         initialQueued.request, std::move(*primaryPass), includeGenerationDetails);
-    if (!isDuckClockScenario(
-            impl.config.trainingSpec.organismType, initialQueued.request.individual.scenarioId)) {
+    if (!duckClock) {
         return finishResult(std::move(result));
     }
 
-    const int passCount = duckClockPassCountForTask(initialQueued.request.taskType);
     std::vector<CompletedEvaluation> passResults;
     passResults.reserve(static_cast<size_t>(passCount));
     passResults.push_back(std::move(result));
@@ -687,9 +1015,13 @@ std::optional<CompletedEvaluation> runEvaluationTask(
             passQueued.scenarioConfigOverride,
             passQueued.nesTileTokenizer,
             spawnSide,
+            passSeeds[static_cast<size_t>(passOrdinal)],
             impl.config.fitnessModel,
             includeGenerationDetails,
+            SnapshotCapture::Never,
+            nullptr,
             visibleHandle,
+            &worldPool,
             &impl.stopRequested,
             &impl.pauseCv,
             &impl.pauseMutex,
@@ -698,14 +1030,115 @@ std::optional<CompletedEvaluation> runEvaluationTask(
             visibleEvaluationRelease(impl, visibleHandle);
             return std::nullopt;
         }
+        evaluationCostObserve(impl, passQueued.request.individual, pass->wallMs);
         passResults.push_back(buildCompletedEvaluationFromPass(
             passQueued.request, std::move(*pass), includeGenerationDetails));
     }
 
-    DIRTSIM_ASSERT(passCount == 4, "EvaluationExecutor: duck clock pass count must be 4");
-    CompletedEvaluation merged = mergeDuckClockGenerationPasses(
-        impl.config.fitnessModel, passResults[0], passResults[1], passResults[2], passResults[3]);
-    return finishResult(std::move(merged));
+    std::optional<CompletedEvaluation> merged = finishDuckClockEvaluation(
+        impl,
+        visibleQueuedSnapshot(visibleHandle, queued),
+        passResults,
+        primarySpawnSide,
+        passSeeds,
+        includeGenerationDetails,
+        snapshotEligible,
+        worldPool);
+    if (!merged.has_value()) {
+        visibleEvaluationRelease(impl, visibleHandle);
+        return std::nullopt;
+    }
+    return finishResult(std::move(merged.value()));
+}
+
+// Split duck clock passes share state with local workers, so only whole tasks go remote.
+bool remoteEligible(const QueuedEvaluation& queued)
+{
+    return !queued.passGroup;
+}
+
+void remoteWorkerLoop(
+    EvaluationExecutor::Impl& impl, size_t workerIndex, RemoteEvaluationTransport& transport)
+{
+    auto retryDelay = std::chrono::duration_cast<std::chrono::milliseconds>(
+        kRemoteRetryInitialDelay);
+    while (true) {
+        QueuedEvaluation task;
+        {
+            std::unique_lock<std::mutex> lock(impl.taskMutex);
+            impl.taskCv.wait(lock, [&impl]() {
+                return impl.stopRequested || impl.scheduler.anyOf(remoteEligible);
+            });
+            if (impl.stopRequested) {
+                return;
+            }
+            auto taken = impl.scheduler.takeIf(workerIndex, remoteEligible);
+            if (!taken.has_value()) {
+                continue;
+            }
+            if (taken->stolen) {
+                impl.scheduleTracker.taskStolen();
+            }
+            task = std::move(taken->task);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(impl.pauseMutex);
+            impl.pauseCv.wait(
+                lock, [&impl]() { return !impl.paused || impl.stopRequested.load(); });
+        }
+        if (impl.stopRequested) {
+            return;
+        }
+
+        auto response = transport.run(
+            remoteEvaluationCommandMake(
+                impl.config.trainingSpec,
+                task.request,
+                task.evolutionConfig,
+                task.scenarioConfigOverride),
+            impl.config.remoteTimeoutMs);
+        if (impl.stopRequested) {
+            return;
+        }
+
+        if (response.isValue()) {
+            retryDelay =
+                std::chrono::duration_cast<std::chrono::milliseconds>(kRemoteRetryInitialDelay);
+            {
+                std::lock_guard<std::mutex> lock(impl.taskMutex);
+                impl.scheduleTracker.remoteTaskFinished();
+            }
+            resultQueuePush(
+                impl, remoteEvaluationResultFromOkay(task.request, std::move(response).value()));
+            continue;
+        }
+
+        LOG_WARN(
+            Network,
+            "EvaluationExecutor: Peer {} failed eval {}, re-queueing: {}",
+            transport.describe(),
+            task.request.index,
+            response.errorValue());
+        {
+            std::unique_lock<std::mutex> lock(impl.taskMutex);
+            const double expectedMs = expectedTaskCostMsLocked(impl, task);
+            std::vector<std::pair<QueuedEvaluation, double>> requeue;
+            requeue.emplace_back(std::move(task), expectedMs);
+            impl.scheduler.pushBatch(std::move(requeue));
+            impl.scheduleTracker.remoteTaskRequeued();
+            impl.taskCv.notify_all();
+
+            // Back off so a lost peer does not keep pulling tasks away from local workers.
+            impl.taskCv.wait_for(lock, retryDelay, [&impl]() { return impl.stopRequested.load(); });
+            if (impl.stopRequested) {
+                return;
+            }
+        }
+        retryDelay = std::min(
+            retryDelay * 2,
+            std::chrono::duration_cast<std::chrono::milliseconds>(kRemoteRetryMaxDelay));
+    }
 }
 
 QueuedEvaluation queuedEvaluationMake(
@@ -760,33 +1193,61 @@ void EvaluationExecutor::start(int maxParallelEvaluations)
     impl_->paused = false;
     impl_->stopRequested.store(false);
     impl_->visible.reset();
+    impl_->snapshotFitnessThreshold.store(std::numeric_limits<double>::lowest());
+
+    {
+        std::lock_guard<std::mutex> lock(impl_->taskMutex);
+        impl_->scheduler.resize(
+            static_cast<size_t>(impl_->backgroundWorkerCount)
+            + impl_->config.remoteTransports.size());
+        impl_->scheduleTracker = EvaluationScheduleTracker{};
+    }
 
     impl_->workers.reserve(impl_->backgroundWorkerCount);
+    impl_->worldPools.clear();
+    for (int i = 0; i < impl_->backgroundWorkerCount; ++i) {
+        impl_->worldPools.push_back(
+            std::make_unique<TrainingWorldPool>(kWorldPoolEntriesPerWorker));
+    }
     Impl* state = impl_.get();
     for (int i = 0; i < impl_->backgroundWorkerCount; ++i) {
-        impl_->workers.emplace_back([state]() {
+        const size_t workerIndex = static_cast<size_t>(i);
+        TrainingWorldPool* worldPool = impl_->worldPools[workerIndex].get();
+        impl_->workers.emplace_back([state, worldPool, workerIndex]() {
             while (true) {
                 QueuedEvaluation task;
                 {
                     std::unique_lock<std::mutex> lock(state->taskMutex);
                     state->taskCv.wait(lock, [state]() {
                         return state->stopRequested
-                            || (!state->taskQueue.empty()
+                            || (!state->scheduler.empty()
                                 && state->activeEvaluations.load()
                                     < state->allowedConcurrency.load());
                     });
                     if (state->stopRequested) {
                         return;
                     }
-                    task = std::move(state->taskQueue.front());
-                    state->taskQueue.pop_front();
+                    auto taken = state->scheduler.take(workerIndex);
+                    if (taken->stolen) {
+                        state->scheduleTracker.taskStolen();
+                    }
+                    task = std::move(taken->task);
                     state->activeEvaluations.fetch_add(1);
                 }
 
+                const auto taskStart = std::chrono::steady_clock::now();
                 std::optional<CompletedEvaluation> result =
-                    runEvaluationTask(*state, std::move(task));
+                    runEvaluationTask(*state, std::move(task), *worldPool, workerIndex);
+                const auto taskEnd = std::chrono::steady_clock::now();
 
                 state->activeEvaluations.fetch_sub(1);
+                {
+                    std::lock_guard<std::mutex> lock(state->taskMutex);
+                    state->scheduleTracker.taskFinished(taskStart, taskEnd);
+                    if (state->scheduler.empty() && state->activeEvaluations.load() > 0) {
+                        state->scheduleTracker.workerStarved(taskEnd);
+                    }
+                }
                 state->taskCv.notify_one();
 
                 if (state->stopRequested) {
@@ -794,12 +1255,23 @@ void EvaluationExecutor::start(int maxParallelEvaluations)
                 }
 
                 if (result.has_value()) {
-                    std::lock_guard<std::mutex> lock(state->resultMutex);
-                    state->resultQueue.push_back(std::move(*result));
+                    resultQueuePush(*state, std::move(*result));
                 }
             }
         });
     }
+
+    // Remote workers own the scheduler deques after the local ones.
+    for (size_t r = 0; r < impl_->config.remoteTransports.size(); ++r) {
+        const size_t workerIndex = static_cast<size_t>(impl_->backgroundWorkerCount) + r;
+        RemoteEvaluationTransport* transport = impl_->config.remoteTransports[r].get();
+        DIRTSIM_ASSERT(transport != nullptr, "EvaluationExecutor: Null remote transport");
+        impl_->remoteWorkersRunning.fetch_add(1);
+        impl_->workers.emplace_back([state, workerIndex, transport]() {
+            remoteWorkerLoop(*state, workerIndex, *transport);
+            state->remoteWorkersRunning.fetch_sub(1);
+        });
+    }
 }
 
 void EvaluationExecutor::stop()
@@ -816,12 +1288,21 @@ void EvaluationExecutor::stop()
     impl_->pauseCv.notify_all();
     impl_->taskCv.notify_all();
 
+    // A cancel can land just before a remote worker sends, so repeat until they all exit.
+    while (impl_->remoteWorkersRunning.load() > 0) {
+        for (const auto& transport : impl_->config.remoteTransports) {
+            transport->cancel();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
     for (auto& worker : impl_->workers) {
         if (worker.joinable()) {
             worker.join();
         }
     }
     impl_->workers.clear();
+    impl_->worldPools.clear();
     impl_->backgroundWorkerCount = 0;
     impl_->maxParallelEvaluations = 1;
     impl_->allowedConcurrency.store(0);
@@ -829,7 +1310,7 @@ void EvaluationExecutor::stop()
 
     {
         std::lock_guard<std::mutex> lock(impl_->taskMutex);
-        impl_->taskQueue.clear();
+        impl_->scheduler.clear();
     }
     {
         std::lock_guard<std::mutex> lock(impl_->resultMutex);
@@ -867,16 +1348,45 @@ void EvaluationExecutor::generationBatchSubmit(
 
     {
         std::lock_guard<std::mutex> lock(impl_->taskMutex);
-        impl_->taskQueue.clear();
+        impl_->scheduler.clear();
+        impl_->scheduleTracker.windowStart(
+            std::chrono::steady_clock::now(), impl_->backgroundWorkerCount);
+        scheduleBatch(*impl_, std::move(queuedEvaluations));
+    }
 
-        for (auto& queued : queuedEvaluations) {
-            impl_->taskQueue.push_back(std::move(queued));
-        }
+    impl_->taskCv.notify_all();
+}
+
+void EvaluationExecutor::evaluationSubmit(
+    const EvaluationRequest& request,
+    const EvolutionConfig& evolutionConfig,
+    const std::optional<ScenarioConfig>& scenarioConfigOverride)
+{
+    std::vector<QueuedEvaluation> queuedEvaluations;
+    {
+        std::lock_guard<std::mutex> lock(impl_->taskMutex);
+        // Keep the tokenizer so later submissions for the same scenario reuse it.
+        std::optional<Scenario::EnumType> sharedNesTileScenarioId = impl_->config.nesTileTokenizer
+            ? std::optional<Scenario::EnumType>(impl_->config.trainingSpec.scenarioId)
+            : std::nullopt;
+        auto nesTileTokenizer = resolveNesTileTokenizerForQueuedRequest(
+            request,
+            scenarioConfigOverride,
+            impl_->config.nesTileTokenizer,
+            sharedNesTileScenarioId);
+        queuedEvaluations.push_back(queuedEvaluationMake(
+            request, evolutionConfig, scenarioConfigOverride, std::move(nesTileTokenizer)));
+        scheduleBatch(*impl_, std::move(queuedEvaluations));
     }
 
     impl_->taskCv.notify_all();
 }
 
+void EvaluationExecutor::snapshotFitnessThresholdSet(double threshold)
+{
+    impl_->snapshotFitnessThreshold.store(threshold);
+}
+
 void EvaluationExecutor::robustnessPassSubmit(
     const EvaluationRequest& request,
     int targetEvalCount,
@@ -909,9 +1419,7 @@ void EvaluationExecutor::robustnessPassSubmit(
 
     {
         std::lock_guard<std::mutex> lock(impl_->taskMutex);
-        for (auto& queued : queuedEvaluations) {
-            impl_->taskQueue.push_back(std::move(queued));
-        }
+        scheduleBatch(*impl_, std::move(queuedEvaluations));
     }
 
     impl_->taskCv.notify_all();
@@ -928,11 +1436,12 @@ std::optional<std::string> EvaluationExecutor::scenarioConfigOverrideSet(
     {
         std::lock_guard<std::mutex> lock(impl_->taskMutex);
         std::shared_ptr<NesTileTokenizer> sharedNesTileTokenizer = nullptr;
-        const bool needsNesTileTokenizer = std::any_of(
-            impl_->taskQueue.begin(), impl_->taskQueue.end(), [scenarioId](const auto& queued) {
-                return queued.request.individual.scenarioId == scenarioId
-                    && requiresNesTileTokenizer(queued.request.individual);
-            });
+        bool needsNesTileTokenizer = false;
+        impl_->scheduler.forEach([scenarioId, &needsNesTileTokenizer](const auto& queued) {
+            needsNesTileTokenizer = needsNesTileTokenizer
+                || (queued.request.individual.scenarioId == scenarioId
+                    && requiresNesTileTokenizer(queued.request.individual));
+        });
         if (needsNesTileTokenizer) {
             auto tokenizerResult =
                 NesTileTokenizerBootstrapper::build(scenarioId, scenarioConfigOverride);
@@ -943,14 +1452,16 @@ std::optional<std::string> EvaluationExecutor::scenarioConfigOverrideSet(
             impl_->config.nesTileTokenizer = sharedNesTileTokenizer;
         }
 
-        for (auto& queued : impl_->taskQueue) {
-            if (queued.request.individual.scenarioId == scenarioId) {
-                queued.scenarioConfigOverride = scenarioConfigOverride;
-                queued.nesTileTokenizer = requiresNesTileTokenizer(queued.request.individual)
-                    ? sharedNesTileTokenizer
-                    : nullptr;
+        impl_->scheduler.forEach([&](QueuedEvaluation& queued) {
+            // Split passes keep the config their evaluation started with.
+            if (queued.passGroup || queued.request.individual.scenarioId != scenarioId) {
+                return;
             }
-        }
+            queued.scenarioConfigOverride = scenarioConfigOverride;
+            queued.nesTileTokenizer = requiresNesTileTokenizer(queued.request.individual)
+                ? sharedNesTileTokenizer
+                : nullptr;
+        });
     }
 
     std::shared_ptr<VisibleEvaluationHandle> activeHandle;
@@ -1064,6 +1575,12 @@ VisibleTickResult EvaluationExecutor::visibleTick(
     return result;
 }
 
+EvaluationScheduleStats EvaluationExecutor::scheduleStatsGet() const
+{
+    std::lock_guard<std::mutex> lock(impl_->taskMutex);
+    return impl_->scheduleTracker.stats();
+}
+
 int EvaluationExecutor::activeEvaluationsGet() const
 {
     return impl_->activeEvaluations.load();
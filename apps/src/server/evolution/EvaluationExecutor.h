@@ -9,11 +9,13 @@
 #include "core/organisms/evolution/TrainingBrainRegistry.h"
 #include "core/organisms/evolution/TrainingSpec.h"
 #include "core/scenarios/nes/NesControllerTelemetry.h"
+#include "server/evolution/EvaluationScheduler.h"
 #include "server/evolution/FitnessEvaluation.h"
 #include "server/evolution/FitnessModelBundle.h"
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
@@ -29,6 +31,8 @@ class NesTileTokenizer;
 
 namespace Server::EvolutionSupport {
 
+class RemoteEvaluationTransport;
+
 enum class EvaluationTaskType : uint8_t {
     GenerationEval = 0,
     RobustnessEval = 1,
@@ -100,6 +104,13 @@ public:
         GenomeRepository* genomeRepository = nullptr;
         FitnessModelBundle fitnessModel;
         std::shared_ptr<NesTileTokenizer> nesTileTokenizer = nullptr;
+        // When false, no worker claims the visible preview slot.
+        bool visiblePreviewEnabled = true;
+        // Peer evaluation slots; each gets a worker that ships whole tasks to its peer.
+        std::vector<std::shared_ptr<RemoteEvaluationTransport>> remoteTransports = {};
+        int remoteTimeoutMs = 300000;
+        // Called on a worker thread after each result is queued for completedDrain().
+        std::function<void()> resultReadyCallback = nullptr;
     };
 
     explicit EvaluationExecutor(Config config);
@@ -118,6 +129,16 @@ public:
         const EvolutionConfig& evolutionConfig,
         const std::optional<ScenarioConfig>& scenarioConfigOverride);
 
+    // Appends one evaluation to the queue without resetting the current batch.
+    void evaluationSubmit(
+        const EvaluationRequest& request,
+        const EvolutionConfig& evolutionConfig,
+        const std::optional<ScenarioConfig>& scenarioConfigOverride);
+
+    // Generation results only carry a snapshot when their fitness reaches this running
+    // threshold, which workers raise as candidates complete. start() resets it to lowest().
+    void snapshotFitnessThresholdSet(double threshold);
+
     void robustnessPassSubmit(
         const EvaluationRequest& request,
         int targetEvalCount,
@@ -135,6 +156,9 @@ public:
     std::unordered_map<std::string, EvaluationTimerAggregate> visibleTimerStatsCollect() const;
     VisibleTickResult visibleTick(std::chrono::steady_clock::time_point now, int streamIntervalMs);
 
+    // Utilization of the worker pool since the last generation batch was submitted.
+    EvaluationScheduleStats scheduleStatsGet() const;
+
     int activeEvaluationsGet() const;
     int allowedConcurrencyGet() const;
     void allowedConcurrencySet(int allowedConcurrency);
@@ -0,0 +1,94 @@
+#include "EvaluationScheduler.h"
+
+namespace DirtSim::Server::EvolutionSupport {
+
+double EvaluationCostModel::estimateMs(const std::string& key) const
+{
+    const auto it = passMs_.find(key);
+    if (it != passMs_.end()) {
+        return it->second;
+    }
+    if (passMs_.empty()) {
+        return kDefaultPassMs;
+    }
+
+    double sum = 0.0;
+    for (const auto& [name, passMs] : passMs_) {
+        sum += passMs;
+    }
+    return sum / static_cast<double>(passMs_.size());
+}
+
+void EvaluationCostModel::observe(const std::string& key, double passMs)
+{
+    if (passMs < 0.0) {
+        return;
+    }
+
+    const auto [it, inserted] = passMs_.try_emplace(key, passMs);
+    if (!inserted) {
+        it->second += kSmoothing * (passMs - it->second);
+    }
+}
+
+void EvaluationCostModel::clear()
+{
+    passMs_.clear();
+}
+
+void EvaluationScheduleTracker::windowStart(Clock::time_point now, int workerCount)
+{
+    *this = EvaluationScheduleTracker{};
+    windowStart_ = now;
+    workerCount_ = workerCount;
+}
+
+void EvaluationScheduleTracker::taskFinished(Clock::time_point start, Clock::time_point end)
+{
+    if (!windowStart_.has_value()) {
+        return;
+    }
+
+    busyMs_ += std::chrono::duration<double, std::milli>(end - start).count();
+    completedTasks_++;
+    if (!lastCompletion_.has_value() || end > lastCompletion_.value()) {
+        lastCompletion_ = end;
+    }
+}
+
+void EvaluationScheduleTracker::workerStarved(Clock::time_point now)
+{
+    if (windowStart_.has_value() && !firstStarved_.has_value()) {
+        firstStarved_ = now;
+    }
+}
+
+EvaluationScheduleStats EvaluationScheduleTracker::stats() const
+{
+    EvaluationScheduleStats stats{
+        .busyMs = busyMs_,
+        .completedTasks = completedTasks_,
+        .stolenTasks = stolenTasks_,
+        .splitPasses = splitPasses_,
+        .remoteTasks = remoteTasks_,
+        .remoteRequeues = remoteRequeues_,
+    };
+    if (!windowStart_.has_value() || !lastCompletion_.has_value()) {
+        return stats;
+    }
+
+    stats.wallMs =
+        std::chrono::duration<double, std::milli>(lastCompletion_.value() - windowStart_.value())
+            .count();
+    if (stats.wallMs > 0.0 && workerCount_ > 0) {
+        stats.coreUtilization = busyMs_ / (stats.wallMs * static_cast<double>(workerCount_));
+    }
+    if (firstStarved_.has_value() && lastCompletion_.value() > firstStarved_.value()) {
+        stats.tailIdleMs = std::chrono::duration<double, std::milli>(
+                               lastCompletion_.value() - firstStarved_.value())
+                               .count();
+    }
+    return stats;
+}
+
+} // namespace DirtSim::Server::EvolutionSupport
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace DirtSim::Server::EvolutionSupport {
+
+struct EvaluationScheduleStats {
+    double wallMs = 0.0;          // Window start to the latest task completion.
+    double busyMs = 0.0;          // Task time summed across workers.
+    double coreUtilization = 0.0; // busyMs / (workers * wallMs).
+    double tailIdleMs = 0.0;      // First worker left without work to the latest completion.
+    uint32_t completedTasks = 0;
+    uint32_t stolenTasks = 0;
+    uint32_t splitPasses = 0;
+    uint32_t remoteTasks = 0;    // Completed by peer servers.
+    uint32_t remoteRequeues = 0; // Handed back to the queue after a peer failed or timed out.
+};
+
+/**
+ * Learned per-pass evaluation cost.
+ *
+ * Estimates are an exponential moving average of observed pass wall time per key.
+ * Unseen keys fall back to the mean of the known keys, so a mixed population orders
+ * sensibly once a few evaluations have completed.
+ */
+class EvaluationCostModel {
+public:
+    double estimateMs(const std::string& key) const;
+    void observe(const std::string& key, double passMs);
+    void clear();
+
+private:
+    static constexpr double kDefaultPassMs = 1.0;
+    static constexpr double kSmoothing = 0.25;
+
+    std::unordered_map<std::string, double> passMs_;
+};
+
+/**
+ * Tracks how well one scheduling window (a generation and its follow-up passes) kept
+ * the workers busy.
+ */
+class EvaluationScheduleTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void windowStart(Clock::time_point now, int workerCount);
+    void taskFinished(Clock::time_point start, Clock::time_point end);
+    // A worker found nothing left to run while other tasks were still in flight.
+    void workerStarved(Clock::time_point now);
+    void taskStolen() { stolenTasks_++; }
+    void passesSplit(uint32_t count) { splitPasses_ += count; }
+    void remoteTaskFinished() { remoteTasks_++; }
+    void remoteTaskRequeued() { remoteRequeues_++; }
+
+    EvaluationScheduleStats stats() const;
+
+private:
+    std::optional<Clock::time_point> windowStart_;
+    std::optional<Clock::time_point> lastCompletion_;
+    std::optional<Clock::time_point> firstStarved_;
+    int workerCount_ = 0;
+    double busyMs_ = 0.0;
+    uint32_t completedTasks_ = 0;
+    uint32_t stolenTasks_ = 0;
+    uint32_t splitPasses_ = 0;
+    uint32_t remoteTasks_ = 0;
+    uint32_t remoteRequeues_ = 0;
+};
+
+/**
+ * Per-worker task deques with longest-expected-first ordering and stealing.
+ *
+ * Batches are assigned greedily, longest task first, to the worker with the least
+ * expected work queued. Each deque stays sorted by expected cost, and a worker whose
+ * deque is empty steals the front of the deque with the most expected work left.
+ * Not thread-safe; the owner serializes access.
+ */
+template <typename Task>
+class EvaluationScheduler {
+public:
+    struct Taken {
+        Task task;
+        double expectedMs = 0.0;
+        bool stolen = false;
+    };
+
+    void resize(size_t workerCount)
+    {
+        clear();
+        workers_.resize(std::max<size_t>(1, workerCount));
+    }
+
+    void clear()
+    {
+        for (auto& worker : workers_) {
+            worker.entries.clear();
+            worker.expectedMs = 0.0;
+        }
+        queuedCount_ = 0;
+    }
+
+    bool empty() const { return queuedCount_ == 0; }
+    size_t queuedCount() const { return queuedCount_; }
+
+    void pushBatch(std::vector<std::pair<Task, double>> batch)
+    {
+        ensureWorker();
+        std::stable_sort(batch.begin(), batch.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second > rhs.second;
+        });
+        for (auto& [task, expectedMs] : batch) {
+            const auto leastLoaded = std::min_element(
+                workers_.begin(), workers_.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.expectedMs < rhs.expectedMs;
+                });
+            insertSorted(*leastLoaded, Entry{ .task = std::move(task), .expectedMs = expectedMs });
+        }
+    }
+
+    void pushToWorker(size_t workerIndex, Task task, double expectedMs)
+    {
+        ensureWorker();
+        insertSorted(
+            workers_[workerIndex % workers_.size()],
+            Entry{ .task = std::move(task), .expectedMs = expectedMs });
+    }
+
+    std::optional<Taken> take(size_t workerIndex)
+    {
+        if (queuedCount_ == 0) {
+            return std::nullopt;
+        }
+
+        WorkerQueue* source = &workers_[workerIndex % workers_.size()];
+        bool stolen = false;
+        if (source->entries.empty()) {
+            source = &*std::max_element(
+                workers_.begin(), workers_.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.expectedMs < rhs.expectedMs;
+                });
+            stolen = true;
+        }
+
+        return takeAt(*source, source->entries.begin(), stolen);
+    }
+
+    // Like take(), but only hands out tasks canRun accepts: the first eligible task in the
+    // worker's own deque, otherwise one stolen from the most loaded deque that holds any.
+    template <typename Pred>
+    std::optional<Taken> takeIf(size_t workerIndex, Pred&& canRun)
+    {
+        if (queuedCount_ == 0) {
+            return std::nullopt;
+        }
+
+        const auto eligible = [&canRun](const Entry& entry) { return canRun(entry.task); };
+        WorkerQueue& own = workers_[workerIndex % workers_.size()];
+        const auto ownEntry = std::find_if(own.entries.begin(), own.entries.end(), eligible);
+        if (ownEntry != own.entries.end()) {
+            return takeAt(own, ownEntry, false);
+        }
+
+        WorkerQueue* source = nullptr;
+        typename std::deque<Entry>::iterator sourceEntry;
+        for (auto& worker : workers_) {
+            if (source && worker.expectedMs <= source->expectedMs) {
+                continue;
+            }
+            const auto entry = std::find_if(worker.entries.begin(), worker.entries.end(), eligible);
+            if (entry != worker.entries.end()) {
+                source = &worker;
+                sourceEntry = entry;
+            }
+        }
+        if (!source) {
+            return std::nullopt;
+        }
+        return takeAt(*source, sourceEntry, true);
+    }
+
+    template <typename Pred>
+    bool anyOf(Pred&& pred) const
+    {
+        for (const auto& worker : workers_) {
+            for (const auto& entry : worker.entries) {
+                if (pred(entry.task)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn)
+    {
+        for (auto& worker : workers_) {
+            for (auto& entry : worker.entries) {
+                fn(entry.task);
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        Task task;
+        double expectedMs = 0.0;
+    };
+
+    struct WorkerQueue {
+        std::deque<Entry> entries;
+        double expectedMs = 0.0;
+    };
+
+    std::vector<WorkerQueue> workers_;
+    size_t queuedCount_ = 0;
+
+    void ensureWorker()
+    {
+        if (workers_.empty()) {
+            workers_.resize(1);
+        }
+    }
+
+    Taken takeAt(WorkerQueue& source, typename std::deque<Entry>::iterator entryIt, bool stolen)
+    {
+        Entry entry = std::move(*entryIt);
+        source.entries.erase(entryIt);
+        source.expectedMs =
+            source.entries.empty() ? 0.0 : std::max(0.0, source.expectedMs - entry.expectedMs);
+        queuedCount_--;
+        return Taken{
+            .task = std::move(entry.task),
+            .expectedMs = entry.expectedMs,
+            .stolen = stolen,
+        };
+    }
+
+    void insertSorted(WorkerQueue& worker, Entry entry)
+    {
+        // Equal costs keep submission order.
+        const auto position = std::find_if(
+            worker.entries.begin(), worker.entries.end(), [&entry](const Entry& queued) {
+                return queued.expectedMs < entry.expectedMs;
+            });
+        worker.expectedMs += entry.expectedMs;
+        worker.entries.insert(position, std::move(entry));
+        queuedCount_++;
+    }
+};
+
+} // namespace DirtSim::Server::EvolutionSupport
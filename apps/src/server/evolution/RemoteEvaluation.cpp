@@ -0,0 +1,486 @@
+#include "RemoteEvaluation.h"
+
+#include "core/Assert.h"
+#include "core/LoggingChannels.h"
+#include "core/ReflectSerializer.h"
+#include "core/network/WebSocketService.h"
+#include "core/organisms/evolution/GenomeRepository.h"
+#include "core/organisms/evolution/TrainingBrainRegistry.h"
+#include "os-manager/PeerTrust.h"
+#include "server/evolution/FitnessModelBundle.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <nlohmann/json.hpp>
+#include <sstream>
+
+namespace DirtSim::Server::EvolutionSupport {
+
+namespace {
+
+std::vector<Api::EvaluationRun::SignatureCount> signatureCountsMake(
+    const std::vector<std::pair<std::string, int>>& signatures)
+{
+    std::vector<Api::EvaluationRun::SignatureCount> counts;
+    counts.reserve(signatures.size());
+    for (const auto& [signature, count] : signatures) {
+        counts.push_back({ .signature = signature, .count = count });
+    }
+    return counts;
+}
+
+std::vector<std::pair<std::string, int>> signaturePairsMake(
+    std::vector<Api::EvaluationRun::SignatureCount> counts)
+{
+    std::vector<std::pair<std::string, int>> signatures;
+    signatures.reserve(counts.size());
+    for (auto& entry : counts) {
+        signatures.emplace_back(std::move(entry.signature), entry.count);
+    }
+    return signatures;
+}
+
+// Base64 body of an OpenSSH public key line ("type body [comment]"), or empty if malformed.
+std::string publicKeyBodyGet(const std::string& publicKey)
+{
+    std::istringstream stream(publicKey);
+    std::string keyType;
+    std::string keyBody;
+    stream >> keyType >> keyBody;
+    return keyBody;
+}
+
+std::string executorKey(const TrainingSpec& trainingSpec)
+{
+    return std::to_string(static_cast<int>(trainingSpec.organismType)) + "/"
+        + Scenario::toString(trainingSpec.scenarioId);
+}
+
+} // namespace
+
+Api::EvaluationRun::Command remoteEvaluationCommandMake(
+    const TrainingSpec& trainingSpec,
+    const EvaluationRequest& request,
+    const EvolutionConfig& evolutionConfig,
+    const std::optional<ScenarioConfig>& scenarioConfigOverride)
+{
+    Api::EvaluationRun::Command command{
+        .trainingSpec = trainingSpec,
+        .evolution = evolutionConfig,
+        .scenarioConfigOverride = scenarioConfigOverride,
+        .taskType = static_cast<uint8_t>(request.taskType),
+        .robustSampleOrdinal = request.robustSampleOrdinal,
+        .brainKind = request.individual.brainKind,
+        .brainVariant = request.individual.brainVariant,
+        .scenarioId = request.individual.scenarioId,
+        .genomeWeights = std::nullopt,
+        .peerClientPubkey = {},
+        .connectionId = {},
+    };
+    // The peer only needs the organism and scenario, not the seed population.
+    command.trainingSpec.population.clear();
+    if (request.individual.genome.has_value()) {
+        command.genomeWeights = request.individual.genome->weights;
+    }
+    return command;
+}
+
+EvaluationRequest remoteEvaluationRequestFromCommand(
+    const Api::EvaluationRun::Command& command, int index)
+{
+    EvaluationRequest request{
+        .taskType = static_cast<EvaluationTaskType>(command.taskType),
+        .index = index,
+        .robustSampleOrdinal = command.robustSampleOrdinal,
+        .individual =
+            EvaluationIndividual{
+                .brainKind = command.brainKind,
+                .brainVariant = command.brainVariant,
+                .scenarioId = command.scenarioId,
+                .genome = std::nullopt,
+            },
+    };
+    if (command.genomeWeights.has_value()) {
+        Genome genome;
+        genome.weights = *command.genomeWeights;
+        request.individual.genome = std::move(genome);
+    }
+    return request;
+}
+
+Api::EvaluationRun::Okay remoteEvaluationOkayMake(const CompletedEvaluation& result)
+{
+    Api::EvaluationRun::Okay okay{
+        .fitnessEvaluation = result.fitnessEvaluation,
+        .simTime = result.simTime,
+        .commandsAccepted = result.commandsAccepted,
+        .commandsRejected = result.commandsRejected,
+        .topCommandSignatures = signatureCountsMake(result.topCommandSignatures),
+        .topCommandOutcomeSignatures = signatureCountsMake(result.topCommandOutcomeSignatures),
+        .timers = {},
+    };
+    okay.timers.reserve(result.timerStats.size());
+    for (const auto& [name, timer] : result.timerStats) {
+        okay.timers.push_back({ .name = name, .totalMs = timer.totalMs, .calls = timer.calls });
+    }
+    return okay;
+}
+
+CompletedEvaluation remoteEvaluationResultFromOkay(
+    const EvaluationRequest& request, Api::EvaluationRun::Okay okay)
+{
+    CompletedEvaluation result{
+        .taskType = request.taskType,
+        .index = request.index,
+        .robustGeneration = request.robustGeneration,
+        .robustSampleOrdinal = request.robustSampleOrdinal,
+        .fitnessEvaluation = std::move(okay.fitnessEvaluation),
+        .simTime = okay.simTime,
+        .commandsAccepted = okay.commandsAccepted,
+        .commandsRejected = okay.commandsRejected,
+        .topCommandSignatures = signaturePairsMake(std::move(okay.topCommandSignatures)),
+        .topCommandOutcomeSignatures =
+            signaturePairsMake(std::move(okay.topCommandOutcomeSignatures)),
+        .snapshot = std::nullopt,
+        .timerStats = {},
+    };
+    for (auto& timer : okay.timers) {
+        result.timerStats[std::move(timer.name)] =
+            EvaluationTimerAggregate{ .totalMs = timer.totalMs, .calls = timer.calls };
+    }
+    return result;
+}
+
+// =============================================================================
+// RemoteEvaluationPeerTrust.
+// =============================================================================
+
+RemoteEvaluationPeerTrust::RemoteEvaluationPeerTrust(const std::vector<std::string>& clientPubkeys)
+{
+    for (const auto& publicKey : clientPubkeys) {
+        std::string body = publicKeyBodyGet(publicKey);
+        if (!body.empty()) {
+            keyBodies_.insert(std::move(body));
+        }
+    }
+}
+
+Result<RemoteEvaluationPeerTrust, std::string> RemoteEvaluationPeerTrust::load(
+    const std::filesystem::path& allowlistPath)
+{
+    using LoadResult = Result<RemoteEvaluationPeerTrust, std::string>;
+
+    std::ifstream file(allowlistPath);
+    if (!file) {
+        return LoadResult::error("Cannot open peer allowlist " + allowlistPath.string());
+    }
+
+    std::vector<OsManager::PeerTrustBundle> allowlist;
+    try {
+        const auto json = nlohmann::json::parse(file);
+        if (!json.is_array()) {
+            return LoadResult::error("Peer allowlist must be a JSON array");
+        }
+        // Same format os-manager writes; its json conversion lives in the os-manager binary.
+        for (const auto& entry : json) {
+            allowlist.push_back(ReflectSerializer::from_json<OsManager::PeerTrustBundle>(entry));
+        }
+    }
+    catch (const std::exception& e) {
+        return LoadResult::error(std::string("Failed to parse peer allowlist: ") + e.what());
+    }
+
+    std::vector<std::string> clientPubkeys;
+    clientPubkeys.reserve(allowlist.size());
+    for (const auto& bundle : allowlist) {
+        clientPubkeys.push_back(bundle.client_pubkey);
+    }
+    return LoadResult::okay(RemoteEvaluationPeerTrust(clientPubkeys));
+}
+
+bool RemoteEvaluationPeerTrust::isTrustedKey(const std::string& publicKey) const
+{
+    const std::string body = publicKeyBodyGet(publicKey);
+    return !body.empty() && keyBodies_.contains(body);
+}
+
+Result<std::string, ApiError> RemoteEvaluationPeerTrust::publicKeyRead(
+    const std::filesystem::path& path)
+{
+    using ReadResult = Result<std::string, ApiError>;
+
+    std::ifstream file(path);
+    if (!file) {
+        return ReadResult::error(ApiError("Cannot open peer key " + path.string()));
+    }
+    std::string line;
+    std::getline(file, line);
+    if (publicKeyBodyGet(line).empty()) {
+        return ReadResult::error(ApiError("Invalid public key in " + path.string()));
+    }
+    return ReadResult::okay(line);
+}
+
+// =============================================================================
+// WebSocketEvaluationTransport.
+// =============================================================================
+
+WebSocketEvaluationTransport::WebSocketEvaluationTransport(
+    std::string address, std::string clientPubkey)
+    : address_(std::move(address)),
+      clientPubkey_(std::move(clientPubkey)),
+      client_(std::make_unique<Network::WebSocketService>())
+{
+    client_->setProtocol(Network::Protocol::BINARY);
+}
+
+WebSocketEvaluationTransport::~WebSocketEvaluationTransport()
+{
+    client_->disconnect();
+}
+
+Result<Api::EvaluationRun::Okay, std::string> WebSocketEvaluationTransport::run(
+    const Api::EvaluationRun::Command& command, int timeoutMs)
+{
+    using RunResult = Result<Api::EvaluationRun::Okay, std::string>;
+
+    if (!client_->isConnected()) {
+        auto connectResult = client_->connect(address_, kConnectTimeoutMs);
+        if (connectResult.isError()) {
+            return RunResult::error("Connect failed: " + connectResult.errorValue());
+        }
+    }
+
+    Api::EvaluationRun::Command keyedCommand = command;
+    keyedCommand.peerClientPubkey = clientPubkey_;
+    auto response =
+        client_->sendCommandAndGetResponse<Api::EvaluationRun::Okay>(keyedCommand, timeoutMs);
+    if (response.isError()) {
+        // Drop the connection so a late reply cannot be matched to a later request.
+        client_->disconnect();
+        return RunResult::error(response.errorValue());
+    }
+    if (response.value().isError()) {
+        return RunResult::error(response.value().errorValue().message);
+    }
+    return RunResult::okay(std::move(response).value().value());
+}
+
+void WebSocketEvaluationTransport::cancel()
+{
+    client_->failPendingRequests("Cancelled");
+}
+
+std::string WebSocketEvaluationTransport::describe() const
+{
+    return address_;
+}
+
+// =============================================================================
+// RemoteEvaluationHost.
+// =============================================================================
+
+std::unique_ptr<EvaluationExecutor> remoteHostExecutorStart(
+    const TrainingSpec& trainingSpec,
+    GenomeRepository& genomeRepository,
+    int workerCount,
+    std::function<void()> resultReadyCallback)
+{
+    auto executor = std::make_unique<EvaluationExecutor>(
+        EvaluationExecutor::Config{
+            .trainingSpec = trainingSpec,
+            .brainRegistry = TrainingBrainRegistry::createDefault(),
+            .genomeRepository = &genomeRepository,
+            .fitnessModel = fitnessModelResolve(trainingSpec.organismType, trainingSpec.scenarioId),
+            .nesTileTokenizer = nullptr,
+            .visiblePreviewEnabled = false,
+            .resultReadyCallback = std::move(resultReadyCallback),
+        });
+    executor->start(workerCount);
+    // The coordinator keeps its own snapshots; never capture one here. Set after start(),
+    // which resets the threshold.
+    executor->snapshotFitnessThresholdSet(std::numeric_limits<double>::max());
+    return executor;
+}
+
+RemoteEvaluationHost::RemoteEvaluationHost(
+    GenomeRepository& genomeRepository, int workerCount, int maxExecutors)
+    : genomeRepository_(genomeRepository),
+      workerCount_(std::max(1, workerCount)),
+      maxExecutors_(std::max(1, maxExecutors))
+{
+    completionThread_ = std::thread([this]() { completionLoop(); });
+}
+
+RemoteEvaluationHost::~RemoteEvaluationHost()
+{
+    stop();
+}
+
+void RemoteEvaluationHost::submit(Api::EvaluationRun::Cwc cwc)
+{
+    std::vector<std::unique_ptr<EvaluationExecutor>> retired;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopRequested_) {
+            cwc.sendResponse(
+                Api::EvaluationRun::Response::error(ApiError{ "Remote evaluation host stopped" }));
+            return;
+        }
+
+        const std::string key = executorKey(cwc.command.trainingSpec);
+        HostExecutor& hostExecutor = executorForLocked(key, cwc.command.trainingSpec, retired);
+        const int ticket = nextTicket_++;
+        hostExecutor.executor->evaluationSubmit(
+            remoteEvaluationRequestFromCommand(cwc.command, ticket),
+            cwc.command.evolution,
+            cwc.command.scenarioConfigOverride);
+        hostExecutor.pendingCount++;
+        hostExecutor.lastUsed = ++useCounter_;
+        pending_.emplace(ticket, std::move(cwc));
+        concurrencyRebalanceLocked();
+    }
+
+    for (auto& executor : retired) {
+        executor->stop();
+    }
+}
+
+void RemoteEvaluationHost::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopRequested_) {
+            return;
+        }
+        stopRequested_ = true;
+    }
+    cv_.notify_all();
+    if (completionThread_.joinable()) {
+        completionThread_.join();
+    }
+
+    std::unordered_map<std::string, HostExecutor> executors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        executors.swap(executors_);
+    }
+    for (auto& [key, hostExecutor] : executors) {
+        hostExecutor.executor->stop();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [ticket, cwc] : pending_) {
+        cwc.sendResponse(
+            Api::EvaluationRun::Response::error(ApiError{ "Remote evaluation host stopped" }));
+    }
+    pending_.clear();
+}
+
+size_t RemoteEvaluationHost::executorCountGet() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return executors_.size();
+}
+
+size_t RemoteEvaluationHost::pendingCountGet() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+RemoteEvaluationHost::HostExecutor& RemoteEvaluationHost::executorForLocked(
+    const std::string& key,
+    const TrainingSpec& trainingSpec,
+    std::vector<std::unique_ptr<EvaluationExecutor>>& retired)
+{
+    auto it = executors_.find(key);
+    if (it != executors_.end()) {
+        return it->second;
+    }
+
+    while (static_cast<int>(executors_.size()) >= maxExecutors_) {
+        auto victim = executors_.end();
+        for (auto candidate = executors_.begin(); candidate != executors_.end(); ++candidate) {
+            if (candidate->second.pendingCount == 0
+                && (victim == executors_.end()
+                    || candidate->second.lastUsed < victim->second.lastUsed)) {
+                victim = candidate;
+            }
+        }
+        if (victim == executors_.end()) {
+            // Every executor is busy; run over the cap until one drains.
+            break;
+        }
+        LOG_INFO(Network, "RemoteEvaluationHost: evicting idle executor for {}", victim->first);
+        retired.push_back(std::move(victim->second.executor));
+        executors_.erase(victim);
+    }
+
+    auto executor = remoteHostExecutorStart(
+        trainingSpec, genomeRepository_, workerCount_, [this]() { resultReadyNotify(); });
+    LOG_INFO(Network, "RemoteEvaluationHost: started {} workers for {}", workerCount_, key);
+    return executors_.emplace(key, HostExecutor{ .executor = std::move(executor) }).first->second;
+}
+
+void RemoteEvaluationHost::concurrencyRebalanceLocked()
+{
+    int busyCount = 0;
+    for (const auto& [key, hostExecutor] : executors_) {
+        if (hostExecutor.pendingCount > 0) {
+            busyCount++;
+        }
+    }
+    const int share = std::max(1, workerCount_ / std::max(1, busyCount));
+    for (auto& [key, hostExecutor] : executors_) {
+        hostExecutor.executor->allowedConcurrencySet(
+            hostExecutor.pendingCount > 0 ? share : workerCount_);
+    }
+}
+
+void RemoteEvaluationHost::resultReadyNotify()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        resultsReady_ = true;
+    }
+    cv_.notify_all();
+}
+
+void RemoteEvaluationHost::completionLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stopRequested_ || resultsReady_; });
+        if (stopRequested_) {
+            return;
+        }
+        resultsReady_ = false;
+
+        std::vector<std::pair<Api::EvaluationRun::Cwc, Api::EvaluationRun::Okay>> finished;
+        for (auto& [key, hostExecutor] : executors_) {
+            for (const CompletedEvaluation& result : hostExecutor.executor->completedDrain()) {
+                auto it = pending_.find(result.index);
+                if (it == pending_.end()) {
+                    continue;
+                }
+                hostExecutor.pendingCount--;
+                finished.emplace_back(std::move(it->second), remoteEvaluationOkayMake(result));
+                pending_.erase(it);
+            }
+        }
+        if (finished.empty()) {
+            continue;
+        }
+        concurrencyRebalanceLocked();
+
+        lock.unlock();
+        for (auto& [cwc, okay] : finished) {
+            cwc.sendResponse(Api::EvaluationRun::Response::okay(std::move(okay)));
+        }
+        lock.lock();
+    }
+}
+
+} // namespace DirtSim::Server::EvolutionSupport
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "core/Result.h"
+#include "server/api/EvaluationRun.h"
+#include "server/evolution/EvaluationExecutor.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace DirtSim {
+
+class GenomeRepository;
+
+namespace Network {
+class WebSocketService;
+}
+
+namespace Server::EvolutionSupport {
+
+// Request/result conversion between executor tasks and the EvaluationRun wire format.
+Api::EvaluationRun::Command remoteEvaluationCommandMake(
+    const TrainingSpec& trainingSpec,
+    const EvaluationRequest& request,
+    const EvolutionConfig& evolutionConfig,
+    const std::optional<ScenarioConfig>& scenarioConfigOverride);
+EvaluationRequest remoteEvaluationRequestFromCommand(
+    const Api::EvaluationRun::Command& command, int index);
+Api::EvaluationRun::Okay remoteEvaluationOkayMake(const CompletedEvaluation& result);
+CompletedEvaluation remoteEvaluationResultFromOkay(
+    const EvaluationRequest& request, Api::EvaluationRun::Okay okay);
+
+/**
+ * One evaluation slot on a peer server. EvaluationExecutor runs a remote worker thread per
+ * transport; run() blocks that thread until the peer answers, fails, or times out.
+ */
+class RemoteEvaluationTransport {
+public:
+    virtual ~RemoteEvaluationTransport() = default;
+
+    virtual Result<Api::EvaluationRun::Okay, std::string> run(
+        const Api::EvaluationRun::Command& command, int timeoutMs) = 0;
+
+    // Abandons an in-flight run() from another thread.
+    virtual void cancel() = 0;
+
+    virtual std::string describe() const = 0;
+};
+
+// Transport over a dedicated binary WebSocket connection, reconnecting after failures.
+// Stamps each command with this server's peer client key so the peer can check it against
+// its allowlist; the address carries the peer's access token (ws://host:port/?token=...).
+class WebSocketEvaluationTransport : public RemoteEvaluationTransport {
+public:
+    WebSocketEvaluationTransport(std::string address, std::string clientPubkey);
+    ~WebSocketEvaluationTransport() override;
+
+    Result<Api::EvaluationRun::Okay, std::string> run(
+        const Api::EvaluationRun::Command& command, int timeoutMs) override;
+    void cancel() override;
+    std::string describe() const override;
+
+private:
+    static constexpr int kConnectTimeoutMs = 3000;
+
+    std::string address_;
+    std::string clientPubkey_;
+    std::unique_ptr<Network::WebSocketService> client_;
+};
+
+/**
+ * Coordinators allowed to run EvaluationRun here: those whose peer client key (sent in the
+ * command) is in the os-manager peer allowlist (OsManager::PeerTrustBundle, written by
+ * TrustPeer). Keys match on their base64 body, so the comment does not matter.
+ */
+class RemoteEvaluationPeerTrust {
+public:
+    RemoteEvaluationPeerTrust() = default;
+    explicit RemoteEvaluationPeerTrust(const std::vector<std::string>& clientPubkeys);
+
+    static Result<RemoteEvaluationPeerTrust, std::string> load(
+        const std::filesystem::path& allowlistPath);
+
+    bool isTrustedKey(const std::string& publicKey) const;
+
+    // First line of an OpenSSH public key file, e.g. os-manager's ssh/peer_ed25519.pub.
+    static Result<std::string, ApiError> publicKeyRead(const std::filesystem::path& path);
+
+private:
+    std::unordered_set<std::string> keyBodies_;
+};
+
+// Starts the executor a peer runs for one organism/scenario: no previews and no snapshots,
+// so duck clock merges never replay a pass either.
+std::unique_ptr<EvaluationExecutor> remoteHostExecutorStart(
+    const TrainingSpec& trainingSpec,
+    GenomeRepository& genomeRepository,
+    int workerCount,
+    std::function<void()> resultReadyCallback = nullptr);
+
+/**
+ * Peer-side runner for EvaluationRun commands.
+ *
+ * Keeps an EvaluationExecutor per organism/scenario pair, with previews and snapshots
+ * disabled, for at most maxExecutors pairs; a new pair evicts the least recently used idle
+ * executor. Busy executors split workerCount evaluations between them, so several pairs
+ * never oversubscribe the machine. Commands are queued from the network thread and
+ * answered from a completion thread woken by the executors, so neither the network nor the
+ * state machine waits on a simulation.
+ */
+class RemoteEvaluationHost {
+public:
+    static constexpr int kDefaultMaxExecutors = 2;
+
+    RemoteEvaluationHost(
+        GenomeRepository& genomeRepository,
+        int workerCount,
+        int maxExecutors = kDefaultMaxExecutors);
+    ~RemoteEvaluationHost();
+
+    RemoteEvaluationHost(const RemoteEvaluationHost&) = delete;
+    RemoteEvaluationHost& operator=(const RemoteEvaluationHost&) = delete;
+
+    void submit(Api::EvaluationRun::Cwc cwc);
+    void stop();
+
+    size_t executorCountGet() const;
+    size_t pendingCountGet() const;
+
+private:
+    struct HostExecutor {
+        std::unique_ptr<EvaluationExecutor> executor;
+        int pendingCount = 0;
+        uint64_t lastUsed = 0;
+    };
+
+    // Evicted executors go to retired; stop them after releasing mutex_, since their
+    // workers take it to report results.
+    HostExecutor& executorForLocked(
+        const std::string& key,
+        const TrainingSpec& trainingSpec,
+        std::vector<std::unique_ptr<EvaluationExecutor>>& retired);
+    void concurrencyRebalanceLocked();
+    void completionLoop();
+    void resultReadyNotify();
+
+    GenomeRepository& genomeRepository_;
+    int workerCount_ = 1;
+    int maxExecutors_ = kDefaultMaxExecutors;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, HostExecutor> executors_;
+    std::unordered_map<int, Api::EvaluationRun::Cwc> pending_; // By ticket.
+    int nextTicket_ = 0;
+    uint64_t useCounter_ = 0;
+    bool resultsReady_ = false;
+    bool stopRequested_ = false;
+    std::thread completionThread_;
+};
+
+} // namespace Server::EvolutionSupport
+} // namespace DirtSim
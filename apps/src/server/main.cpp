@@ -1,9 +1,12 @@
 #include "StateMachine.h"
 #include "core/ConfigLoader.h"
+#include "core/GlyphAtlas.h"
 #include "core/GridOfCells.h"
 #include "core/LoggingChannels.h"
 #include "core/Timers.h"
 #include "core/network/WebSocketService.h"
+#include "core/organisms/brains/WeightQuantization.h"
+#include "evolution/RemoteEvaluation.h"
 #include <args.hxx>
 #include <csignal>
 #include <memory>
@@ -64,11 +67,41 @@ int main(int argc, char** argv)
         "no-openmp",
         "Disable OpenMP parallelization (for testing/debugging)",
         { "no-openmp" });
+    args::ValueFlag<std::string> genomeWeightEncoding(
+        parser,
+        "encoding",
+        "Genome archive weight encoding: float32 (default), fp16, or int8",
+        { "genome-weight-encoding" });
     args::ValueFlag<std::string> configDir(
         parser,
         "config-dir",
         "Config directory (default: searches ./config/, ~/.config/dirtsim/, /etc/dirtsim/)",
         { "config-dir" });
+    args::ValueFlagList<std::string> evalPeers(
+        parser,
+        "url",
+        "Peer server to offload training evaluations to, e.g. ws://localhost:9001 (repeatable)",
+        { "eval-peer" });
+    args::ValueFlag<int> evalPeerSlots(
+        parser,
+        "count",
+        "Concurrent evaluations sent to each --eval-peer (default: 4)",
+        { "eval-peer-slots" });
+    args::ValueFlag<std::string> bindArg(
+        parser,
+        "address",
+        "Address to listen on (default: 127.0.0.1). Non-loopback clients need the access token",
+        { "bind" });
+    args::ValueFlag<std::string> peerAllowlistArg(
+        parser,
+        "path",
+        "os-manager peer-allowlist.json: coordinators whose peer key may run evaluations here",
+        { "peer-allowlist" });
+    args::ValueFlag<std::string> peerKeyArg(
+        parser,
+        "path",
+        "Public key sent to --eval-peer servers, e.g. os-manager's ssh/peer_ed25519.pub",
+        { "peer-key" });
 
     try {
         parser.ParseCLI(argc, argv);
@@ -85,6 +118,7 @@ int main(int argc, char** argv)
 
     uint16_t port = portArg ? args::get(portArg) : 8080;
     int maxSteps = stepsArg ? args::get(stepsArg) : -1;
+    const std::string bindAddress = bindArg ? args::get(bindArg) : "127.0.0.1";
 
     // Set up config loader with explicit directory if provided.
     if (configDir) {
@@ -92,6 +126,17 @@ int main(int argc, char** argv)
         spdlog::info("Config directory: {}", args::get(configDir));
     }
 
+    WeightEncoding weightEncoding = WeightEncoding::Float32;
+    if (genomeWeightEncoding) {
+        const auto encoding = parseWeightEncoding(args::get(genomeWeightEncoding));
+        if (!encoding.has_value()) {
+            std::cerr << "Unknown genome weight encoding: " << args::get(genomeWeightEncoding)
+                      << std::endl;
+            return 1;
+        }
+        weightEncoding = encoding.value();
+    }
+
     // Configure GridOfCells cache (default: enabled).
     GridOfCells::USE_CACHE = !gridCacheDisabled;
     spdlog::info("GridOfCells cache: {}", GridOfCells::USE_CACHE ? "ENABLED" : "DISABLED");
@@ -111,7 +156,7 @@ int main(int argc, char** argv)
     }
 
     spdlog::info("Starting Sparkle Duck WebSocket Server");
-    spdlog::info("Port: {}", port);
+    spdlog::info("Bind: {}:{}", bindAddress, port);
     if (maxSteps > 0) {
         spdlog::info("Max steps: {}", maxSteps);
     }
@@ -120,7 +165,7 @@ int main(int argc, char** argv)
     }
 
     // Create headless state machine. Config is loaded by Startup state.
-    auto stateMachine = std::make_unique<Server::StateMachine>();
+    auto stateMachine = std::make_unique<Server::StateMachine>(std::nullopt, weightEncoding);
     g_stateMachine = stateMachine.get();
 
     // Set up signal handler for graceful shutdown.
@@ -133,9 +178,37 @@ int main(int argc, char** argv)
     // Setup command handlers via state machine (also stores pointer).
     stateMachine->setupWebSocketService(service);
     stateMachine->setWebSocketPort(port);
+    stateMachine->setWebSocketBindAddress(bindAddress);
+
+    using Server::EvolutionSupport::RemoteEvaluationPeerTrust;
+    RemoteEvaluationPeerTrust peerTrust;
+    if (peerAllowlistArg) {
+        auto trustResult = RemoteEvaluationPeerTrust::load(args::get(peerAllowlistArg));
+        if (trustResult.isError()) {
+            spdlog::error("Failed to load peer allowlist: {}", trustResult.errorValue());
+            return 1;
+        }
+        peerTrust = std::move(trustResult).value();
+    }
+    stateMachine->setRemoteEvaluationPeerTrust(std::move(peerTrust));
+
+    if (evalPeers) {
+        std::string peerKey;
+        if (peerKeyArg) {
+            auto keyResult = RemoteEvaluationPeerTrust::publicKeyRead(args::get(peerKeyArg));
+            if (keyResult.isError()) {
+                spdlog::error("Failed to read peer key: {}", keyResult.errorValue().message);
+                return 1;
+            }
+            peerKey = std::move(keyResult).value();
+        }
+        const int slots = evalPeerSlots ? args::get(evalPeerSlots) : 4;
+        spdlog::info("Evaluation peers: {} ({} slots each)", args::get(evalPeers).size(), slots);
+        stateMachine->setRemoteEvaluationPeers(args::get(evalPeers), slots, std::move(peerKey));
+    }
 
     // Start listening for connections.
-    auto listenResult = service.listen(port, "127.0.0.1");
+    auto listenResult = service.listen(port, bindAddress);
     if (listenResult.isError()) {
         spdlog::error("Failed to start WebSocket service: {}", listenResult.errorValue());
         return 1;
@@ -150,6 +223,12 @@ int main(int argc, char** argv)
 
     // Cleanup.
     service.stopListening();
+    if (auto atlas = GlyphAtlas::shared(); atlas && atlas->isDirty()) {
+        auto saveResult = atlas->save();
+        if (saveResult.isError()) {
+            spdlog::warn("Failed to save glyph atlas: {}", saveResult.errorValue());
+        }
+    }
     spdlog::info("Server shut down cleanly");
 
     // Print timer statistics if requested.
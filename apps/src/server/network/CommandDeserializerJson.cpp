@@ -3,6 +3,7 @@
 #include "server/api/CellSet.h"
 #include "server/api/ClockEventTrigger.h"
 #include "server/api/DiagramGet.h"
+#include "server/api/EvaluationRun.h"
 #include "server/api/EventSubscribe.h"
 #include "server/api/EvolutionPauseSet.h"
 #include "server/api/Exit.h"
@@ -33,6 +34,7 @@
 #include "server/api/SimStop.h"
 #include "server/api/SpawnDirtBall.h"
 #include "server/api/StateGet.h"
+#include "server/api/StateRegionGet.h"
 #include "server/api/TimerStatsGet.h"
 #include "server/api/TrainingBestSnapshotGet.h"
 #include "server/api/TrainingResultDelete.h"
@@ -92,6 +94,9 @@ Result<ApiCommand, ApiError> CommandDeserializerJson::deserialize(const std::str
         else if (commandName == Api::DiagramGet::Command::name()) {
             return Result<ApiCommand, ApiError>::okay(Api::DiagramGet::Command::fromJson(cmd));
         }
+        else if (commandName == Api::EvaluationRun::Command::name()) {
+            return Result<ApiCommand, ApiError>::okay(Api::EvaluationRun::Command::fromJson(cmd));
+        }
         else if (commandName == Api::EventSubscribe::Command::name()) {
             return Result<ApiCommand, ApiError>::okay(Api::EventSubscribe::Command::fromJson(cmd));
         }
@@ -194,6 +199,9 @@ Result<ApiCommand, ApiError> CommandDeserializerJson::deserialize(const std::str
         else if (commandName == Api::StateGet::Command::name()) {
             return Result<ApiCommand, ApiError>::okay(Api::StateGet::Command::fromJson(cmd));
         }
+        else if (commandName == Api::StateRegionGet::Command::name()) {
+            return Result<ApiCommand, ApiError>::okay(Api::StateRegionGet::Command::fromJson(cmd));
+        }
         else if (commandName == Api::StatusGet::Command::name()) {
             return Result<ApiCommand, ApiError>::okay(Api::StatusGet::Command::fromJson(cmd));
         }
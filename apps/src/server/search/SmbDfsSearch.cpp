@@ -14,6 +14,7 @@
 #include <array>
 #include <cmath>
 #include <functional>
+#include <utility>
 
 namespace DirtSim::Server::SearchSupport {
 
@@ -147,6 +148,8 @@ Api::SearchProgressEvent toSearchProgressEvent(SmbDfsSearchTraceEventType eventT
             return Api::SearchProgressEvent::PrunedTransposition;
         case SmbDfsSearchTraceEventType::PrunedNonGameplay:
             return Api::SearchProgressEvent::PrunedNonGameplay;
+        case SmbDfsSearchTraceEventType::PrunedBeamWidth:
+            return Api::SearchProgressEvent::PrunedBeamWidth;
         case SmbDfsSearchTraceEventType::RootInitialized:
             return Api::SearchProgressEvent::RootInitialized;
         case SmbDfsSearchTraceEventType::Stopped:
@@ -304,10 +307,7 @@ Result<std::monostate, std::string> SmbDfsSearch::startDfs()
             buildSmbSearchEvaluatorSummary(evaluation.fitnessDetails, lastGameState);
         rootPrefixFrames_ = capturedPrefixFrames;
         return initializeRootNode(
-            savestate.value(),
-            evaluatorSummary,
-            stepResult.memorySnapshot.has_value() ? &stepResult.memorySnapshot.value() : nullptr,
-            stepResult.scenarioVideoFrame);
+            savestate.value(), evaluatorSummary, stepResult.scenarioVideoFrame);
     }
 
     return Result<std::monostate, std::string>::error("Timed out while preparing SMB DFS root");
@@ -330,11 +330,7 @@ Result<std::monostate, std::string> SmbDfsSearch::startFromFixture(
 
     rootPrefixFrames_ = makeRootPrefixFrames(fixture.evaluatorSummary.gameplayFrames);
     return initializeRootNode(
-        fixture.savestate,
-        fixture.evaluatorSummary,
-        fixture.memorySnapshot.has_value() ? &fixture.memorySnapshot.value() : nullptr,
-        fixture.scenarioVideoFrame.has_value() ? fixture.scenarioVideoFrame
-                                               : driver_->copyRuntimeFrameSnapshot());
+        fixture.savestate, fixture.evaluatorSummary, fixture.scenarioVideoFrame);
 }
 
 SmbDfsSearchTickResult SmbDfsSearch::tick()
@@ -360,9 +356,13 @@ SmbDfsSearchTickResult SmbDfsSearch::tick()
         };
     }
 
+    return options_.strategy == SmbSearchStrategy::BestFirst ? tickBestFirst() : tickDepthFirst();
+}
+
+SmbDfsSearchTickResult SmbDfsSearch::tickDepthFirst()
+{
     while (true) {
-        if (options_.maxSearchedNodeCount > 0
-            && progress_.searchedNodeCount >= options_.maxSearchedNodeCount) {
+        if (isBudgetExceeded()) {
             completeWithTraceEvent(SmbDfsSearchTraceEventType::CompletedBudgetExceeded);
             return SmbDfsSearchTickResult{ .completed = true };
         }
@@ -405,7 +405,9 @@ SmbDfsSearchTickResult SmbDfsSearch::tick()
             progress_.lastSearchEvent = Api::SearchProgressEvent::Backtracked;
             if (!dfsStack_.empty()) {
                 noteChildOutcome(dfsStack_.back(), exhaustedOutcome, exhaustedBlockReason);
-                updateRenderableState(nodes_[dfsStack_.back().nodeIndex]);
+                // The parent's frame is not kept, so only the timestep moves back.
+                updateRenderableState(
+                    nodes_[dfsStack_.back().nodeIndex].gameplayFrame, std::nullopt);
                 return SmbDfsSearchTickResult{
                     .renderChanged = true,
                 };
@@ -413,242 +415,307 @@ SmbDfsSearchTickResult SmbDfsSearch::tick()
             continue;
         }
 
-        const size_t parentIndex = dfsFrame.nodeIndex;
-        const uint8_t actionOrderIndex = dfsFrame.nextActionIndex;
-        const SmbSearchLegalAction action =
-            dfsFrame.actionOrdering.actions[dfsFrame.nextActionIndex++];
-        const bool groundedVerticalJumpPriorityAction =
-            actionOrderIndex < dfsFrame.actionOrdering.groundedVerticalJumpPriorityActionCount;
-        const SmbSearchNode& parent = nodes_[parentIndex];
-        const uint64_t parentCurrentFrontier = parent.currentFrontier;
-        const uint8_t parentPlayerYScreen = parent.playerYScreen;
-        const uint8_t parentVelocityStuckFrameCount = parent.velocityStuckFrameCount;
-
-        if (!driver_->loadRuntimeSavestate(parent.savestate, 2000u)) {
-            const std::string runtimeLastError = driver_->getRuntimeLastError();
-            completeWithError(
-                runtimeLastError.empty() ? "Failed to load SMB DFS parent savestate"
-                                         : runtimeLastError);
-            return SmbDfsSearchTickResult{
-                .completed = true,
-                .error = completionErrorMessage_,
-            };
+        ChildExpansion expansion = expandNextChild(dfsFrame);
+        if (expansion.aliveChildFrame.has_value()) {
+            dfsStack_.push_back(expansion.aliveChildFrame.value());
         }
+        return expansion.tickResult;
+    }
+}
 
-        NesSuperMarioBrosEvaluator evaluator;
-        if (parent.evaluatorSummary.gameState.value_or(0u) == 1u) {
-            evaluator.restoreProgress(
-                decodeSmbStageIndex(parent.evaluatorSummary.bestFrontier),
-                decodeSmbAbsoluteX(parent.evaluatorSummary.bestFrontier),
-                parent.evaluatorSummary.distanceRewardTotal,
-                parent.evaluatorSummary.levelClearRewardTotal,
-                parent.evaluatorSummary.gameplayFrames,
-                parent.evaluatorSummary.gameplayFramesSinceProgress);
+SmbDfsSearchTickResult SmbDfsSearch::tickBestFirst()
+{
+    while (true) {
+        if (isBudgetExceeded()) {
+            completeWithTraceEvent(SmbDfsSearchTraceEventType::CompletedBudgetExceeded);
+            return SmbDfsSearchTickResult{ .completed = true };
         }
 
-        const auto stepResult = driver_->step(
-            timers_, playerControlFrameToNesMask(smbSearchLegalActionToPlayerControlFrame(action)));
-        if (!stepResult.runtimeHealthy || !stepResult.runtimeRunning) {
-            const std::string errorMessage = stepResult.lastError.empty()
-                ? "NES runtime stopped during DFS expansion"
-                : stepResult.lastError;
-            completeWithError(errorMessage);
-            return SmbDfsSearchTickResult{
-                .completed = true,
-                .error = completionErrorMessage_,
-            };
+        if (!expandingFrame_.has_value()) {
+            if (openNodeHeap_.empty()) {
+                completeWithTraceEvent(SmbDfsSearchTraceEventType::CompletedExhausted);
+                return SmbDfsSearchTickResult{ .completed = true };
+            }
+
+            std::pop_heap(
+                openNodeHeap_.begin(), openNodeHeap_.end(), [this](size_t lhs, size_t rhs) {
+                    return isBetterOpenNode(rhs, lhs);
+                });
+            const size_t nodeIndex = openNodeHeap_.back();
+            openNodeHeap_.pop_back();
+            const auto frameIt = openFrames_.find(nodeIndex);
+            DIRTSIM_ASSERT(frameIt != openFrames_.end(), "Open SMB search node has no frame");
+            expandingFrame_ = frameIt->second;
+            openFrames_.erase(frameIt);
         }
-        if (stepResult.advancedFrames == 0) {
-            completeWithError("DFS expansion did not advance the NES runtime");
-            return SmbDfsSearchTickResult{
-                .completed = true,
-                .error = completionErrorMessage_,
-            };
+
+        DfsFrame& dfsFrame = expandingFrame_.value();
+        if (dfsFrame.nextActionIndex >= dfsFrame.actionOrdering.count) {
+            // Every child now carries its own savestate, so this node is never loaded again.
+            releaseNodeHeavyData(dfsFrame.nodeIndex);
+            if (dfsFrame.unresolvedChildCount == 0u) {
+                resolveBestFirstNode(dfsFrame);
+            }
+            else {
+                waitingFrames_.emplace(dfsFrame.nodeIndex, dfsFrame);
+            }
+            expandingFrame_.reset();
+            continue;
         }
-        if (!stepResult.memorySnapshot.has_value()) {
-            completeWithError("DFS expansion did not provide an NES memory snapshot");
-            return SmbDfsSearchTickResult{
+
+        ChildExpansion expansion = expandNextChild(dfsFrame);
+        if (expansion.aliveChildFrame.has_value()) {
+            dfsFrame.unresolvedChildCount++;
+            pushOpenNode(expansion.aliveChildFrame.value());
+        }
+        return expansion.tickResult;
+    }
+}
+
+SmbDfsSearch::ChildExpansion SmbDfsSearch::expandNextChild(DfsFrame& dfsFrame)
+{
+    std::optional<DfsFrame> aliveChildFrame = std::nullopt;
+    const size_t parentIndex = dfsFrame.nodeIndex;
+    const uint8_t actionOrderIndex = dfsFrame.nextActionIndex;
+    const SmbSearchLegalAction action = dfsFrame.actionOrdering.actions[dfsFrame.nextActionIndex++];
+    const bool groundedVerticalJumpPriorityAction =
+        actionOrderIndex < dfsFrame.actionOrdering.groundedVerticalJumpPriorityActionCount;
+    const SmbSearchNode& parent = nodes_[parentIndex];
+    const uint64_t parentCurrentFrontier = parent.currentFrontier;
+    const uint8_t parentPlayerYScreen = parent.playerYScreen;
+    const uint8_t parentVelocityStuckFrameCount = parent.velocityStuckFrameCount;
+
+    if (!driver_->loadRuntimeSavestate(savestateStore_.load(parent.savestate), 2000u)) {
+        const std::string runtimeLastError = driver_->getRuntimeLastError();
+        completeWithError(
+            runtimeLastError.empty() ? "Failed to load SMB DFS parent savestate"
+                                     : runtimeLastError);
+        return ChildExpansion{
+            .tickResult = SmbDfsSearchTickResult{
                 .completed = true,
                 .error = completionErrorMessage_,
-            };
-        }
+            },
+        };
+    }
 
-        NesSuperMarioBrosRamExtractor extractor;
-        const NesSuperMarioBrosState state =
-            extractor.extract(stepResult.memorySnapshot.value(), true);
-        const std::optional<uint8_t> gameState = state.phase == SmbPhase::Gameplay
-            ? std::optional<uint8_t>(1u)
-            : std::optional<uint8_t>(0u);
-        const auto evaluation = evaluator.evaluate(
-            NesSuperMarioBrosEvaluatorInput{
-                .advancedFrames = stepResult.advancedFrames,
-                .state = state,
-            });
-        const SmbSearchEvaluatorSummary evaluatorSummary =
-            buildSmbSearchEvaluatorSummary(evaluation.snapshot, gameState);
+    NesSuperMarioBrosEvaluator evaluator;
+    if (parent.evaluatorSummary.gameState.value_or(0u) == 1u) {
+        evaluator.restoreProgress(
+            decodeSmbStageIndex(parent.evaluatorSummary.bestFrontier),
+            decodeSmbAbsoluteX(parent.evaluatorSummary.bestFrontier),
+            parent.evaluatorSummary.distanceRewardTotal,
+            parent.evaluatorSummary.levelClearRewardTotal,
+            parent.evaluatorSummary.gameplayFrames,
+            parent.evaluatorSummary.gameplayFramesSinceProgress);
+    }
 
-        const auto savestate = driver_->copyRuntimeSavestate();
-        if (!savestate.has_value()) {
-            completeWithError("Failed to capture SMB DFS child savestate");
-            return SmbDfsSearchTickResult{
+    const auto stepResult = driver_->step(
+        timers_, playerControlFrameToNesMask(smbSearchLegalActionToPlayerControlFrame(action)));
+    if (!stepResult.runtimeHealthy || !stepResult.runtimeRunning) {
+        const std::string errorMessage = stepResult.lastError.empty()
+            ? "NES runtime stopped during DFS expansion"
+            : stepResult.lastError;
+        completeWithError(errorMessage);
+        return ChildExpansion{
+            .tickResult = SmbDfsSearchTickResult{
                 .completed = true,
                 .error = completionErrorMessage_,
-            };
-        }
+            },
+        };
+    }
+    emulatorFrameCount_ += stepResult.advancedFrames;
+    if (stepResult.advancedFrames == 0) {
+        completeWithError("DFS expansion did not advance the NES runtime");
+        return ChildExpansion{
+            .tickResult = SmbDfsSearchTickResult{
+                .completed = true,
+                .error = completionErrorMessage_,
+            },
+        };
+    }
+    if (!stepResult.memorySnapshot.has_value()) {
+        completeWithError("DFS expansion did not provide an NES memory snapshot");
+        return ChildExpansion{
+            .tickResult = SmbDfsSearchTickResult{
+                .completed = true,
+                .error = completionErrorMessage_,
+            },
+        };
+    }
 
-        std::optional<ScenarioVideoFrame> scenarioVideoFrame = stepResult.scenarioVideoFrame;
-        if (!scenarioVideoFrame.has_value()) {
-            scenarioVideoFrame = driver_->copyRuntimeFrameSnapshot();
-        }
+    NesSuperMarioBrosRamExtractor extractor;
+    const NesSuperMarioBrosState state = extractor.extract(stepResult.memorySnapshot.value(), true);
+    const std::optional<uint8_t> gameState = state.phase == SmbPhase::Gameplay
+        ? std::optional<uint8_t>(1u)
+        : std::optional<uint8_t>(0u);
+    const auto evaluation = evaluator.evaluate(
+        NesSuperMarioBrosEvaluatorInput{
+            .advancedFrames = stepResult.advancedFrames,
+            .state = state,
+        });
+    const SmbSearchEvaluatorSummary evaluatorSummary =
+        buildSmbSearchEvaluatorSummary(evaluation.snapshot, gameState);
+
+    const auto savestate = driver_->copyRuntimeCompactSavestate();
+    if (!savestate.has_value()) {
+        completeWithError("Failed to capture SMB DFS child savestate");
+        return ChildExpansion{
+            .tickResult = SmbDfsSearchTickResult{
+                .completed = true,
+                .error = completionErrorMessage_,
+            },
+        };
+    }
 
-        const bool belowScreen = evaluatorSummary.endReason == SmbEpisodeEndReason::FellBelowScreen;
-        const bool terminalLoss = evaluatorSummary.terminal && !belowScreen;
-        const bool nonGameplay =
-            !evaluatorSummary.terminal && state.gameMode != SmbGameMode::Normal;
-        const std::optional<ClosedLossTranspositionKey> closedLossTranspositionKey =
-            buildClosedLossTranspositionKey(state, stepResult.memorySnapshot.value());
-        const std::optional<ClosedLossTranspositionShapeKey> closedLossTranspositionShapeKey =
-            closedLossTranspositionKey.has_value()
-            ? std::optional<ClosedLossTranspositionShapeKey>(
-                  buildClosedLossTranspositionShapeKey(closedLossTranspositionKey.value()))
-            : std::nullopt;
-        const bool prunedTransposition = !evaluatorSummary.terminal && !nonGameplay
-            && closedLossTranspositionKey.has_value()
-            && isClosedLossTranspositionPruned(
-                closedLossTranspositionKey.value(), evaluatorSummary);
-        const ClosedLossTranspositionShapeProbeResult approximateTranspositionProbe =
-            !evaluatorSummary.terminal && !nonGameplay && closedLossTranspositionKey.has_value()
-                && closedLossTranspositionShapeKey.has_value()
-            ? probeClosedLossTranspositionShape(
-                  closedLossTranspositionShapeKey.value(),
-                  closedLossTranspositionKey.value(),
-                  evaluatorSummary)
-            : ClosedLossTranspositionShapeProbeResult{};
-        const size_t childIndex = nodes_.size();
-        nodes_.push_back(
-            SmbSearchNode{
-                .savestate = savestate.value(),
-                .memorySnapshot = stepResult.memorySnapshot.value(),
-                .scenarioVideoFrame = scenarioVideoFrame,
-                .evaluatorSummary = evaluatorSummary,
-                .parentIndex = parentIndex,
-                .actionFromParent = action,
-                .currentFrontier = encodeCurrentFrontier(state),
-                .gameplayFrame = evaluatorSummary.gameplayFrames,
-                .playerYScreen = state.playerYScreen,
-            });
-        closedLossTranspositionKeys_.push_back(closedLossTranspositionKey);
-        nodeOutcomes_.push_back(SmbSearchNodeOutcome::Open);
-        closedLossBlockReasons_.push_back(SmbDfsClosedLossBlockReason::None);
-        progress_.searchedNodeCount++;
-        if (groundedVerticalJumpPriorityAction) {
-            progress_.groundedVerticalJumpPriorityActionCount++;
-        }
-        updateRenderableState(nodes_.back());
-
-        const bool velocityStuckCandidate = options_.velocityPruningEnabled
-            && !evaluatorSummary.terminal && !nonGameplay
-            && state.absoluteX == decodeSmbAbsoluteX(parentCurrentFrontier) && !state.airborne
-            && state.playerYScreen >= parentPlayerYScreen
-            && std::abs(state.horizontalSpeedNormalized) <= kVelocityPruneHorizontalSpeedEpsilon
-            && evaluatorSummary.gameplayFramesSinceProgress > 0;
-        const uint8_t velocityStuckFrameCount = velocityStuckCandidate
-            ? static_cast<uint8_t>(std::min<uint16_t>(
-                  static_cast<uint16_t>(parentVelocityStuckFrameCount) + 1u, 255u))
-            : 0u;
-        nodes_.back().velocityStuckFrameCount = velocityStuckFrameCount;
-        const bool velocityStuck =
-            velocityStuckFrameCount >= kVelocityPruneConsecutiveFrameThreshold;
-        const bool stalled = !evaluatorSummary.terminal && !nonGameplay
-            && evaluatorSummary.gameplayFramesSinceProgress >= options_.stallFrameLimit;
-        const SmbDfsSearchTraceEventType traceEvent = belowScreen
-            ? SmbDfsSearchTraceEventType::PrunedBelowScreen
-            : terminalLoss        ? SmbDfsSearchTraceEventType::PrunedDead
-            : prunedTransposition ? SmbDfsSearchTraceEventType::PrunedTransposition
-            : nonGameplay         ? SmbDfsSearchTraceEventType::PrunedNonGameplay
-            : velocityStuck       ? SmbDfsSearchTraceEventType::PrunedVelocityStuck
-            : stalled             ? SmbDfsSearchTraceEventType::PrunedStalled
-                                  : SmbDfsSearchTraceEventType::ExpandedAlive;
-        const bool expandedAlive = traceEvent == SmbDfsSearchTraceEventType::ExpandedAlive;
-        const bool childClosedLossCandidate = expandedAlive && isClosedLossCandidate(childIndex);
-        const SmbDfsClosedLossBlockReason childInitialBlockReason = expandedAlive
-            ? getInitialClosedLossBlockReason(childIndex)
-            : SmbDfsClosedLossBlockReason::None;
-        const SmbSearchNodeOutcome childOutcome = expandedAlive ? SmbSearchNodeOutcome::Open
-            : nonGameplay ? SmbSearchNodeOutcome::NotClosedLoss
-                          : SmbSearchNodeOutcome::ClosedLoss;
-        const SmbDfsClosedLossBlockReason childBlockReason = expandedAlive ? childInitialBlockReason
-            : nonGameplay ? SmbDfsClosedLossBlockReason::NonGameplay
-                          : SmbDfsClosedLossBlockReason::None;
-        recordTrace(
-            SmbDfsSearchTraceEntry{
-                .eventType = traceEvent,
-                .nodeIndex = childIndex,
-                .parentIndex = parentIndex,
-                .action = action,
-                .gameplayFrame = evaluatorSummary.gameplayFrames,
-                .frontier = evaluatorSummary.bestFrontier,
-                .evaluationScore = evaluatorSummary.evaluationScore,
-                .framesSinceProgress = evaluatorSummary.gameplayFramesSinceProgress,
-                .groundedVerticalJumpPriorityAction = groundedVerticalJumpPriorityAction,
-                .closedLossCandidate = expandedAlive
-                    ? childClosedLossCandidate
-                    : childOutcome == SmbSearchNodeOutcome::ClosedLoss,
-                .closedLossProven = childOutcome == SmbSearchNodeOutcome::ClosedLoss,
-                .closedLossApproximateTranspositionPruned = approximateTranspositionProbe.pruned,
-                .closedLossApproximateTranspositionRamDiffCount =
-                    approximateTranspositionProbe.ramDiffCount,
-                .closedLossApproximateTranspositionRamDiffs =
-                    approximateTranspositionProbe.ramDiffs,
-                .closedLossBlockReason = childBlockReason,
-            });
-        progress_.lastSearchEvent = toSearchProgressEvent(traceEvent);
-
-        if (!evaluatorSummary.terminal && !prunedTransposition && !nonGameplay && !velocityStuck
-            && !stalled) {
-            updateBestLeaf(childIndex);
-            const SmbSearchActionOrdering actionOrdering = buildDfsActionOrder(
-                state.airborne,
-                state.verticalSpeedNormalized,
-                getHorizontalDirection(state),
-                action,
-                options_.groundedVerticalJumpPrioritizationEnabled);
-            dfsStack_.push_back(
-                DfsFrame{
-                    .nodeIndex = childIndex,
-                    .nextActionIndex = 0,
-                    .actionOrdering = actionOrdering,
-                    .closedLossCandidate = childClosedLossCandidate,
-                    .closedLossBlockReason = childInitialBlockReason,
-                });
-        }
-        else {
-            nodeOutcomes_[childIndex] = childOutcome;
-            closedLossBlockReasons_[childIndex] = childBlockReason;
-            noteChildOutcome(dfsFrame, childOutcome, childBlockReason);
-            if (childOutcome == SmbSearchNodeOutcome::ClosedLoss) {
-                publishClosedLossTranspositionEntry(childIndex);
-            }
-            // Pruned node will never be loaded again. Release heavy data.
-            releaseNodeHeavyData(childIndex);
+    const bool belowScreen = evaluatorSummary.endReason == SmbEpisodeEndReason::FellBelowScreen;
+    const bool terminalLoss = evaluatorSummary.terminal && !belowScreen;
+    const bool nonGameplay = !evaluatorSummary.terminal && state.gameMode != SmbGameMode::Normal;
+    const std::optional<ClosedLossTranspositionKey> closedLossTranspositionKey =
+        buildClosedLossTranspositionKey(state, stepResult.memorySnapshot.value());
+    const std::optional<ClosedLossTranspositionShapeKey> closedLossTranspositionShapeKey =
+        closedLossTranspositionKey.has_value()
+        ? std::optional<ClosedLossTranspositionShapeKey>(
+              buildClosedLossTranspositionShapeKey(closedLossTranspositionKey.value()))
+        : std::nullopt;
+    const bool prunedTransposition = !evaluatorSummary.terminal && !nonGameplay
+        && closedLossTranspositionKey.has_value()
+        && isClosedLossTranspositionPruned(closedLossTranspositionKey.value(), evaluatorSummary);
+    const ClosedLossTranspositionShapeProbeResult approximateTranspositionProbe =
+        !evaluatorSummary.terminal && !nonGameplay && closedLossTranspositionKey.has_value()
+            && closedLossTranspositionShapeKey.has_value()
+        ? probeClosedLossTranspositionShape(
+              closedLossTranspositionShapeKey.value(),
+              closedLossTranspositionKey.value(),
+              evaluatorSummary)
+        : ClosedLossTranspositionShapeProbeResult{};
+    const size_t childIndex = nodes_.size();
+    nodes_.push_back(
+        SmbSearchNode{
+            .savestate = savestateStore_.store(savestate.value()),
+            .evaluatorSummary = evaluatorSummary,
+            .parentIndex = parentIndex,
+            .actionFromParent = action,
+            .currentFrontier = encodeCurrentFrontier(state),
+            .gameplayFrame = evaluatorSummary.gameplayFrames,
+            .playerYScreen = state.playerYScreen,
+        });
+    closedLossTranspositionKeys_.push_back(closedLossTranspositionKey);
+    nodeOutcomes_.push_back(SmbSearchNodeOutcome::Open);
+    closedLossBlockReasons_.push_back(SmbDfsClosedLossBlockReason::None);
+    progress_.searchedNodeCount++;
+    if (groundedVerticalJumpPriorityAction) {
+        progress_.groundedVerticalJumpPriorityActionCount++;
+    }
+    updateRenderableState(
+        evaluatorSummary.gameplayFrames,
+        stepResult.scenarioVideoFrame.has_value() ? stepResult.scenarioVideoFrame
+                                                  : driver_->copyRuntimeFrameSnapshot());
+
+    const bool velocityStuckCandidate = options_.velocityPruningEnabled
+        && !evaluatorSummary.terminal && !nonGameplay
+        && state.absoluteX == decodeSmbAbsoluteX(parentCurrentFrontier) && !state.airborne
+        && state.playerYScreen >= parentPlayerYScreen
+        && std::abs(state.horizontalSpeedNormalized) <= kVelocityPruneHorizontalSpeedEpsilon
+        && evaluatorSummary.gameplayFramesSinceProgress > 0;
+    const uint8_t velocityStuckFrameCount = velocityStuckCandidate
+        ? static_cast<uint8_t>(std::min<uint16_t>(
+              static_cast<uint16_t>(parentVelocityStuckFrameCount) + 1u, 255u))
+        : 0u;
+    nodes_.back().velocityStuckFrameCount = velocityStuckFrameCount;
+    const bool velocityStuck = velocityStuckFrameCount >= kVelocityPruneConsecutiveFrameThreshold;
+    const bool stalled = !evaluatorSummary.terminal && !nonGameplay
+        && evaluatorSummary.gameplayFramesSinceProgress >= options_.stallFrameLimit;
+    const SmbDfsSearchTraceEventType traceEvent = belowScreen
+        ? SmbDfsSearchTraceEventType::PrunedBelowScreen
+        : terminalLoss        ? SmbDfsSearchTraceEventType::PrunedDead
+        : prunedTransposition ? SmbDfsSearchTraceEventType::PrunedTransposition
+        : nonGameplay         ? SmbDfsSearchTraceEventType::PrunedNonGameplay
+        : velocityStuck       ? SmbDfsSearchTraceEventType::PrunedVelocityStuck
+        : stalled             ? SmbDfsSearchTraceEventType::PrunedStalled
+                              : SmbDfsSearchTraceEventType::ExpandedAlive;
+    const bool expandedAlive = traceEvent == SmbDfsSearchTraceEventType::ExpandedAlive;
+    const bool childClosedLossCandidate = expandedAlive && isClosedLossCandidate(childIndex);
+    const SmbDfsClosedLossBlockReason childInitialBlockReason = expandedAlive
+        ? getInitialClosedLossBlockReason(childIndex)
+        : SmbDfsClosedLossBlockReason::None;
+    const SmbSearchNodeOutcome childOutcome = expandedAlive ? SmbSearchNodeOutcome::Open
+        : nonGameplay ? SmbSearchNodeOutcome::NotClosedLoss
+                      : SmbSearchNodeOutcome::ClosedLoss;
+    const SmbDfsClosedLossBlockReason childBlockReason = expandedAlive ? childInitialBlockReason
+        : nonGameplay ? SmbDfsClosedLossBlockReason::NonGameplay
+                      : SmbDfsClosedLossBlockReason::None;
+    recordTrace(
+        SmbDfsSearchTraceEntry{
+            .eventType = traceEvent,
+            .nodeIndex = childIndex,
+            .parentIndex = parentIndex,
+            .action = action,
+            .gameplayFrame = evaluatorSummary.gameplayFrames,
+            .frontier = evaluatorSummary.bestFrontier,
+            .evaluationScore = evaluatorSummary.evaluationScore,
+            .framesSinceProgress = evaluatorSummary.gameplayFramesSinceProgress,
+            .groundedVerticalJumpPriorityAction = groundedVerticalJumpPriorityAction,
+            .closedLossCandidate = expandedAlive
+                ? childClosedLossCandidate
+                : childOutcome == SmbSearchNodeOutcome::ClosedLoss,
+            .closedLossProven = childOutcome == SmbSearchNodeOutcome::ClosedLoss,
+            .closedLossApproximateTranspositionPruned = approximateTranspositionProbe.pruned,
+            .closedLossApproximateTranspositionRamDiffCount =
+                approximateTranspositionProbe.ramDiffCount,
+            .closedLossApproximateTranspositionRamDiffs = approximateTranspositionProbe.ramDiffs,
+            .closedLossBlockReason = childBlockReason,
+        });
+    progress_.lastSearchEvent = toSearchProgressEvent(traceEvent);
+
+    if (!evaluatorSummary.terminal && !prunedTransposition && !nonGameplay && !velocityStuck
+        && !stalled) {
+        updateBestLeaf(childIndex);
+        const SmbSearchActionOrdering actionOrdering = buildDfsActionOrder(
+            state.airborne,
+            state.verticalSpeedNormalized,
+            getHorizontalDirection(state),
+            action,
+            options_.groundedVerticalJumpPrioritizationEnabled);
+        aliveChildFrame = DfsFrame{
+            .nodeIndex = childIndex,
+            .nextActionIndex = 0,
+            .actionOrdering = actionOrdering,
+            .closedLossCandidate = childClosedLossCandidate,
+            .closedLossBlockReason = childInitialBlockReason,
+        };
+    }
+    else {
+        nodeOutcomes_[childIndex] = childOutcome;
+        closedLossBlockReasons_[childIndex] = childBlockReason;
+        noteChildOutcome(dfsFrame, childOutcome, childBlockReason);
+        if (childOutcome == SmbSearchNodeOutcome::ClosedLoss) {
+            publishClosedLossTranspositionEntry(childIndex);
         }
+        // Pruned node will never be loaded again. Release heavy data.
+        releaseNodeHeavyData(childIndex);
+    }
 
-        if (options_.stopAfterBestFrontier.has_value()
-            && bestFrontier_ >= options_.stopAfterBestFrontier.value()) {
-            completeWithTraceEvent(SmbDfsSearchTraceEventType::CompletedMilestoneReached);
-            return SmbDfsSearchTickResult{
+    if (options_.stopAfterBestFrontier.has_value()
+        && bestFrontier_ >= options_.stopAfterBestFrontier.value()) {
+        completeWithTraceEvent(SmbDfsSearchTraceEventType::CompletedMilestoneReached);
+        return ChildExpansion{
+            .aliveChildFrame = aliveChildFrame,
+            .tickResult = SmbDfsSearchTickResult{
                 .completed = true,
                 .frameAdvanced = true,
                 .renderChanged = true,
-            };
-        }
+            },
+        };
+    }
 
-        return SmbDfsSearchTickResult{
+    return ChildExpansion{
+        .aliveChildFrame = aliveChildFrame,
+        .tickResult = SmbDfsSearchTickResult{
             .completed = completed_,
             .frameAdvanced = true,
             .renderChanged = true,
-        };
-    }
+        },
+    };
 }
 
 void SmbDfsSearch::pauseSet(bool paused)
@@ -743,6 +810,39 @@ const std::vector<SmbDfsSearchTraceEntry>& SmbDfsSearch::getTrace() const
     return trace_;
 }
 
+uint64_t SmbDfsSearch::getEmulatorFrameCount() const
+{
+    return emulatorFrameCount_;
+}
+
+size_t SmbDfsSearch::getOpenNodeCount() const
+{
+    return openNodeHeap_.size();
+}
+
+SmbSavestateStore::Stats SmbDfsSearch::getSavestateStoreStats() const
+{
+    return savestateStore_.getStats();
+}
+
+SmbDfsSearchMemoryStats SmbDfsSearch::getMemoryStats() const
+{
+    size_t nodeBytes = nodes_.capacity() * sizeof(SmbSearchNode)
+        + nodeOutcomes_.capacity() * sizeof(SmbSearchNodeOutcome)
+        + closedLossBlockReasons_.capacity() * sizeof(SmbDfsClosedLossBlockReason)
+        + closedLossTranspositionKeys_.capacity()
+            * sizeof(std::optional<ClosedLossTranspositionKey>);
+    for (const SmbSearchNode& node : nodes_) {
+        nodeBytes += node.savestate.pageIds.capacity() * sizeof(uint32_t);
+    }
+
+    return SmbDfsSearchMemoryStats{
+        .nodeCount = nodes_.size(),
+        .nodeBytes = nodeBytes,
+        .savestateBytes = savestateStore_.getStats().storedBytes,
+    };
+}
+
 const WorldData& SmbDfsSearch::getWorldData() const
 {
     return worldData_;
@@ -774,7 +874,13 @@ Result<std::monostate, std::string> SmbDfsSearch::initializeRuntime()
     progress_ = Api::SearchProgress{};
     rootPrefixFrames_.clear();
     nodes_.clear();
+    savestateStore_.clear();
     dfsStack_.clear();
+    openNodeHeap_.clear();
+    openFrames_.clear();
+    expandingFrame_.reset();
+    waitingFrames_.clear();
+    emulatorFrameCount_ = 0;
     nodeOutcomes_.clear();
     closedLossBlockReasons_.clear();
     closedLossTranspositionKeys_.clear();
@@ -794,17 +900,11 @@ Result<std::monostate, std::string> SmbDfsSearch::initializeRuntime()
 Result<std::monostate, std::string> SmbDfsSearch::initializeRootNode(
     const SmolnesRuntime::Savestate& savestate,
     const SmbSearchEvaluatorSummary& evaluatorSummary,
-    const SmolnesRuntime::MemorySnapshot* memorySnapshot,
-    const std::optional<ScenarioVideoFrame>& scenarioVideoFrame)
+    std::optional<ScenarioVideoFrame> scenarioVideoFrame)
 {
     nodes_.push_back(
         SmbSearchNode{
-            .savestate = savestate,
-            .memorySnapshot =
-                memorySnapshot != nullptr ? *memorySnapshot : SmolnesRuntime::MemorySnapshot{},
-            .scenarioVideoFrame = scenarioVideoFrame.has_value()
-                ? scenarioVideoFrame
-                : driver_->copyRuntimeFrameSnapshot(),
+            .savestate = savestateStore_.store(savestate),
             .evaluatorSummary = evaluatorSummary,
             .currentFrontier = evaluatorSummary.bestFrontier,
             .gameplayFrame = evaluatorSummary.gameplayFrames,
@@ -812,25 +912,33 @@ Result<std::monostate, std::string> SmbDfsSearch::initializeRootNode(
     closedLossTranspositionKeys_.push_back(std::nullopt);
     nodeOutcomes_.push_back(SmbSearchNodeOutcome::Open);
     closedLossBlockReasons_.push_back(getInitialClosedLossBlockReason(0u));
-    dfsStack_.push_back(
-        DfsFrame{
-            .nodeIndex = 0u,
-            .nextActionIndex = 0,
-            .actionOrdering = buildDfsActionOrder(
-                false,
-                0.0,
-                SmbSearchHorizontalDirection::None,
-                std::nullopt,
-                options_.groundedVerticalJumpPrioritizationEnabled),
-            .closedLossCandidate = isClosedLossCandidate(0u),
-            .closedLossBlockReason = getInitialClosedLossBlockReason(0u),
-        });
+    const DfsFrame rootFrame{
+        .nodeIndex = 0u,
+        .nextActionIndex = 0,
+        .actionOrdering = buildDfsActionOrder(
+            false,
+            0.0,
+            SmbSearchHorizontalDirection::None,
+            std::nullopt,
+            options_.groundedVerticalJumpPrioritizationEnabled),
+        .closedLossCandidate = isClosedLossCandidate(0u),
+        .closedLossBlockReason = getInitialClosedLossBlockReason(0u),
+    };
+    if (options_.strategy == SmbSearchStrategy::BestFirst) {
+        pushOpenNode(rootFrame);
+    }
+    else {
+        dfsStack_.push_back(rootFrame);
+    }
 
     bestLeafIndex_ = 0u;
     bestFrontier_ = evaluatorSummary.bestFrontier;
     bestScore_ = evaluatorSummary.evaluationScore;
     progress_.bestFrontier = bestFrontier_;
-    updateRenderableState(nodes_.front());
+    updateRenderableState(
+        evaluatorSummary.gameplayFrames,
+        scenarioVideoFrame.has_value() ? std::move(scenarioVideoFrame)
+                                       : driver_->copyRuntimeFrameSnapshot());
     progress_.lastSearchEvent = Api::SearchProgressEvent::RootInitialized;
     rebuildBestPlan();
     recordTrace(
@@ -908,6 +1016,149 @@ void SmbDfsSearch::completeWithTraceEvent(SmbDfsSearchTraceEventType eventType)
         });
 }
 
+bool SmbDfsSearch::isBudgetExceeded() const
+{
+    if (options_.maxSearchedNodeCount > 0
+        && progress_.searchedNodeCount >= options_.maxSearchedNodeCount) {
+        return true;
+    }
+    return options_.maxEmulatorFrameCount > 0
+        && emulatorFrameCount_ >= options_.maxEmulatorFrameCount;
+}
+
+bool SmbDfsSearch::isBetterOpenNode(size_t lhsNodeIndex, size_t rhsNodeIndex) const
+{
+    const SmbSearchNode& lhs = nodes_[lhsNodeIndex];
+    const SmbSearchNode& rhs = nodes_[rhsNodeIndex];
+    if (lhs.currentFrontier != rhs.currentFrontier) {
+        return lhs.currentFrontier > rhs.currentFrontier;
+    }
+    if (lhs.evaluatorSummary.evaluationScore != rhs.evaluatorSummary.evaluationScore) {
+        return lhs.evaluatorSummary.evaluationScore > rhs.evaluatorSummary.evaluationScore;
+    }
+    if (lhs.gameplayFrame != rhs.gameplayFrame) {
+        return lhs.gameplayFrame < rhs.gameplayFrame;
+    }
+    return lhsNodeIndex < rhsNodeIndex;
+}
+
+void SmbDfsSearch::pushOpenNode(const DfsFrame& dfsFrame)
+{
+    openFrames_.emplace(dfsFrame.nodeIndex, dfsFrame);
+    openNodeHeap_.push_back(dfsFrame.nodeIndex);
+    std::push_heap(openNodeHeap_.begin(), openNodeHeap_.end(), [this](size_t lhs, size_t rhs) {
+        return isBetterOpenNode(rhs, lhs);
+    });
+    if (options_.beamWidth > 0 && openNodeHeap_.size() > options_.beamWidth) {
+        dropWorstOpenNode();
+    }
+}
+
+void SmbDfsSearch::dropWorstOpenNode()
+{
+    // The heap keeps the best node in front, so the worst is a leaf in the back half.
+    auto worstIt = openNodeHeap_.begin() + static_cast<std::ptrdiff_t>(openNodeHeap_.size() / 2u);
+    for (auto it = worstIt + 1; it != openNodeHeap_.end(); ++it) {
+        if (isBetterOpenNode(*worstIt, *it)) {
+            worstIt = it;
+        }
+    }
+    const size_t nodeIndex = *worstIt;
+    *worstIt = openNodeHeap_.back();
+    openNodeHeap_.pop_back();
+    std::make_heap(openNodeHeap_.begin(), openNodeHeap_.end(), [this](size_t lhs, size_t rhs) {
+        return isBetterOpenNode(rhs, lhs);
+    });
+
+    const auto frameIt = openFrames_.find(nodeIndex);
+    DIRTSIM_ASSERT(frameIt != openFrames_.end(), "Open SMB search node has no frame");
+    const SmbDfsClosedLossBlockReason blockReason = frameIt->second.closedLossBlockReason;
+    openFrames_.erase(frameIt);
+
+    // A dropped node was never explored, so it cannot prove its parent a closed loss.
+    nodeOutcomes_[nodeIndex] = SmbSearchNodeOutcome::NotClosedLoss;
+    closedLossBlockReasons_[nodeIndex] = blockReason;
+    releaseNodeHeavyData(nodeIndex);
+    const SmbSearchNode& node = nodes_[nodeIndex];
+    recordTrace(
+        SmbDfsSearchTraceEntry{
+            .eventType = SmbDfsSearchTraceEventType::PrunedBeamWidth,
+            .nodeIndex = nodeIndex,
+            .parentIndex = node.parentIndex,
+            .action = node.actionFromParent,
+            .gameplayFrame = node.gameplayFrame,
+            .frontier = node.evaluatorSummary.bestFrontier,
+            .evaluationScore = node.evaluatorSummary.evaluationScore,
+            .framesSinceProgress = node.evaluatorSummary.gameplayFramesSinceProgress,
+            .closedLossBlockReason = blockReason,
+        });
+    progress_.lastSearchEvent = Api::SearchProgressEvent::PrunedBeamWidth;
+
+    const std::optional<DfsFrame> parentFrame =
+        noteBestFirstChildResolved(nodeIndex, SmbSearchNodeOutcome::NotClosedLoss, blockReason);
+    if (parentFrame.has_value()) {
+        resolveBestFirstNode(parentFrame.value());
+    }
+}
+
+std::optional<SmbDfsSearch::DfsFrame> SmbDfsSearch::noteBestFirstChildResolved(
+    size_t nodeIndex, SmbSearchNodeOutcome outcome, SmbDfsClosedLossBlockReason blockReason)
+{
+    const std::optional<size_t> parentIndex = nodes_[nodeIndex].parentIndex;
+    if (!parentIndex.has_value()) {
+        return std::nullopt;
+    }
+
+    // The parent is either still being expanded, which settles it once its actions run out, or
+    // waiting on its children. A waiting parent is handed back once its last child settles.
+    DfsFrame* parentFrame = nullptr;
+    const auto parentIt = waitingFrames_.find(parentIndex.value());
+    if (expandingFrame_.has_value() && expandingFrame_->nodeIndex == parentIndex.value()) {
+        parentFrame = &expandingFrame_.value();
+    }
+    else if (parentIt != waitingFrames_.end()) {
+        parentFrame = &parentIt->second;
+    }
+    if (parentFrame == nullptr) {
+        return std::nullopt;
+    }
+
+    noteChildOutcome(*parentFrame, outcome, blockReason);
+    DIRTSIM_ASSERT(parentFrame->unresolvedChildCount > 0u, "SMB search child count underflow");
+    parentFrame->unresolvedChildCount--;
+    if (parentFrame->unresolvedChildCount > 0u || parentIt == waitingFrames_.end()) {
+        return std::nullopt;
+    }
+
+    const DfsFrame resolvedParentFrame = parentIt->second;
+    waitingFrames_.erase(parentIt);
+    return resolvedParentFrame;
+}
+
+void SmbDfsSearch::resolveBestFirstNode(DfsFrame dfsFrame)
+{
+    // Settle the node's outcome, then walk up while each parent has no unresolved children left.
+    while (true) {
+        const size_t nodeIndex = dfsFrame.nodeIndex;
+        const SmbSearchNodeOutcome outcome = dfsFrame.closedLossCandidate
+            ? SmbSearchNodeOutcome::ClosedLoss
+            : SmbSearchNodeOutcome::NotClosedLoss;
+        const SmbDfsClosedLossBlockReason blockReason = dfsFrame.closedLossCandidate
+            ? SmbDfsClosedLossBlockReason::None
+            : dfsFrame.closedLossBlockReason;
+        nodeOutcomes_[nodeIndex] = outcome;
+        closedLossBlockReasons_[nodeIndex] = blockReason;
+        publishClosedLossTranspositionEntry(nodeIndex);
+
+        const std::optional<DfsFrame> parentFrame =
+            noteBestFirstChildResolved(nodeIndex, outcome, blockReason);
+        if (!parentFrame.has_value()) {
+            return;
+        }
+        dfsFrame = parentFrame.value();
+    }
+}
+
 bool SmbDfsSearch::isClosedLossCandidate(size_t nodeIndex) const
 {
     return nodeIndex < nodes_.size();
@@ -1138,11 +1389,7 @@ void SmbDfsSearch::releaseNodeHeavyData(size_t nodeIndex)
     if (nodeIndex >= nodes_.size()) {
         return;
     }
-    SmbSearchNode& node = nodes_[nodeIndex];
-    node.savestate.bytes.clear();
-    node.savestate.bytes.shrink_to_fit();
-    node.memorySnapshot = SmolnesRuntime::MemorySnapshot{};
-    node.scenarioVideoFrame.reset();
+    savestateStore_.release(nodes_[nodeIndex].savestate);
 }
 
 void SmbDfsSearch::updateBestLeaf(size_t nodeIndex)
@@ -1163,15 +1410,16 @@ void SmbDfsSearch::updateBestLeaf(size_t nodeIndex)
     }
 }
 
-void SmbDfsSearch::updateRenderableState(const SmbSearchNode& node)
+void SmbDfsSearch::updateRenderableState(
+    uint64_t gameplayFrame, std::optional<ScenarioVideoFrame> scenarioVideoFrame)
 {
-    scenarioVideoFrame_ = node.scenarioVideoFrame;
-    progress_.currentGameplayFrame = node.gameplayFrame;
-    worldData_.timestep = static_cast<int32_t>(node.gameplayFrame);
-    if (!scenarioVideoFrame_.has_value()) {
+    progress_.currentGameplayFrame = gameplayFrame;
+    worldData_.timestep = static_cast<int32_t>(gameplayFrame);
+    if (!scenarioVideoFrame.has_value()) {
         return;
     }
 
+    scenarioVideoFrame_ = std::move(scenarioVideoFrame);
     worldData_.width = static_cast<int16_t>(scenarioVideoFrame_->width);
     worldData_.height = static_cast<int16_t>(scenarioVideoFrame_->height);
 }
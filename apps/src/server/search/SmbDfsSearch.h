@@ -6,6 +6,7 @@
 #include "core/WorldData.h"
 #include "server/api/Plan.h"
 #include "server/api/SearchProgress.h"
+#include "server/search/SmbSavestateStore.h"
 #include "server/search/SmbSearchCore.h"
 
 #include <array>
@@ -46,8 +47,21 @@ enum class SmbDfsSearchCompletionReason : uint8_t {
     Error = 2,
 };
 
+enum class SmbSearchStrategy : uint8_t {
+    // Expand the newest node first and backtrack chronologically.
+    DepthFirst = 0,
+    // Expand the open node furthest along the level, then by score, then by fewest frames.
+    BestFirst = 1,
+};
+
 struct SmbDfsSearchOptions {
+    SmbSearchStrategy strategy = SmbSearchStrategy::DepthFirst;
     uint32_t maxSearchedNodeCount = 5'000;
+    // Emulator frames advanced by node expansion; zero means unlimited.
+    uint64_t maxEmulatorFrameCount = 0;
+    // Best-first only: open nodes kept; past this the worst open node is dropped. Zero means
+    // unlimited.
+    uint32_t beamWidth = 0;
     uint32_t stallFrameLimit = 120;
     bool velocityPruningEnabled = true;
     bool belowScreenPruningEnabled = true;
@@ -58,6 +72,14 @@ struct SmbDfsSearchOptions {
     std::optional<uint64_t> stopAfterBestFrontier = std::nullopt;
 };
 
+struct SmbDfsSearchMemoryStats {
+    size_t nodeCount = 0;
+    // Node records, their savestate page lists, and the per-node search bookkeeping.
+    size_t nodeBytes = 0;
+    // Distinct savestate pages held for live nodes.
+    size_t savestateBytes = 0;
+};
+
 struct SmbDfsSearchTickResult {
     bool completed = false;
     bool frameAdvanced = false;
@@ -80,6 +102,7 @@ enum class SmbDfsSearchTraceEventType : uint8_t {
     PrunedBelowScreen = 11,
     PrunedTransposition = 12,
     PrunedNonGameplay = 13,
+    PrunedBeamWidth = 14,
 };
 
 enum class SmbDfsClosedLossBlockReason : uint8_t {
@@ -131,6 +154,10 @@ public:
     const Api::SearchProgress& getProgress() const;
     const std::optional<ScenarioVideoFrame>& getScenarioVideoFrame() const;
     const std::vector<SmbDfsSearchTraceEntry>& getTrace() const;
+    uint64_t getEmulatorFrameCount() const;
+    size_t getOpenNodeCount() const;
+    SmbSavestateStore::Stats getSavestateStoreStats() const;
+    SmbDfsSearchMemoryStats getMemoryStats() const;
     const WorldData& getWorldData() const;
 
 private:
@@ -140,6 +167,13 @@ private:
         SmbSearchActionOrdering actionOrdering = {};
         bool closedLossCandidate = true;
         SmbDfsClosedLossBlockReason closedLossBlockReason = SmbDfsClosedLossBlockReason::None;
+        // Best-first only: alive children whose outcome is still unknown.
+        uint8_t unresolvedChildCount = 0;
+    };
+
+    struct ChildExpansion {
+        std::optional<DfsFrame> aliveChildFrame = std::nullopt;
+        SmbDfsSearchTickResult tickResult;
     };
 
     struct ClosedLossTranspositionEntry {
@@ -218,8 +252,18 @@ private:
     Result<std::monostate, std::string> initializeRootNode(
         const SmolnesRuntime::Savestate& savestate,
         const SmbSearchEvaluatorSummary& evaluatorSummary,
-        const SmolnesRuntime::MemorySnapshot* memorySnapshot,
-        const std::optional<ScenarioVideoFrame>& scenarioVideoFrame);
+        std::optional<ScenarioVideoFrame> scenarioVideoFrame);
+
+    SmbDfsSearchTickResult tickDepthFirst();
+    SmbDfsSearchTickResult tickBestFirst();
+    ChildExpansion expandNextChild(DfsFrame& dfsFrame);
+    bool isBudgetExceeded() const;
+    bool isBetterOpenNode(size_t lhsNodeIndex, size_t rhsNodeIndex) const;
+    void pushOpenNode(const DfsFrame& dfsFrame);
+    void dropWorstOpenNode();
+    std::optional<DfsFrame> noteBestFirstChildResolved(
+        size_t nodeIndex, SmbSearchNodeOutcome outcome, SmbDfsClosedLossBlockReason blockReason);
+    void resolveBestFirstNode(DfsFrame dfsFrame);
 
     void completeWithError(const std::string& errorMessage);
     void completeWithTraceEvent(SmbDfsSearchTraceEventType eventType);
@@ -246,18 +290,28 @@ private:
     void recordTrace(const SmbDfsSearchTraceEntry& entry);
     void releaseNodeHeavyData(size_t nodeIndex);
     void updateBestLeaf(size_t nodeIndex);
-    void updateRenderableState(const SmbSearchNode& node);
+    void updateRenderableState(
+        uint64_t gameplayFrame, std::optional<ScenarioVideoFrame> scenarioVideoFrame);
 
     SmbDfsSearchOptions options_;
     std::unique_ptr<NesSmolnesScenarioDriver> driver_;
     Timers timers_;
     WorldData worldData_;
+    // Nodes keep no frames; this is the frame of the most recently stepped node.
     std::optional<ScenarioVideoFrame> scenarioVideoFrame_ = std::nullopt;
     Api::Plan plan_;
     Api::SearchProgress progress_;
     std::vector<PlayerControlFrame> rootPrefixFrames_;
+    SmbSavestateStore savestateStore_;
     std::vector<SmbSearchNode> nodes_;
     std::vector<DfsFrame> dfsStack_;
+    // Best-first state: a heap of open node indices, the node being expanded, and expanded nodes
+    // waiting on child outcomes before they can be proven closed losses.
+    std::vector<size_t> openNodeHeap_;
+    std::unordered_map<size_t, DfsFrame> openFrames_;
+    std::optional<DfsFrame> expandingFrame_ = std::nullopt;
+    std::unordered_map<size_t, DfsFrame> waitingFrames_;
+    uint64_t emulatorFrameCount_ = 0;
     std::vector<SmbSearchNodeOutcome> nodeOutcomes_;
     std::vector<SmbDfsClosedLossBlockReason> closedLossBlockReasons_;
     std::vector<std::optional<ClosedLossTranspositionKey>> closedLossTranspositionKeys_;
@@ -0,0 +1,139 @@
+#include "server/search/SmbSavestateStore.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace DirtSim::Server::SearchSupport {
+
+namespace {
+
+uint64_t hashPage(const std::array<std::byte, SmbSavestateStore::PageBytes>& bytes)
+{
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+    uint64_t hash = FNV_OFFSET;
+    for (size_t offset = 0; offset < bytes.size(); offset += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes.data() + offset, sizeof(word));
+        hash ^= word;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+} // namespace
+
+SmbSavestateStore::Handle SmbSavestateStore::store(const SmolnesRuntime::Savestate& savestate)
+{
+    Handle handle;
+    handle.frameId = savestate.frameId;
+    handle.byteCount = static_cast<uint32_t>(savestate.bytes.size());
+    handle.pageIds.reserve((savestate.bytes.size() + PageBytes - 1u) / PageBytes);
+
+    std::array<std::byte, PageBytes> page{};
+    for (size_t offset = 0; offset < savestate.bytes.size(); offset += PageBytes) {
+        const size_t count = std::min(PageBytes, savestate.bytes.size() - offset);
+        // The tail page is zero-padded so equal tails still share a page.
+        page.fill(std::byte{ 0 });
+        std::memcpy(page.data(), savestate.bytes.data() + offset, count);
+        handle.pageIds.push_back(internPage(page));
+    }
+
+    if (!handle.empty()) {
+        handleCount_++;
+        logicalBytes_ += handle.byteCount;
+    }
+    return handle;
+}
+
+SmolnesRuntime::Savestate SmbSavestateStore::load(const Handle& handle) const
+{
+    SmolnesRuntime::Savestate savestate;
+    savestate.frameId = handle.frameId;
+    savestate.bytes.resize(handle.byteCount);
+    for (size_t i = 0; i < handle.pageIds.size(); ++i) {
+        const size_t offset = i * PageBytes;
+        const size_t count = std::min(PageBytes, savestate.bytes.size() - offset);
+        std::memcpy(savestate.bytes.data() + offset, pages_[handle.pageIds[i]].bytes.data(), count);
+    }
+    return savestate;
+}
+
+void SmbSavestateStore::release(Handle& handle)
+{
+    if (handle.empty()) {
+        return;
+    }
+
+    for (const uint32_t pageId : handle.pageIds) {
+        Page& page = pages_[pageId];
+        if (--page.refCount > 0u) {
+            continue;
+        }
+
+        const auto [begin, end] = pageIdsByHash_.equal_range(page.hash);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == pageId) {
+                pageIdsByHash_.erase(it);
+                break;
+            }
+        }
+        freePageIds_.push_back(pageId);
+    }
+
+    handleCount_--;
+    logicalBytes_ -= handle.byteCount;
+    handle = Handle{};
+}
+
+void SmbSavestateStore::clear()
+{
+    pages_.clear();
+    freePageIds_.clear();
+    pageIdsByHash_.clear();
+    handleCount_ = 0;
+    logicalBytes_ = 0;
+}
+
+SmbSavestateStore::Stats SmbSavestateStore::getStats() const
+{
+    const size_t pageCount = pages_.size() - freePageIds_.size();
+    return Stats{
+        .handleCount = handleCount_,
+        .logicalBytes = logicalBytes_,
+        .pageCount = pageCount,
+        .storedBytes = pageCount * PageBytes,
+    };
+}
+
+uint32_t SmbSavestateStore::internPage(const std::array<std::byte, PageBytes>& bytes)
+{
+    const uint64_t hash = hashPage(bytes);
+    const auto [begin, end] = pageIdsByHash_.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        Page& page = pages_[it->second];
+        if (page.bytes == bytes) {
+            page.refCount++;
+            return it->second;
+        }
+    }
+
+    uint32_t pageId = 0;
+    if (!freePageIds_.empty()) {
+        pageId = freePageIds_.back();
+        freePageIds_.pop_back();
+    }
+    else {
+        pageId = static_cast<uint32_t>(pages_.size());
+        pages_.emplace_back();
+    }
+
+    Page& page = pages_[pageId];
+    page.bytes = bytes;
+    page.hash = hash;
+    page.refCount = 1u;
+    pageIdsByHash_.emplace(hash, pageId);
+    return pageId;
+}
+
+} // namespace DirtSim::Server::SearchSupport
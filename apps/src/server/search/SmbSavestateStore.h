@@ -0,0 +1,58 @@
+#pragma once
+
+#include "core/scenarios/nes/SmolnesRuntime.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace DirtSim::Server::SearchSupport {
+
+// Content-addressed page store for search-node savestates. Savestates are split into fixed-size
+// pages and identical pages are stored once and reference counted, so a child node shares every
+// page its frame did not touch with its parent.
+class SmbSavestateStore {
+public:
+    static constexpr size_t PageBytes = 256u;
+
+    struct Handle {
+        uint64_t frameId = 0;
+        uint32_t byteCount = 0;
+        std::vector<uint32_t> pageIds;
+
+        bool empty() const { return pageIds.empty(); }
+    };
+
+    struct Stats {
+        size_t handleCount = 0;
+        size_t logicalBytes = 0;
+        size_t pageCount = 0;
+        size_t storedBytes = 0;
+    };
+
+    Handle store(const SmolnesRuntime::Savestate& savestate);
+    SmolnesRuntime::Savestate load(const Handle& handle) const;
+    void release(Handle& handle);
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    struct Page {
+        std::array<std::byte, PageBytes> bytes{};
+        uint64_t hash = 0;
+        uint32_t refCount = 0;
+    };
+
+    uint32_t internPage(const std::array<std::byte, PageBytes>& bytes);
+
+    std::vector<Page> pages_;
+    std::vector<uint32_t> freePageIds_;
+    std::unordered_multimap<uint64_t, uint32_t> pageIdsByHash_;
+    size_t handleCount_ = 0;
+    size_t logicalBytes_ = 0;
+};
+
+} // namespace DirtSim::Server::SearchSupport
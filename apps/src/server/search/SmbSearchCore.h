@@ -5,6 +5,7 @@
 #include "core/input/PlayerControlFrame.h"
 #include "core/scenarios/nes/NesFitnessDetails.h"
 #include "core/scenarios/nes/SmolnesRuntime.h"
+#include "server/search/SmbSavestateStore.h"
 
 #include <array>
 #include <cstddef>
@@ -62,9 +63,7 @@ struct SmbSearchEvaluatorSummary {
 };
 
 struct SmbSearchNode {
-    SmolnesRuntime::Savestate savestate;
-    SmolnesRuntime::MemorySnapshot memorySnapshot{};
-    std::optional<ScenarioVideoFrame> scenarioVideoFrame = std::nullopt;
+    SmbSavestateStore::Handle savestate;
     SmbSearchEvaluatorSummary evaluatorSummary;
     std::optional<size_t> parentIndex = std::nullopt;
     std::optional<SmbSearchLegalAction> actionFromParent = std::nullopt;
@@ -26,6 +26,7 @@
 #include "server/api/TrainingBestPlaybackFrame.h"
 #include "server/api/TrainingBestSnapshot.h"
 #include "server/api/TrainingResult.h"
+#include "server/evolution/RemoteEvaluation.h"
 #include "server/evolution/TrainingBestSnapshotGenerator.h"
 #include <algorithm>
 #include <array>
@@ -758,6 +759,22 @@ void Evolution::onEnter(StateMachine& dsm)
     lastCpuSampleTime_ = {};
     cpuMetrics_->get(); // Prime the delta with an initial reading.
 
+    // One transport per peer slot; each slot is its own connection and remote worker.
+    std::vector<std::shared_ptr<EvolutionSupport::RemoteEvaluationTransport>> remoteTransports;
+    for (const auto& peer : dsm.getRemoteEvaluationPeers()) {
+        for (int slot = 0; slot < dsm.getRemoteEvaluationPeerSlots(); ++slot) {
+            remoteTransports.push_back(
+                std::make_shared<EvolutionSupport::WebSocketEvaluationTransport>(
+                    peer, dsm.getRemoteEvaluationClientPubkey()));
+        }
+    }
+    if (!remoteTransports.empty()) {
+        LOG_INFO(
+            State,
+            "Evolution: Offloading evaluations to {} peer slots",
+            remoteTransports.size());
+    }
+
     executor_ = std::make_unique<EvolutionSupport::EvaluationExecutor>(
         EvolutionSupport::EvaluationExecutor::Config{
             .trainingSpec = trainingSpec,
@@ -765,6 +782,7 @@ void Evolution::onEnter(StateMachine& dsm)
             .genomeRepository = &dsm.getGenomeRepository(),
             .fitnessModel = fitnessModel_,
             .nesTileTokenizer = nesTileTokenizer_,
+            .remoteTransports = std::move(remoteTransports),
         });
     executor_->start(evolutionConfig.maxParallelEvaluations);
     queueGenerationTasks();
@@ -1037,6 +1055,10 @@ void Evolution::queueGenerationTasks()
         requests.push_back(makeEvaluationRequest(population[i], i));
     }
 
+    // The bar tracks this generation's best, which workers raise as results land. Starting
+    // from the all-time best would leave the generation best without a snapshot whenever it
+    // falls short of a carried-over or robust-averaged all-time value.
+    executor_->snapshotFitnessThresholdSet(std::numeric_limits<double>::lowest());
     executor_->generationBatchSubmit(requests, evolutionConfig, scenarioConfigOverride_);
 }
 
@@ -1977,6 +1999,12 @@ void Evolution::captureLastGenerationTelemetry()
         }
     }
     lastGenTelemetry_.phenotypeNovelOffspringMutatedCount = novelOffspringMutated;
+
+    if (executor_) {
+        const EvolutionSupport::EvaluationScheduleStats schedule = executor_->scheduleStatsGet();
+        lastGenTelemetry_.coreUtilization = schedule.coreUtilization;
+        lastGenTelemetry_.tailIdleSeconds = schedule.tailIdleMs / 1000.0;
+    }
 }
 
 void Evolution::updateTrainingPhaseTelemetry()
@@ -2375,6 +2403,8 @@ void Evolution::broadcastProgress(StateMachine& dsm)
             lastGenTelemetry_.phenotypeUniqueOffspringMutatedCount,
         .lastGenerationPhenotypeNovelOffspringMutatedCount =
             lastGenTelemetry_.phenotypeNovelOffspringMutatedCount,
+        .lastGenerationCoreUtilization = lastGenTelemetry_.coreUtilization,
+        .lastGenerationTailIdleSeconds = lastGenTelemetry_.tailIdleSeconds,
     };
 
     dsm.broadcastEventData(Api::EvolutionProgress::name(), Network::serialize_payload(progress));
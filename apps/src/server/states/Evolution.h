@@ -245,6 +245,8 @@ private:
         double breedingWeightChangesAvg = 0.0;
         int breedingWeightChangesMin = 0;
         int breedingWeightChangesMax = 0;
+        double coreUtilization = 0.0;
+        double tailIdleSeconds = 0.0;
     };
 
     LastGenerationTelemetry lastGenTelemetry_;
@@ -2,7 +2,10 @@
 #include "core/Assert.h"
 #include "core/LoggingChannels.h"
 #include "core/Timers.h"
+#include "core/World.h"
+#include "core/WorldData.h"
 #include "core/scenarios/ScenarioRegistry.h"
+#include "server/RenderBroadcastPipeline.h"
 #include "server/StateMachine.h"
 #include "server/api/TimerStatsGet.h"
 #include <spdlog/spdlog.h>
@@ -117,6 +120,24 @@ State::Any SimPaused::onEvent(const Api::PerfStatsGet::Cwc& cwc, StateMachine& d
     stats.network_send_avg_ms =
         stats.network_send_calls > 0 ? stats.network_send_total_ms / stats.network_send_calls : 0.0;
 
+    // Render broadcast, which runs on its own thread alongside physics.
+    if (const RenderBroadcastPipeline* renderPipeline = dsm.getRenderBroadcastPipeline()) {
+        const RenderBroadcastPipeline::Stats broadcast = renderPipeline->getStats();
+        stats.broadcast_calls = static_cast<uint32_t>(broadcast.broadcast);
+        stats.broadcast_total_ms = broadcast.broadcastTotalMs;
+        stats.broadcast_avg_ms =
+            broadcast.broadcast > 0 ? broadcast.broadcastTotalMs / broadcast.broadcast : 0.0;
+        stats.broadcast_dropped = static_cast<uint32_t>(broadcast.dropped);
+        stats.broadcast_overlap_ms = broadcast.overlapMs;
+    }
+
+    // Physics regression check: a hash of the current grid.
+    if (const auto grid = previousState.session.requireGridWorld(); grid.isValue()) {
+        World* world = grid.value().world;
+        stats.state_hash = fmt::format("{:016x}", world->getStateHash());
+        stats.state_hash_timestep = world->getData().timestep;
+    }
+
     spdlog::info(
         "SimPaused: API perf_stats_get returning {} physics steps, {} serializations",
         stats.physics_calls,
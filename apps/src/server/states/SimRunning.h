@@ -100,7 +100,6 @@ struct SimRunning {
     Any onEvent(const DirtSim::Api::CellGet::Cwc& cwc, StateMachine& dsm);
     Any onEvent(const DirtSim::Api::CellSet::Cwc& cwc, StateMachine& dsm);
     Any onEvent(const DirtSim::Api::ClockEventTrigger::Cwc& cwc, StateMachine& dsm);
-    Any onEvent(const DirtSim::Api::DiagramGet::Cwc& cwc, StateMachine& dsm);
     Any onEvent(const DirtSim::Api::Exit::Cwc& cwc, StateMachine& dsm);
     Any onEvent(const DirtSim::Api::FingerDown::Cwc& cwc, StateMachine& dsm);
     Any onEvent(const DirtSim::Api::FingerMove::Cwc& cwc, StateMachine& dsm);
@@ -5,6 +5,7 @@
 #include "server/StateMachine.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace DirtSim {
 namespace Server {
@@ -70,10 +71,25 @@ Any UnsavedTrainingResult::onEvent(const Api::TrainingResultSave::Cwc& cwc, Stat
     Api::TrainingResultSave::Okay response;
     response.savedIds.reserve(uniqueIds.size());
 
+    std::vector<GenomeRepository::StoreByHashEntry> storeEntries;
+    storeEntries.reserve(uniqueIds.size());
     for (const auto& id : uniqueIds) {
         const Candidate* candidate = candidateLookup.at(id);
-        const auto storeResult =
-            repo.storeOrUpdateByHash(candidate->genome, candidate->metadata, candidate->id);
+        storeEntries.push_back(
+            GenomeRepository::StoreByHashEntry{
+                .genome = &candidate->genome,
+                .metadata = candidate->metadata,
+                .preferredId = candidate->id,
+            });
+    }
+    const auto storeResults = repo.storeOrUpdateByHashBatch(storeEntries);
+    if (storeResults.size() != storeEntries.size()) {
+        cwc.sendResponse(
+            Api::TrainingResultSave::Response::error(
+                ApiError("TrainingResultSave failed to write genomes")));
+        return std::move(*this);
+    }
+    for (const auto& storeResult : storeResults) {
         response.savedIds.push_back(storeResult.id);
     }
 
@@ -8,11 +8,15 @@
 #include "core/scenarios/tests/NesTestRomPath.h"
 #include "server/evolution/EvaluationExecutor.h"
 #include "server/evolution/FitnessModelBundle.h"
+#include "server/evolution/RemoteEvaluation.h"
 #include "server/tests/TestStateMachineFixture.h"
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <gtest/gtest.h>
+#include <limits>
+#include <mutex>
 #include <random>
 #include <thread>
 #include <vector>
@@ -151,6 +155,60 @@ EvaluationExecutor makeExecutor(
         });
 }
 
+// Answers every evaluation locally with a fixed fitness, or fails every one.
+class FakeRemoteTransport : public RemoteEvaluationTransport {
+public:
+    explicit FakeRemoteTransport(bool succeed) : succeed_(succeed) {}
+
+    Result<Api::EvaluationRun::Okay, std::string> run(
+        const Api::EvaluationRun::Command& command, int /*timeoutMs*/) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            commands_.push_back(command);
+        }
+        if (!succeed_) {
+            return Result<Api::EvaluationRun::Okay, std::string>::error("Peer lost");
+        }
+        Api::EvaluationRun::Okay okay;
+        okay.fitnessEvaluation.totalFitness = kRemoteFitness;
+        okay.simTime = 1.0;
+        return Result<Api::EvaluationRun::Okay, std::string>::okay(std::move(okay));
+    }
+
+    void cancel() override {}
+
+    std::string describe() const override { return "fake"; }
+
+    std::vector<Api::EvaluationRun::Command> commandsGet() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return commands_;
+    }
+
+    static constexpr double kRemoteFitness = 42.0;
+
+private:
+    bool succeed_ = true;
+    mutable std::mutex mutex_;
+    std::vector<Api::EvaluationRun::Command> commands_;
+};
+
+EvaluationExecutor makeRemoteExecutor(
+    const TrainingSpec& trainingSpec,
+    GenomeRepository& genomeRepository,
+    std::shared_ptr<RemoteEvaluationTransport> transport)
+{
+    return EvaluationExecutor(
+        EvaluationExecutor::Config{
+            .trainingSpec = trainingSpec,
+            .brainRegistry = TrainingBrainRegistry::createDefault(),
+            .genomeRepository = &genomeRepository,
+            .fitnessModel = fitnessModelResolve(trainingSpec.organismType, trainingSpec.scenarioId),
+            .remoteTransports = { std::move(transport) },
+        });
+}
+
 EvolutionConfig makeEvolutionConfig(int populationSize, double maxSimulationTime)
 {
     EvolutionConfig config;
@@ -372,6 +430,217 @@ TEST(EvaluationExecutorTest, DuckClockPreviewCompletesAsSingleMergedEvaluation)
     EXPECT_EQ(previewCount, 1);
 }
 
+TEST(EvaluationExecutorTest, GenerationResultsBelowSnapshotThresholdOmitSnapshots)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::TreeGermination, OrganismType::TREE, 4);
+    EvaluationExecutor executor =
+        makeExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository());
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(4, 0.016);
+
+    std::vector<EvaluationRequest> requests;
+    for (int i = 0; i < 4; ++i) {
+        requests.push_back(makeGenerationRequest(
+            i, Scenario::EnumType::TreeGermination, static_cast<WeightType>(0.1f * (i + 1))));
+    }
+
+    executor.start(2);
+    executor.snapshotFitnessThresholdSet(std::numeric_limits<double>::max());
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+
+    std::vector<CompletedEvaluation> completed;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && completed.size() < 4) {
+        for (auto& result : executor.completedDrain()) {
+            completed.push_back(std::move(result));
+        }
+        for (auto& result : executor.visibleTick(std::chrono::steady_clock::now(), 0).completed) {
+            completed.push_back(std::move(result));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(completed.size(), 4u);
+    for (const auto& result : completed) {
+        EXPECT_FALSE(result.snapshot.has_value()) << "index " << result.index;
+    }
+}
+
+TEST(EvaluationExecutorTest, RemoteHostExecutorNeverCapturesSnapshots)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::Clock, OrganismType::DUCK, 1);
+    auto executor =
+        remoteHostExecutorStart(trainingSpec, fixture.stateMachine->getGenomeRepository(), 1);
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(1, 0.0);
+
+    // A lone duck clock result would claim the generation best and replay a pass locally.
+    executor->evaluationSubmit(makeDuckClockGenerationRequest(0), evolutionConfig, std::nullopt);
+
+    std::vector<CompletedEvaluation> completed;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && completed.empty()) {
+        for (auto& result : executor->completedDrain()) {
+            completed.push_back(std::move(result));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    executor->stop();
+
+    ASSERT_EQ(completed.size(), 1u);
+    EXPECT_FALSE(completed.front().snapshot.has_value());
+    EXPECT_EQ(
+        completed.front().timerStats.find("evaluation_snapshot_replay"),
+        completed.front().timerStats.end());
+}
+
+TEST(EvaluationExecutorTest, RemoteEvaluationHostEvictsIdleExecutorsAndWakesOnResults)
+{
+    TestStateMachineFixture fixture;
+    RemoteEvaluationHost host(fixture.stateMachine->getGenomeRepository(), 1, 1);
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(1, 0.016);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Api::EvaluationRun::Response> responses;
+    const auto run = [&](const TrainingSpec& trainingSpec, const EvaluationRequest& request) {
+        Api::EvaluationRun::Cwc cwc;
+        cwc.command =
+            remoteEvaluationCommandMake(trainingSpec, request, evolutionConfig, std::nullopt);
+        cwc.callback = [&](Api::EvaluationRun::Response response) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                responses.push_back(std::move(response));
+            }
+            cv.notify_all();
+        };
+        const size_t expected = responses.size() + 1;
+        host.submit(std::move(cwc));
+
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, std::chrono::seconds(2), [&]() {
+            return responses.size() == expected;
+        });
+    };
+
+    const TrainingSpec treeSpec =
+        makeTrainingSpec(Scenario::EnumType::TreeGermination, OrganismType::TREE, 1);
+    const TrainingSpec duckSpec = makeTrainingSpec(Scenario::EnumType::Clock, OrganismType::DUCK, 1);
+    ASSERT_TRUE(run(treeSpec, makeGenerationRequest(0, Scenario::EnumType::TreeGermination, 0.1f)));
+    ASSERT_TRUE(run(duckSpec, makeDuckClockGenerationRequest(0)));
+    EXPECT_EQ(host.executorCountGet(), 1u);
+    ASSERT_TRUE(run(treeSpec, makeGenerationRequest(0, Scenario::EnumType::TreeGermination, 0.2f)));
+    EXPECT_EQ(host.executorCountGet(), 1u);
+    EXPECT_EQ(host.pendingCountGet(), 0u);
+
+    host.stop();
+    for (const auto& response : responses) {
+        EXPECT_TRUE(response.isValue()) << response.errorValue().message;
+    }
+}
+
+TEST(EvaluationExecutorTest, GenerationBestResultKeepsSnapshot)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::TreeGermination, OrganismType::TREE, 4);
+    EvaluationExecutor executor =
+        makeExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository());
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(4, 0.016);
+
+    std::vector<EvaluationRequest> requests;
+    for (int i = 0; i < 4; ++i) {
+        requests.push_back(makeGenerationRequest(
+            i, Scenario::EnumType::TreeGermination, static_cast<WeightType>(0.1f * (i + 1))));
+    }
+
+    executor.start(2);
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+
+    std::vector<CompletedEvaluation> completed;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && completed.size() < 4) {
+        for (auto& result : executor.completedDrain()) {
+            completed.push_back(std::move(result));
+        }
+        for (auto& result : executor.visibleTick(std::chrono::steady_clock::now(), 0).completed) {
+            completed.push_back(std::move(result));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(completed.size(), 4u);
+    const auto best = std::max_element(
+        completed.begin(), completed.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.fitnessEvaluation.totalFitness < rhs.fitnessEvaluation.totalFitness;
+        });
+    EXPECT_TRUE(best->snapshot.has_value());
+}
+
+TEST(EvaluationExecutorTest, DuckClockCandidateBestReplaysRepresentativePassForSnapshot)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::Clock, OrganismType::DUCK, 1);
+    EvaluationExecutor executor =
+        makeExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository());
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(1, 0.0);
+    const std::vector<EvaluationRequest> requests{
+        makeDuckClockGenerationRequest(0),
+    };
+
+    executor.start(1);
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+
+    std::vector<CompletedEvaluation> completed;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && completed.empty()) {
+        for (auto& result : executor.visibleTick(std::chrono::steady_clock::now(), 0).completed) {
+            completed.push_back(std::move(result));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(completed.size(), 1u);
+    EXPECT_TRUE(completed.front().snapshot.has_value());
+    const auto replay = completed.front().timerStats.find("evaluation_snapshot_replay");
+    ASSERT_NE(replay, completed.front().timerStats.end());
+    EXPECT_EQ(replay->second.calls, 1u);
+}
+
+TEST(EvaluationExecutorTest, BackgroundDuckClockEvaluationSplitsPassesAcrossWorkers)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::Clock, OrganismType::DUCK, 2);
+    EvaluationExecutor executor =
+        makeExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository());
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(2, 0.0);
+    const std::vector<EvaluationRequest> requests{
+        makeDuckClockGenerationRequest(0),
+        makeDuckClockGenerationRequest(1),
+    };
+
+    executor.start(2);
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+
+    int completedCount = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && completedCount < 2) {
+        completedCount += completedCountDrain(executor);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // One evaluation is claimed as the preview and stays whole; the other is split.
+    EXPECT_EQ(completedCount, 2);
+    const EvaluationScheduleStats stats = executor.scheduleStatsGet();
+    EXPECT_EQ(stats.splitPasses, 3u);
+    EXPECT_GT(stats.wallMs, 0.0);
+    EXPECT_GT(stats.coreUtilization, 0.0);
+}
+
 TEST(EvaluationExecutorTest, DuckClockVisibleEvaluationUsesFlatBasicPreviewLighting)
 {
     TestStateMachineFixture fixture;
@@ -662,3 +931,89 @@ TEST(EvaluationExecutorTest, NesTileVisibleEvaluationBootstrapsTokenizer)
     ASSERT_TRUE(configError.has_value());
     EXPECT_NE(configError->find("Active NES tile evaluations"), std::string::npos);
 }
+
+TEST(EvaluationExecutorTest, RemoteWorkersShareGenerationBatchWithLocalWorkers)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::TreeGermination, OrganismType::TREE, 6);
+    auto transport = std::make_shared<FakeRemoteTransport>(true);
+    EvaluationExecutor executor =
+        makeRemoteExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository(), transport);
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(6, 0.5);
+
+    std::vector<EvaluationRequest> requests;
+    for (int i = 0; i < 6; ++i) {
+        requests.push_back(makeGenerationRequest(
+            i, Scenario::EnumType::TreeGermination, static_cast<WeightType>(0.1f * (i + 1))));
+    }
+
+    executor.start(1);
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+
+    std::vector<CompletedEvaluation> completed;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline && completed.size() < 6u) {
+        for (auto& result : executor.completedDrain()) {
+            completed.push_back(std::move(result));
+        }
+        for (auto& result : executor.visibleTick(std::chrono::steady_clock::now(), 0).completed) {
+            completed.push_back(std::move(result));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(completed.size(), 6u);
+
+    const auto commands = transport->commandsGet();
+    ASSERT_FALSE(commands.empty());
+    EXPECT_EQ(executor.scheduleStatsGet().remoteTasks, commands.size());
+    for (const auto& command : commands) {
+        EXPECT_TRUE(command.trainingSpec.population.empty());
+        ASSERT_TRUE(command.genomeWeights.has_value());
+        EXPECT_EQ(command.genomeWeights->size(), makeNeuralNetGenome(0.0f).weights.size());
+    }
+
+    std::vector<int> indices;
+    for (const auto& result : completed) {
+        indices.push_back(result.index);
+        if (result.fitnessEvaluation.totalFitness == FakeRemoteTransport::kRemoteFitness) {
+            EXPECT_FALSE(result.snapshot.has_value());
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, (std::vector<int>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST(EvaluationExecutorTest, FailedRemoteEvaluationIsRequeuedForLocalWorkers)
+{
+    TestStateMachineFixture fixture;
+    const TrainingSpec trainingSpec =
+        makeTrainingSpec(Scenario::EnumType::TreeGermination, OrganismType::TREE, 2);
+    auto transport = std::make_shared<FakeRemoteTransport>(false);
+    EvaluationExecutor executor =
+        makeRemoteExecutor(trainingSpec, fixture.stateMachine->getGenomeRepository(), transport);
+    const EvolutionConfig evolutionConfig = makeEvolutionConfig(2, 0.016);
+    const std::vector<EvaluationRequest> requests{
+        makeGenerationRequest(0, Scenario::EnumType::TreeGermination, 0.1f),
+        makeGenerationRequest(1, Scenario::EnumType::TreeGermination, 0.2f),
+    };
+
+    // Paused, the local worker holds its task so the remote worker takes the other one.
+    executor.start(1);
+    executor.pauseSet(true);
+    executor.generationBatchSubmit(requests, evolutionConfig, std::nullopt);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    executor.pauseSet(false);
+
+    int completedCount = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+    while (std::chrono::steady_clock::now() < deadline && completedCount < 2) {
+        completedCount += completedCountDrain(executor);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(completedCount, 2);
+    EXPECT_EQ(transport->commandsGet().size(), 1u);
+    EXPECT_EQ(executor.scheduleStatsGet().remoteRequeues, 1u);
+    EXPECT_EQ(executor.scheduleStatsGet().remoteTasks, 0u);
+}
@@ -0,0 +1,120 @@
+#include "server/evolution/EvaluationScheduler.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace DirtSim::Server::EvolutionSupport;
+
+TEST(EvaluationSchedulerTest, BatchAssignsLongestTasksToLeastLoadedWorkers)
+{
+    EvaluationScheduler<std::string> scheduler;
+    scheduler.resize(2);
+    scheduler.pushBatch({
+        { "short-a", 1.0 },
+        { "long", 8.0 },
+        { "short-b", 1.0 },
+        { "medium", 4.0 },
+    });
+    ASSERT_EQ(scheduler.queuedCount(), 4u);
+
+    // long -> worker 0, medium -> worker 1, then the shorts top up worker 1.
+    EXPECT_EQ(scheduler.take(0)->task, "long");
+    EXPECT_EQ(scheduler.take(1)->task, "medium");
+    EXPECT_EQ(scheduler.take(1)->task, "short-a");
+    EXPECT_EQ(scheduler.take(1)->task, "short-b");
+    EXPECT_TRUE(scheduler.empty());
+    EXPECT_FALSE(scheduler.take(0).has_value());
+}
+
+TEST(EvaluationSchedulerTest, IdleWorkerStealsFromMostLoadedWorker)
+{
+    EvaluationScheduler<std::string> scheduler;
+    scheduler.resize(3);
+    scheduler.pushToWorker(0, "a-small", 1.0);
+    scheduler.pushToWorker(1, "b-big", 5.0);
+    scheduler.pushToWorker(1, "b-small", 2.0);
+
+    const auto stolen = scheduler.take(2);
+    ASSERT_TRUE(stolen.has_value());
+    EXPECT_TRUE(stolen->stolen);
+    EXPECT_EQ(stolen->task, "b-big");
+
+    const auto own = scheduler.take(0);
+    ASSERT_TRUE(own.has_value());
+    EXPECT_FALSE(own->stolen);
+    EXPECT_EQ(own->task, "a-small");
+}
+
+TEST(EvaluationSchedulerTest, EqualCostsKeepSubmissionOrder)
+{
+    EvaluationScheduler<int> scheduler;
+    scheduler.resize(1);
+    std::vector<std::pair<int, double>> batch;
+    for (int i = 0; i < 5; ++i) {
+        batch.emplace_back(i, 3.0);
+    }
+    scheduler.pushBatch(std::move(batch));
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(scheduler.take(0)->task, i);
+    }
+}
+
+TEST(EvaluationSchedulerTest, TakeIfSkipsIneligibleTasksAndStealsEligibleOnes)
+{
+    EvaluationScheduler<std::string> scheduler;
+    scheduler.resize(3);
+    scheduler.pushToWorker(0, "pass-a", 6.0);
+    scheduler.pushToWorker(0, "whole-a", 1.0);
+    scheduler.pushToWorker(1, "pass-b", 3.0);
+    const auto whole = [](const std::string& task) { return task.starts_with("whole"); };
+
+    EXPECT_TRUE(scheduler.anyOf(whole));
+    const auto stolen = scheduler.takeIf(2, whole);
+    ASSERT_TRUE(stolen.has_value());
+    EXPECT_TRUE(stolen->stolen);
+    EXPECT_EQ(stolen->task, "whole-a");
+
+    EXPECT_FALSE(scheduler.anyOf(whole));
+    EXPECT_FALSE(scheduler.takeIf(2, whole).has_value());
+    EXPECT_EQ(scheduler.queuedCount(), 2u);
+    EXPECT_EQ(scheduler.take(0)->task, "pass-a");
+}
+
+TEST(EvaluationCostModelTest, UnseenKeysUseMeanOfKnownKeys)
+{
+    EvaluationCostModel model;
+    EXPECT_GT(model.estimateMs("unknown"), 0.0);
+
+    model.observe("clock/duck", 400.0);
+    model.observe("tree/nn", 100.0);
+    EXPECT_DOUBLE_EQ(model.estimateMs("clock/duck"), 400.0);
+    EXPECT_DOUBLE_EQ(model.estimateMs("unknown"), 250.0);
+
+    model.observe("tree/nn", 200.0);
+    EXPECT_GT(model.estimateMs("tree/nn"), 100.0);
+    EXPECT_LT(model.estimateMs("tree/nn"), 200.0);
+}
+
+TEST(EvaluationScheduleTrackerTest, ReportsUtilizationAndTailIdle)
+{
+    using Clock = EvaluationScheduleTracker::Clock;
+    const Clock::time_point start{};
+    const auto ms = [start](int value) { return start + std::chrono::milliseconds(value); };
+
+    EvaluationScheduleTracker tracker;
+    tracker.windowStart(start, 2);
+    tracker.taskFinished(ms(0), ms(60));
+    tracker.workerStarved(ms(60));
+    tracker.taskFinished(ms(0), ms(100));
+
+    const EvaluationScheduleStats stats = tracker.stats();
+    EXPECT_DOUBLE_EQ(stats.wallMs, 100.0);
+    EXPECT_DOUBLE_EQ(stats.busyMs, 160.0);
+    EXPECT_DOUBLE_EQ(stats.coreUtilization, 0.8);
+    EXPECT_DOUBLE_EQ(stats.tailIdleMs, 40.0);
+    EXPECT_EQ(stats.completedTasks, 2u);
+}
@@ -0,0 +1,119 @@
+#include "core/organisms/brains/Genome.h"
+#include "core/organisms/evolution/GenomeRepository.h"
+#include "server/GenomeListIndex.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace DirtSim;
+using namespace DirtSim::Server;
+
+namespace {
+
+GenomeMetadata makeMetadata(
+    const std::string& name,
+    double fitness,
+    OrganismType organismType,
+    const std::string& brainKind,
+    GenomePoolId genomePoolId = GenomePoolId::DirtSim)
+{
+    GenomeMetadata meta;
+    meta.name = name;
+    meta.fitness = fitness;
+    meta.createdTimestamp = 1000 + static_cast<uint64_t>(fitness);
+    meta.organismType = organismType;
+    meta.brainKind = brainKind;
+    meta.genomePoolId = genomePoolId;
+    return meta;
+}
+
+std::vector<std::string> names(const Api::GenomeList::Okay& response)
+{
+    std::vector<std::string> result;
+    for (const auto& entry : response.genomes) {
+        result.push_back(entry.metadata.name);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(GenomeListIndexTest, PagesThroughSortedGenomes)
+{
+    GenomeRepository repo;
+    for (int i = 0; i < 5; ++i) {
+        repo.store(
+            UUID::generate(),
+            Genome(1, static_cast<WeightType>(i)),
+            makeMetadata("g" + std::to_string(i), i, OrganismType::TREE, "NeuralNet"));
+    }
+
+    GenomeListIndex index;
+    Api::GenomeList::Command command;
+    command.sortKey = GenomeSortKey::Fitness;
+    command.sortDirection = GenomeSortDirection::Desc;
+    command.offset = 1;
+    command.limit = 2;
+
+    const auto page = index.query(repo, command);
+    EXPECT_EQ(page.totalCount, 5u);
+    EXPECT_EQ(names(page), (std::vector<std::string>{ "g3", "g2" }));
+
+    command.sortDirection = GenomeSortDirection::Asc;
+    command.offset = 4;
+    command.limit = 0;
+    EXPECT_EQ(names(index.query(repo, command)), (std::vector<std::string>{ "g4" }));
+
+    command.offset = 10;
+    const auto pastEnd = index.query(repo, command);
+    EXPECT_TRUE(pastEnd.genomes.empty());
+    EXPECT_EQ(pastEnd.totalCount, 5u);
+}
+
+TEST(GenomeListIndexTest, FiltersByOrganismBrainAndPool)
+{
+    GenomeRepository repo;
+    const Genome genome(1, 0.5f);
+    repo.store(UUID::generate(), genome, makeMetadata("tree", 1.0, OrganismType::TREE, "A"));
+    repo.store(UUID::generate(), genome, makeMetadata("duckA", 2.0, OrganismType::DUCK, "A"));
+    repo.store(UUID::generate(), genome, makeMetadata("duckB", 3.0, OrganismType::DUCK, "B"));
+    repo.store(
+        UUID::generate(),
+        genome,
+        makeMetadata("smb", 4.0, OrganismType::NES_DUCK, "A", GenomePoolId::Smb));
+
+    GenomeListIndex index;
+    Api::GenomeList::Command command;
+    command.sortKey = GenomeSortKey::Fitness;
+
+    command.organismType = OrganismType::DUCK;
+    EXPECT_EQ(names(index.query(repo, command)), (std::vector<std::string>{ "duckB", "duckA" }));
+
+    command.brainKind = "A";
+    const auto duckA = index.query(repo, command);
+    EXPECT_EQ(duckA.totalCount, 1u);
+    EXPECT_EQ(names(duckA), (std::vector<std::string>{ "duckA" }));
+
+    command = Api::GenomeList::Command{};
+    command.genomePoolId = GenomePoolId::Smb;
+    EXPECT_EQ(names(index.query(repo, command)), (std::vector<std::string>{ "smb" }));
+}
+
+TEST(GenomeListIndexTest, ReusesCachedMetadataUntilRepositoryChanges)
+{
+    GenomeRepository repo;
+    const GenomeId id = UUID::generate();
+    repo.store(id, Genome(1, 0.5f), makeMetadata("a", 1.0, OrganismType::TREE, "A"));
+
+    GenomeListIndex index;
+    Api::GenomeList::Command command;
+    EXPECT_EQ(index.query(repo, command).totalCount, 1u);
+    command.sortKey = GenomeSortKey::Generation;
+    EXPECT_EQ(index.query(repo, command).totalCount, 1u);
+    EXPECT_EQ(index.getRefreshCount(), 1u);
+
+    repo.remove(id);
+    EXPECT_EQ(index.query(repo, command).totalCount, 0u);
+    EXPECT_EQ(index.getRefreshCount(), 2u);
+}
@@ -0,0 +1,72 @@
+#include "server/ReadOnlyQueryExecutor.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace DirtSim;
+using namespace DirtSim::Server;
+
+TEST(ReadOnlyQueryExecutorTest, RunsQueriesOffTheSubmittingThread)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> queryThreads;
+    ReadOnlyQueryExecutor executor(2);
+
+    for (int i = 0; i < 8; ++i) {
+        executor.submit([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            queryThreads.insert(std::this_thread::get_id());
+        });
+    }
+    executor.waitUntilIdle();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_FALSE(queryThreads.empty());
+    EXPECT_EQ(queryThreads.count(std::this_thread::get_id()), 0u);
+
+    const ReadOnlyQueryExecutor::Stats stats = executor.getStats();
+    EXPECT_EQ(stats.submitted, 8u);
+    EXPECT_EQ(stats.completed, 8u);
+}
+
+TEST(ReadOnlyQueryExecutorTest, SlowQueryDoesNotBlockOtherWorkers)
+{
+    std::atomic<bool> release{ false };
+    std::atomic<bool> fastDone{ false };
+    ReadOnlyQueryExecutor executor(2);
+
+    executor.submit([&] {
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    executor.submit([&] { fastDone = true; });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!fastDone.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(fastDone.load());
+
+    release = true;
+    executor.waitUntilIdle();
+    EXPECT_EQ(executor.getStats().completed, 2u);
+}
+
+TEST(ReadOnlyQueryExecutorTest, ThrowingQueryLeavesWorkerRunning)
+{
+    std::atomic<int> ran{ 0 };
+    ReadOnlyQueryExecutor executor(1);
+
+    executor.submit([] { throw std::runtime_error("query failed"); });
+    executor.submit([&] { ran++; });
+    executor.waitUntilIdle();
+
+    EXPECT_EQ(ran.load(), 1);
+    EXPECT_EQ(executor.getStats().completed, 2u);
+}
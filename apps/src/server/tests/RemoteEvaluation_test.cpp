@@ -0,0 +1,82 @@
+#include "server/evolution/RemoteEvaluation.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace DirtSim::Server::EvolutionSupport;
+
+namespace {
+
+constexpr const char* kPeerKey =
+    "ssh-ed25519 AAAAC3NzaC1lZDI1NTE5AAAAIOj2Bz3lS2xJ7lJ0k6Yl0vX2b4jv9w0Qm1l2cR4f5T6u dirtsim@pi5";
+
+std::filesystem::path tempPathMake(const std::string& stem, const std::string& extension)
+{
+    return std::filesystem::temp_directory_path()
+        / (stem + "-"
+           + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())
+           + extension);
+}
+
+} // namespace
+
+TEST(RemoteEvaluationPeerTrustTest, TrustsNoKeyWithoutAllowlist)
+{
+    const RemoteEvaluationPeerTrust trust;
+    EXPECT_FALSE(trust.isTrustedKey(kPeerKey));
+    EXPECT_FALSE(trust.isTrustedKey(""));
+}
+
+TEST(RemoteEvaluationPeerTrustTest, TrustsAllowlistedKeysRegardlessOfComment)
+{
+    const RemoteEvaluationPeerTrust trust({ kPeerKey, "" });
+    EXPECT_TRUE(trust.isTrustedKey(kPeerKey));
+    EXPECT_TRUE(trust.isTrustedKey(
+        "ssh-ed25519 AAAAC3NzaC1lZDI1NTE5AAAAIOj2Bz3lS2xJ7lJ0k6Yl0vX2b4jv9w0Qm1l2cR4f5T6u"));
+    EXPECT_FALSE(trust.isTrustedKey(
+        "ssh-ed25519 AAAAC3NzaC1lZDI1NTE5AAAAIOj2Bz3lS2xJ7lJ0k6Yl0vX2b4jv9w0Qm1l2cR4f5T6v"));
+    EXPECT_FALSE(trust.isTrustedKey(""));
+}
+
+TEST(RemoteEvaluationPeerTrustTest, LoadsClientKeysFromPeerAllowlist)
+{
+    const auto path = tempPathMake("dirtsim-peer-allowlist", ".json");
+    {
+        std::ofstream file(path);
+        file << R"([{"host": "192.168.1.20", "ssh_user": "dirtsim", "ssh_port": 22,)"
+             << R"( "host_fingerprint_sha256": "SHA256:abc", "client_pubkey": ")" << kPeerKey
+             << R"("}])";
+    }
+
+    const auto result = RemoteEvaluationPeerTrust::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(result.isValue()) << result.errorValue();
+    EXPECT_TRUE(result.value().isTrustedKey(kPeerKey));
+    EXPECT_FALSE(result.value().isTrustedKey("192.168.1.20"));
+
+    EXPECT_TRUE(RemoteEvaluationPeerTrust::load(path).isError());
+}
+
+TEST(RemoteEvaluationPeerTrustTest, ReadsPublicKeyFile)
+{
+    const auto path = tempPathMake("dirtsim-peer-key", ".pub");
+    {
+        std::ofstream file(path);
+        file << kPeerKey << "\n";
+    }
+
+    const auto result = RemoteEvaluationPeerTrust::publicKeyRead(path);
+    ASSERT_TRUE(result.isValue()) << result.errorValue().message;
+    EXPECT_EQ(result.value(), kPeerKey);
+
+    {
+        std::ofstream file(path);
+        file << "not-a-key\n";
+    }
+    EXPECT_TRUE(RemoteEvaluationPeerTrust::publicKeyRead(path).isError());
+    std::filesystem::remove(path);
+    EXPECT_TRUE(RemoteEvaluationPeerTrust::publicKeyRead(path).isError());
+}
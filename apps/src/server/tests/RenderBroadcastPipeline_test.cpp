@@ -0,0 +1,133 @@
+#include "server/RenderBroadcastPipeline.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace DirtSim;
+using namespace DirtSim::Server;
+
+TEST(RenderBroadcastPipelineTest, BroadcastsPublishedFrameOnItsOwnThread)
+{
+    std::mutex mutex;
+    std::vector<int32_t> timesteps;
+    std::thread::id broadcastThread;
+
+    RenderBroadcastPipeline pipeline([&](const RenderFrame& frame) {
+        std::lock_guard<std::mutex> lock(mutex);
+        timesteps.push_back(frame.data.timestep);
+        broadcastThread = std::this_thread::get_id();
+    });
+
+    RenderFrame& frame = pipeline.beginFrame();
+    frame.data.timestep = 7;
+    pipeline.publishFrame();
+    pipeline.waitUntilIdle();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(timesteps.size(), 1u);
+    EXPECT_EQ(timesteps.front(), 7);
+    EXPECT_NE(broadcastThread, std::this_thread::get_id());
+
+    const RenderBroadcastPipeline::Stats stats = pipeline.getStats();
+    EXPECT_EQ(stats.published, 1u);
+    EXPECT_EQ(stats.broadcast, 1u);
+    EXPECT_EQ(stats.dropped, 0u);
+}
+
+TEST(RenderBroadcastPipelineTest, SlowBroadcasterDropsSupersededFrames)
+{
+    std::atomic<bool> started{ false };
+    std::atomic<bool> release{ false };
+    std::mutex mutex;
+    std::vector<int32_t> timesteps;
+
+    RenderBroadcastPipeline pipeline([&](const RenderFrame& frame) {
+        started = true;
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        timesteps.push_back(frame.data.timestep);
+    });
+
+    // The first frame occupies the broadcaster; the rest replace each other while pending.
+    pipeline.beginFrame().data.timestep = 1;
+    pipeline.publishFrame();
+    while (!started.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (int32_t step = 2; step <= 5; ++step) {
+        pipeline.beginFrame().data.timestep = step;
+        pipeline.publishFrame();
+    }
+
+    release = true;
+    pipeline.waitUntilIdle();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(timesteps.size(), 2u);
+    EXPECT_EQ(timesteps.front(), 1);
+    EXPECT_EQ(timesteps.back(), 5);
+
+    const RenderBroadcastPipeline::Stats stats = pipeline.getStats();
+    EXPECT_EQ(stats.published, 5u);
+    EXPECT_EQ(stats.broadcast, 2u);
+    EXPECT_EQ(stats.dropped, 3u);
+}
+
+TEST(RenderBroadcastPipelineTest, ReportsBroadcastTimeThatOverlapsPhysics)
+{
+    std::atomic<bool> started{ false };
+    RenderBroadcastPipeline pipeline([&](const RenderFrame&) {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    });
+
+    pipeline.publishFrame();
+    while (!started.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    pipeline.beginPhysics();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pipeline.endPhysics();
+    pipeline.waitUntilIdle();
+
+    const RenderBroadcastPipeline::Stats stats = pipeline.getStats();
+    EXPECT_GE(stats.overlapMs, 5.0);
+    EXPECT_LE(stats.overlapMs, stats.broadcastTotalMs);
+}
+
+TEST(RenderBroadcastPipelineTest, ThrowingBroadcastCountsAsDroppedAndKeepsRunning)
+{
+    std::mutex mutex;
+    std::vector<int32_t> timesteps;
+
+    RenderBroadcastPipeline pipeline([&](const RenderFrame& frame) {
+        if (frame.data.timestep == 1) {
+            throw std::runtime_error("send failed");
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        timesteps.push_back(frame.data.timestep);
+    });
+
+    pipeline.beginFrame().data.timestep = 1;
+    pipeline.publishFrame();
+    pipeline.waitUntilIdle();
+    pipeline.beginFrame().data.timestep = 2;
+    pipeline.publishFrame();
+    pipeline.waitUntilIdle();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(timesteps.size(), 1u);
+    EXPECT_EQ(timesteps.front(), 2);
+
+    const RenderBroadcastPipeline::Stats stats = pipeline.getStats();
+    EXPECT_EQ(stats.published, 2u);
+    EXPECT_EQ(stats.broadcast, 1u);
+    EXPECT_EQ(stats.dropped, 1u);
+}
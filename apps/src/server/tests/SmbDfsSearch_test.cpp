@@ -144,6 +144,7 @@ bool isCreationEvent(SmbDfsSearchTraceEventType eventType)
         case SmbDfsSearchTraceEventType::RootInitialized:
             return true;
         case SmbDfsSearchTraceEventType::Backtracked:
+        case SmbDfsSearchTraceEventType::PrunedBeamWidth:
         case SmbDfsSearchTraceEventType::CompletedBudgetExceeded:
         case SmbDfsSearchTraceEventType::CompletedExhausted:
         case SmbDfsSearchTraceEventType::CompletedMilestoneReached:
@@ -182,6 +183,8 @@ std::string toString(SmbDfsSearchTraceEventType eventType)
             return "PrunedTransposition";
         case SmbDfsSearchTraceEventType::PrunedNonGameplay:
             return "PrunedNonGameplay";
+        case SmbDfsSearchTraceEventType::PrunedBeamWidth:
+            return "PrunedBeamWidth";
         case SmbDfsSearchTraceEventType::RootInitialized:
             return "RootInitialized";
         case SmbDfsSearchTraceEventType::Stopped:
@@ -550,6 +553,7 @@ WindowStats computeWindowStats(
             case SmbDfsSearchTraceEventType::PrunedNonGameplay:
                 stats.prunedNonGameplayCount++;
                 break;
+            case SmbDfsSearchTraceEventType::PrunedBeamWidth:
             case SmbDfsSearchTraceEventType::CompletedBudgetExceeded:
             case SmbDfsSearchTraceEventType::CompletedExhausted:
             case SmbDfsSearchTraceEventType::CompletedMilestoneReached:
@@ -668,6 +672,7 @@ TraceEventStats computeTraceEventStats(
             case SmbDfsSearchTraceEventType::PrunedNonGameplay:
                 stats.prunedNonGameplayCount++;
                 break;
+            case SmbDfsSearchTraceEventType::PrunedBeamWidth:
             case SmbDfsSearchTraceEventType::CompletedBudgetExceeded:
             case SmbDfsSearchTraceEventType::CompletedExhausted:
             case SmbDfsSearchTraceEventType::CompletedMilestoneReached:
@@ -1240,6 +1245,7 @@ std::string buildDivergenceHistogramReport(
                 bucket.prunedNonGameplayCount++;
                 break;
             case SmbDfsSearchTraceEventType::Backtracked:
+            case SmbDfsSearchTraceEventType::PrunedBeamWidth:
             case SmbDfsSearchTraceEventType::CompletedBudgetExceeded:
             case SmbDfsSearchTraceEventType::CompletedExhausted:
             case SmbDfsSearchTraceEventType::CompletedMilestoneReached:
@@ -1492,6 +1498,7 @@ void printTraceSummary(const std::vector<SmbDfsSearchTraceEntry>& trace)
             case SmbDfsSearchTraceEventType::PrunedNonGameplay:
                 prunedNonGameplayCount++;
                 break;
+            case SmbDfsSearchTraceEventType::PrunedBeamWidth:
             case SmbDfsSearchTraceEventType::CompletedBudgetExceeded:
             case SmbDfsSearchTraceEventType::CompletedExhausted:
             case SmbDfsSearchTraceEventType::CompletedMilestoneReached:
@@ -1698,6 +1705,39 @@ TEST(SmbDfsSearchTest, TickAdvancesSearch)
     }
 }
 
+TEST(SmbDfsSearchTest, ChildSavestatesSharePagesWithParents)
+{
+    REQUIRE_SMB_ROM_OR_SKIP();
+
+    SmbSearchHarness harness;
+    const auto fixtureResult = harness.captureFixture(SmbSearchRootFixtureId::FlatGroundSanity);
+    ASSERT_FALSE(fixtureResult.isError()) << fixtureResult.errorValue();
+
+    SmbDfsSearch search;
+    const auto startResult = search.startFromFixture(fixtureResult.value());
+    ASSERT_FALSE(startResult.isError()) << startResult.errorValue();
+
+    for (size_t tickIndex = 0; tickIndex < 8u; ++tickIndex) {
+        const auto tickResult = search.tick();
+        ASSERT_FALSE(tickResult.error.has_value()) << tickResult.error.value();
+        ASSERT_FALSE(tickResult.completed);
+    }
+
+    // Live nodes hold compact child savestates that mostly reuse their parent's pages.
+    const SmbSavestateStore::Stats stats = search.getSavestateStoreStats();
+    ASSERT_GT(stats.handleCount, 1u);
+    EXPECT_LT(stats.storedBytes * 2u, stats.logicalBytes);
+    EXPECT_LT(stats.logicalBytes, stats.handleCount * smolnesRuntimeGetSavestateSize());
+
+    // Nodes keep neither frames nor memory snapshots, only their savestate pages.
+    const SmbDfsSearchMemoryStats memoryStats = search.getMemoryStats();
+    ASSERT_GT(memoryStats.nodeCount, 1u);
+    EXPECT_EQ(memoryStats.savestateBytes, stats.storedBytes);
+    EXPECT_LT(
+        memoryStats.nodeBytes / memoryStats.nodeCount,
+        sizeof(DirtSim::SmolnesRuntime::MemorySnapshot));
+}
+
 TEST(SmbDfsSearchTest, PrunedNodeDoesNotCompleteBestFrontierMilestone)
 {
     REQUIRE_SMB_ROM_OR_SKIP();
@@ -2037,6 +2077,82 @@ TEST(SmbDfsSearchTest, FindsPlanToFirstGap)
         search.getPlan().summary.elapsedFrames, flatResult.value().evaluatorSummary.gameplayFrames);
 }
 
+TEST(SmbDfsSearchTest, BestFirstReachesFixtureMilestonesAndReportsFramesAgainstDfs)
+{
+    REQUIRE_SMB_ROM_OR_SKIP();
+
+    SmbSearchHarness harness;
+    const auto flatResult = harness.captureFixture(SmbSearchRootFixtureId::FlatGroundSanity);
+    ASSERT_FALSE(flatResult.isError()) << flatResult.errorValue();
+
+    constexpr uint64_t kFrameBudget = 20'000u;
+    const auto runToFrontier = [&flatResult](SmbSearchStrategy strategy, uint64_t targetFrontier) {
+        SmbDfsSearch search(
+            SmbDfsSearchOptions{
+                .strategy = strategy,
+                .maxSearchedNodeCount = 0u,
+                .maxEmulatorFrameCount = kFrameBudget,
+                .stallFrameLimit = 120u,
+                .stopAfterBestFrontier = targetFrontier,
+            });
+        const auto startResult = search.startFromFixture(flatResult.value());
+        EXPECT_FALSE(startResult.isError()) << startResult.errorValue();
+        const auto runResult = runSearchToCompletion(search, kFrameBudget * 2u);
+        EXPECT_FALSE(runResult.isError()) << runResult.errorValue();
+        return std::make_pair(search.getProgress().bestFrontier, search.getEmulatorFrameCount());
+    };
+
+    for (const SmbSearchRootFixtureId fixtureId :
+         { SmbSearchRootFixtureId::FirstGoomba, SmbSearchRootFixtureId::FirstGap }) {
+        const auto targetResult = harness.captureFixture(fixtureId);
+        ASSERT_FALSE(targetResult.isError()) << targetResult.errorValue();
+        const uint64_t targetFrontier = targetResult.value().evaluatorSummary.bestFrontier;
+
+        const auto [dfsFrontier, dfsFrames] =
+            runToFrontier(SmbSearchStrategy::DepthFirst, targetFrontier);
+        const auto [bestFirstFrontier, bestFirstFrames] =
+            runToFrontier(SmbSearchStrategy::BestFirst, targetFrontier);
+        std::cout << targetResult.value().name << " frames to milestone: dfs=" << dfsFrames
+                  << (dfsFrontier >= targetFrontier ? "" : " (not reached)")
+                  << " bestFirst=" << bestFirstFrames
+                  << (bestFirstFrontier >= targetFrontier ? "" : " (not reached)") << "\n";
+
+        EXPECT_GE(bestFirstFrontier, targetFrontier);
+        EXPECT_LE(bestFirstFrames, kFrameBudget);
+    }
+}
+
+TEST(SmbDfsSearchTest, BeamWidthCapsBestFirstOpenNodes)
+{
+    REQUIRE_SMB_ROM_OR_SKIP();
+
+    SmbSearchHarness harness;
+    const auto fixtureResult = harness.captureFixture(SmbSearchRootFixtureId::FlatGroundSanity);
+    ASSERT_FALSE(fixtureResult.isError()) << fixtureResult.errorValue();
+
+    constexpr uint32_t kBeamWidth = 8u;
+    SmbDfsSearch search(
+        SmbDfsSearchOptions{
+            .strategy = SmbSearchStrategy::BestFirst,
+            .maxSearchedNodeCount = 400u,
+            .beamWidth = kBeamWidth,
+            .stallFrameLimit = 120u,
+        });
+    const auto startResult = search.startFromFixture(fixtureResult.value());
+    ASSERT_FALSE(startResult.isError()) << startResult.errorValue();
+
+    for (size_t tickIndex = 0; tickIndex < 1000u && !search.isCompleted(); ++tickIndex) {
+        const auto tickResult = search.tick();
+        ASSERT_FALSE(tickResult.error.has_value()) << tickResult.error.value();
+        ASSERT_LE(search.getOpenNodeCount(), kBeamWidth);
+    }
+
+    const auto& trace = search.getTrace();
+    EXPECT_TRUE(std::any_of(trace.begin(), trace.end(), [](const SmbDfsSearchTraceEntry& entry) {
+        return entry.eventType == SmbDfsSearchTraceEventType::PrunedBeamWidth;
+    }));
+}
+
 TEST(SmbDfsSearchTest, DISABLED_ReportFirstGoombaSearch)
 {
     REQUIRE_SMB_ROM_OR_SKIP();
@@ -0,0 +1,77 @@
+#include "server/search/SmbSavestateStore.h"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+
+using namespace DirtSim;
+using namespace DirtSim::Server::SearchSupport;
+
+namespace {
+
+SmolnesRuntime::Savestate makeSavestate(uint64_t frameId, size_t byteCount, uint8_t seed)
+{
+    SmolnesRuntime::Savestate savestate;
+    savestate.frameId = frameId;
+    savestate.bytes.resize(byteCount);
+    for (size_t i = 0; i < byteCount; ++i) {
+        savestate.bytes[i] = static_cast<std::byte>((i * 31u + (i / 256u) * 17u + seed) & 0xFFu);
+    }
+    return savestate;
+}
+
+} // namespace
+
+TEST(SmbSavestateStoreTest, LoadReturnsStoredBytes)
+{
+    SmbSavestateStore store;
+    const SmolnesRuntime::Savestate savestate = makeSavestate(42u, 1000u, 3u);
+
+    const SmbSavestateStore::Handle handle = store.store(savestate);
+    const SmolnesRuntime::Savestate loaded = store.load(handle);
+
+    EXPECT_EQ(handle.pageIds.size(), 4u);
+    EXPECT_EQ(loaded.frameId, 42u);
+    EXPECT_EQ(loaded.bytes, savestate.bytes);
+}
+
+TEST(SmbSavestateStoreTest, ChildSharesUnchangedPagesWithParent)
+{
+    SmbSavestateStore store;
+    const SmolnesRuntime::Savestate parent = makeSavestate(1u, 16u * 256u, 7u);
+    SmolnesRuntime::Savestate child = parent;
+    child.frameId = 2u;
+    child.bytes[5u * 256u + 9u] ^= std::byte{ 0x01 };
+
+    SmbSavestateStore::Handle parentHandle = store.store(parent);
+    SmbSavestateStore::Handle childHandle = store.store(child);
+
+    SmbSavestateStore::Stats stats = store.getStats();
+    EXPECT_EQ(stats.handleCount, 2u);
+    EXPECT_EQ(stats.logicalBytes, 32u * 256u);
+    EXPECT_EQ(stats.pageCount, 17u);
+    EXPECT_EQ(store.load(childHandle).bytes, child.bytes);
+
+    store.release(parentHandle);
+    EXPECT_TRUE(parentHandle.empty());
+    stats = store.getStats();
+    EXPECT_EQ(stats.handleCount, 1u);
+    EXPECT_EQ(stats.pageCount, 16u);
+    EXPECT_EQ(store.load(childHandle).bytes, child.bytes);
+
+    store.release(childHandle);
+    EXPECT_EQ(store.getStats().pageCount, 0u);
+    EXPECT_EQ(store.getStats().logicalBytes, 0u);
+}
+
+TEST(SmbSavestateStoreTest, ReleasedPagesAreReused)
+{
+    SmbSavestateStore store;
+    SmbSavestateStore::Handle first = store.store(makeSavestate(1u, 512u, 1u));
+    store.release(first);
+
+    const SmolnesRuntime::Savestate second = makeSavestate(2u, 512u, 2u);
+    const SmbSavestateStore::Handle handle = store.store(second);
+
+    EXPECT_EQ(store.getStats().pageCount, 2u);
+    EXPECT_EQ(store.load(handle).bytes, second.bytes);
+}
@@ -0,0 +1,134 @@
+#include "core/WorldData.h"
+#include "server/api/StateRegionGet.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace DirtSim;
+using namespace DirtSim::Api;
+
+namespace {
+
+WorldData makeWorldData()
+{
+    WorldData data;
+    data.width = 12;
+    data.height = 8;
+    data.cells.resize(static_cast<size_t>(data.width) * data.height);
+    data.organism_ids.resize(data.cells.size());
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            Cell& cell = data.at(x, y);
+            cell.replaceMaterial(
+                (x + y) % 2 == 0 ? Material::EnumType::Dirt : Material::EnumType::Water,
+                0.25f + 0.05f * static_cast<float>(x));
+            cell.velocity = Vector2f{ static_cast<float>(x), -static_cast<float>(y) };
+            cell.pressure = static_cast<float>(y * 10 + x);
+            cell.setColor(0xFF000000u | static_cast<uint32_t>(y * 256 + x));
+        }
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(StateRegionGetTest, JsonPlanesFollowRequestedFieldsRowMajor)
+{
+    const WorldData data = makeWorldData();
+    StateRegionGet::Command cmd{
+        .x = 2,
+        .y = 3,
+        .width = 4,
+        .height = 2,
+        .fields = { StateRegionGet::Field::Pressure, StateRegionGet::Field::Velocity },
+        .encoding = StateRegionGet::Encoding::Json,
+    };
+
+    const auto response = StateRegionGet::extractRegion(data, cmd);
+    ASSERT_TRUE(response.isValue()) << response.errorValue().message;
+    const auto& okay = response.value();
+    ASSERT_EQ(okay.planes.size(), 2u);
+    EXPECT_EQ(okay.planes[0].field, StateRegionGet::Field::Pressure);
+    ASSERT_EQ(okay.planes[0].values.size(), 8u);
+    ASSERT_EQ(okay.planes[1].values.size(), 16u);
+    EXPECT_TRUE(okay.planes[0].bytes.empty());
+
+    size_t i = 0;
+    for (int y = 3; y < 5; ++y) {
+        for (int x = 2; x < 6; ++x, ++i) {
+            EXPECT_EQ(okay.planes[0].values[i], data.at(x, y).pressure);
+            EXPECT_EQ(okay.planes[1].values[i * 2], data.at(x, y).velocity.x);
+            EXPECT_EQ(okay.planes[1].values[i * 2 + 1], data.at(x, y).velocity.y);
+        }
+    }
+}
+
+TEST(StateRegionGetTest, BinaryPlanesPackElementsAndClampToWorld)
+{
+    const WorldData data = makeWorldData();
+    StateRegionGet::Command cmd{
+        .x = 9,
+        .y = -2,
+        .width = 10,
+        .height = 4,
+        .fields = { StateRegionGet::Field::Material,
+                    StateRegionGet::Field::Fill,
+                    StateRegionGet::Field::Color },
+        .encoding = StateRegionGet::Encoding::Binary,
+    };
+
+    const auto response = StateRegionGet::extractRegion(data, cmd);
+    ASSERT_TRUE(response.isValue()) << response.errorValue().message;
+    const auto& okay = response.value();
+    EXPECT_EQ(okay.x, 9);
+    EXPECT_EQ(okay.y, 0);
+    EXPECT_EQ(okay.width, 3);
+    EXPECT_EQ(okay.height, 2);
+
+    const auto& material = okay.planes[0].bytes;
+    const auto& fill = okay.planes[1].bytes;
+    const auto& color = okay.planes[2].bytes;
+    ASSERT_EQ(material.size(), 6u);
+    ASSERT_EQ(fill.size(), 6u * sizeof(float));
+    ASSERT_EQ(color.size(), 6u * sizeof(uint32_t));
+
+    size_t i = 0;
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 9; x < 12; ++x, ++i) {
+            const Cell& cell = data.at(x, y);
+            EXPECT_EQ(material[i], static_cast<uint8_t>(cell.material_type));
+
+            float fillValue = 0.0f;
+            std::memcpy(&fillValue, fill.data() + i * sizeof(float), sizeof(float));
+            EXPECT_FLOAT_EQ(fillValue, cell.fill_ratio);
+
+            uint32_t colorValue = 0;
+            std::memcpy(&colorValue, color.data() + i * sizeof(uint32_t), sizeof(uint32_t));
+            EXPECT_EQ(colorValue, cell.getColor());
+        }
+    }
+
+    const nlohmann::json json = okay.toJson();
+    EXPECT_EQ(json["encoding"], "binary");
+    EXPECT_EQ(json["planes"][0]["field"], "material");
+    EXPECT_EQ(json["planes"][0]["data"].get<std::string>().size(), 8u);
+}
+
+TEST(StateRegionGetTest, CommandJsonUsesFieldNamesAndRejectsEmptyRegions)
+{
+    const auto cmd = StateRegionGet::Command::fromJson(
+        nlohmann::json{ { "x", 1 },
+                        { "fields", { "organism_id", "fill" } },
+                        { "encoding", "binary" } });
+    ASSERT_EQ(cmd.fields.size(), 2u);
+    EXPECT_EQ(cmd.fields[0], StateRegionGet::Field::OrganismId);
+    EXPECT_EQ(cmd.encoding, StateRegionGet::Encoding::Binary);
+    EXPECT_EQ(cmd.width, 0);
+
+    const WorldData data = makeWorldData();
+    StateRegionGet::Command outside{ .x = 40, .y = 0, .width = 4, .height = 4 };
+    EXPECT_TRUE(StateRegionGet::extractRegion(data, outside).isError());
+
+    StateRegionGet::Command noFields{ .fields = {} };
+    EXPECT_TRUE(StateRegionGet::extractRegion(data, noFields).isError());
+}
@@ -1,5 +1,7 @@
 #include "core/network/BinaryProtocol.h"
+#include "core/network/MessageType.h"
 #include "server/api/ApiError.h"
+#include "server/api/StatusGet.h"
 #include <gtest/gtest.h>
 
 using namespace DirtSim;
@@ -251,3 +253,60 @@ TEST(BinaryProtocolTest, FullCommandResponseRoundtrip)
     EXPECT_EQ(result.value().value, 84);
     EXPECT_EQ(result.value().name, "response");
 }
+
+// ============================================================================
+// Envelope View and Message Type Tests
+// ============================================================================
+
+TEST(BinaryProtocolTest, ParseEnvelopeViewsPayloadInPlace)
+{
+    std::vector<std::byte> buffer;
+    write_envelope(buffer, 7, command_type_id<MockCommand>(), 0, MockCommand{ 5, "in place" });
+
+    const EnvelopeView view = parse_envelope(buffer);
+    EXPECT_EQ(view.id, 7u);
+    EXPECT_EQ(view.type, messageTypeIdOf("mock_command"));
+    EXPECT_FALSE(view.response);
+
+    // The payload is the tail of the received buffer, not a copy.
+    ASSERT_FALSE(view.payload.empty());
+    EXPECT_EQ(view.payload.data() + view.payload.size(), buffer.data() + buffer.size());
+
+    const auto cmd = deserialize_payload<MockCommand>(view.payload);
+    EXPECT_EQ(cmd.param1, 5);
+    EXPECT_EQ(cmd.param2, "in place");
+}
+
+TEST(BinaryProtocolTest, ResponseFlagMapsToResponseSuffix)
+{
+    const Result<TestOkay, ApiError> result =
+        Result<TestOkay, ApiError>::okay(TestOkay{ 3, "flagged" });
+    const auto bytes = serialize_response(9, command_type_id<MockCommand>(), result);
+
+    const EnvelopeView view = parse_envelope(bytes);
+    EXPECT_TRUE(view.response);
+    EXPECT_EQ(view.type, messageTypeIdOf("mock_command"));
+
+    const MessageEnvelope envelope = deserialize_envelope(bytes);
+    EXPECT_EQ(envelope.message_type, "mock_command_response");
+    const auto extracted = extract_result<TestOkay, ApiError>(envelope);
+    ASSERT_TRUE(extracted.isValue());
+    EXPECT_EQ(extracted.value().name, "flagged");
+}
+
+TEST(BinaryProtocolTest, ApiCommandTypeIdIsRegisteredHashOfName)
+{
+    constexpr MessageTypeId id = Api::StatusGet::Command::typeId();
+    static_assert(id == messageTypeIdOf(Api::StatusGet::Command::name()));
+
+    const auto name = MessageTypeRegistry::nameOf(id);
+    ASSERT_TRUE(name.has_value());
+    EXPECT_EQ(name.value(), Api::StatusGet::Command::name());
+}
+
+TEST(BinaryProtocolTest, UnknownTypeIdGetsPlaceholderName)
+{
+    const MessageTypeId unknown = messageTypeIdOf("never_registered_type");
+    EXPECT_FALSE(MessageTypeRegistry::nameOf(unknown).has_value());
+    EXPECT_TRUE(messageTypeName(unknown).starts_with("type#"));
+}
@@ -232,3 +232,67 @@ TEST(CellSerializationTest, ParseRenderMessageAssertsOnInvalidBasicPayload)
 
     EXPECT_DEATH({ static_cast<void>(Ui::MessageParser::parseRenderMessage(buffer)); }, "");
 }
+
+TEST(CellSerializationTest, OrganismSpansRoundTripOnLargeWorldWithManyOrganisms)
+{
+    constexpr int16_t width = 1024;
+    constexpr int16_t height = 600;
+    constexpr int organismCount = 1000;
+    const size_t cellCount = static_cast<size_t>(width) * height;
+
+    WorldData worldData;
+    worldData.width = width;
+    worldData.height = height;
+    worldData.cells.resize(cellCount);
+    worldData.colors.resize(cellCount);
+
+    // 1000 organisms of 3x4 cells in a 40x25 lattice, reaching past index 65,535 and id 255.
+    std::vector<OrganismId> organismGrid(cellCount);
+    for (int k = 0; k < organismCount; ++k) {
+        const int x0 = (k % 40) * 25 + 1;
+        const int y0 = (k / 40) * 24 + 1;
+        for (int y = y0; y < y0 + 4; ++y) {
+            for (int x = x0; x < x0 + 3; ++x) {
+                organismGrid[static_cast<size_t>(y) * width + x] = OrganismId{ k + 1 };
+            }
+        }
+    }
+
+    const RenderMessage msg =
+        packCellRenderMessage(worldData, RenderFormat::EnumType::Basic, organismGrid);
+    ASSERT_EQ(msg.organisms.size(), static_cast<size_t>(organismCount));
+    EXPECT_EQ(msg.organisms.back().organism_id, static_cast<uint32_t>(organismCount));
+    for (const auto& org : msg.organisms) {
+        EXPECT_EQ(org.spans.size(), 4u);
+    }
+
+    std::vector<std::byte> buffer;
+    auto out = zpp::bits::out(buffer);
+    out(msg).or_throw();
+
+    RenderMessage decoded;
+    auto in = zpp::bits::in(buffer);
+    in(decoded).or_throw();
+
+    EXPECT_EQ(applyOrganismData(decoded.organisms, cellCount), organismGrid);
+}
+
+TEST(CellSerializationTest, OrganismSpansSplitAtRowEnds)
+{
+    std::vector<OrganismId> grid(12);
+    grid[2] = OrganismId{ 7 };
+    grid[3] = OrganismId{ 7 };
+    grid[4] = OrganismId{ 7 };
+    grid[5] = OrganismId{ 9 };
+
+    const auto organisms = extractOrganisms(grid, 4);
+    ASSERT_EQ(organisms.size(), 2u);
+    ASSERT_EQ(organisms[0].spans.size(), 2u);
+    EXPECT_EQ(organisms[0].spans[0].start, 2u);
+    EXPECT_EQ(organisms[0].spans[0].length, 2u);
+    EXPECT_EQ(organisms[0].spans[1].start, 4u);
+    EXPECT_EQ(organisms[0].spans[1].length, 1u);
+    ASSERT_EQ(organisms[1].spans.size(), 1u);
+    EXPECT_EQ(organisms[1].spans[0].start, 5u);
+    EXPECT_EQ(applyOrganismData(organisms, grid.size()), grid);
+}
@@ -0,0 +1,93 @@
+#include "core/CoalescingQueue.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct TestEvent {
+    std::string kind;
+    int value = 0;
+    std::unique_ptr<int> payload; // Keeps the event move-only.
+};
+
+std::optional<size_t> coalesceFrames(const TestEvent& event)
+{
+    if (event.kind == "frame") {
+        return 0;
+    }
+    if (event.kind == "progress") {
+        return 1;
+    }
+    return std::nullopt;
+}
+
+TestEvent makeEvent(const std::string& kind, int value)
+{
+    return TestEvent{ .kind = kind, .value = value, .payload = std::make_unique<int>(value) };
+}
+
+} // namespace
+
+TEST(CoalescingQueueTest, NewerSnapshotReplacesPendingOneOfSameKind)
+{
+    CoalescingQueue<TestEvent> queue(coalesceFrames);
+    queue.push(makeEvent("frame", 1));
+    queue.push(makeEvent("progress", 2));
+    queue.push(makeEvent("frame", 3));
+
+    auto first = queue.tryPop();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->kind, "progress");
+
+    auto second = queue.tryPop();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->kind, "frame");
+    EXPECT_EQ(second->value, 3);
+    ASSERT_NE(second->payload, nullptr);
+    EXPECT_EQ(*second->payload, 3);
+
+    EXPECT_FALSE(queue.tryPop().has_value());
+    EXPECT_EQ(queue.stats().coalesced, 1u);
+}
+
+TEST(CoalescingQueueTest, CommandsKeepOrderAroundCoalescedSnapshots)
+{
+    CoalescingQueue<TestEvent> queue(coalesceFrames);
+    queue.push(makeEvent("command", 1));
+    queue.push(makeEvent("frame", 2));
+    queue.push(makeEvent("command", 3));
+    queue.push(makeEvent("frame", 4));
+    queue.push(makeEvent("command", 5));
+
+    std::vector<int> values;
+    while (auto event = queue.tryPop()) {
+        values.push_back(event->value);
+    }
+
+    // The stale frame is gone; the newest one lands where it was pushed.
+    EXPECT_EQ(values, (std::vector<int>{ 1, 3, 4, 5 }));
+}
+
+TEST(CoalescingQueueTest, StatsTrackHighWaterMarkAcrossPops)
+{
+    CoalescingQueue<TestEvent> queue(coalesceFrames);
+    queue.push(makeEvent("command", 1));
+    queue.push(makeEvent("command", 2));
+    queue.push(makeEvent("frame", 3));
+    queue.push(makeEvent("frame", 4));
+    ASSERT_EQ(queue.size(), 3u);
+
+    queue.tryPop();
+    queue.tryPop();
+    queue.push(makeEvent("frame", 5));
+
+    const auto stats = queue.stats();
+    EXPECT_EQ(stats.highWaterMark, 3u);
+    EXPECT_EQ(stats.pushed, 5u);
+    EXPECT_EQ(stats.coalesced, 2u);
+    EXPECT_EQ(queue.size(), 1u);
+}
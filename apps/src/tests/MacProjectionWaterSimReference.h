@@ -0,0 +1,61 @@
+#pragma once
+
+#include "core/water/WaterSim.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace DirtSim {
+
+/**
+ * The MAC projection solver as it was before tiling: every cell, every step, serially.
+ * Tests compare MacProjectionWaterSim against it with tile sleep off.
+ */
+class MacProjectionWaterSimReference final : public IWaterSim {
+public:
+    struct Parameters {
+        float advectionCflLimit = 0.90f;
+        float advectionVolumeEpsilon = 0.0001f;
+        int displacementMaxRadius = 8;
+        float fluidMaskVolumeEpsilon = 0.0001f;
+        int pressureIterations = 2;
+        float pressureGradientVelocityScale = 1.0f;
+        float velocityCflLimit = 0.95f;
+        float velocityDampingPerSecond = 0.05f;
+        float velocitySleepEpsilon = 0.00005f;
+    };
+
+    WaterSimMode getMode() const override { return WaterSimMode::MacProjection; }
+
+    void reset() override;
+    void resize(int worldWidth, int worldHeight) override;
+    void advanceTime(World& world, double deltaTimeSeconds) override;
+    void syncToSettings(const PhysicsSettings& settings) override;
+
+    bool tryGetWaterVolumeView(WaterVolumeView& out) const override;
+    bool tryGetMutableWaterVolumeView(WaterVolumeMutableView& out) override;
+
+    void setParametersForTesting(const Parameters& parameters) { parameters_ = parameters; }
+    const Parameters& getParametersForTesting() const { return parameters_; }
+
+private:
+    int width_ = 0;
+    int height_ = 0;
+    Parameters parameters_{};
+
+    std::vector<float> waterVolume_;
+    std::vector<float> uFaceVelocity_;
+    std::vector<float> vFaceVelocity_;
+
+    std::vector<float> divergence_;
+    std::vector<float> pressure_;
+    std::vector<float> pressureScratch_;
+    std::vector<float> hydroPressure_;
+    std::vector<float> volumeScratch_;
+    std::vector<uint8_t> fluidMask_;
+    std::vector<uint8_t> projectionMask_;
+    std::vector<uint8_t> projectionMaskScratch_;
+    std::vector<uint8_t> solidMask_;
+};
+
+} // namespace DirtSim
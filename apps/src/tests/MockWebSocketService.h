@@ -68,6 +68,7 @@ public:
     void setAccessToken(std::string token) override;
     void clearAccessToken() override;
     void closeNonLocalClients() override;
+    bool isLocalClient(const std::string& /*connectionId*/) override { return true; }
 
     bool clientWantsEvents(const std::string& /*connectionId*/) const override;
     bool clientWantsRender(const std::string& /*connectionId*/) const override;
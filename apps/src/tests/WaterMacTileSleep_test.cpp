@@ -0,0 +1,180 @@
+#include "core/World.h"
+#include "core/WorldData.h"
+#include "core/water/MacProjectionWaterSim.h"
+#include "tests/MacProjectionWaterSimReference.h"
+
+#include <gtest/gtest.h>
+
+using namespace DirtSim;
+
+namespace {
+
+constexpr int kWidth = 96;
+constexpr int kHeight = 64;
+constexpr int kPondTop = 40;
+constexpr double kDeltaTime = 0.016;
+
+float sumVolume(const MacProjectionWaterSim& sim)
+{
+    WaterVolumeView view{};
+    if (!sim.tryGetWaterVolumeView(view)) {
+        return 0.0f;
+    }
+
+    float total = 0.0f;
+    for (float v : view.volume) {
+        total += v;
+    }
+    return total;
+}
+
+void fillPond(MacProjectionWaterSim& sim)
+{
+    WaterVolumeMutableView volumeMutable{};
+    ASSERT_TRUE(sim.tryGetMutableWaterVolumeView(volumeMutable));
+    for (int y = kPondTop; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            volumeMutable.volume[static_cast<size_t>(y) * kWidth + x] = 1.0f;
+        }
+    }
+}
+
+template <typename Sim>
+void fillCorner(Sim& sim, int width, int height)
+{
+    WaterVolumeMutableView volumeMutable{};
+    ASSERT_TRUE(sim.tryGetMutableWaterVolumeView(volumeMutable));
+    for (int y = height / 2; y < height; ++y) {
+        for (int x = width / 2; x < width; ++x) {
+            volumeMutable.volume[static_cast<size_t>(y) * width + x] = 1.0f;
+        }
+    }
+}
+
+} // namespace
+
+TEST(WaterMacTileSleepTest, AllTilesAwakeMatchesUntiledSolverExactly)
+{
+    // Not a multiple of the tile size, so edge tiles are partial.
+    constexpr int kOddWidth = 70;
+    constexpr int kOddHeight = 50;
+    World world(kOddWidth, kOddHeight);
+    for (int y = 30; y < kOddHeight; ++y) {
+        world.getData().at(20, y).replaceMaterial(Material::EnumType::Wall, 1.0f);
+    }
+
+    MacProjectionWaterSim tiled;
+    tiled.resize(kOddWidth, kOddHeight);
+    tiled.reset();
+    auto parameters = tiled.getParametersForTesting();
+    parameters.tileSleepSteps = 0;
+    tiled.setParametersForTesting(parameters);
+
+    MacProjectionWaterSimReference untiled;
+    untiled.resize(kOddWidth, kOddHeight);
+    untiled.reset();
+
+    fillCorner(tiled, kOddWidth, kOddHeight);
+    fillCorner(untiled, kOddWidth, kOddHeight);
+
+    for (int step = 0; step < 300; ++step) {
+        if (step == 100) {
+            world.getData().at(40, 40).replaceMaterial(Material::EnumType::Dirt, 1.0f);
+        }
+        tiled.advanceTime(world, kDeltaTime);
+        untiled.advanceTime(world, kDeltaTime);
+
+        WaterVolumeView tiledView{};
+        WaterVolumeView untiledView{};
+        ASSERT_TRUE(tiled.tryGetWaterVolumeView(tiledView));
+        ASSERT_TRUE(untiled.tryGetWaterVolumeView(untiledView));
+        ASSERT_EQ(tiledView.volume.size(), untiledView.volume.size());
+        for (size_t i = 0; i < tiledView.volume.size(); ++i) {
+            ASSERT_EQ(tiledView.volume[i], untiledView.volume[i])
+                << "step " << step << " cell " << i;
+        }
+    }
+}
+
+TEST(WaterMacTileSleepTest, SettledPondStopsSimulatingTiles)
+{
+    World world(kWidth, kHeight);
+
+    MacProjectionWaterSim sim;
+    sim.resize(kWidth, kHeight);
+    sim.reset();
+    fillPond(sim);
+    const float totalInitial = sumVolume(sim);
+
+    const int sleepSteps = sim.getParametersForTesting().tileSleepSteps;
+    for (int step = 0; step < sleepSteps + 2; ++step) {
+        sim.advanceTime(world, kDeltaTime);
+    }
+
+    EXPECT_EQ(sim.getSimulatedTileCountForTesting(), 0);
+    EXPECT_NEAR(sumVolume(sim), totalInitial, 0.001f);
+}
+
+TEST(WaterMacTileSleepTest, VolumeEditWakesSleepingTiles)
+{
+    World world(kWidth, kHeight);
+
+    MacProjectionWaterSim sim;
+    sim.resize(kWidth, kHeight);
+    sim.reset();
+    fillPond(sim);
+
+    const int sleepSteps = sim.getParametersForTesting().tileSleepSteps;
+    for (int step = 0; step < sleepSteps + 2; ++step) {
+        sim.advanceTime(world, kDeltaTime);
+    }
+    ASSERT_EQ(sim.getSimulatedTileCountForTesting(), 0);
+
+    // A drop well above the pond, edited the way World adds water.
+    constexpr size_t kDropIdx = static_cast<size_t>(10) * kWidth + 50;
+    {
+        WaterVolumeMutableView volumeMutable{};
+        ASSERT_TRUE(sim.tryGetMutableWaterVolumeView(volumeMutable));
+        volumeMutable.volume[kDropIdx] = 1.0f;
+    }
+    const float totalWithDrop = sumVolume(sim);
+
+    sim.advanceTime(world, kDeltaTime);
+    EXPECT_GT(sim.getSimulatedTileCountForTesting(), 0);
+
+    for (int step = 0; step < 200; ++step) {
+        sim.advanceTime(world, kDeltaTime);
+    }
+
+    WaterVolumeView view{};
+    ASSERT_TRUE(sim.tryGetWaterVolumeView(view));
+    EXPECT_LT(view.volume[kDropIdx], 0.01f);
+    EXPECT_NEAR(sumVolume(sim), totalWithDrop, 0.01f);
+}
+
+TEST(WaterMacTileSleepTest, WallPlacedInSleepingPondDisplacesWater)
+{
+    World world(kWidth, kHeight);
+
+    MacProjectionWaterSim sim;
+    sim.resize(kWidth, kHeight);
+    sim.reset();
+    fillPond(sim);
+
+    const int sleepSteps = sim.getParametersForTesting().tileSleepSteps;
+    for (int step = 0; step < sleepSteps + 2; ++step) {
+        sim.advanceTime(world, kDeltaTime);
+    }
+    ASSERT_EQ(sim.getSimulatedTileCountForTesting(), 0);
+
+    // Near the surface, so the displaced water finds room within the displacement radius.
+    const float totalInitial = sumVolume(sim);
+    world.getData().at(48, kPondTop + 1).replaceMaterial(Material::EnumType::Wall, 1.0f);
+    sim.advanceTime(world, kDeltaTime);
+
+    WaterVolumeView view{};
+    ASSERT_TRUE(sim.tryGetWaterVolumeView(view));
+    EXPECT_GT(sim.getSimulatedTileCountForTesting(), 0);
+    EXPECT_EQ(view.volume[static_cast<size_t>(kPondTop + 1) * kWidth + 48], 0.0f);
+    EXPECT_NEAR(sumVolume(sim), totalInitial, 0.01f);
+}
@@ -350,6 +350,16 @@ Result<std::monostate, std::string> TrainingIdleView::loadGenomeDetail(const Gen
     return genomeBrowserPanel_->loadDetailForId(genomeId);
 }
 
+void TrainingIdleView::receiveGenomeListPage(const GenomeListPageReceivedEvent& evt)
+{
+    // The browser may have been closed while the page was in flight.
+    if (!genomeBrowserPanel_) {
+        return;
+    }
+
+    genomeBrowserPanel_->receiveListPage(evt);
+}
+
 void TrainingIdleView::addGenomeToTraining(const GenomeId& genomeId)
 {
     if (genomeId.isNil()) {
@@ -29,6 +29,7 @@ class TrainingConfigPanel;
 class TrainingResultBrowserPanel;
 class UiComponentManager;
 class UiServices;
+struct GenomeListPageReceivedEvent;
 
 class TrainingIdleView {
 public:
@@ -65,6 +66,7 @@ public:
     Result<GenomeId, std::string> openGenomeDetailByIndex(int index);
     Result<GenomeId, std::string> openGenomeDetailById(const GenomeId& genomeId);
     Result<std::monostate, std::string> loadGenomeDetail(const GenomeId& genomeId);
+    void receiveGenomeListPage(const GenomeListPageReceivedEvent& evt);
     void addGenomeToTraining(const GenomeId& genomeId);
     bool isTrainingResultModalVisible() const;
     Starfield::Snapshot captureStarfieldSnapshot() const;
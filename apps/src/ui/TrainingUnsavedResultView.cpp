@@ -338,7 +338,7 @@ void TrainingUnsavedResultView::onTrainingResultSaveClicked(lv_event_t* e)
 
     TrainingResultSaveClickedEvent evt;
     evt.ids = self->getTrainingResultSaveIds();
-    self->eventSink_.queueEvent(evt);
+    self->eventSink_.queueEvent(std::move(evt));
 }
 
 void TrainingUnsavedResultView::onTrainingResultSaveAndRestartClicked(lv_event_t* e)
@@ -351,7 +351,7 @@ void TrainingUnsavedResultView::onTrainingResultSaveAndRestartClicked(lv_event_t
     TrainingResultSaveClickedEvent evt;
     evt.ids = self->getTrainingResultSaveIds();
     evt.restart = true;
-    self->eventSink_.queueEvent(evt);
+    self->eventSink_.queueEvent(std::move(evt));
 }
 
 void TrainingUnsavedResultView::onTrainingResultDiscardClicked(lv_event_t* e)
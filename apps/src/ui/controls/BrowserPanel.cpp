@@ -3,6 +3,8 @@
 #include "core/LoggingChannels.h"
 #include "ui/ui_builders/LVGLBuilder.h"
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 
 namespace DirtSim {
 namespace Ui {
@@ -14,6 +16,12 @@ constexpr int kMinRightColumnWidth = 120;
 constexpr int kRowHeight = LVGLBuilder::Style::ACTION_SIZE;
 constexpr int kRowGap = 10;
 constexpr int kDeleteRowGap = 8;
+constexpr int kListRowGap = 10;
+constexpr int kListRowPitch = kRowHeight + kListRowGap;
+// Extra pooled rows beyond the viewport, so a partially scrolled row is never blank.
+constexpr int kListOverscanRows = 2;
+// Rows left below the viewport when the next page is requested.
+constexpr size_t kListNextPageThresholdRows = 32;
 
 struct ColumnWidths {
     int left = ExpandablePanel::DefaultWidth;
@@ -110,6 +118,13 @@ BrowserPanel::~BrowserPanel()
     closeModal();
 }
 
+void BrowserPanel::setNextPageSources(
+    ListFetcher nextPageFetcher, NextPageRequester nextPageRequester)
+{
+    nextPageFetcher_ = std::move(nextPageFetcher);
+    nextPageRequester_ = std::move(nextPageRequester);
+}
+
 void BrowserPanel::refreshList()
 {
     if (!listFetcher_) {
@@ -117,17 +132,117 @@ void BrowserPanel::refreshList()
         return;
     }
 
+    const auto start = std::chrono::steady_clock::now();
     auto result = listFetcher_();
+    // A page still in flight belongs to the old list; the owner drops it.
+    nextPagePending_ = false;
     if (result.isError()) {
         LOG_WARN(Controls, "BrowserPanel: List fetch failed: {}", result.errorValue());
         items_.clear();
+        listComplete_ = true;
     }
     else {
         items_ = std::move(result.value());
+        listComplete_ = !nextPageRequester_ || items_.empty();
     }
+    const auto fetched = std::chrono::steady_clock::now();
 
     rebuildList();
     updateDeleteSelectedState();
+
+    const auto built = std::chrono::steady_clock::now();
+    const auto elapsedMs = [](auto from, auto to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    };
+    LOG_INFO(
+        Controls,
+        "BrowserPanel: '{}' listed {} items with {} rows in {:.1f} ms (fetch {:.1f} ms)",
+        title_,
+        items_.size(),
+        rows_.size(),
+        elapsedMs(start, built),
+        elapsedMs(start, fetched));
+
+    // A first page shorter than the viewport leaves nothing to scroll.
+    requestNextPageIfNeeded();
+}
+
+void BrowserPanel::appendPage(Result<std::vector<Item>, std::string> page)
+{
+    nextPagePending_ = false;
+    if (page.isError()) {
+        LOG_WARN(Controls, "BrowserPanel: Next page fetch failed: {}", page.errorValue());
+        listComplete_ = true;
+        return;
+    }
+    if (page.value().empty()) {
+        listComplete_ = true;
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const size_t pageSize = page.value().size();
+    appendItems(std::move(page.value()));
+    LOG_INFO(
+        Controls,
+        "BrowserPanel: '{}' appended {} items in {:.1f} ms",
+        title_,
+        pageSize,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count());
+
+    requestNextPageIfNeeded();
+}
+
+void BrowserPanel::appendItems(std::vector<Item> page)
+{
+    items_.insert(
+        items_.end(), std::make_move_iterator(page.begin()), std::make_move_iterator(page.end()));
+
+    // A list shorter than the viewport has fewer rows than it can show; only then rebuild.
+    if (!listSpacer_ || rows_.size() < rowPoolCapacity_) {
+        rebuildList();
+        return;
+    }
+
+    lv_obj_set_height(listSpacer_, static_cast<int>(items_.size()) * kListRowPitch - kListRowGap);
+    updateVisibleRows(false);
+}
+
+bool BrowserPanel::appendNextPage()
+{
+    if (listComplete_ || !nextPageFetcher_) {
+        return false;
+    }
+
+    auto result = nextPageFetcher_();
+    // The synchronous fetch supersedes any page in flight; the owner drops it.
+    nextPagePending_ = false;
+    if (result.isError()) {
+        LOG_WARN(Controls, "BrowserPanel: Next page fetch failed: {}", result.errorValue());
+        listComplete_ = true;
+        return false;
+    }
+    if (result.value().empty()) {
+        listComplete_ = true;
+        return false;
+    }
+
+    appendItems(std::move(result.value()));
+    return true;
+}
+
+void BrowserPanel::requestNextPageIfNeeded()
+{
+    if (listComplete_ || nextPagePending_
+        || firstVisibleIndex_ + rows_.size() + kListNextPageThresholdRows < items_.size()) {
+        return;
+    }
+
+    nextPagePending_ = nextPageRequester_();
+    if (!nextPagePending_) {
+        listComplete_ = true;
+    }
 }
 
 Result<GenomeId, std::string> BrowserPanel::openDetailByIndex(size_t index)
@@ -146,8 +261,12 @@ Result<GenomeId, std::string> BrowserPanel::openDetailByIndex(size_t index)
 
 Result<GenomeId, std::string> BrowserPanel::openDetailById(const GenomeId& id)
 {
-    auto it =
-        std::find_if(items_.begin(), items_.end(), [&](const Item& item) { return item.id == id; });
+    const auto matchesId = [&](const Item& item) { return item.id == id; };
+    auto it = std::find_if(items_.begin(), items_.end(), matchesId);
+    // The item may be on a page that hasn't been scrolled to yet.
+    while (it == items_.end() && appendNextPage()) {
+        it = std::find_if(items_.begin(), items_.end(), matchesId);
+    }
     if (it == items_.end()) {
         return Result<GenomeId, std::string>::error("Detail item not found");
     }
@@ -214,17 +333,15 @@ void BrowserPanel::createLayout()
     lv_obj_clear_flag(columns, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_flex_align(columns, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
 
+    // No flex layout: rebuildList() positions a small pool of rows by hand.
     listColumn_ = lv_obj_create(columns);
     lv_obj_set_size(listColumn_, widths.left, LV_PCT(100));
-    lv_obj_set_flex_flow(listColumn_, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_flex_align(
-        listColumn_, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
     lv_obj_set_style_pad_all(listColumn_, 0, 0);
-    lv_obj_set_style_pad_row(listColumn_, 10, 0);
     lv_obj_set_style_bg_opa(listColumn_, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(listColumn_, 0, 0);
     lv_obj_set_scroll_dir(listColumn_, LV_DIR_VER);
     lv_obj_set_scrollbar_mode(listColumn_, LV_SCROLLBAR_MODE_AUTO);
+    lv_obj_add_event_cb(listColumn_, onListScrolled, LV_EVENT_SCROLL, this);
 
     lv_obj_t* actionColumn = lv_obj_create(columns);
     lv_obj_set_size(actionColumn, widths.right, LV_PCT(100));
@@ -310,10 +427,14 @@ void BrowserPanel::rebuildList()
         listColumnWidth = ExpandablePanel::DefaultWidth;
     }
     const int rowButtonWidth = std::max(0, listColumnWidth - kRowHeight - kRowGap);
+    const int listColumnHeight = std::max(kListRowPitch, lv_obj_get_height(listColumn_));
 
     lv_obj_clean(listColumn_);
+    listSpacer_ = nullptr;
     rows_.clear();
     rowContexts_.clear();
+    firstVisibleIndex_ = 0;
+    rowPoolCapacity_ = static_cast<size_t>(listColumnHeight / kListRowPitch + kListOverscanRows);
 
     if (items_.empty()) {
         lv_obj_t* emptyLabel = lv_label_create(listColumn_);
@@ -323,10 +444,19 @@ void BrowserPanel::rebuildList()
         return;
     }
 
-    rows_.reserve(items_.size());
-    rowContexts_.reserve(items_.size());
+    // Sizes the scrollable content for the whole list; only the pooled rows are real objects.
+    listSpacer_ = lv_obj_create(listColumn_);
+    lv_obj_set_size(listSpacer_, 1, static_cast<int>(items_.size()) * kListRowPitch - kListRowGap);
+    lv_obj_set_style_bg_opa(listSpacer_, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(listSpacer_, 0, 0);
+    lv_obj_clear_flag(listSpacer_, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(listSpacer_, LV_OBJ_FLAG_SCROLLABLE);
 
-    for (size_t i = 0; i < items_.size(); ++i) {
+    const size_t poolSize = std::min(items_.size(), rowPoolCapacity_);
+    rows_.reserve(poolSize);
+    rowContexts_.reserve(poolSize);
+
+    for (size_t i = 0; i < poolSize; ++i) {
         RowWidgets row{};
         row.row = lv_obj_create(listColumn_);
         lv_obj_set_size(row.row, LV_PCT(100), kRowHeight);
@@ -359,13 +489,46 @@ void BrowserPanel::rebuildList()
                                   .callback(onItemButtonClicked, context.get())
                                   .buildOrLog();
 
-        if (selectedIds_.count(items_[i].id) > 0) {
-            lv_obj_add_state(row.checkbox, LV_STATE_CHECKED);
-        }
-
         rows_.push_back(row);
         rowContexts_.push_back(std::move(context));
     }
+
+    // The old content may have been scrolled further than the new list reaches.
+    lv_obj_update_layout(listColumn_);
+    const int overscroll = -static_cast<int>(lv_obj_get_scroll_bottom(listColumn_));
+    if (overscroll > 0) {
+        lv_obj_scroll_by(listColumn_, 0, overscroll, LV_ANIM_OFF);
+    }
+    updateVisibleRows(true);
+}
+
+void BrowserPanel::updateVisibleRows(bool force)
+{
+    if (rows_.empty()) {
+        return;
+    }
+
+    const int scrollY = std::max(0, static_cast<int>(lv_obj_get_scroll_y(listColumn_)));
+    const size_t maxFirst = items_.size() - rows_.size();
+    const size_t first = std::min(static_cast<size_t>(scrollY / kListRowPitch), maxFirst);
+    if (!force && first == firstVisibleIndex_) {
+        return;
+    }
+    firstVisibleIndex_ = first;
+
+    for (size_t slot = 0; slot < rows_.size(); ++slot) {
+        const size_t index = first + slot;
+        const RowWidgets& row = rows_[slot];
+        CallbackContext& context = *rowContexts_[slot];
+        if (force || context.index != index) {
+            context.index = index;
+            LVGLBuilder::ActionButtonBuilder::setText(
+                row.buttonContainer, items_[index].label.c_str());
+        }
+        lv_obj_set_y(row.row, static_cast<int>(index) * kListRowPitch);
+    }
+
+    updateSelectionCheckboxes();
 }
 
 void BrowserPanel::updateDeleteSelectedState()
@@ -382,11 +545,12 @@ void BrowserPanel::updateModalDeleteState()
 
 void BrowserPanel::updateSelectionCheckboxes()
 {
-    for (size_t i = 0; i < rows_.size() && i < items_.size(); ++i) {
-        if (!rows_[i].checkbox) {
+    for (size_t i = 0; i < rows_.size() && i < rowContexts_.size(); ++i) {
+        const size_t index = rowContexts_[i]->index;
+        if (!rows_[i].checkbox || index >= items_.size()) {
             continue;
         }
-        if (selectedIds_.count(items_[i].id) > 0) {
+        if (selectedIds_.count(items_[index].id) > 0) {
             lv_obj_add_state(rows_[i].checkbox, LV_STATE_CHECKED);
         }
         else {
@@ -789,6 +953,17 @@ void BrowserPanel::updateSidePanelToggleIcon()
     LVGLBuilder::ActionButtonBuilder::setIcon(modalToggleButton_, symbol);
 }
 
+void BrowserPanel::onListScrolled(lv_event_t* e)
+{
+    auto* self = static_cast<BrowserPanel*>(lv_event_get_user_data(e));
+    if (!self) {
+        return;
+    }
+
+    self->updateVisibleRows(false);
+    self->requestNextPageIfNeeded();
+}
+
 void BrowserPanel::onItemButtonClicked(lv_event_t* e)
 {
     if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
@@ -75,6 +75,8 @@ public:
     };
 
     using ListFetcher = std::function<Result<std::vector<Item>, std::string>()>;
+    // Starts fetching the next page off the UI thread; false when there is nothing to fetch.
+    using NextPageRequester = std::function<bool()>;
     using DetailFetcher = std::function<Result<DetailText, std::string>(const Item& item)>;
     using DeleteHandler = std::function<Result<bool, std::string>(const Item& item)>;
 
@@ -90,6 +92,13 @@ public:
         ModalStyle modalStyle = ModalStyle{});
     ~BrowserPanel();
 
+    // Optional. refreshList() then shows the list fetcher's first page, and the requester is
+    // asked for the next page as the list scrolls near its end. The owner hands the page back
+    // through appendPage() on the UI thread; an error or empty page ends the list. The fetcher
+    // loads pages synchronously, only when a lookup by id needs an item not yet listed.
+    void setNextPageSources(ListFetcher nextPageFetcher, NextPageRequester nextPageRequester);
+    void appendPage(Result<std::vector<Item>, std::string> page);
+
     void refreshList();
     Result<GenomeId, std::string> openDetailByIndex(size_t index);
     Result<GenomeId, std::string> openDetailById(const GenomeId& id);
@@ -127,14 +136,23 @@ private:
 
     std::string title_;
     std::vector<Item> items_;
+    // Row objects are pooled to cover the viewport and rebound to items_ as the list scrolls;
+    // rowContexts_[i]->index is the item currently shown by rows_[i].
     std::vector<RowWidgets> rows_;
     std::vector<std::unique_ptr<CallbackContext>> rowContexts_;
+    lv_obj_t* listSpacer_ = nullptr;
+    size_t rowPoolCapacity_ = 0;
+    size_t firstVisibleIndex_ = 0;
+    bool listComplete_ = true;
+    bool nextPagePending_ = false;
     std::vector<std::unique_ptr<ModalActionContext>> modalActionContexts_;
     std::unordered_set<GenomeId> selectedIds_;
     std::optional<GenomeId> modalItemId_;
     bool sidePanelVisible_ = false;
 
     ListFetcher listFetcher_;
+    ListFetcher nextPageFetcher_;
+    NextPageRequester nextPageRequester_;
     DetailFetcher detailFetcher_;
     DeleteHandler deleteHandler_;
     std::vector<DetailAction> detailActions_;
@@ -144,6 +162,10 @@ private:
 
     void createLayout();
     void rebuildList();
+    void appendItems(std::vector<Item> page);
+    bool appendNextPage();
+    void requestNextPageIfNeeded();
+    void updateVisibleRows(bool force);
     void updateDeleteSelectedState();
     void updateModalDeleteState();
     void updateSelectionCheckboxes();
@@ -159,6 +181,7 @@ private:
     void setSidePanelVisible(bool visible);
     void updateSidePanelToggleIcon();
 
+    static void onListScrolled(lv_event_t* e);
     static void onItemButtonClicked(lv_event_t* e);
     static void onItemCheckboxToggled(lv_event_t* e);
     static void onSelectAllClicked(lv_event_t* e);
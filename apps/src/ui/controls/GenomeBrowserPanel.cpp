@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 #include <utility>
 
 namespace DirtSim {
@@ -21,6 +22,7 @@ namespace {
 constexpr int kSortArrowWidth = LVGLBuilder::Style::ACTION_SIZE;
 constexpr int kSortRowGap = 8;
 constexpr int kSortRowHeight = LVGLBuilder::Style::ACTION_SIZE;
+constexpr uint32_t kListPageSize = 256;
 constexpr const char* kSortArrowDown = "↓";
 constexpr const char* kSortArrowUp = "↑";
 } // namespace
@@ -69,6 +71,8 @@ GenomeBrowserPanel::GenomeBrowserPanel(
           },
           BrowserPanel::ModalStyle(420, 440, 90, 0, LV_OPA_60, LV_OPA_80))
 {
+    browser_.setNextPageSources(
+        [this]() { return fetchNextPage(); }, [this]() { return requestNextPage(); });
     refresh();
 }
 
@@ -94,40 +98,135 @@ Result<std::monostate, std::string> GenomeBrowserPanel::loadDetailForId(const Ge
 
 Result<std::vector<BrowserPanel::Item>, std::string> GenomeBrowserPanel::fetchList()
 {
+    metadataById_.clear();
+    listNextOffset_ = 0;
+    listTotalCount_ = 0;
+    return fetchNextPage();
+}
+
+// One page per call, so opening the browser waits on a single response however large the
+// archive is; later pages come from requestNextPage() as the list scrolls.
+Result<std::vector<BrowserPanel::Item>, std::string> GenomeBrowserPanel::fetchNextPage()
+{
+    using PageResult = Result<std::vector<BrowserPanel::Item>, std::string>;
+    // This page supersedes any requested one, which would otherwise land at a stale offset.
+    pendingPageRequestId_ = 0;
     if (!wsService_) {
-        return Result<std::vector<BrowserPanel::Item>, std::string>::error(
-            "No WebSocketService available");
+        return PageResult::error("No WebSocketService available");
     }
     if (!wsService_->isConnected()) {
-        return Result<std::vector<BrowserPanel::Item>, std::string>::error("Server not connected");
+        return PageResult::error("Server not connected");
+    }
+    if (listNextOffset_ > 0 && listNextOffset_ >= listTotalCount_) {
+        return PageResult::okay();
     }
 
-    Api::GenomeList::Command cmd{
-        .sortKey = sortKey_,
-        .sortDirection = sortDirections_[sortKeyIndex(sortKey_)],
-    };
-    auto response = wsService_->sendCommandAndGetResponse<Api::GenomeList::Okay>(cmd, 5000);
+    auto response =
+        wsService_->sendCommandAndGetResponse<Api::GenomeList::Okay>(nextPageCommand(), 5000);
     if (response.isError()) {
-        return Result<std::vector<BrowserPanel::Item>, std::string>::error(response.errorValue());
+        return PageResult::error(response.errorValue());
     }
     if (response.value().isError()) {
-        return Result<std::vector<BrowserPanel::Item>, std::string>::error(
-            response.value().errorValue().message);
+        return PageResult::error(response.value().errorValue().message);
     }
 
-    metadataById_.clear();
-    std::vector<BrowserPanel::Item> items;
     const auto& ok = response.value().value();
-    items.reserve(ok.genomes.size());
-    for (const auto& entry : ok.genomes) {
-        metadataById_[entry.id] = entry.metadata;
+    std::vector<BrowserPanel::Item> items = itemsFromPage(ok);
+
+    // A page of nothing but repeats is not the end of the list.
+    if (items.empty() && !ok.genomes.empty() && listNextOffset_ < listTotalCount_) {
+        return fetchNextPage();
+    }
+    return PageResult::okay(std::move(items));
+}
+
+// Sends the request from a worker thread so the LVGL thread keeps scrolling; the response comes
+// back through the event queue to receiveListPage().
+bool GenomeBrowserPanel::requestNextPage()
+{
+    if (!wsService_ || !eventSink_ || !wsService_->isConnected()) {
+        return false;
+    }
+    if (listNextOffset_ > 0 && listNextOffset_ >= listTotalCount_) {
+        return false;
+    }
+
+    const uint64_t requestId = ++lastPageRequestId_;
+    pendingPageRequestId_ = requestId;
+    const Api::GenomeList::Command cmd = nextPageCommand();
+    std::thread([wsService = wsService_, eventSink = eventSink_, cmd, requestId]() {
+        GenomeListPageReceivedEvent evt{ .requestId = requestId };
+        auto response = wsService->sendCommandAndGetResponse<Api::GenomeList::Okay>(cmd, 5000);
+        if (response.isError()) {
+            evt.page = Result<Api::GenomeList::Okay, std::string>::error(response.errorValue());
+        }
+        else if (response.value().isError()) {
+            evt.page = Result<Api::GenomeList::Okay, std::string>::error(
+                response.value().errorValue().message);
+        }
+        else {
+            evt.page = Result<Api::GenomeList::Okay, std::string>::okay(
+                std::move(response.value().value()));
+        }
+        eventSink->queueEvent(std::move(evt));
+    }).detach();
+    return true;
+}
+
+void GenomeBrowserPanel::receiveListPage(const GenomeListPageReceivedEvent& evt)
+{
+    if (pendingPageRequestId_ == 0 || evt.requestId != pendingPageRequestId_) {
+        LOG_INFO(Controls, "GenomeBrowser: Dropping stale list page {}", evt.requestId);
+        return;
+    }
+    pendingPageRequestId_ = 0;
+
+    using PageResult = Result<std::vector<BrowserPanel::Item>, std::string>;
+    if (evt.page.isError()) {
+        browser_.appendPage(PageResult::error(evt.page.errorValue()));
+        return;
+    }
+
+    const auto& ok = evt.page.value();
+    std::vector<BrowserPanel::Item> items = itemsFromPage(ok);
+
+    // A page of nothing but repeats is not the end of the list.
+    if (items.empty() && !ok.genomes.empty() && listNextOffset_ < listTotalCount_
+        && requestNextPage()) {
+        return;
+    }
+    browser_.appendPage(PageResult::okay(std::move(items)));
+}
+
+Api::GenomeList::Command GenomeBrowserPanel::nextPageCommand() const
+{
+    return Api::GenomeList::Command{
+        .sortKey = sortKey_,
+        .sortDirection = sortDirections_[sortKeyIndex(sortKey_)],
+        .offset = listNextOffset_,
+        .limit = kListPageSize,
+    };
+}
+
+std::vector<BrowserPanel::Item> GenomeBrowserPanel::itemsFromPage(
+    const Api::GenomeList::Okay& page)
+{
+    listNextOffset_ += static_cast<uint32_t>(page.genomes.size());
+    listTotalCount_ = page.totalCount;
+
+    std::vector<BrowserPanel::Item> items;
+    items.reserve(page.genomes.size());
+    for (const auto& entry : page.genomes) {
+        // The archive can change between pages; skip entries that shifted into view twice.
+        if (!metadataById_.emplace(entry.id, entry.metadata).second) {
+            continue;
+        }
         BrowserPanel::Item item;
         item.id = entry.id;
         item.label = formatListLabel(entry.id, entry.metadata);
         items.push_back(std::move(item));
     }
-
-    return Result<std::vector<BrowserPanel::Item>, std::string>::okay(std::move(items));
+    return items;
 }
 
 Result<BrowserPanel::DetailText, std::string> GenomeBrowserPanel::fetchDetail(
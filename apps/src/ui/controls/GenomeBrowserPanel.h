@@ -4,8 +4,10 @@
 #include "core/ScenarioId.h"
 #include "core/organisms/evolution/GenomeMetadata.h"
 #include "core/organisms/evolution/GenomeSort.h"
+#include "server/api/GenomeList.h"
 #include "ui/state-machine/EventSink.h"
 #include <array>
+#include <cstdint>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -31,6 +33,7 @@ public:
     Result<GenomeId, std::string> openDetailByIndex(size_t index);
     Result<GenomeId, std::string> openDetailById(const GenomeId& id);
     Result<std::monostate, std::string> loadDetailForId(const GenomeId& id);
+    void receiveListPage(const GenomeListPageReceivedEvent& evt);
 
 private:
     struct ScenarioButtonContext {
@@ -62,6 +65,12 @@ private:
     std::vector<SortRowWidgets> sortRows_;
     BrowserPanel browser_;
     std::unordered_map<GenomeId, GenomeMetadata> metadataById_;
+    // Paging position in the server's sorted list since the last refresh.
+    uint32_t listNextOffset_ = 0;
+    uint32_t listTotalCount_ = 0;
+    // Pages arrive as events; only the one answering pendingPageRequestId_ is still wanted.
+    uint64_t lastPageRequestId_ = 0;
+    uint64_t pendingPageRequestId_ = 0;
     std::unordered_map<lv_obj_t*, Scenario::EnumType> scenarioButtons_;
     std::optional<GenomeId> scenarioPanelGenomeId_;
     std::optional<Scenario::EnumType> selectedScenarioId_;
@@ -69,6 +78,10 @@ private:
     lv_obj_t* scenarioDescriptionLabel_ = nullptr;
 
     Result<std::vector<BrowserPanel::Item>, std::string> fetchList();
+    Result<std::vector<BrowserPanel::Item>, std::string> fetchNextPage();
+    bool requestNextPage();
+    Api::GenomeList::Command nextPageCommand() const;
+    std::vector<BrowserPanel::Item> itemsFromPage(const Api::GenomeList::Okay& page);
     Result<BrowserPanel::DetailText, std::string> fetchDetail(const BrowserPanel::Item& item);
     Result<bool, std::string> deleteItem(const BrowserPanel::Item& item);
     Result<std::monostate, std::string> loadItem(const BrowserPanel::Item& item);
@@ -4,6 +4,7 @@
 #include "core/encoding/H264Encoder.h"
 #include "ui/DisplayCapture.h"
 
+#include <algorithm>
 #include <nlohmann/json.hpp>
 #include <rtc/rtc.hpp>
 #include <spdlog/spdlog.h>
@@ -11,7 +12,37 @@
 namespace DirtSim {
 namespace Ui {
 
+namespace {
+
+constexpr double kLatencySmoothing = 0.1;
+// Encode time, as a fraction of the frame interval, above which the rate is lowered and
+// below which it is raised back toward the target.
+constexpr double kEncodeBudgetHigh = 0.8;
+constexpr double kEncodeBudgetLow = 0.4;
+constexpr auto kRateChangeCooldown = std::chrono::seconds(1);
+
+int frameIntervalMs(float frameRate)
+{
+    return static_cast<int>(1000.0f / frameRate);
+}
+
+void smooth(double& average, double sample)
+{
+    average = average == 0.0 ? sample : average + kLatencySmoothing * (sample - average);
+}
+
+double elapsedMs(
+    std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
 WebRtcStreamer::WebRtcStreamer()
+    : captureIntervalMs_(frameIntervalMs(kTargetFps)),
+      bitrate_(kTargetBitrate),
+      frameRate_(kTargetFps)
 {
     // Enable libdatachannel logging at Warning level (errors/warnings only).
     static bool loggerInitialized = false;
@@ -21,11 +52,23 @@ WebRtcStreamer::WebRtcStreamer()
     }
 
     streamStartTime_ = std::chrono::steady_clock::now();
+    stats_.bitrate = bitrate_;
+    stats_.frameRate = frameRate_;
+    encodeThread_ = std::thread([this]() { encodeLoop(); });
     LOG_INFO(Network, "Created");
 }
 
 WebRtcStreamer::~WebRtcStreamer()
 {
+    {
+        std::lock_guard<std::mutex> lock(mailboxMutex_);
+        stopEncoder_ = true;
+    }
+    mailboxCv_.notify_one();
+    if (encodeThread_.joinable()) {
+        encodeThread_.join();
+    }
+
     std::lock_guard<std::mutex> lock(clientsMutex_);
     clients_.clear();
     LOG_INFO(Network, "Destroyed");
@@ -127,6 +170,7 @@ std::string WebRtcStreamer::initiateStream(
         if (it != clients_.end()) {
             it->second.ready = true;
             it->second.startTime = std::chrono::steady_clock::now();
+            forceNextFrame_ = true;
             LOG_INFO(Network, "Video track open for client {}", clientId);
         }
     });
@@ -144,6 +188,7 @@ std::string WebRtcStreamer::initiateStream(
     conn.ready = false;
 
     clients_[clientId] = std::move(conn);
+    forceNextFrame_ = true;
 
     // Set local description to generate offer and trigger ICE gathering.
     try {
@@ -253,61 +298,137 @@ void WebRtcStreamer::sendFrame()
         return;
     }
 
-    std::lock_guard<std::mutex> lock(clientsMutex_);
-
-    // If no clients at all, skip.
-    if (clients_.empty()) {
-        return;
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex_);
+        if (clients_.empty()) {
+            return;
+        }
     }
 
-    // Frame rate limiting - only send at target FPS (30fps = ~33ms interval).
-    static auto lastFrameTime = std::chrono::steady_clock::now();
-    auto currentTime = std::chrono::steady_clock::now();
-    auto timeSinceLastFrame =
-        std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastFrameTime);
-    constexpr auto frameInterval = std::chrono::milliseconds(33); // ~30fps.
-
-    if (timeSinceLastFrame < frameInterval) {
-        return; // Too soon, skip this frame.
+    // Frame rate limiting - capture at the encoder's current frame rate.
+    const auto currentTime = std::chrono::steady_clock::now();
+    if (currentTime - lastCaptureTime_ < std::chrono::milliseconds(captureIntervalMs_.load())) {
+        return;
     }
-    lastFrameTime = currentTime;
+    lastCaptureTime_ = currentTime;
 
-    // NOTE: We'll try to send frames even if not "ready" to trigger track opening.
+    // NOTE: Frames are sent even before a client is "ready" to trigger track opening.
     // Some WebRTC implementations need to see media flowing before onOpen fires.
 
-    // Capture display pixels.
     auto screenshotData = captureDisplayPixels(display_, 1.0);
     if (!screenshotData) {
         return;
     }
 
-    // Initialize encoder if needed.
-    uint32_t evenWidth = screenshotData->width & ~1u;
-    uint32_t evenHeight = screenshotData->height & ~1u;
+    CapturedFrame frame{
+        .pixels = std::move(screenshotData->pixels),
+        .width = screenshotData->width,
+        .height = screenshotData->height,
+        .capturedAt = std::chrono::steady_clock::now(),
+    };
+    const double captureMs = elapsedMs(currentTime, frame.capturedAt);
+
+    bool replaced = false;
+    {
+        std::lock_guard<std::mutex> lock(mailboxMutex_);
+        replaced = mailbox_.has_value();
+        mailbox_ = std::move(frame);
+    }
+    mailboxCv_.notify_one();
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    smooth(stats_.captureMs, captureMs);
+    stats_.framesCaptured++;
+    if (replaced) {
+        stats_.framesReplaced++;
+    }
+}
+
+WebRtcStreamer::Stats WebRtcStreamer::getStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return stats_;
+}
+
+void WebRtcStreamer::encodeLoop()
+{
+    while (true) {
+        CapturedFrame frame;
+        {
+            std::unique_lock<std::mutex> lock(mailboxMutex_);
+            mailboxCv_.wait(lock, [this]() { return stopEncoder_ || mailbox_.has_value(); });
+            if (stopEncoder_) {
+                return;
+            }
+            frame = std::move(mailbox_.value());
+            mailbox_.reset();
+        }
 
+        encodeFrame(frame);
+    }
+}
+
+void WebRtcStreamer::encodeFrame(CapturedFrame& frame)
+{
+    const auto encodeStart = std::chrono::steady_clock::now();
+    const double queueMs = elapsedMs(frame.capturedAt, encodeStart);
+
+    // A static display costs nothing to stream; the decoder keeps showing the last frame.
+    const bool forced = forceNextFrame_.exchange(false);
+    if (!forced && !lastEncodedPixels_.empty() && frame.pixels == lastEncodedPixels_) {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        smooth(stats_.queueMs, queueMs);
+        stats_.framesSkippedIdentical++;
+        return;
+    }
+
+    // Initialize encoder if needed.
+    const uint32_t evenWidth = frame.width & ~1u;
+    const uint32_t evenHeight = frame.height & ~1u;
     if (!encoder_ || encoder_->getWidth() != evenWidth || encoder_->getHeight() != evenHeight) {
         encoder_ = std::make_unique<H264Encoder>();
-        // Use 5Mbps bitrate for rapidly-changing fractal content.
-        // 500kbps was causing massive oversized frames that overflow send buffers.
-        if (!encoder_->initialize(
-                screenshotData->width, screenshotData->height, 5000000, kTargetFps)) {
+        if (!encoder_->initialize(frame.width, frame.height, bitrate_, frameRate_)) {
             LOG_ERROR(Network, "Failed to initialize encoder");
+            encoder_.reset();
             return;
         }
     }
+    if (forced) {
+        encoder_->requestKeyframe();
+    }
 
-    // Encode frame.
-    auto encoded = encoder_->encode(
-        screenshotData->pixels.data(), screenshotData->width, screenshotData->height);
-    if (!encoded) {
-        return;
+    auto encoded = encoder_->encode(frame.pixels.data(), frame.width, frame.height);
+    const auto encodeEnd = std::chrono::steady_clock::now();
+    const double encodeMs = elapsedMs(encodeStart, encodeEnd);
+
+    if (encoded) {
+        sendEncodedFrame(encoded.value(), frame);
+        lastEncodedPixels_.swap(frame.pixels);
+    }
+    const double sendMs = elapsedMs(encodeEnd, std::chrono::steady_clock::now());
+
+    adaptRateControl(encodeMs);
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    smooth(stats_.queueMs, queueMs);
+    smooth(stats_.encodeMs, encodeMs);
+    if (encoded) {
+        smooth(stats_.sendMs, sendMs);
+        stats_.framesEncoded++;
     }
+    stats_.bitrate = bitrate_;
+    stats_.frameRate = frameRate_;
+}
 
-    // Calculate RTP timestamp.
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - streamStartTime_);
+void WebRtcStreamer::sendEncodedFrame(const EncodedFrame& encoded, const CapturedFrame& frame)
+{
+    // RTP timestamps follow capture time, so encoder jitter doesn't show up as playback jitter.
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(frame.capturedAt - streamStartTime_);
     auto rtpTimestamp = static_cast<uint32_t>((elapsed.count() * kClockRate) / 1'000'000);
 
+    std::lock_guard<std::mutex> lock(clientsMutex_);
+
     // Send to all clients (even if not "ready" - might help trigger track opening).
     for (auto& [id, client] : clients_) {
         if (!client.videoTrack) {
@@ -337,16 +458,16 @@ void WebRtcStreamer::sendFrame()
             auto elapsed_us = std::chrono::duration<double, std::micro>(elapsed);
 
             client.videoTrack->sendFrame(
-                reinterpret_cast<const std::byte*>(encoded->data.data()),
-                encoded->data.size(),
+                reinterpret_cast<const std::byte*>(encoded.data.data()),
+                encoded.data.size(),
                 rtc::FrameInfo(elapsed_us));
 
             spdlog::debug(
                 "WebRtcStreamer: Sent frame to {} ({} bytes, ts={}, keyframe={})",
                 id,
-                encoded->data.size(),
+                encoded.data.size(),
                 rtpTimestamp,
-                encoded->isKeyframe);
+                encoded.isKeyframe);
         }
         catch (const std::exception& e) {
             LOG_WARN(Network, "Failed to send frame to {}: {}", id, e.what());
@@ -356,6 +477,48 @@ void WebRtcStreamer::sendFrame()
     frameCount_++;
 }
 
+void WebRtcStreamer::adaptRateControl(double encodeMs)
+{
+    smooth(encodeMsAverage_, encodeMs);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!encoder_ || now - lastRateChange_ < kRateChangeCooldown) {
+        return;
+    }
+
+    const double budgetMs = 1000.0 / frameRate_;
+    float frameRate = frameRate_;
+    uint32_t bitrate = bitrate_;
+    if (encodeMsAverage_ > budgetMs * kEncodeBudgetHigh && frameRate_ > kMinFps) {
+        frameRate = std::max(kMinFps, frameRate_ * 0.75f);
+        bitrate = std::max(kMinBitrate, static_cast<uint32_t>(bitrate_ * 0.75));
+    }
+    else if (encodeMsAverage_ < budgetMs * kEncodeBudgetLow && frameRate_ < kTargetFps) {
+        frameRate = std::min(kTargetFps, frameRate_ * 1.25f);
+        bitrate = std::min(kTargetBitrate, static_cast<uint32_t>(bitrate_ * 1.25));
+    }
+    else {
+        return;
+    }
+
+    if (!encoder_->setRateControl(bitrate, frameRate)) {
+        return;
+    }
+
+    LOG_INFO(
+        Network,
+        "Encode averaging {:.1f}ms; rate {}fps/{}kbps -> {}fps/{}kbps",
+        encodeMsAverage_,
+        frameRate_,
+        bitrate_ / 1000,
+        frameRate,
+        bitrate / 1000);
+    frameRate_ = frameRate;
+    bitrate_ = bitrate;
+    lastRateChange_ = now;
+    captureIntervalMs_ = frameIntervalMs(frameRate_);
+}
+
 bool WebRtcStreamer::hasClients() const
 {
     std::lock_guard<std::mutex> lock(clientsMutex_);
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 // Forward declarations for libdatachannel types.
 namespace rtc {
@@ -20,6 +26,7 @@ class RtcpSrReporter;
 namespace DirtSim {
 
 class H264Encoder;
+struct EncodedFrame;
 
 namespace Ui {
 
@@ -35,12 +42,34 @@ namespace Ui {
  * 3. ICE candidates are sent to browser as they're gathered (via provided callback)
  * 4. Browser sends SDP answer via WebRtcAnswer command
  * 5. Connection established, frames flow via RTP
+ *
+ * Frame pipeline: sendFrame() captures on the UI thread (LVGL is not thread-safe) and
+ * hands the pixels to an encode thread through a single-slot mailbox. If the encoder
+ * falls behind, the pending frame is replaced by the newer one rather than queued.
+ * Frames identical to the last encoded one are skipped, and the encoder's frame rate
+ * and bitrate follow the measured encode time.
  */
 class WebRtcStreamer {
 public:
     // Callback to send ICE candidates to the client.
     using IceCandidateCallback = std::function<void(const std::string& candidateJson)>;
 
+    struct Stats {
+        // Moving averages, in milliseconds.
+        double captureMs = 0.0; // Display readback on the UI thread.
+        double queueMs = 0.0;   // Capture to encode start.
+        double encodeMs = 0.0;
+        double sendMs = 0.0; // Handing the encoded frame to every client track.
+
+        uint64_t framesCaptured = 0;
+        uint64_t framesEncoded = 0;
+        uint64_t framesSkippedIdentical = 0;
+        uint64_t framesReplaced = 0; // Overwritten in the mailbox before being encoded.
+
+        uint32_t bitrate = 0;
+        float frameRate = 0.0f;
+    };
+
     WebRtcStreamer();
     ~WebRtcStreamer();
 
@@ -94,12 +123,18 @@ public:
     void closeAllClients();
 
     /**
-     * @brief Capture and send a frame to all connected clients.
+     * @brief Capture a frame and queue it for encoding and sending.
      *
-     * Should be called regularly (e.g., 30fps) from the main loop.
+     * Should be called regularly from the main loop; captures are rate limited to the
+     * encoder's current frame rate.
      */
     void sendFrame();
 
+    /**
+     * @brief Pipeline latencies, frame counters and current rate control.
+     */
+    Stats getStats() const;
+
     /**
      * @brief Check if any clients are connected.
      */
@@ -121,21 +156,62 @@ private:
         std::chrono::steady_clock::time_point startTime;
     };
 
+    struct CapturedFrame {
+        std::vector<uint8_t> pixels; // ARGB8888.
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::chrono::steady_clock::time_point capturedAt;
+    };
+
+    void encodeLoop();
+    void encodeFrame(CapturedFrame& frame);
+    void sendEncodedFrame(const EncodedFrame& encoded, const CapturedFrame& frame);
+    void adaptRateControl(double encodeMs);
+
     lv_display_t* display_ = nullptr;
-    std::unique_ptr<H264Encoder> encoder_;
 
     mutable std::mutex clientsMutex_;
     std::unordered_map<std::string, ClientConnection> clients_;
 
+    // Capture side (UI thread).
+    std::chrono::steady_clock::time_point lastCaptureTime_;
+    std::atomic<int> captureIntervalMs_;
+
+    // Single-slot mailbox between capture and encode.
+    std::mutex mailboxMutex_;
+    std::condition_variable mailboxCv_;
+    std::optional<CapturedFrame> mailbox_;
+    bool stopEncoder_ = false;
+
+    // Encode thread state; only touched by encodeThread_.
+    std::unique_ptr<H264Encoder> encoder_;
+    std::vector<uint8_t> lastEncodedPixels_;
+    uint32_t bitrate_;
+    float frameRate_;
+    double encodeMsAverage_ = 0.0;
+    std::chrono::steady_clock::time_point lastRateChange_;
+
+    // Set when a client joins so it gets a keyframe even if the display is static.
+    std::atomic<bool> forceNextFrame_{ true };
+
+    mutable std::mutex statsMutex_;
+    Stats stats_;
+
     // RTP timing.
     std::chrono::steady_clock::time_point streamStartTime_;
     uint32_t frameCount_ = 0;
 
+    std::thread encodeThread_;
+
     // Video parameters.
     static constexpr uint32_t kVideoSsrc = 42;
     static constexpr uint8_t kPayloadType = 96;   // Dynamic payload type for H.264.
     static constexpr uint32_t kClockRate = 90000; // Standard for video.
     static constexpr float kTargetFps = 30.0f;
+    static constexpr float kMinFps = 10.0f;
+    // 5Mbps for rapidly-changing fractal content; 500kbps overflowed send buffers.
+    static constexpr uint32_t kTargetBitrate = 5000000;
+    static constexpr uint32_t kMinBitrate = 1500000;
 };
 
 } // namespace Ui
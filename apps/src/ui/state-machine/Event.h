@@ -56,6 +56,7 @@
 #include "core/organisms/evolution/TrainingSpec.h"
 #include "server/UserSettings.h"
 #include "server/api/EvolutionProgress.h"
+#include "server/api/GenomeList.h"
 #include "server/api/PlanPlaybackStopped.h"
 #include "server/api/PlanSaved.h"
 #include "server/api/SearchCompleted.h"
@@ -301,6 +302,15 @@ struct TrainingBestPlaybackFrameReceivedEvent {
     static constexpr const char* name() { return "TrainingBestPlaybackFrameReceivedEvent"; }
 };
 
+/**
+ * @brief A genome browser list page, fetched off the UI thread so scrolling never waits on it.
+ */
+struct GenomeListPageReceivedEvent {
+    uint64_t requestId = 0;
+    Result<Api::GenomeList::Okay, std::string> page;
+    static constexpr const char* name() { return "GenomeListPageReceivedEvent"; }
+};
+
 struct UserSettingsUpdatedEvent {
     DirtSim::UserSettings settings;
     static constexpr const char* name() { return "UserSettingsUpdatedEvent"; }
@@ -372,6 +382,7 @@ using Event = std::variant<
     TrainingBestPlaybackFrameReceivedEvent,
     TrainingBestSnapshotReceivedEvent,
     PhysicsSettingsReceivedEvent,
+    GenomeListPageReceivedEvent,
 
     // UI control events
     IconSelectedEvent,
@@ -435,5 +446,23 @@ inline std::string getEventName(const Event& event)
     return std::visit([](auto&& e) { return std::string(e.name()); }, event);
 }
 
+/**
+ * @brief Coalesce key for snapshot events, where only the newest pending one matters.
+ *
+ * Render frames and progress updates carry complete state, so a newer one replaces an
+ * unprocessed older one of the same type. Commands and input return nullopt and keep
+ * strict ordering.
+ */
+inline std::optional<size_t> getEventCoalesceKey(const Event& event)
+{
+    if (std::holds_alternative<DirtSim::UiUpdateEvent>(event)
+        || std::holds_alternative<EvolutionProgressReceivedEvent>(event)
+        || std::holds_alternative<SearchProgressReceivedEvent>(event)
+        || std::holds_alternative<TrainingBestPlaybackFrameReceivedEvent>(event)) {
+        return event.index();
+    }
+    return std::nullopt;
+}
+
 } // namespace Ui
 } // namespace DirtSim
@@ -1,15 +1,16 @@
 #include "EventProcessor.h"
 #include "StateMachine.h"
 #include "core/LoggingChannels.h"
-#include "core/SynchronizedQueue.h"
+#include "core/CoalescingQueue.h"
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace DirtSim {
 namespace Ui {
 
 struct EventQueue {
-    SynchronizedQueue<Event> queue;
+    CoalescingQueue<Event> queue{ getEventCoalesceKey };
 };
 
 EventProcessor::EventProcessor() : eventQueue(std::make_shared<EventQueue>())
@@ -32,10 +33,10 @@ void EventProcessor::processEventsFromQueue(StateMachine& sm)
     }
 }
 
-void EventProcessor::enqueueEvent(const Event& event)
+void EventProcessor::enqueueEvent(Event&& event)
 {
     LOG_DEBUG(State, "Enqueuing event: {}", getEventName(event));
-    eventQueue->queue.push(event);
+    eventQueue->queue.push(std::move(event));
 }
 
 bool EventProcessor::hasEvents() const
@@ -58,6 +59,16 @@ size_t EventProcessor::queueSize() const
     return eventQueue->queue.size();
 }
 
+size_t EventProcessor::queueHighWaterMark() const
+{
+    return eventQueue->queue.stats().highWaterMark;
+}
+
+uint64_t EventProcessor::coalescedEventCount() const
+{
+    return eventQueue->queue.stats().coalesced;
+}
+
 void EventProcessor::clearQueue()
 {
     eventQueue->queue.clear();
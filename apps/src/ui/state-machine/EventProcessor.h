@@ -2,6 +2,7 @@
 
 #include "Event.h"
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace DirtSim {
@@ -16,11 +17,13 @@ public:
 
     void processEvent(StateMachine& sm, const Event& event);
     void processEventsFromQueue(StateMachine& sm);
-    void enqueueEvent(const Event& event);
+    void enqueueEvent(Event&& event);
 
     bool hasEvents() const;
     bool waitForEvents(std::chrono::milliseconds timeout);
     size_t queueSize() const;
+    size_t queueHighWaterMark() const;
+    uint64_t coalescedEventCount() const;
     void clearQueue();
     void requestYield();
 
@@ -20,6 +20,12 @@ public:
      * @param event Event to queue.
      */
     virtual void queueEvent(const Event& event) = 0;
+
+    /**
+     * @brief Queue an event without copying it.
+     * @param event Event to queue.
+     */
+    virtual void queueEvent(Event&& event) = 0;
 };
 
 } // namespace Ui
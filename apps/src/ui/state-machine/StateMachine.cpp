@@ -147,11 +147,11 @@ void StateMachine::setupWebSocketService()
         [this](const std::string& messageType, const std::vector<std::byte>& payload) {
             if (auto event = MessageParser::parseServerCommand(messageType, payload);
                 event.has_value()) {
-                queueEvent(event.value());
+                queueEvent(std::move(event.value()));
             }
         });
 
-    ws.onBinary([this](const std::vector<std::byte>& bytes) {
+    ws.onBinary([this](std::span<const std::byte> bytes) {
         LOG_DEBUG(Network, "Received binary message ({} bytes)", bytes.size());
 
         try {
@@ -164,40 +164,44 @@ void StateMachine::setupWebSocketService()
 
     // Register handlers for UI commands that come from CLI (port 7070).
     // All UI commands are queued to the state machine for processing.
-    ws.registerHandler<UiApi::SimRun::Cwc>([this](UiApi::SimRun::Cwc cwc) { queueEvent(cwc); });
-    ws.registerHandler<UiApi::SimPause::Cwc>([this](UiApi::SimPause::Cwc cwc) { queueEvent(cwc); });
-    ws.registerHandler<UiApi::SimStop::Cwc>([this](UiApi::SimStop::Cwc cwc) { queueEvent(cwc); });
+    ws.registerHandler<UiApi::SimRun::Cwc>(
+        [this](UiApi::SimRun::Cwc cwc) { queueEvent(std::move(cwc)); });
+    ws.registerHandler<UiApi::SimPause::Cwc>(
+        [this](UiApi::SimPause::Cwc cwc) { queueEvent(std::move(cwc)); });
+    ws.registerHandler<UiApi::SimStop::Cwc>(
+        [this](UiApi::SimStop::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingQuit::Cwc>(
-        [this](UiApi::TrainingQuit::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingQuit::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingResultDiscard::Cwc>(
-        [this](UiApi::TrainingResultDiscard::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingResultDiscard::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingResultSave::Cwc>(
-        [this](UiApi::TrainingResultSave::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingResultSave::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingStart::Cwc>(
-        [this](UiApi::TrainingStart::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingStart::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingActiveScenarioControlsShow::Cwc>(
-        [this](UiApi::TrainingActiveScenarioControlsShow::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingActiveScenarioControlsShow::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::TrainingConfigShowEvolution::Cwc>(
-        [this](UiApi::TrainingConfigShowEvolution::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::TrainingConfigShowEvolution::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::GenomeBrowserOpen::Cwc>(
-        [this](UiApi::GenomeBrowserOpen::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::GenomeBrowserOpen::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::GenomeDetailLoad::Cwc>(
-        [this](UiApi::GenomeDetailLoad::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::GenomeDetailLoad::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::GenomeDetailOpen::Cwc>(
-        [this](UiApi::GenomeDetailOpen::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::GenomeDetailOpen::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::IconRailExpand::Cwc>(
-        [this](UiApi::IconRailExpand::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::IconRailExpand::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::IconRailShowIcons::Cwc>(
-        [this](UiApi::IconRailShowIcons::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::IconRailShowIcons::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::IconSelect::Cwc>(
-        [this](UiApi::IconSelect::Cwc cwc) { queueEvent(cwc); });
-    ws.registerHandler<UiApi::StateGet::Cwc>([this](UiApi::StateGet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::IconSelect::Cwc cwc) { queueEvent(std::move(cwc)); });
+    ws.registerHandler<UiApi::StateGet::Cwc>(
+        [this](UiApi::StateGet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::StatusGet::Cwc>(
-        [this](UiApi::StatusGet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::StatusGet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::StopButtonPress::Cwc>(
-        [this](UiApi::StopButtonPress::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::StopButtonPress::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::SynthKeyEvent::Cwc>(
-        [this](UiApi::SynthKeyEvent::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::SynthKeyEvent::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::WebSocketAccessSet::Cwc>([this](UiApi::WebSocketAccessSet::Cwc cwc) {
         using Response = UiApi::WebSocketAccessSet::Response;
         auto& wsService = getWebSocketService();
@@ -236,61 +240,63 @@ void StateMachine::setupWebSocketService()
         }
     });
     ws.registerHandler<UiApi::ScreenGrab::Cwc>(
-        [this](UiApi::ScreenGrab::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::ScreenGrab::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::StreamStart::Cwc>(
-        [this](UiApi::StreamStart::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::StreamStart::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::WebRtcAnswer::Cwc>(
-        [this](UiApi::WebRtcAnswer::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::WebRtcAnswer::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::WebRtcCandidate::Cwc>(
-        [this](UiApi::WebRtcCandidate::Cwc cwc) { queueEvent(cwc); });
-    ws.registerHandler<UiApi::Exit::Cwc>([this](UiApi::Exit::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::WebRtcCandidate::Cwc cwc) { queueEvent(std::move(cwc)); });
+    ws.registerHandler<UiApi::Exit::Cwc>(
+        [this](UiApi::Exit::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::MouseDown::Cwc>(
-        [this](UiApi::MouseDown::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::MouseDown::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::MouseMove::Cwc>(
-        [this](UiApi::MouseMove::Cwc cwc) { queueEvent(cwc); });
-    ws.registerHandler<UiApi::MouseUp::Cwc>([this](UiApi::MouseUp::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::MouseMove::Cwc cwc) { queueEvent(std::move(cwc)); });
+    ws.registerHandler<UiApi::MouseUp::Cwc>(
+        [this](UiApi::MouseUp::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkConnectCancelPress::Cwc>(
-        [this](UiApi::NetworkConnectCancelPress::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkConnectCancelPress::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkConnectPress::Cwc>(
-        [this](UiApi::NetworkConnectPress::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkConnectPress::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkDiagnosticsGet::Cwc>(
-        [this](UiApi::NetworkDiagnosticsGet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkDiagnosticsGet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkPasswordSubmit::Cwc>(
-        [this](UiApi::NetworkPasswordSubmit::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkPasswordSubmit::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkScannerEnterPress::Cwc>(
-        [this](UiApi::NetworkScannerEnterPress::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkScannerEnterPress::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::NetworkScannerExitPress::Cwc>(
-        [this](UiApi::NetworkScannerExitPress::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::NetworkScannerExitPress::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanBrowserOpen::Cwc>(
-        [this](UiApi::PlanBrowserOpen::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanBrowserOpen::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanDetailOpen::Cwc>(
-        [this](UiApi::PlanDetailOpen::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanDetailOpen::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanDetailSelect::Cwc>(
-        [this](UiApi::PlanDetailSelect::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanDetailSelect::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlantSeed::Cwc>(
-        [this](UiApi::PlantSeed::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlantSeed::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanPlaybackPauseSet::Cwc>(
-        [this](UiApi::PlanPlaybackPauseSet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanPlaybackPauseSet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanPlaybackStart::Cwc>(
-        [this](UiApi::PlanPlaybackStart::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanPlaybackStart::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::PlanPlaybackStop::Cwc>(
-        [this](UiApi::PlanPlaybackStop::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::PlanPlaybackStop::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::DebugVisualizationSelect::Cwc>(
-        [this](UiApi::DebugVisualizationSelect::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::DebugVisualizationSelect::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::DrawDebugToggle::Cwc>(
-        [this](UiApi::DrawDebugToggle::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::DrawDebugToggle::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::RenderModeSelect::Cwc>(
-        [this](UiApi::RenderModeSelect::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::RenderModeSelect::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::SearchPauseSet::Cwc>(
-        [this](UiApi::SearchPauseSet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::SearchPauseSet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::SearchSettingsSet::Cwc>(
-        [this](UiApi::SearchSettingsSet::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::SearchSettingsSet::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::SearchStart::Cwc>(
-        [this](UiApi::SearchStart::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::SearchStart::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<UiApi::SearchStop::Cwc>(
-        [this](UiApi::SearchStop::Cwc cwc) { queueEvent(cwc); });
+        [this](UiApi::SearchStop::Cwc cwc) { queueEvent(std::move(cwc)); });
     ws.registerHandler<Api::TrainingResult::Cwc>(
-        [this](Api::TrainingResult::Cwc cwc) { queueEvent(cwc); });
+        [this](Api::TrainingResult::Cwc cwc) { queueEvent(std::move(cwc)); });
 
     // =========================================================================
     // JSON protocol support - for CLI and browser clients.
@@ -468,7 +474,12 @@ const ScenarioMetadataManager& StateMachine::scenarioMetadataManager() const
 
 void StateMachine::queueEvent(const Event& event)
 {
-    eventProcessor.enqueueEvent(event);
+    eventProcessor.enqueueEvent(Event{ event });
+}
+
+void StateMachine::queueEvent(Event&& event)
+{
+    eventProcessor.enqueueEvent(std::move(event));
 }
 
 void StateMachine::processEvents()
@@ -731,6 +742,23 @@ void StateMachine::handleEvent(const Event& event)
             },
             fsmState.getVariant());
 
+        UiApi::StatusGet::StreamStatus stream;
+        if (webRtcStreamer_) {
+            const auto streamStats = webRtcStreamer_->getStats();
+            stream = UiApi::StatusGet::StreamStatus{
+                .clients = static_cast<uint32_t>(webRtcStreamer_->clientCount()),
+                .capture_ms = streamStats.captureMs,
+                .queue_ms = streamStats.queueMs,
+                .encode_ms = streamStats.encodeMs,
+                .send_ms = streamStats.sendMs,
+                .frames_encoded = streamStats.framesEncoded,
+                .frames_skipped_identical = streamStats.framesSkippedIdentical,
+                .frames_replaced = streamStats.framesReplaced,
+                .bitrate_kbps = streamStats.bitrate / 1000,
+                .frame_rate = streamStats.frameRate,
+            };
+        }
+
         UiApi::StatusGet::Okay status{
             .state = getCurrentStateName(),
             .connected_to_server = wsService_ && wsService_->isConnected(),
@@ -745,6 +773,10 @@ void StateMachine::handleEvent(const Event& event)
             .selected_icon = selectedIcon,
             .panel_visible = panelVisible,
             .state_details = stateDetails,
+            .stream = stream,
+            .event_queue_depth = eventProcessor.queueSize(),
+            .event_queue_high_water = eventProcessor.queueHighWaterMark(),
+            .events_coalesced = eventProcessor.coalescedEventCount(),
         };
 
         LOG_DEBUG(State, "Sending StatusGet response (state={})", status.state);
@@ -1243,6 +1275,9 @@ void StateMachine::handleEvent(const Event& event)
                                 std::decay_t<decltype(evt)>,
                                 PlanPlaybackStoppedReceivedEvent>
                             || std::is_same_v<std::decay_t<decltype(evt)>, PlanSavedReceivedEvent>
+                            || std::is_same_v<
+                                std::decay_t<decltype(evt)>,
+                                GenomeListPageReceivedEvent>
                             || std::
                                 is_same_v<std::decay_t<decltype(evt)>, SearchCompletedReceivedEvent>
                             || std::is_same_v<
@@ -71,6 +71,7 @@ public:
     void mainLoopRun();
 
     void queueEvent(const Event& event) override;
+    void queueEvent(Event&& event) override;
 
     void handleEvent(const Event& event);
 
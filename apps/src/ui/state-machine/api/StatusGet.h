@@ -37,6 +37,22 @@ struct SynthStateDetails {
 
 using StateDetails = std::variant<NoStateDetails, SynthStateDetails>;
 
+// WebRTC stream pipeline; latencies are moving averages in milliseconds.
+struct StreamStatus {
+    uint32_t clients = 0;
+    double capture_ms = 0.0;
+    double queue_ms = 0.0;
+    double encode_ms = 0.0;
+    double send_ms = 0.0;
+    uint64_t frames_encoded = 0;
+    uint64_t frames_skipped_identical = 0;
+    uint64_t frames_replaced = 0;
+    uint32_t bitrate_kbps = 0;
+    double frame_rate = 0.0;
+
+    using serialize = zpp::bits::members<10>;
+};
+
 struct Okay {
     std::string state; // UI state machine current state.
     bool connected_to_server = false;
@@ -51,6 +67,12 @@ struct Okay {
     Ui::IconId selected_icon = Ui::IconId::NONE;
     bool panel_visible = false;
     StateDetails state_details = NoStateDetails{};
+    StreamStatus stream;
+
+    // Event queue: pending depth, deepest seen, and snapshot events replaced by newer ones.
+    uint64_t event_queue_depth = 0;
+    uint64_t event_queue_high_water = 0;
+    uint64_t events_coalesced = 0;
 
     API_COMMAND_NAME();
     nlohmann::json toJson() const;
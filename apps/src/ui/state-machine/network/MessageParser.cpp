@@ -135,7 +135,7 @@ std::optional<Event> MessageParser::parseServerCommand(
     return std::nullopt;
 }
 
-UiUpdateEvent MessageParser::parseRenderMessage(const std::vector<std::byte>& bytes)
+UiUpdateEvent MessageParser::parseRenderMessage(std::span<const std::byte> bytes)
 {
     RenderMessageFull fullMsg;
     zpp::bits::in in(bytes);
@@ -4,6 +4,7 @@
 #include "ui/state-machine/Event.h"
 #include <nlohmann/json.hpp>
 #include <optional>
+#include <span>
 #include <string>
 
 namespace DirtSim {
@@ -34,7 +35,7 @@ public:
     /**
      * @brief Parse a binary RenderMessage push into a UiUpdateEvent.
      */
-    static UiUpdateEvent parseRenderMessage(const std::vector<std::byte>& bytes);
+    static UiUpdateEvent parseRenderMessage(std::span<const std::byte> bytes);
 
 private:
     /**
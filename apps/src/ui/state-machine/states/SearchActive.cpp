@@ -57,6 +57,8 @@ const char* searchProgressEventText(Api::SearchProgressEvent event)
             return "Pruned transposition";
         case Api::SearchProgressEvent::PrunedNonGameplay:
             return "Pruned mode";
+        case Api::SearchProgressEvent::PrunedBeamWidth:
+            return "Pruned beam";
         case Api::SearchProgressEvent::CompletedBudgetExceeded:
             return "Budget hit";
         case Api::SearchProgressEvent::CompletedExhausted:
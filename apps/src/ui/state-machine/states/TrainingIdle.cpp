@@ -451,6 +451,14 @@ State::Any TrainingIdle::onEvent(const GenomeAddToTrainingClickedEvent& evt, Sta
     return std::move(*this);
 }
 
+State::Any TrainingIdle::onEvent(const GenomeListPageReceivedEvent& evt, StateMachine& /*sm*/)
+{
+    DIRTSIM_ASSERT(view_, "TrainingIdleView must exist");
+
+    view_->receiveGenomeListPage(evt);
+    return std::move(*this);
+}
+
 State::Any TrainingIdle::onEvent(const ViewBestButtonClickedEvent& evt, StateMachine& sm)
 {
     LOG_INFO(State, "View Best clicked, genome_id={}", evt.genomeId.toShortString());
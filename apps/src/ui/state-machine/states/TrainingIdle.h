@@ -40,6 +40,7 @@ struct TrainingIdle {
     Any onEvent(const TrainingStreamConfigChangedEvent& evt, StateMachine& sm);
     Any onEvent(const GenomeLoadClickedEvent& evt, StateMachine& sm);
     Any onEvent(const GenomeAddToTrainingClickedEvent& evt, StateMachine& sm);
+    Any onEvent(const GenomeListPageReceivedEvent& evt, StateMachine& sm);
     Any onEvent(const ViewBestButtonClickedEvent& evt, StateMachine& sm);
 
     bool isTrainingResultModalVisible() const;
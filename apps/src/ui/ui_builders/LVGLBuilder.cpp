@@ -1991,6 +1991,7 @@ Result<lv_obj_t*, std::string> LVGLBuilder::ActionButtonBuilder::createActionBut
         .glow_color = glow_color_,
         .button = button_,
         .icon_label = icon_label_,
+        .text_label = label_,
         .label = text_.empty() ? (icon_.empty() ? "ActionButton" : icon_) : text_,
         .user_callback = nullptr, // Not used - we register user callback separately.
         .user_data = nullptr
@@ -2122,6 +2123,17 @@ void LVGLBuilder::ActionButtonBuilder::setIcon(lv_obj_t* container, const char*
     lv_label_set_text(state->icon_label, symbol);
 }
 
+void LVGLBuilder::ActionButtonBuilder::setText(lv_obj_t* container, const char* text)
+{
+    if (!container || !text) return;
+
+    ActionButtonState* state = static_cast<ActionButtonState*>(lv_obj_get_user_data(container));
+    if (!state || !state->text_label) return;
+
+    lv_label_set_text(state->text_label, text);
+    state->label = text;
+}
+
 // ============================================================================
 // ActionDropdownBuilder Implementation
 // ============================================================================
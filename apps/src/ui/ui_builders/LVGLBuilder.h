@@ -487,6 +487,7 @@ public:
         static void setChecked(lv_obj_t* container, bool checked);
         static bool isChecked(lv_obj_t* container);
         static void setIcon(lv_obj_t* container, const char* symbol);
+        static void setText(lv_obj_t* container, const char* text);
 
     private:
         lv_obj_t* parent_;
@@ -527,6 +528,7 @@ public:
             uint32_t glow_color;
             lv_obj_t* button; // Inner button for styling.
             lv_obj_t* icon_label;
+            lv_obj_t* text_label;
             std::string label;
             lv_event_cb_t user_callback;
             void* user_data;